@@ -0,0 +1,123 @@
+/*  vkad call benchmark: compares the cost of a call through a loaded table, through the vk* convenience macros, through the macros with thread-local dispatch and
+    directly to a statically linked driver.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+
+    Usage: calls [calls per run]
+    Linked to the static mock driver, whose vkCmdDraw only counts the vertices, so the numbers are mostly the cost of the call itself. Needs a POSIX system for clock_gettime.
+*/
+#define _POSIX_C_SOURCE 200809L
+#define VKAD_USER_GLOBAL   globalFunctions
+#define VKAD_USER_INSTANCE instanceFunctions
+#define VKAD_USER_DEVICE   deviceFunctions
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "vkad.h"
+
+#define RUNS 9
+#define METHOD_COUNT 4
+
+VkadGlobalFunctions   globalFunctions;
+VkadInstanceFunctions instanceFunctions;
+VkadDeviceFunctions   deviceFunctions;
+
+/* in calls_direct.c, which is compiled with static dispatch */
+PFN_vkGetInstanceProcAddr linkedGetInstanceProcAddr(void);
+void drawDirect(VkCommandBuffer commandBuffer, uint32_t count);
+/* in calls_tls.c, which is compiled with thread-local dispatch */
+void drawThroughThreadLocal(const VkadDeviceFunctions* functions, VkCommandBuffer commandBuffer, uint32_t count);
+/* in the static mock driver */
+uint64_t mockDrawnVertexCount(void);
+
+static double now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec * 1e9 + (double) time.tv_nsec;
+}
+
+/* the table is passed like in an application that keeps it in its own context */
+static void drawThroughTable(const VkadDeviceFunctions* functions, VkCommandBuffer commandBuffer, uint32_t count) {
+    uint32_t i;
+    for (i = 0; i < count; ++i) functions->CmdDraw(commandBuffer, 3, 1, 0, 0);
+}
+static void drawThroughMacros(VkCommandBuffer commandBuffer, uint32_t count) {
+    uint32_t i;
+    for (i = 0; i < count; ++i) vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+}
+
+int main(int argc, char** argv) {
+    static const char* const names[METHOD_COUNT] = { "table", "macros", "tls", "direct" };
+    double best[METHOD_COUNT];
+    VkApplicationInfo applicationInfo;
+    VkInstanceCreateInfo instanceCreateInfo;
+    VkDeviceQueueCreateInfo queueCreateInfo;
+    VkDeviceCreateInfo deviceCreateInfo;
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo;
+    VkInstance instance;
+    VkPhysicalDevice physicalDevice;
+    VkDevice device;
+    VkCommandBuffer commandBuffer;
+    PFN_vkGetInstanceProcAddr loader = linkedGetInstanceProcAddr();
+    uint32_t physicalDeviceCount = 1;
+    float priority = 1.0f;
+    long count = argc > 1 ? atol(argv[1]) : 10000000;
+    int method, run;
+    if (count < 1 || count > 0x7FFFFFFF) {
+        fprintf(stderr, "usage: %s [calls per run]\n", argv[0]);
+        return 2;
+    }
+
+    vkadLoadGlobalFunctions(loader, &globalFunctions);
+    memset(&applicationInfo, 0, sizeof(applicationInfo));
+    applicationInfo.sType      = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_1;
+    memset(&instanceCreateInfo, 0, sizeof(instanceCreateInfo));
+    instanceCreateInfo.sType            = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    if (vkCreateInstance(&instanceCreateInfo, NULL, &instance) != VK_SUCCESS) return 1;
+    vkadLoadInstanceFunctions(loader, instance, &instanceFunctions);
+    if (vkEnumeratePhysicalDevices(instance, &physicalDeviceCount, &physicalDevice) != VK_SUCCESS || physicalDeviceCount == 0) return 1;
+    memset(&queueCreateInfo, 0, sizeof(queueCreateInfo));
+    queueCreateInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueCount       = 1;
+    queueCreateInfo.pQueuePriorities = &priority;
+    memset(&deviceCreateInfo, 0, sizeof(deviceCreateInfo));
+    deviceCreateInfo.sType                = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos    = &queueCreateInfo;
+    if (vkCreateDevice(physicalDevice, &deviceCreateInfo, NULL, &device) != VK_SUCCESS) return 1;
+    vkadLoadDeviceFunctions(vkGetDeviceProcAddr, device, &deviceFunctions);
+    memset(&commandBufferAllocateInfo, 0, sizeof(commandBufferAllocateInfo));
+    commandBufferAllocateInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    if (vkAllocateCommandBuffers(device, &commandBufferAllocateInfo, &commandBuffer) != VK_SUCCESS) return 1;
+
+    /* the best of several runs, which is the least disturbed by the rest of the system */
+    for (method = 0; method < METHOD_COUNT; ++method) best[method] = -1.0;
+    for (run = 0; run < RUNS; ++run) {
+        for (method = 0; method < METHOD_COUNT; ++method) {
+            double start = now(), time;
+            if (method == 0) drawThroughTable(&deviceFunctions, commandBuffer, (uint32_t) count);
+            else if (method == 1) drawThroughMacros(commandBuffer, (uint32_t) count);
+            else if (method == 2) drawThroughThreadLocal(&deviceFunctions, commandBuffer, (uint32_t) count);
+            else drawDirect(commandBuffer, (uint32_t) count);
+            time = (now() - start) / (double) count;
+            if (best[method] < 0.0 || time < best[method]) best[method] = time;
+        }
+    }
+    for (method = 0; method < METHOD_COUNT; ++method) printf("%-8s %6.2f ns per call\n", names[method], best[method]);
+    /* every call draws a triangle, so a method that skipped the driver shows up here */
+    if (mockDrawnVertexCount() != (uint64_t) 3 * (uint64_t) count * METHOD_COUNT * RUNS) {
+        fprintf(stderr, "the driver drew %llu vertices instead of %llu\n", (unsigned long long) mockDrawnVertexCount(),
+            (unsigned long long) ((uint64_t) 3 * (uint64_t) count * METHOD_COUNT * RUNS));
+        return 1;
+    }
+
+    vkDestroyDevice(device, NULL);
+    vkDestroyInstance(instance, NULL);
+    return 0;
+}
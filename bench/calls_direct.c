@@ -0,0 +1,16 @@
+/*  vkad call benchmark, the part with static dispatch: calls the functions of the statically linked mock driver directly.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+*/
+#define VKAD_STATIC_DISPATCH
+
+#include "vkad.h"
+
+PFN_vkGetInstanceProcAddr linkedGetInstanceProcAddr(void) {
+    return vkGetInstanceProcAddr;
+}
+
+void drawDirect(VkCommandBuffer commandBuffer, uint32_t count) {
+    uint32_t i;
+    for (i = 0; i < count; ++i) vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+}
@@ -0,0 +1,13 @@
+/*  vkad call benchmark, the part with thread-local dispatch: calls through the vk* macros, which read the table of the calling thread.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+*/
+#define VKAD_THREAD_LOCAL_DISPATCH
+
+#include "vkad.h"
+
+void drawThroughThreadLocal(const VkadDeviceFunctions* functions, VkCommandBuffer commandBuffer, uint32_t count) {
+    uint32_t i;
+    vkadMakeCurrent(functions);
+    for (i = 0; i < count; ++i) vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+}
@@ -0,0 +1,116 @@
+/*  vkad instance filter test: loads the instance table for a headless instance and checks the physical device commands of device extensions.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+
+    Usage: filter <driver manifest or library>
+    Meant for the mock driver, which returns a function for every name it knows, so every member that is NULL was skipped, and whose physical device reports
+    no extensions. Returns non-zero if the filtered table or the availability set is not what the documentation promises.
+*/
+#define VKAD_LIBRARY_LOADING
+
+#include <stdio.h>
+#include <string.h>
+
+#include "vkad.h"
+
+#define SURFACE_FUNCTION_COUNT 6
+
+static int failures;
+
+static void check(int condition, const char* what) {
+    if (!condition) {
+        fprintf(stderr, "failed: %s\n", what);
+        ++failures;
+    }
+}
+
+int main(int argc, char** argv) {
+    /* the functions of VK_KHR_surface and of a surface platform, which a headless instance does not enable */
+    static const VkadInstanceFunctionId surfaceFunctions[SURFACE_FUNCTION_COUNT] = {
+        VKAD_INSTANCE_FUNCTION_ID_DestroySurfaceKHR,
+        VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfaceSupportKHR,
+        VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfaceCapabilitiesKHR,
+        VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfaceFormatsKHR,
+        VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfacePresentModesKHR,
+        VKAD_INSTANCE_FUNCTION_ID_CreateHeadlessSurfaceEXT,
+    };
+    VkadLibrary library;
+    VkadGlobalFunctions global;
+    VkadInstanceFunctions instanceFunctions;
+    VkadInstanceFunctionSet available;
+    VkadLoadStats fullStats, stats;
+    VkadInstanceLoadInfo loadInfo = { 0, NULL, NULL, NULL, NULL };
+    VkApplicationInfo applicationInfo;
+    VkInstanceCreateInfo instanceCreateInfo;
+    VkInstance instance;
+    VkPhysicalDevice physicalDevice;
+    VkExtensionProperties properties;
+    PFN_vkGetInstanceProcAddr loader;
+    uint32_t physicalDeviceCount = 1, propertyCount = 0;
+    int i, surfaceSkipped = 1;
+    VkResult result;
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <driver manifest or library>\n", argv[0]);
+        return 2;
+    }
+
+    loader = vkadOpenDriver(argv[1], &library);
+    if (loader == NULL) {
+        fprintf(stderr, "cannot open the driver %s\n", argv[1]);
+        return 1;
+    }
+    vkadLoadGlobalFunctions(loader, &global);
+    memset(&applicationInfo, 0, sizeof(applicationInfo));
+    applicationInfo.sType      = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_1;
+    memset(&instanceCreateInfo, 0, sizeof(instanceCreateInfo));
+    instanceCreateInfo.sType            = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    if (global.CreateInstance == NULL || global.CreateInstance(&instanceCreateInfo, NULL, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "cannot create an instance\n");
+        return 1;
+    }
+
+    /* every member, for the number of members the filtered load has to account for */
+    loadInfo.pStats = &fullStats;
+    vkadLoadInstanceFunctionsEx(loader, instance, &loadInfo, &instanceFunctions);
+
+    loadInfo.pCreateInfo = &instanceCreateInfo;
+    loadInfo.pAvailable  = &available;
+    loadInfo.pStats      = &stats;
+    vkadLoadInstanceFunctionsEx(loader, instance, &loadInfo, &instanceFunctions);
+    for (i = 0; i < SURFACE_FUNCTION_COUNT; ++i) {
+        if (vkadGetInstanceFunction(&instanceFunctions, surfaceFunctions[i]) != NULL || vkadInstanceFunctionAvailable(&available, surfaceFunctions[i])) {
+            fprintf(stderr, "%s was loaded\n", vkadInstanceFunctionName(surfaceFunctions[i]));
+            surfaceSkipped = 0;
+        }
+    }
+    check(surfaceSkipped, "the surface and platform functions are NULL");
+    check(stats.lookupCount + stats.skippedCount == fullStats.lookupCount + fullStats.skippedCount, "every member is either looked up or skipped");
+    check(stats.skippedCount >= fullStats.skippedCount + SURFACE_FUNCTION_COUNT, "the surface and platform functions are counted as skipped");
+    check(instanceFunctions.GetPhysicalDeviceFeatures2 != NULL, "the functions of version 1.1 are loaded");
+
+    /* the physical device commands of device extensions are loaded anyway, until the extension properties of a physical device rule them out */
+    check(instanceFunctions.GetPhysicalDeviceFragmentShadingRatesKHR != NULL
+          && vkadInstanceFunctionAvailable(&available, VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFragmentShadingRatesKHR),
+          "GetPhysicalDeviceFragmentShadingRatesKHR is loaded for a headless instance");
+    result = instanceFunctions.EnumeratePhysicalDevices(instance, &physicalDeviceCount, &physicalDevice);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || physicalDeviceCount == 0) {
+        fprintf(stderr, "no physical device\n");
+        return 1;
+    }
+    if (instanceFunctions.EnumerateDeviceExtensionProperties(physicalDevice, NULL, &propertyCount, NULL) != VK_SUCCESS || propertyCount != 0) {
+        fprintf(stderr, "the physical device has extensions\n");
+        return 1;
+    }
+    vkadCheckPhysicalDeviceFunctions(&properties, propertyCount, &available);
+    check(!vkadInstanceFunctionAvailable(&available, VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFragmentShadingRatesKHR),
+          "GetPhysicalDeviceFragmentShadingRatesKHR is cleared for a physical device without VK_KHR_fragment_shading_rate");
+    check(vkadInstanceFunctionAvailable(&available, VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFeatures2), "the core functions stay available");
+    printf("instance: %u lookups and %u skipped for a headless instance, %u and %u without filter\n", stats.lookupCount, stats.skippedCount, fullStats.lookupCount,
+           fullStats.skippedCount);
+
+    if (instanceFunctions.DestroyInstance != NULL) instanceFunctions.DestroyInstance(instance, NULL);
+    vkadCloseLibrary(&library);
+    return failures != 0;
+}
@@ -0,0 +1,115 @@
+/*  vkad alias folding test: loads a device table with VKAD_LOAD_FOLD_ALIASES_BIT from a driver that only has the KHR name of vkCmdDrawIndirectCount.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+
+    Usage: fold <driver manifest or library>
+    Meant for the mock driver with VKAD_MOCK_FUNCTIONS naming a load manifest with vkCmdDrawIndirectCountKHR and the instance functions needed to create a device,
+    which is how ctest runs it. Returns non-zero if the table or the statistics are not what folding promises.
+*/
+#define VKAD_LIBRARY_LOADING
+
+#include <stdio.h>
+#include <string.h>
+
+#include "vkad.h"
+
+static int failures;
+
+static void check(int condition, const char* what) {
+    if (!condition) {
+        fprintf(stderr, "failed: %s\n", what);
+        ++failures;
+    }
+}
+
+int main(int argc, char** argv) {
+    static const char* const extensions[] = { "VK_KHR_draw_indirect_count" };
+    VkadLibrary library;
+    VkadGlobalFunctions global;
+    VkadInstanceFunctions instanceFunctions;
+    VkadDeviceFunctions deviceFunctions;
+    VkadDeviceFunctionSet available;
+    VkadLoadStats coreStats, stats;
+    VkadDeviceLoadInfo loadInfo = { NULL, 0, 0, NULL, NULL, NULL };
+    VkApplicationInfo applicationInfo;
+    VkInstanceCreateInfo instanceCreateInfo;
+    VkDeviceQueueCreateInfo queueCreateInfo;
+    VkDeviceCreateInfo deviceCreateInfo;
+    VkInstance instance;
+    VkPhysicalDevice physicalDevice;
+    VkDevice device;
+    PFN_vkGetInstanceProcAddr loader;
+    uint32_t physicalDeviceCount = 1;
+    float priority = 1.0f;
+    VkResult result;
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <driver manifest or library>\n", argv[0]);
+        return 2;
+    }
+
+    loader = vkadOpenDriver(argv[1], &library);
+    if (loader == NULL) {
+        fprintf(stderr, "cannot open the driver %s\n", argv[1]);
+        return 1;
+    }
+    vkadLoadGlobalFunctions(loader, &global);
+    memset(&applicationInfo, 0, sizeof(applicationInfo));
+    applicationInfo.sType      = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_1;
+    memset(&instanceCreateInfo, 0, sizeof(instanceCreateInfo));
+    instanceCreateInfo.sType            = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    if (global.CreateInstance == NULL || global.CreateInstance(&instanceCreateInfo, NULL, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "cannot create an instance\n");
+        return 1;
+    }
+    vkadLoadInstanceFunctions(loader, instance, &instanceFunctions);
+    if (instanceFunctions.EnumeratePhysicalDevices == NULL || instanceFunctions.CreateDevice == NULL || instanceFunctions.GetDeviceProcAddr == NULL) {
+        fprintf(stderr, "the driver lacks the functions for creating a device, VKAD_MOCK_FUNCTIONS has to list them\n");
+        return 1;
+    }
+    result = instanceFunctions.EnumeratePhysicalDevices(instance, &physicalDeviceCount, &physicalDevice);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || physicalDeviceCount == 0) {
+        fprintf(stderr, "no physical device\n");
+        return 1;
+    }
+    memset(&queueCreateInfo, 0, sizeof(queueCreateInfo));
+    queueCreateInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueCount       = 1;
+    queueCreateInfo.pQueuePriorities = &priority;
+    memset(&deviceCreateInfo, 0, sizeof(deviceCreateInfo));
+    deviceCreateInfo.sType                = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos    = &queueCreateInfo;
+    if (instanceFunctions.CreateDevice(physicalDevice, &deviceCreateInfo, NULL, &device) != VK_SUCCESS) {
+        fprintf(stderr, "cannot create a device\n");
+        return 1;
+    }
+
+    /* the lookups of version 1.1 alone, in which every family has only its core member enabled */
+    loadInfo.pCreateInfo = &deviceCreateInfo;
+    loadInfo.apiVersion  = VK_API_VERSION_1_1;
+    loadInfo.pStats      = &coreStats;
+    vkadLoadDeviceFunctionsEx(instanceFunctions.GetDeviceProcAddr, device, &loadInfo, &deviceFunctions);
+
+    /* with the extension, each of its two families (CmdDrawIndirectCount and CmdDrawIndexedIndirectCount) costs one lookup of the KHR name more */
+    deviceCreateInfo.enabledExtensionCount   = 1;
+    deviceCreateInfo.ppEnabledExtensionNames = extensions;
+    loadInfo.flags      = VKAD_LOAD_FOLD_ALIASES_BIT;
+    loadInfo.pAvailable = &available;
+    loadInfo.pStats     = &stats;
+    vkadLoadDeviceFunctionsEx(instanceFunctions.GetDeviceProcAddr, device, &loadInfo, &deviceFunctions);
+    check(deviceFunctions.CmdDrawIndirectCountKHR != NULL, "CmdDrawIndirectCountKHR is loaded");
+    check(deviceFunctions.CmdDrawIndirectCount == deviceFunctions.CmdDrawIndirectCountKHR, "CmdDrawIndirectCount is the KHR function");
+    check(vkadDeviceFunctionAvailable(&available, VKAD_DEVICE_FUNCTION_ID_CmdDrawIndirectCount), "CmdDrawIndirectCount is available");
+    check(vkadDeviceFunctionAvailable(&available, VKAD_DEVICE_FUNCTION_ID_CmdDrawIndirectCountKHR), "CmdDrawIndirectCountKHR is available");
+    check(deviceFunctions.CmdDrawIndexedIndirectCount == NULL && !vkadDeviceFunctionAvailable(&available, VKAD_DEVICE_FUNCTION_ID_CmdDrawIndexedIndirectCount),
+          "CmdDrawIndexedIndirectCount, which the driver lacks, is NULL");
+    check(stats.lookupCount == coreStats.lookupCount + 2, "one lookup more for each family of the extension");
+    printf("device: %u lookups for version 1.1, %u with the extension and folding, %u resolved\n", coreStats.lookupCount, stats.lookupCount, stats.resolvedCount);
+
+    if (deviceFunctions.DestroyDevice != NULL) deviceFunctions.DestroyDevice(device, NULL);
+    if (instanceFunctions.DestroyInstance != NULL) instanceFunctions.DestroyInstance(instance, NULL);
+    vkadCloseLibrary(&library);
+    return failures != 0;
+}
@@ -0,0 +1,149 @@
+/*  vkad instrumentation test: instruments the instance and device tables of the mock driver and checks the call counts, sampling and the trace.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+
+    Usage: instrument <driver manifest or library> <trace file>
+    Returns non-zero if a count or the trace is wrong, and 77 (which ctest reports as skipped) where vkad has no thunks for the platform.
+*/
+#define VKAD_LIBRARY_LOADING
+#define VKAD_INSTRUMENTATION
+
+#include <stdio.h>
+#include <string.h>
+
+#include "vkad.h"
+
+#define DRAW_COUNT 100
+#define SAMPLING_INTERVAL 4
+
+static int failures;
+
+static void check(int condition, const char* what) {
+    if (!condition) {
+        fprintf(stderr, "failed: %s\n", what);
+        ++failures;
+    }
+}
+
+/* the number of complete events in a trace file, or -1 if it cannot be read */
+static int countTraceEvents(const char* path) {
+    static const char event[] = "\"ph\":\"X\"";
+    char line[512];
+    int count = 0;
+    FILE* file = fopen(path, "r");
+    if (file == NULL) return -1;
+    while (fgets(line, (int) sizeof(line), file) != NULL) {
+        const char* position = line;
+        while ((position = strstr(position, event)) != NULL) {
+            ++count;
+            position += sizeof(event) - 1;
+        }
+    }
+    fclose(file);
+    return count;
+}
+
+int main(int argc, char** argv) {
+    static VkadCallStatistics statistics;
+    VkadLibrary library;
+    VkadGlobalFunctions global;
+    VkadInstanceFunctions instanceFunctions, instrumentedInstance;
+    VkadDeviceFunctions deviceFunctions, instrumentedDevice;
+    VkApplicationInfo applicationInfo;
+    VkInstanceCreateInfo instanceCreateInfo;
+    VkDeviceQueueCreateInfo queueCreateInfo;
+    VkDeviceCreateInfo deviceCreateInfo;
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo;
+    VkInstance instance;
+    VkPhysicalDevice physicalDevice;
+    VkDevice device;
+    VkCommandBuffer commandBuffer;
+    PFN_vkGetInstanceProcAddr loader;
+    uint32_t physicalDeviceCount = 1;
+    float priority = 1.0f;
+    int i;
+    VkResult result;
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <driver manifest or library> <trace file>\n", argv[0]);
+        return 2;
+    }
+#if !VKAD_HAS_THUNKS
+    fprintf(stderr, "instrumentation is not available for this platform\n");
+    return 77;
+#endif
+
+    loader = vkadOpenDriver(argv[1], &library);
+    if (loader == NULL) {
+        fprintf(stderr, "cannot open the driver %s\n", argv[1]);
+        return 1;
+    }
+    vkadLoadGlobalFunctions(loader, &global);
+    memset(&applicationInfo, 0, sizeof(applicationInfo));
+    applicationInfo.sType      = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_1;
+    memset(&instanceCreateInfo, 0, sizeof(instanceCreateInfo));
+    instanceCreateInfo.sType            = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    if (global.CreateInstance == NULL || global.CreateInstance(&instanceCreateInfo, NULL, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "cannot create an instance\n");
+        return 1;
+    }
+    vkadLoadInstanceFunctions(loader, instance, &instanceFunctions);
+    check(vkadInstrumentInstanceFunctions(instance, &instanceFunctions, &instrumentedInstance), "the instance table is instrumented");
+    result = instrumentedInstance.EnumeratePhysicalDevices(instance, &physicalDeviceCount, &physicalDevice);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || physicalDeviceCount == 0) {
+        fprintf(stderr, "no physical device\n");
+        return 1;
+    }
+    memset(&queueCreateInfo, 0, sizeof(queueCreateInfo));
+    queueCreateInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueCount       = 1;
+    queueCreateInfo.pQueuePriorities = &priority;
+    memset(&deviceCreateInfo, 0, sizeof(deviceCreateInfo));
+    deviceCreateInfo.sType                = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos    = &queueCreateInfo;
+    if (instrumentedInstance.CreateDevice(physicalDevice, &deviceCreateInfo, NULL, &device) != VK_SUCCESS) {
+        fprintf(stderr, "cannot create a device\n");
+        return 1;
+    }
+    vkadLoadDeviceFunctions(instanceFunctions.GetDeviceProcAddr, device, &deviceFunctions);
+    check(vkadInstrumentDeviceFunctions(device, &deviceFunctions, &instrumentedDevice), "the device table is instrumented");
+    memset(&commandBufferAllocateInfo, 0, sizeof(commandBufferAllocateInfo));
+    commandBufferAllocateInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    if (instrumentedDevice.AllocateCommandBuffers(device, &commandBufferAllocateInfo, &commandBuffer) != VK_SUCCESS) {
+        fprintf(stderr, "cannot allocate a command buffer\n");
+        return 1;
+    }
+
+    /* every call timed and traced; no other instrumented call may happen while tracing is enabled */
+    vkadSetTracing(1);
+    for (i = 0; i < DRAW_COUNT; ++i) instrumentedDevice.CmdDraw(commandBuffer, 3, 1, 0, 0);
+    vkadSetTracing(0);
+    vkadGetCallStatistics(&statistics);
+    check(statistics.instance[VKAD_INSTANCE_FUNCTION_ID_EnumeratePhysicalDevices].callCount == 1, "one call of EnumeratePhysicalDevices");
+    check(statistics.instance[VKAD_INSTANCE_FUNCTION_ID_CreateDevice].callCount == 1, "one call of CreateDevice");
+    check(statistics.device[VKAD_DEVICE_FUNCTION_ID_AllocateCommandBuffers].callCount == 1, "one call of AllocateCommandBuffers");
+    check(statistics.device[VKAD_DEVICE_FUNCTION_ID_CmdDraw].callCount == DRAW_COUNT, "every call of CmdDraw is counted");
+    check(statistics.device[VKAD_DEVICE_FUNCTION_ID_CmdDraw].timedCount == DRAW_COUNT, "every call of CmdDraw is timed without sampling");
+    check(vkadWriteTrace(argv[2]), "the trace is written");
+    check(countTraceEvents(argv[2]) == DRAW_COUNT, "the trace has one event for each call of CmdDraw");
+
+    /* with sampling, only every interval-th call is timed */
+    vkadSetCallSampling(SAMPLING_INTERVAL);
+    for (i = 0; i < DRAW_COUNT * SAMPLING_INTERVAL; ++i) instrumentedDevice.CmdDraw(commandBuffer, 3, 1, 0, 0);
+    vkadSetCallSampling(1);
+    vkadGetCallStatistics(&statistics);
+    check(statistics.device[VKAD_DEVICE_FUNCTION_ID_CmdDraw].callCount == DRAW_COUNT + DRAW_COUNT * SAMPLING_INTERVAL, "every sampled call of CmdDraw is counted");
+    check(statistics.device[VKAD_DEVICE_FUNCTION_ID_CmdDraw].timedCount == DRAW_COUNT + DRAW_COUNT, "one in every interval calls of CmdDraw is timed");
+    printf("CmdDraw: %llu calls, %llu timed, %llu ns\n", (unsigned long long) statistics.device[VKAD_DEVICE_FUNCTION_ID_CmdDraw].callCount,
+           (unsigned long long) statistics.device[VKAD_DEVICE_FUNCTION_ID_CmdDraw].timedCount, (unsigned long long) statistics.device[VKAD_DEVICE_FUNCTION_ID_CmdDraw].nanoseconds);
+
+    vkadReleaseInstrumentedFunctions(&instrumentedDevice);
+    vkadReleaseInstrumentedFunctions(&instrumentedInstance);
+    if (deviceFunctions.DestroyDevice != NULL) deviceFunctions.DestroyDevice(device, NULL);
+    if (instanceFunctions.DestroyInstance != NULL) instanceFunctions.DestroyInstance(instance, NULL);
+    vkadCloseLibrary(&library);
+    return failures != 0;
+}
@@ -0,0 +1,154 @@
+/*  vkad lazy loading test: calls members of a lazily loaded table of the mock driver, records the called ones in a load manifest and preloads them.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+
+    Usage: lazy <driver manifest or library> <load manifest>
+    Returns non-zero if a member is not resolved as promised or the recorded set is wrong, and 77 (which ctest reports as skipped) where vkad has no thunks
+    for the platform, since the tables are then loaded completely.
+*/
+#define VKAD_LIBRARY_LOADING
+#define VKAD_LAZY_LOADING
+#define VKAD_LOAD_MANIFESTS
+
+#include <stdio.h>
+#include <string.h>
+
+#include "vkad.h"
+
+#define CALLED_COUNT 3
+
+static int failures;
+
+static void check(int condition, const char* what) {
+    if (!condition) {
+        fprintf(stderr, "failed: %s\n", what);
+        ++failures;
+    }
+}
+
+/* whether the members in the set hold the driver's functions, and all others do not */
+static int resolvedExactly(PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkadDeviceFunctions* functions, const VkadDeviceFunctionSet* set) {
+    char name[128];
+    uint32_t i;
+    int exactly = 1;
+    for (i = 0; i < VKAD_DEVICE_FUNCTION_COUNT; ++i) {
+        PFN_vkVoidFunction function = vkadGetDeviceFunction(functions, (VkadDeviceFunctionId) i), driverFunction;
+        int inSet = vkadDeviceFunctionAvailable(set, (VkadDeviceFunctionId) i);
+        if (function == NULL) continue;
+        snprintf(name, sizeof(name), "vk%s", vkadDeviceFunctionName((VkadDeviceFunctionId) i));
+        driverFunction = loader(device, name);
+        if ((function == driverFunction) != inSet) {
+            fprintf(stderr, "%s is %s\n", name, inSet ? "not resolved" : "resolved");
+            exactly = 0;
+        }
+    }
+    return exactly;
+}
+
+int main(int argc, char** argv) {
+    static const VkadDeviceFunctionId calledIds[CALLED_COUNT] = {
+        VKAD_DEVICE_FUNCTION_ID_GetDeviceQueue,
+        VKAD_DEVICE_FUNCTION_ID_AllocateCommandBuffers,
+        VKAD_DEVICE_FUNCTION_ID_CmdDraw,
+    };
+    VkadLibrary library;
+    VkadGlobalFunctions global;
+    VkadInstanceFunctions instanceFunctions;
+    VkadDeviceFunctions deviceFunctions, preloadedFunctions;
+    VkadDeviceFunctionSet expected, called, manifest;
+    VkApplicationInfo applicationInfo;
+    VkInstanceCreateInfo instanceCreateInfo;
+    VkDeviceQueueCreateInfo queueCreateInfo;
+    VkDeviceCreateInfo deviceCreateInfo;
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo;
+    VkInstance instance;
+    VkPhysicalDevice physicalDevice;
+    VkDevice device;
+    VkQueue queue;
+    VkCommandBuffer commandBuffer;
+    PFN_vkGetInstanceProcAddr loader;
+    uint32_t physicalDeviceCount = 1, i;
+    float priority = 1.0f;
+    VkResult result;
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <driver manifest or library> <load manifest>\n", argv[0]);
+        return 2;
+    }
+#if !VKAD_HAS_THUNKS
+    fprintf(stderr, "lazy loading is not available for this platform\n");
+    return 77;
+#endif
+
+    loader = vkadOpenDriver(argv[1], &library);
+    if (loader == NULL) {
+        fprintf(stderr, "cannot open the driver %s\n", argv[1]);
+        return 1;
+    }
+    vkadLoadGlobalFunctions(loader, &global);
+    memset(&applicationInfo, 0, sizeof(applicationInfo));
+    applicationInfo.sType      = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_1;
+    memset(&instanceCreateInfo, 0, sizeof(instanceCreateInfo));
+    instanceCreateInfo.sType            = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    if (global.CreateInstance == NULL || global.CreateInstance(&instanceCreateInfo, NULL, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "cannot create an instance\n");
+        return 1;
+    }
+    vkadLoadInstanceFunctions(loader, instance, &instanceFunctions);
+    result = instanceFunctions.EnumeratePhysicalDevices(instance, &physicalDeviceCount, &physicalDevice);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || physicalDeviceCount == 0) {
+        fprintf(stderr, "no physical device\n");
+        return 1;
+    }
+    memset(&queueCreateInfo, 0, sizeof(queueCreateInfo));
+    queueCreateInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueCount       = 1;
+    queueCreateInfo.pQueuePriorities = &priority;
+    memset(&deviceCreateInfo, 0, sizeof(deviceCreateInfo));
+    deviceCreateInfo.sType                = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos    = &queueCreateInfo;
+    if (instanceFunctions.CreateDevice(physicalDevice, &deviceCreateInfo, NULL, &device) != VK_SUCCESS) {
+        fprintf(stderr, "cannot create a device\n");
+        return 1;
+    }
+    memset(&expected, 0, sizeof(expected));
+    for (i = 0; i < CALLED_COUNT; ++i) expected.bits[calledIds[i] / 32] |= UINT32_C(1) << (calledIds[i] % 32);
+
+    /* nothing is resolved before the first call, and each call resolves only its own member */
+    vkadLoadDeviceFunctionsLazy(instanceFunctions.GetDeviceProcAddr, device, &deviceFunctions);
+    vkadGetCalledDeviceFunctions(&deviceFunctions, &called);
+    memset(&manifest, 0, sizeof(manifest));
+    check(memcmp(&called, &manifest, sizeof(called)) == 0, "no member is called after loading");
+    deviceFunctions.GetDeviceQueue(device, 0, 0, &queue);
+    memset(&commandBufferAllocateInfo, 0, sizeof(commandBufferAllocateInfo));
+    commandBufferAllocateInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    check(deviceFunctions.AllocateCommandBuffers(device, &commandBufferAllocateInfo, &commandBuffer) == VK_SUCCESS, "the command buffer is allocated through a thunk");
+    deviceFunctions.CmdDraw(commandBuffer, 3, 1, 0, 0);
+    deviceFunctions.CmdDraw(commandBuffer, 3, 1, 0, 0);
+    check(resolvedExactly(instanceFunctions.GetDeviceProcAddr, device, &deviceFunctions, &expected), "the called members hold the driver's functions");
+    vkadGetCalledDeviceFunctions(&deviceFunctions, &called);
+    check(memcmp(&called, &expected, sizeof(called)) == 0, "the called set has exactly the called members");
+    vkadReleaseDeviceFunctions(&deviceFunctions);
+
+    /* the recorded set survives the manifest and is resolved right away by the preloaded load */
+    check(vkadWriteLoadManifest(argv[2], NULL, &called), "the manifest is written");
+    check(vkadReadLoadManifest(argv[2], NULL, &manifest), "the manifest is read");
+    check(memcmp(&manifest, &expected, sizeof(manifest)) == 0, "the manifest has exactly the called members");
+    vkadLoadDeviceFunctionsPreloaded(instanceFunctions.GetDeviceProcAddr, device, &manifest, &preloadedFunctions);
+    check(resolvedExactly(instanceFunctions.GetDeviceProcAddr, device, &preloadedFunctions, &expected), "the preloaded members hold the driver's functions");
+    preloadedFunctions.CmdDispatch(commandBuffer, 1, 1, 1);
+    vkadGetCalledDeviceFunctions(&preloadedFunctions, &called);
+    expected.bits[VKAD_DEVICE_FUNCTION_ID_CmdDispatch / 32] |= UINT32_C(1) << (VKAD_DEVICE_FUNCTION_ID_CmdDispatch % 32);
+    check(memcmp(&called, &expected, sizeof(called)) == 0, "a member that was not preloaded is still resolved on its first call");
+    vkadReleaseDeviceFunctions(&preloadedFunctions);
+
+    /* the released tables must not be called any more */
+    vkadLoadDeviceFunctions(instanceFunctions.GetDeviceProcAddr, device, &deviceFunctions);
+    if (deviceFunctions.DestroyDevice != NULL) deviceFunctions.DestroyDevice(device, NULL);
+    if (instanceFunctions.DestroyInstance != NULL) instanceFunctions.DestroyInstance(instance, NULL);
+    vkadCloseLibrary(&library);
+    return failures != 0;
+}
@@ -0,0 +1,131 @@
+/*  vkad load benchmark: measures the load functions for the three tables on a driver, and where the time of loading the device table goes.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+
+    Usage: load <driver manifest or library> [runs]
+    The driver is opened directly with vkadOpenDriver, so the numbers do not include the loader. With the mock driver, VKAD_MOCK_LOOKUP_NANOSECONDS models the cost
+    of a lookup in a real driver. Needs a POSIX system for clock_gettime.
+*/
+#define _POSIX_C_SOURCE 200809L
+#define VKAD_LIBRARY_LOADING
+#define VKAD_LAZY_LOADING
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "vkad.h"
+
+#define MAX_RUNS 10000
+#define PHASE_COUNT 5
+
+static double now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec * 1e6 + (double) time.tv_nsec * 1e-3;
+}
+
+static int compareTimes(const void* a, const void* b) {
+    double x = *(const double*) a, y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char** argv) {
+    static double times[PHASE_COUNT][MAX_RUNS];
+    static const char* const names[PHASE_COUNT] = { "global", "instance", "device", "filtered", "lazy" };
+    VkadLibrary library;
+    VkadGlobalFunctions global;
+    VkadInstanceFunctions instanceFunctions;
+    VkadDeviceFunctions deviceFunctions;
+    VkadLoadStats stats;
+    VkadDeviceLoadInfo loadInfo = { NULL, 0, 0, NULL, NULL, NULL };
+    VkApplicationInfo applicationInfo;
+    VkInstanceCreateInfo instanceCreateInfo;
+    VkDeviceQueueCreateInfo queueCreateInfo;
+    VkDeviceCreateInfo deviceCreateInfo;
+    VkInstance instance;
+    VkPhysicalDevice physicalDevice;
+    VkDevice device;
+    PFN_vkGetInstanceProcAddr loader;
+    uint32_t physicalDeviceCount = 1;
+    float priority = 1.0f;
+    int runs = argc > 2 ? atoi(argv[2]) : 100;
+    int phase, i;
+    double start;
+    VkResult result;
+    if (argc < 2 || runs < 1 || runs > MAX_RUNS) {
+        fprintf(stderr, "usage: %s <driver manifest or library> [runs (1 to %d)]\n", argv[0], MAX_RUNS);
+        return 2;
+    }
+
+    loader = vkadOpenDriver(argv[1], &library);
+    if (loader == NULL) {
+        fprintf(stderr, "cannot open the driver %s\n", argv[1]);
+        return 1;
+    }
+    vkadLoadGlobalFunctions(loader, &global);
+    memset(&applicationInfo, 0, sizeof(applicationInfo));
+    applicationInfo.sType      = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_1;
+    memset(&instanceCreateInfo, 0, sizeof(instanceCreateInfo));
+    instanceCreateInfo.sType            = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    if (global.CreateInstance == NULL || global.CreateInstance(&instanceCreateInfo, NULL, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "cannot create an instance\n");
+        return 1;
+    }
+    vkadLoadInstanceFunctions(loader, instance, &instanceFunctions);
+    result = instanceFunctions.EnumeratePhysicalDevices(instance, &physicalDeviceCount, &physicalDevice);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || physicalDeviceCount == 0) {
+        fprintf(stderr, "no physical device\n");
+        return 1;
+    }
+    memset(&queueCreateInfo, 0, sizeof(queueCreateInfo));
+    queueCreateInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueCount       = 1;
+    queueCreateInfo.pQueuePriorities = &priority;
+    memset(&deviceCreateInfo, 0, sizeof(deviceCreateInfo));
+    deviceCreateInfo.sType                = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos    = &queueCreateInfo;
+    if (instanceFunctions.CreateDevice(physicalDevice, &deviceCreateInfo, NULL, &device) != VK_SUCCESS) {
+        fprintf(stderr, "cannot create a device\n");
+        return 1;
+    }
+
+    for (i = 0; i < runs; ++i) {
+        start = now();
+        vkadLoadGlobalFunctions(loader, &global);
+        times[0][i] = now() - start;
+        start = now();
+        vkadLoadInstanceFunctions(loader, instance, &instanceFunctions);
+        times[1][i] = now() - start;
+        start = now();
+        vkadLoadDeviceFunctions(instanceFunctions.GetDeviceProcAddr, device, &deviceFunctions);
+        times[2][i] = now() - start;
+        /* a device without extensions, so only the core functions are looked up */
+        start = now();
+        vkadLoadDeviceFunctionsFiltered(instanceFunctions.GetDeviceProcAddr, device, &deviceCreateInfo, VK_API_VERSION_1_1, &deviceFunctions);
+        times[3][i] = now() - start;
+        start = now();
+        vkadLoadDeviceFunctionsLazy(instanceFunctions.GetDeviceProcAddr, device, &deviceFunctions);
+        times[4][i] = now() - start;
+        vkadReleaseDeviceFunctions(&deviceFunctions);
+    }
+    for (phase = 0; phase < PHASE_COUNT; ++phase) {
+        qsort(times[phase], (size_t) runs, sizeof(double), compareTimes);
+        printf("%-8s min %10.1f us  median %10.1f us  max %10.1f us\n", names[phase], times[phase][0], times[phase][runs / 2], times[phase][runs - 1]);
+    }
+
+    loadInfo.pStats = &stats;
+    vkadLoadDeviceFunctionsEx(instanceFunctions.GetDeviceProcAddr, device, &loadInfo, &deviceFunctions);
+    printf("device: %u lookups, %u resolved, %u NULL, %.1f of %.1f us in the driver\n", stats.lookupCount, stats.resolvedCount, stats.nullCount,
+           (double) stats.loaderNanoseconds * 1e-3, (double) stats.nanoseconds * 1e-3);
+    printf("tables: global %u, instance %u, device %u bytes\n", (unsigned) sizeof(VkadGlobalFunctions), (unsigned) sizeof(VkadInstanceFunctions), (unsigned) sizeof(VkadDeviceFunctions));
+
+    if (deviceFunctions.DestroyDevice != NULL) deviceFunctions.DestroyDevice(device, NULL);
+    if (instanceFunctions.DestroyInstance != NULL) instanceFunctions.DestroyInstance(instance, NULL);
+    vkadCloseLibrary(&library);
+    return 0;
+}
@@ -0,0 +1,229 @@
+/*  vkad mock driver: a Vulkan driver (ICD) without a GPU, for measuring vkad on machines without one.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+
+    The driver has one physical device with one queue family and knows every function of the Vulkan headers it is built with. The functions that the loader and the
+    benchmarks need do their work, all others do nothing and return VK_SUCCESS. The cost and the extensions of a real driver can be modeled with environment variables:
+    VKAD_MOCK_LOOKUP_NANOSECONDS    time every call of vkGetInstanceProcAddr and vkGetDeviceProcAddr waits
+    VKAD_MOCK_FUNCTIONS             path of a vkad load manifest; only the instance and device functions listed there are returned, all others are NULL
+    The shared library is opened with vkadOpenDriver or through the Vulkan loader with VK_DRIVER_FILES set to its manifest. The static library also exports
+    vkGetInstanceProcAddr and vkCmdDraw, so it can be linked to an application with VKAD_STATIC_DISPATCH, and mockDrawnVertexCount, which returns the number of
+    vertices that vkCmdDraw counted.
+*/
+#define _POSIX_C_SOURCE 200809L
+#define VKAD_STATIC_DISPATCH
+#define VKAD_LOAD_MANIFESTS
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "vkad.h"
+
+#define MOCK_EXPORT __attribute__((visibility("default")))
+/* the first word of every dispatchable handle belongs to the loader, which expects this value in it */
+#define MOCK_LOADER_MAGIC 0x01CDC0DE
+
+typedef struct MockObject {
+    uintptr_t loaderData;
+} MockObject;
+
+static pthread_once_t configureOnce = PTHREAD_ONCE_INIT;
+static uint64_t lookupNanoseconds;
+static int allFunctions = 1;
+static VkadInstanceFunctionSet instanceFunctions;
+static VkadDeviceFunctionSet deviceFunctions;
+static MockObject physicalDevice = { MOCK_LOADER_MAGIC };
+static MockObject queue = { MOCK_LOADER_MAGIC };
+static MockObject commandBuffer = { MOCK_LOADER_MAGIC };
+static uint64_t drawnVertexCount;
+
+static void configure(void) {
+    const char* value = getenv("VKAD_MOCK_LOOKUP_NANOSECONDS");
+    if (value != NULL) lookupNanoseconds = strtoull(value, NULL, 10);
+    value = getenv("VKAD_MOCK_FUNCTIONS");
+    if (value != NULL && vkadReadLoadManifest(value, &instanceFunctions, &deviceFunctions)) allFunctions = 0;
+}
+
+static uint64_t now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t) time.tv_sec * UINT64_C(1000000000) + (uint64_t) time.tv_nsec;
+}
+/* spins instead of sleeping, since the lookups of real drivers are work and not waiting */
+static void waitForLookup(void) {
+    uint64_t start;
+    if (lookupNanoseconds == 0) return;
+    start = now();
+    while (now() - start < lookupNanoseconds) {}
+}
+
+/* handles the count and array pattern of the enumeration functions */
+static VkResult enumerate(uint32_t available, uint32_t* pCount, int hasArray) {
+    if (!hasArray || *pCount > available) *pCount = available;
+    return *pCount < available ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL mockNothing(void) {
+    return VK_SUCCESS;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL mockEnumerateInstanceVersion(uint32_t* pApiVersion) {
+    *pApiVersion = VK_API_VERSION_1_4;
+    return VK_SUCCESS;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL mockEnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+    (void) pLayerName;
+    return enumerate(0, pPropertyCount, pProperties != NULL);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL mockEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+    return enumerate(0, pPropertyCount, pProperties != NULL);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL mockCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) {
+    MockObject* instance = (MockObject*) malloc(sizeof(MockObject));
+    (void) pCreateInfo;
+    (void) pAllocator;
+    if (instance == NULL) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    instance->loaderData = MOCK_LOADER_MAGIC;
+    *pInstance = (VkInstance) instance;
+    return VK_SUCCESS;
+}
+static VKAPI_ATTR void VKAPI_CALL mockDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator) {
+    (void) pAllocator;
+    free(instance);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL mockEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) {
+    VkResult result = enumerate(1, pPhysicalDeviceCount, pPhysicalDevices != NULL);
+    (void) instance;
+    if (pPhysicalDevices != NULL && *pPhysicalDeviceCount > 0) pPhysicalDevices[0] = (VkPhysicalDevice) &physicalDevice;
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL mockGetPhysicalDeviceProperties(VkPhysicalDevice device, VkPhysicalDeviceProperties* pProperties) {
+    (void) device;
+    memset(pProperties, 0, sizeof(VkPhysicalDeviceProperties));
+    pProperties->apiVersion = VK_API_VERSION_1_4;
+    pProperties->deviceType = VK_PHYSICAL_DEVICE_TYPE_CPU;
+    strcpy(pProperties->deviceName, "vkad mock device");
+}
+static VKAPI_ATTR void VKAPI_CALL mockGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice device, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) {
+    (void) device;
+    enumerate(1, pQueueFamilyPropertyCount, pQueueFamilyProperties != NULL);
+    if (pQueueFamilyProperties != NULL && *pQueueFamilyPropertyCount > 0) {
+        memset(pQueueFamilyProperties, 0, sizeof(VkQueueFamilyProperties));
+        pQueueFamilyProperties->queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+        pQueueFamilyProperties->queueCount = 1;
+    }
+}
+static VKAPI_ATTR VkResult VKAPI_CALL mockEnumerateDeviceExtensionProperties(VkPhysicalDevice device, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+    (void) device;
+    (void) pLayerName;
+    return enumerate(0, pPropertyCount, pProperties != NULL);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL mockCreateDevice(VkPhysicalDevice device, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) {
+    MockObject* logicalDevice = (MockObject*) malloc(sizeof(MockObject));
+    (void) device;
+    (void) pCreateInfo;
+    (void) pAllocator;
+    if (logicalDevice == NULL) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    logicalDevice->loaderData = MOCK_LOADER_MAGIC;
+    *pDevice = (VkDevice) logicalDevice;
+    return VK_SUCCESS;
+}
+static VKAPI_ATTR void VKAPI_CALL mockDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) {
+    (void) pAllocator;
+    free(device);
+}
+static VKAPI_ATTR void VKAPI_CALL mockGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
+    (void) device;
+    (void) queueFamilyIndex;
+    (void) queueIndex;
+    *pQueue = (VkQueue) &queue;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL mockAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) {
+    uint32_t i;
+    (void) device;
+    for (i = 0; i < pAllocateInfo->commandBufferCount; ++i) pCommandBuffers[i] = (VkCommandBuffer) &commandBuffer;
+    return VK_SUCCESS;
+}
+VKAPI_ATTR void VKAPI_CALL vkCmdDraw(VkCommandBuffer buffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+    (void) buffer;
+    (void) firstVertex;
+    (void) firstInstance;
+    drawnVertexCount += (uint64_t) vertexCount * instanceCount;
+}
+/* the vertices drawn so far, so a benchmark can check that every call reached the driver */
+uint64_t mockDrawnVertexCount(void) {
+    return drawnVertexCount;
+}
+
+MOCK_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetDeviceProcAddr(VkDevice device, const char* pName);
+
+typedef struct MockFunction {
+    const char*        name;
+    PFN_vkVoidFunction function;
+} MockFunction;
+/* the functions that do more than nothing; the global ones are only returned by vkGetInstanceProcAddr */
+static const MockFunction globalFunctions[] = {
+    { "vkEnumerateInstanceVersion",             (PFN_vkVoidFunction) mockEnumerateInstanceVersion },
+    { "vkEnumerateInstanceExtensionProperties", (PFN_vkVoidFunction) mockEnumerateInstanceExtensionProperties },
+    { "vkEnumerateInstanceLayerProperties",     (PFN_vkVoidFunction) mockEnumerateInstanceLayerProperties },
+    { "vkCreateInstance",                       (PFN_vkVoidFunction) mockCreateInstance },
+};
+static const MockFunction functions[] = {
+    { "vkDestroyInstance",                          (PFN_vkVoidFunction) mockDestroyInstance },
+    { "vkEnumeratePhysicalDevices",                 (PFN_vkVoidFunction) mockEnumeratePhysicalDevices },
+    { "vkGetPhysicalDeviceProperties",              (PFN_vkVoidFunction) mockGetPhysicalDeviceProperties },
+    { "vkGetPhysicalDeviceQueueFamilyProperties",   (PFN_vkVoidFunction) mockGetPhysicalDeviceQueueFamilyProperties },
+    { "vkEnumerateDeviceExtensionProperties",       (PFN_vkVoidFunction) mockEnumerateDeviceExtensionProperties },
+    { "vkCreateDevice",                             (PFN_vkVoidFunction) mockCreateDevice },
+    { "vkGetDeviceProcAddr",                        (PFN_vkVoidFunction) vk_icdGetDeviceProcAddr },
+    { "vkDestroyDevice",                            (PFN_vkVoidFunction) mockDestroyDevice },
+    { "vkGetDeviceQueue",                           (PFN_vkVoidFunction) mockGetDeviceQueue },
+    { "vkAllocateCommandBuffers",                   (PFN_vkVoidFunction) mockAllocateCommandBuffers },
+    { "vkCmdDraw",                                  (PFN_vkVoidFunction) vkCmdDraw },
+};
+
+static PFN_vkVoidFunction findFunction(const MockFunction* list, size_t count, const char* name) {
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        if (strcmp(list[i].name, name) == 0) return list[i].function;
+    }
+    return NULL;
+}
+/* the function for a name of the given level or below; every known function that is not in the list does nothing, which works for any signature in the
+   C calling conventions of the platforms the benchmarks run on */
+static PFN_vkVoidFunction lookUp(const char* name, int global) {
+    VkadInstanceFunctionId instanceId;
+    VkadDeviceFunctionId deviceId;
+    PFN_vkVoidFunction function;
+    pthread_once(&configureOnce, configure);
+    waitForLookup();
+    if (global && (function = findFunction(globalFunctions, sizeof(globalFunctions) / sizeof(MockFunction), name)) != NULL) return function;
+    if (vkadFindDeviceFunctionId(name, &deviceId)) {
+        if (!allFunctions && !vkadDeviceFunctionAvailable(&deviceFunctions, deviceId)) return NULL;
+    } else if (global && vkadFindInstanceFunctionId(name, &instanceId)) {
+        if (!allFunctions && !vkadInstanceFunctionAvailable(&instanceFunctions, instanceId)) return NULL;
+    } else {
+        return NULL;
+    }
+    function = findFunction(functions, sizeof(functions) / sizeof(MockFunction), name);
+    return function != NULL ? function : (PFN_vkVoidFunction) mockNothing;
+}
+
+MOCK_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetDeviceProcAddr(VkDevice device, const char* pName) {
+    (void) device;
+    return lookUp(pName, 0);
+}
+MOCK_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetInstanceProcAddr(VkInstance instance, const char* pName) {
+    (void) instance;
+    if (strcmp(pName, "vkGetInstanceProcAddr") == 0) return (PFN_vkVoidFunction) vk_icdGetInstanceProcAddr;
+    return lookUp(pName, 1);
+}
+/* only for static linking, the shared library is built with hidden visibility */
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName) {
+    return vk_icdGetInstanceProcAddr(instance, pName);
+}
+MOCK_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vk_icdNegotiateLoaderICDInterfaceVersion(uint32_t* pSupportedVersion) {
+    if (*pSupportedVersion > 5) *pSupportedVersion = 5;
+    return VK_SUCCESS;
+}
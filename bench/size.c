@@ -0,0 +1,13 @@
+/*  vkad size benchmark: a translation unit that uses the load functions for all three tables, compiled once for every profile, so the size of the objects shows
+    what vkad adds to a binary.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+*/
+#include "vkad.h"
+
+void loadAllFunctions(PFN_vkGetInstanceProcAddr loader, VkInstance instance, VkDevice device,
+                      VkadGlobalFunctions* global, VkadInstanceFunctions* instanceFunctions, VkadDeviceFunctions* deviceFunctions) {
+    vkadLoadGlobalFunctions(loader, global);
+    vkadLoadInstanceFunctions(loader, instance, instanceFunctions);
+    vkadLoadDeviceFunctions(instanceFunctions->GetDeviceProcAddr, device, deviceFunctions);
+}
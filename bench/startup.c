@@ -0,0 +1,132 @@
+/*  vkad startup benchmark: compares the time from opening the library to a loaded device table through the Vulkan loader and directly through the driver.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+
+    Usage: startup <driver manifest or library> [runs]
+    Every run starts a new process for each path, so both are measured from a cold start of the process. If the driver is given as a manifest, the loader path is
+    restricted to the same driver with VK_DRIVER_FILES. Works without a GPU with lavapipe or a mock driver. Needs a POSIX system for fork and clock_gettime.
+*/
+#define _POSIX_C_SOURCE 200809L
+#define VKAD_LIBRARY_LOADING
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "vkad.h"
+
+#define MAX_RUNS 1000
+
+static double now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec * 1e6 + (double) time.tv_nsec * 1e-3;
+}
+
+/* opens the library, creates an instance and a device and loads all three tables, returns the time in microseconds or a negative value on failure */
+static double measureStartup(int direct, const char* driver) {
+    VkadLibrary library;
+    VkadGlobalFunctions global;
+    VkadInstanceFunctions instanceFunctions;
+    VkadDeviceFunctions deviceFunctions;
+    VkApplicationInfo applicationInfo;
+    VkInstanceCreateInfo instanceCreateInfo;
+    VkDeviceQueueCreateInfo queueCreateInfo;
+    VkDeviceCreateInfo deviceCreateInfo;
+    VkInstance instance;
+    VkPhysicalDevice physicalDevice;
+    VkDevice device;
+    PFN_vkGetInstanceProcAddr loader;
+    uint32_t physicalDeviceCount = 1;
+    float priority = 1.0f;
+    double start = now(), end;
+    VkResult result;
+
+    loader = direct ? vkadOpenDriver(driver, &library) : vkadOpenLibrary(NULL, &library);
+    if (loader == NULL) return -1.0;
+    vkadLoadGlobalFunctions(loader, &global);
+
+    memset(&applicationInfo, 0, sizeof(applicationInfo));
+    applicationInfo.sType      = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_1;
+    memset(&instanceCreateInfo, 0, sizeof(instanceCreateInfo));
+    instanceCreateInfo.sType            = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    if (global.CreateInstance == NULL || global.CreateInstance(&instanceCreateInfo, NULL, &instance) != VK_SUCCESS) return -1.0;
+    vkadLoadInstanceFunctions(loader, instance, &instanceFunctions);
+
+    result = instanceFunctions.EnumeratePhysicalDevices(instance, &physicalDeviceCount, &physicalDevice);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || physicalDeviceCount == 0) return -1.0;
+    memset(&queueCreateInfo, 0, sizeof(queueCreateInfo));
+    queueCreateInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueFamilyIndex = 0;
+    queueCreateInfo.queueCount       = 1;
+    queueCreateInfo.pQueuePriorities = &priority;
+    memset(&deviceCreateInfo, 0, sizeof(deviceCreateInfo));
+    deviceCreateInfo.sType                = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos    = &queueCreateInfo;
+    if (instanceFunctions.CreateDevice(physicalDevice, &deviceCreateInfo, NULL, &device) != VK_SUCCESS) return -1.0;
+    /* the device functions come from the vkGetDeviceProcAddr of the path, so directly from the driver in the direct case */
+    vkadLoadDeviceFunctions(instanceFunctions.GetDeviceProcAddr, device, &deviceFunctions);
+    end = now();
+
+    if (deviceFunctions.DestroyDevice != NULL) deviceFunctions.DestroyDevice(device, NULL);
+    if (instanceFunctions.DestroyInstance != NULL) instanceFunctions.DestroyInstance(instance, NULL);
+    vkadCloseLibrary(&library);
+    return end - start;
+}
+
+/* runs measureStartup in a new process */
+static double measureInChild(int direct, const char* driver) {
+    int pipeFds[2];
+    double time = -1.0;
+    pid_t child;
+    if (pipe(pipeFds) != 0) return -1.0;
+    child = fork();
+    if (child == 0) {
+        size_t length = strlen(driver);
+        close(pipeFds[0]);
+        if (!direct && length > 5 && strcmp(driver + length - 5, ".json") == 0) setenv("VK_DRIVER_FILES", driver, 1);
+        time = measureStartup(direct, driver);
+        if (write(pipeFds[1], &time, sizeof(time)) != (ssize_t) sizeof(time)) _exit(1);
+        _exit(0);
+    }
+    close(pipeFds[1]);
+    if (child < 0 || read(pipeFds[0], &time, sizeof(time)) != (ssize_t) sizeof(time)) time = -1.0;
+    close(pipeFds[0]);
+    if (child > 0) waitpid(child, NULL, 0);
+    return time;
+}
+
+static int compareTimes(const void* a, const void* b) {
+    double x = *(const double*) a, y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char** argv) {
+    static double times[2][MAX_RUNS];
+    static const char* const names[2] = { "loader", "direct" };
+    int runs = argc > 2 ? atoi(argv[2]) : 20;
+    int path, i, result = 0;
+    if (argc < 2 || runs < 1 || runs > MAX_RUNS) {
+        fprintf(stderr, "usage: %s <driver manifest or library> [runs (1 to %d)]\n", argv[0], MAX_RUNS);
+        return 2;
+    }
+    for (i = 0; i < runs; ++i) {
+        for (path = 0; path < 2; ++path) times[path][i] = measureInChild(path, argv[1]);
+    }
+    for (path = 0; path < 2; ++path) {
+        /* failed runs are negative, so they sort first */
+        qsort(times[path], (size_t) runs, sizeof(double), compareTimes);
+        if (times[path][0] < 0.0) {
+            printf("%-8s failed\n", names[path]);
+            /* the loader may not be installed, but the direct path only needs the driver */
+            if (path == 1) result = 1;
+        } else printf("%-8s min %10.1f us  median %10.1f us  max %10.1f us\n", names[path], times[path][0], times[path][runs / 2], times[path][runs - 1]);
+    }
+    return result;
+}
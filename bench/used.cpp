@@ -0,0 +1,129 @@
+/*  vkad C++ front end test: collects the used members with vkad::call and vkad::get and loads only those from the mock driver.
+    Copyright (c) 2024-2025     Hypatia of Sva <hypatia.sva@posteo.eu>
+    SPDX-License-Identifier: MIT
+
+    Usage: used <driver manifest or library>
+    Meant for the mock driver, which returns a function for every name it knows, so every member that is NULL was left out. Returns non-zero if the used sets
+    are not exactly the members used below, or if the loaded tables have any other member set.
+*/
+#define VKAD_LIBRARY_LOADING
+
+#include <stdio.h>
+#include <string.h>
+
+#include "vkad.h"
+
+static int failures;
+
+static void check(bool condition, const char* what) {
+    if (!condition) {
+        fprintf(stderr, "failed: %s\n", what);
+        ++failures;
+    }
+}
+
+/* never called, but its member is used all the same */
+void dispatch(const VkadDeviceFunctions& functions, VkCommandBuffer commandBuffer) {
+    vkad::call<&VkadDeviceFunctions::CmdDispatch>(functions, commandBuffer, 1u, 1u, 1u);
+}
+
+int main(int argc, char** argv) {
+    static const VkadInstanceFunctionId usedInstance[] = {
+        VKAD_INSTANCE_FUNCTION_ID_DestroyInstance,
+        VKAD_INSTANCE_FUNCTION_ID_EnumeratePhysicalDevices,
+        VKAD_INSTANCE_FUNCTION_ID_CreateDevice,
+        VKAD_INSTANCE_FUNCTION_ID_GetDeviceProcAddr,
+    };
+    static const VkadDeviceFunctionId usedDevice[] = {
+        VKAD_DEVICE_FUNCTION_ID_DestroyDevice,
+        VKAD_DEVICE_FUNCTION_ID_CmdDraw,
+        VKAD_DEVICE_FUNCTION_ID_CmdDispatch,
+    };
+    VkadLibrary library;
+    VkadGlobalFunctions global;
+    VkadInstanceFunctions instanceFunctions;
+    VkadDeviceFunctions deviceFunctions;
+    VkadInstanceFunctionSet expectedInstance;
+    VkadDeviceFunctionSet expectedDevice;
+    VkApplicationInfo applicationInfo;
+    VkInstanceCreateInfo instanceCreateInfo;
+    VkDeviceQueueCreateInfo queueCreateInfo;
+    VkDeviceCreateInfo deviceCreateInfo;
+    VkInstance instance;
+    VkPhysicalDevice physicalDevice;
+    VkDevice device;
+    PFN_vkGetInstanceProcAddr loader;
+    uint32_t physicalDeviceCount = 1, i;
+    float priority = 1.0f;
+    bool onlyUsed = true;
+    VkResult result;
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <driver manifest or library>\n", argv[0]);
+        return 2;
+    }
+
+    /* static initialization is over, so the sets are complete before anything is loaded */
+    memset(&expectedInstance, 0, sizeof(expectedInstance));
+    for (i = 0; i < sizeof(usedInstance) / sizeof(usedInstance[0]); ++i) expectedInstance.bits[usedInstance[i] / 32] |= UINT32_C(1) << (usedInstance[i] % 32);
+    memset(&expectedDevice, 0, sizeof(expectedDevice));
+    for (i = 0; i < sizeof(usedDevice) / sizeof(usedDevice[0]); ++i) expectedDevice.bits[usedDevice[i] / 32] |= UINT32_C(1) << (usedDevice[i] % 32);
+    check(memcmp(&vkad::usedInstanceFunctions(), &expectedInstance, sizeof(expectedInstance)) == 0, "the used instance functions are the ones used below");
+    check(memcmp(&vkad::usedDeviceFunctions(), &expectedDevice, sizeof(expectedDevice)) == 0, "the used device functions are the ones used below");
+
+    loader = vkadOpenDriver(argv[1], &library);
+    if (loader == NULL) {
+        fprintf(stderr, "cannot open the driver %s\n", argv[1]);
+        return 1;
+    }
+    vkadLoadGlobalFunctions(loader, &global);
+    memset(&applicationInfo, 0, sizeof(applicationInfo));
+    applicationInfo.sType      = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_1;
+    memset(&instanceCreateInfo, 0, sizeof(instanceCreateInfo));
+    instanceCreateInfo.sType            = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    if (global.CreateInstance == NULL || global.CreateInstance(&instanceCreateInfo, NULL, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "cannot create an instance\n");
+        return 1;
+    }
+    vkad::loadUsedInstanceFunctions(loader, instance, &instanceFunctions);
+    for (i = 0; i < VKAD_INSTANCE_FUNCTION_COUNT; ++i) {
+        bool used = vkadInstanceFunctionAvailable(&expectedInstance, (VkadInstanceFunctionId) i) != 0;
+        if ((vkadGetInstanceFunction(&instanceFunctions, (VkadInstanceFunctionId) i) != NULL) != used) {
+            fprintf(stderr, "%s is %s\n", vkadInstanceFunctionName((VkadInstanceFunctionId) i), used ? "NULL" : "loaded");
+            onlyUsed = false;
+        }
+    }
+    result = vkad::call<&VkadInstanceFunctions::EnumeratePhysicalDevices>(instanceFunctions, instance, &physicalDeviceCount, &physicalDevice);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || physicalDeviceCount == 0) {
+        fprintf(stderr, "no physical device\n");
+        return 1;
+    }
+    memset(&queueCreateInfo, 0, sizeof(queueCreateInfo));
+    queueCreateInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueCount       = 1;
+    queueCreateInfo.pQueuePriorities = &priority;
+    memset(&deviceCreateInfo, 0, sizeof(deviceCreateInfo));
+    deviceCreateInfo.sType                = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos    = &queueCreateInfo;
+    if (vkad::call<&VkadInstanceFunctions::CreateDevice>(instanceFunctions, physicalDevice, &deviceCreateInfo, nullptr, &device) != VK_SUCCESS) {
+        fprintf(stderr, "cannot create a device\n");
+        return 1;
+    }
+    vkad::loadUsedDeviceFunctions(vkad::get<&VkadInstanceFunctions::GetDeviceProcAddr>(instanceFunctions), device, &deviceFunctions);
+    for (i = 0; i < VKAD_DEVICE_FUNCTION_COUNT; ++i) {
+        bool used = vkadDeviceFunctionAvailable(&expectedDevice, (VkadDeviceFunctionId) i) != 0;
+        if ((vkadGetDeviceFunction(&deviceFunctions, (VkadDeviceFunctionId) i) != NULL) != used) {
+            fprintf(stderr, "%s is %s\n", vkadDeviceFunctionName((VkadDeviceFunctionId) i), used ? "NULL" : "loaded");
+            onlyUsed = false;
+        }
+    }
+    check(onlyUsed, "exactly the used members are loaded");
+    check(vkad::get<&VkadDeviceFunctions::CmdDraw>(deviceFunctions) != NULL, "a member read with vkad::get is loaded");
+
+    vkad::call<&VkadDeviceFunctions::DestroyDevice>(deviceFunctions, device, nullptr);
+    vkad::call<&VkadInstanceFunctions::DestroyInstance>(instanceFunctions, instance, nullptr);
+    vkadCloseLibrary(&library);
+    return failures != 0;
+}
@@ -14,7 +14,168 @@
         void vkadLoadInstanceFunctions(PFN_vkGetInstanceProcAddr loader, VkInstance instance, VkadInstanceFunctions* functions);
         void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice device, VkadDeviceFunctions* functions);
     ```
-    The struct will contain function pointers with member names equivalent to the functions of the appropriate access level, but with the `vk` prefix removes (for example. `VkadDeviceFunctions` has a member `CreateCommandPool` of type `PFN_vkCreateCommandPool`, loaded by `vkadLoadDeviceFunctions` to point to `vkCreateCommandPool`). The function will load all of those pointers, including the platform pointers. Pointers of platforms not included with the macros will be loaded anyway for having a fixed size of these structs, but the type of these members will be `PFN_vkVoidFunction` instead of the correct function pointer type. This means that the type definition, althought not the size, of these structure types can differ when vkad is included in different files with inconsistent platform macros. However, all vkad functions are defined with `static`, so there should be no linking issue, merely an issue of inconsistent type definitions when compiling in the same step. (This is to assist linking general purpose libraries with platform specific ones, if they are compiled seperately.)
+    The struct will contain function pointers with member names equivalent to the functions of the appropriate access level, but with the `vk` prefix removes (for example. `VkadDeviceFunctions` has a member `CreateCommandPool` of type `PFN_vkCreateCommandPool`, loaded by `vkadLoadDeviceFunctions` to point to `vkCreateCommandPool`). The function will load all of those pointers, including the platform pointers. Pointers of platforms not included with the macros will be loaded anyway for having a fixed size of these structs, but the type of these members will be `PFN_vkVoidFunction` instead of the correct function pointer type. This means that the type definition, althought not the size, of these structure types can differ when vkad is included in different files with inconsistent platform macros. However, all vkad functions are defined with `static` (unless `VKAD_SPLIT_IMPLEMENTATION` is defined, see below), so there should be no linking issue, merely an issue of inconsistent type definitions when compiling in the same step. (This is to assist linking general purpose libraries with platform specific ones, if they are compiled seperately.)
+    
+    For devices that only enable a few extensions, the lookups of everything else can be skipped with:
+    ```c
+        void vkadLoadDeviceFunctionsFiltered(PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkDeviceCreateInfo* createInfo, uint32_t apiVersion, VkadDeviceFunctions* functions);
+    ```
+    This only loads the functions of the core versions up to `apiVersion` (the version the device is used with, so the lower one of the instance's and the physical device's `apiVersion`) and of the extensions enabled in `createInfo`, all other members are set to `NULL`. Device functions of instance extensions (`VK_EXT_debug_utils`) are always loaded, since they do not show up in the device create info. Passing `NULL` for `createInfo` loads everything, like `vkadLoadDeviceFunctions`.
+    
+    The same works for the instance table:
+    ```c
+        void     vkadLoadInstanceFunctionsFiltered(PFN_vkGetInstanceProcAddr loader, VkInstance instance, const VkInstanceCreateInfo* createInfo, VkadInstanceFunctions* functions);
+        void     vkadCheckPhysicalDeviceFunctions (const VkExtensionProperties* pProperties, uint32_t propertyCount, VkadInstanceFunctionSet* available);
+    ```
+    This only loads the core versions up to the `apiVersion` of `createInfo->pApplicationInfo` (1.0 without one) and the instance extensions enabled in `createInfo`, so a headless instance skips all surface and platform functions. The instance table also holds the physical device commands of device extensions (like `GetPhysicalDeviceFragmentShadingRatesKHR`), which are always loaded, since the loader returns them as soon as one driver has the extension, but they must only be called with physical devices that have it. `vkadCheckPhysicalDeviceFunctions` takes the extension properties of a physical device, as returned by `EnumerateDeviceExtensionProperties` (which the application calls anyway to choose the extensions), and clears the bits of these commands in an availability set (see `pAvailable` below) unless their extension is listed.
+    
+    With `VKAD_LAZY_LOADING` defined, device functions can also be resolved on first use instead of all at creation time:
+    ```c
+        void vkadLoadDeviceFunctionsLazy(PFN_vkGetDeviceProcAddr loader, VkDevice device, VkadDeviceFunctions* functions);
+        void vkadReleaseDeviceFunctions (VkadDeviceFunctions* functions);
+    ```
+    This points every member to a small trampoline, which on its first call looks the function up with `loader`, stores the result in the member and jumps to it, so later calls go directly to the driver. Since the trampolines find the device through the dispatchable handle of the first argument, the struct has to stay at the same address and must not be copied. `vkadReleaseDeviceFunctions` has to be called before the device is destroyed. At most `VKAD_MAX_LAZY_DEVICES` (64 by default, must be the same in all files) devices can be loaded lazily at the same time. Trampolines are available with GCC and Clang on x86-64 and AArch64 outside of Windows; elsewhere, if no slot is free, or if another lazily loaded device has the same dispatch key (the first pointer in the handle, which is the same loader magic for all objects of many drivers opened with `vkadOpenDriver`, so only one of their devices can be loaded lazily at a time), `vkadLoadDeviceFunctionsLazy` loads everything like `vkadLoadDeviceFunctions`.
+    
+    More options are available through the extended load functions:
+    ```c
+        void vkadLoadInstanceFunctionsEx(PFN_vkGetInstanceProcAddr loader, VkInstance instance, const VkadInstanceLoadInfo* loadInfo, VkadInstanceFunctions* functions);
+        void vkadLoadDeviceFunctionsEx  (PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkadDeviceLoadInfo* loadInfo, VkadDeviceFunctions* functions);
+    ```
+    `VkadDeviceLoadInfo` holds the `pCreateInfo` and `apiVersion` of `vkadLoadDeviceFunctionsFiltered` and `VkadInstanceLoadInfo` the `pCreateInfo` of `vkadLoadInstanceFunctionsFiltered`, and both structs hold `flags` and an optional `pAvailable` set. With `VKAD_LOAD_UNSUPPORTED_STUBS_BIT` in `flags`, members that could not be loaded are not set to `NULL`, but to a stub which does nothing and returns `VK_ERROR_EXTENSION_NOT_PRESENT` (or zero for the few commands that return neither `VkResult` nor `void`), so optional commands like `CmdBeginDebugUtilsLabelEXT` can be called without checking first. `pAvailable` (`VkadInstanceFunctionSet` or `VkadDeviceFunctionSet`) receives one bit per member, in the member order, for the functions that were really loaded. The stubs ignore their parameters, so they are not available on 32-bit Windows, where Vulkan uses `__stdcall` (`VKAD_HAS_UNSUPPORTED_STUBS` is `0` there, and the members stay `NULL`). Lazily loaded tables always use the stubs for functions the driver does not have.
+    
+    Every member also has an ID in the enums `VkadInstanceFunctionId` and `VkadDeviceFunctionId`, which count the members in order (for example `VKAD_DEVICE_FUNCTION_ID_CmdDrawMeshTasksEXT`, up to `VKAD_DEVICE_FUNCTION_ID_COUNT`). The IDs index the availability sets and can be used as a dense key for every function:
+    ```c
+        int                vkadInstanceFunctionAvailable(const VkadInstanceFunctionSet* available, VkadInstanceFunctionId id);
+        int                vkadDeviceFunctionAvailable  (const VkadDeviceFunctionSet* available, VkadDeviceFunctionId id);
+        PFN_vkVoidFunction vkadGetInstanceFunction      (const VkadInstanceFunctions* functions, VkadInstanceFunctionId id);
+        PFN_vkVoidFunction vkadGetDeviceFunction        (const VkadDeviceFunctions* functions, VkadDeviceFunctionId id);
+    ```
+    
+    Functions can also be looked up by name in loaded structs, without going through the loader again:
+    ```c
+        PFN_vkVoidFunction vkadFindInstanceFunction  (const VkadInstanceFunctions* functions, const char* name);
+        PFN_vkVoidFunction vkadFindDeviceFunction    (const VkadDeviceFunctions* functions, const char* name);
+        int                vkadFindInstanceFunctionId(const char* name, VkadInstanceFunctionId* id);
+        int                vkadFindDeviceFunctionId  (const char* name, VkadDeviceFunctionId* id);
+        int                vkadFindInstanceFunctionIdByOffset(size_t offset, VkadInstanceFunctionId* id);
+        int                vkadFindDeviceFunctionIdByOffset  (size_t offset, VkadDeviceFunctionId* id);
+        const char*        vkadInstanceFunctionName  (VkadInstanceFunctionId id);
+        const char*        vkadDeviceFunctionName    (VkadDeviceFunctionId id);
+    ```
+    The names are the full names like `"vkCmdDraw"`, and are found with a perfect hash generated over all function names, so a lookup is one hash and one string comparison. The find functions return `NULL` or `0` for names that are not functions of that level. The reverse lookup returns the member name, which is the function name without the `vk` prefix. The ID of a member can also be found from its byte offset in the struct (like `offsetof(VkadDeviceFunctions, CmdDraw)`), which is how the C++ front end below finds it; these return `0` for offsets that are not a member.
+    
+    With `VKAD_HOT_COLD_LAYOUT` defined, `VkadDeviceFunctions` gets a different member order: the commands used for recording and submitting most frames (draws, dispatches, bindings, barriers, render passes, dynamic state and the like) come first, in a block aligned to 64 bytes, and all other members follow from the next cache line on. The member names stay the same, and the function IDs keep the order of the default layout. The struct then has an alignment of 64, so it should not be allocated with a plain `malloc`, and the macro has to be the same in all files that share the struct.
+    
+    The tables of several devices can be loaded at the same time with:
+    ```c
+        void vkadLoadDeviceFunctionsBatch(PFN_vkGetDeviceProcAddr loader, uint32_t deviceCount, const VkDevice* pDevices, const VkadDeviceLoadInfo* pLoadInfos, VkadDeviceFunctions* pFunctions, const VkadExecutor* pExecutor);
+    ```
+    This loads `pFunctions[i]` for `pDevices[i]` with `pLoadInfos[i]` (or everything if `pLoadInfos` is `NULL`), as one task per device. The tasks are run by `pExecutor` if it is not `NULL`; its `pfnParallelFor(pUserData, taskCount, pfnTask, pTaskData)` has to call `pfnTask(pTaskData, i)` for every `i < taskCount`, on any threads, and return when all are done. Without an executor, the tasks are run on up to `VKAD_MAX_LOAD_THREADS` (8 by default) internal threads together with the calling thread if `VKAD_THREAD_POOL` is defined (which needs pthreads, or `windows.h` on Windows), or else one after another. Every task only writes its own table, so the result is the same in all cases.
+    
+    Devices on the same driver usually get the same pointers, so their tables can be shared:
+    ```c
+        const VkadDeviceFunctions* vkadAcquireSharedDeviceFunctions(VkadDeviceFunctionCache* cache, PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkPhysicalDeviceIDProperties* idProperties, const VkPhysicalDeviceDriverProperties* driverProperties, const VkadDeviceLoadInfo* loadInfo, uint32_t verifyCount);
+        void                       vkadReleaseSharedDeviceFunctions(VkadDeviceFunctionCache* cache, const VkadDeviceFunctions* functions);
+    ```
+    The cache holds up to `VKAD_MAX_SHARED_TABLES` (4 by default) reference counted tables, each for one combination of `driverUUID`, `driverID` (from the optional `driverProperties`), loaded function groups, selection and load flags. A device with the same combination as an existing table gets that table without any lookups; otherwise a new table is loaded. With `verifyCount` greater than `0`, that many of the loaded functions of an existing table (spread over all of them, or all if it has fewer) are looked up again for the new device before sharing it. If they differ, or the cache is full, the function returns `NULL`, and the device needs its own table. The returned table must not be modified. Calls with the same cache have to be synchronized by the application.
+    
+    With `VKAD_LIBRARY_LOADING` defined, vkad can also open the Vulkan library itself, so the application needs no link time dependency on it:
+    ```c
+        PFN_vkGetInstanceProcAddr vkadOpenLibrary (const char* path, VkadLibrary* library);
+        void                      vkadCloseLibrary(VkadLibrary* library);
+    ```
+    `vkadOpenLibrary` opens the library at `path`, or, if `path` is `NULL`, the one named by the environment variable `VKAD_VULKAN_LIBRARY`, or else the system's Vulkan loader (`libvulkan.so.1` on Linux, `vulkan-1.dll` on Windows, `libvulkan.dylib` or MoltenVK on Apple platforms), and returns its `vkGetInstanceProcAddr` for `vkadLoadGlobalFunctions`, or `NULL` on failure. On POSIX systems the library is opened with `RTLD_LAZY | RTLD_LOCAL`, so its symbols are bound on first use and do not clash with the application's; the macro needs `dlfcn.h` (and `-ldl` with older C libraries) there, or `windows.h` on Windows. Pointing `path` or the environment variable at a stub library makes it easy to test without a driver.
+    
+    For applications that only use one driver, the Vulkan loader can also be skipped altogether:
+    ```c
+        PFN_vkGetInstanceProcAddr vkadOpenDriver(const char* path, VkadLibrary* library);
+    ```
+    This opens the driver (ICD) library given by `path`, which may be its manifest (`.json`, from which `library_path` is read) or the library itself, or, if `path` is `NULL`, the first entry of `VK_DRIVER_FILES` or `VK_ICD_FILENAMES`. It then negotiates the loader-driver interface version with the driver and returns its `vk_icdGetInstanceProcAddr`, which can be used for `vkadLoadGlobalFunctions` and `vkadLoadInstanceFunctions`; the device functions then come from the driver's own `vkGetDeviceProcAddr`. The library is closed with `vkadCloseLibrary`. This saves the loader's search for manifests and layers and its trampolines, but also leaves out everything the loader adds, like layers and its handling of several drivers. `bench/startup.c` compares the startup time of both paths for a driver.
+    
+    When a driver is linked to the application directly (like SwiftShader for rendering on the CPU), `VKAD_STATIC_DISPATCH` can be defined. Then vkad does not exclude the prototypes of the Vulkan headers (which may also have been included before vkad), and does not define the `vk*` convenience macros described below, so the same code calls the linked functions directly, which allows inlining and link time optimization. The types and load functions stay the same; passing the linked `vkGetInstanceProcAddr` to them fills the tables with the linked functions.
+    
+    Applications that only use a part of the API can leave out whole kinds of extensions at compile time, by defining some of these macros before including vkad:
+    ```c
+        #define VKAD_NO_WSI_EXTENSIONS
+        #define VKAD_NO_VIDEO_EXTENSIONS
+        #define VKAD_NO_RAY_TRACING_EXTENSIONS
+        #define VKAD_NO_VENDOR_EXTENSIONS
+        #define VKAD_NO_GRAPHICS_EXTENSIONS
+    ```
+    They stand for the surface, swapchain, display and presentation extensions, the video extensions, the acceleration structure, ray tracing pipeline and micromap extensions, all extensions that are neither KHR nor EXT, and the KHR and EXT extensions that are only used for rasterization (like dynamic rendering, the dynamic state extensions and mesh shaders). The members of these extensions are then removed from `VkadInstanceFunctions` and `VkadDeviceFunctions`, the load functions do not look them up, and their `vk*` macros are not defined. The function IDs and names stay the same, but `vkadGetInstanceFunction`, `vkadGetDeviceFunction` and the find functions return `NULL` for removed functions, and they are never available. `VKAD_PROFILE_COMPUTE` defines all five macros, `VKAD_PROFILE_HEADLESS_GRAPHICS` the ones for WSI, video and vendor extensions, and `VKAD_PROFILE_FULL` none, which is the default. Since the struct layouts change, the macros have to be the same in all files that share the structs.
+    
+    Both load info structs also have an optional `pSelection` set; if it is not `NULL`, only the functions in it are looked up, and all others are treated like functions of disabled extensions. In C++17, this set can be collected from the code itself:
+    ```cpp
+        vkad::call<&VkadDeviceFunctions::CmdDispatch>(functions, commandBuffer, x, y, z);
+        PFN_vkCmdDraw draw = vkad::get<&VkadDeviceFunctions::CmdDraw>(functions);
+        void vkad::loadUsedInstanceFunctions(PFN_vkGetInstanceProcAddr loader, VkInstance instance, VkadInstanceFunctions* functions);
+        void vkad::loadUsedDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice device, VkadDeviceFunctions* functions);
+    ```
+    `vkad::call` calls a member and `vkad::get` returns it, and every member used with one of them anywhere in the program is added to `vkad::usedInstanceFunctions()` or `vkad::usedDeviceFunctions()` during static initialization, without any list to maintain. The two load functions pass these sets as `pSelection`, so only the functions the program uses are looked up. Calls through the `vk*` macros or the members themselves are not counted, and the sets are only complete once static initialization is over, so the tables should not be loaded from static constructors.
+    
+    The device functions a program really uses can be recorded in one run and preloaded in later ones. With `VKAD_LAZY_LOADING` defined:
+    ```c
+        void vkadGetCalledDeviceFunctions    (const VkadDeviceFunctions* functions, VkadDeviceFunctionSet* called);
+        void vkadLoadDeviceFunctionsPreloaded(PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkadDeviceFunctionSet* preload, VkadDeviceFunctions* functions);
+    ```
+    `vkadGetCalledDeviceFunctions` returns the members of a lazily loaded table that were called so far (for other tables, all members that are not `NULL`). `vkadLoadDeviceFunctionsPreloaded` loads a table lazily like `vkadLoadDeviceFunctionsLazy`, but looks up the functions in `preload` right away, so only the rarely used ones go through the trampolines. This only covers device tables: instance tables are never loaded lazily, so their calls are not recorded and there is nothing for their other members to fall back to. With `VKAD_LOAD_MANIFESTS` defined (which needs `stdio.h`), the sets can be kept in a file:
+    ```c
+        int vkadWriteLoadManifest(const char* path, const VkadInstanceFunctionSet* instanceFunctions, const VkadDeviceFunctionSet* deviceFunctions);
+        int vkadReadLoadManifest (const char* path, VkadInstanceFunctionSet* instanceFunctions, VkadDeviceFunctionSet* deviceFunctions);
+    ```
+    A manifest is a text file with a header line and the name of one function per line, so it can also be edited by hand and stays valid with other versions of vkad (unknown names are skipped). Both sets may be `NULL`, and both functions return `0` on failure. The instance set can be written by hand or from the call counts of an instrumented table (see below) and passed as `pSelection` of `vkadLoadInstanceFunctionsEx`, but then every instance function that is not in it stays `NULL` (or gets a stub), so it has to list every instance function the program can call.
+    
+    To find out which functions a program calls how often and how long they take, define `VKAD_INSTRUMENTATION` (which needs POSIX threads and `clock_gettime`) and use an instrumented copy of a loaded table:
+    ```c
+        int  vkadInstrumentInstanceFunctions (VkInstance instance, const VkadInstanceFunctions* functions, VkadInstanceFunctions* instrumented);
+        int  vkadInstrumentDeviceFunctions   (VkDevice device, const VkadDeviceFunctions* functions, VkadDeviceFunctions* instrumented);
+        void vkadReleaseInstrumentedFunctions(const void* functions);
+        void vkadGetCallStatistics           (VkadCallStatistics* statistics);
+    ```
+    Every member of the instrumented table points to a trampoline that counts the call in a counter of the calling thread, takes the time until the function returns, and forwards all arguments to the member of the original table, which has to stay unchanged and at the same address until it is released with `vkadReleaseInstrumentedFunctions`. The tables without instrumentation are not changed, so the feature costs nothing where it is not used. `vkadGetCallStatistics` adds up the counters of all threads into a call count and a time in nanoseconds for every function ID; the time of a function includes the functions it calls, like callbacks. The trampolines are only available for x86-64 and AArch64 outside of Windows with GCC and Clang, and they replace the return address of the call, so they do not work with hardware shadow stacks (CET). Without them, when all `VKAD_MAX_INSTRUMENTED_TABLES` registrations are in use, or when another instrumented table of the same level has the same dispatch key (as with the lazily loaded tables of drivers opened with `vkadOpenDriver`), the functions return `0` and the instrumented table is a plain copy.
+    
+    The instrumented tables can also record a trace of the single calls:
+    ```c
+        void vkadSetTracing(int enabled);
+        int  vkadWriteTrace(const char* path);
+    ```
+    While tracing is enabled, every call through an instrumented table adds a record with the function, its start and end time and its first argument to a ring buffer of the calling thread, without locks or atomic read-modify-write operations. `vkadWriteTrace` writes the records that were not written before into a file in the JSON format of the Chrome trace viewer, which can also be opened in Perfetto, and returns `0` on failure. It may run while other threads make calls, but not in several threads at once. Every thread keeps the last `VKAD_TRACE_BUFFER_SIZE` records (4096 by default, a power of two), older ones are lost if the trace is not written often enough.
+    
+    Timing every call costs two clock reads and the return trampoline, which is too much for functions like `vkCmdDraw` that are called very often. With sampling, only every N-th call of every function in every thread is timed, and the others are only counted:
+    ```c
+        void vkadSetCallSampling(uint32_t interval);
+    ```
+    The interval can be changed at any time and takes effect for all instrumented tables at once; `0` and `1` time every call again. The countdowns are kept per thread, so sampling needs no atomic operations. `VkadCallCounter::timedCount` holds the number of timed calls, and `nanoseconds` is the time of all calls, estimated from the timed ones. Only timed calls are traced.
+    
+    To see where the time of loading goes, point `pStats` of a load info to a `VkadLoadStats`. The extended load functions then fill it with the number of lookups and how many of them returned a function or `NULL`, the number of members that were skipped by filters, selections or profiles, the time of the whole load function and of the calls of `loader`, and the `VKAD_SLOWEST_LOOKUP_COUNT` slowest lookups by function ID. For device functions, `groupNanoseconds` also splits the time of the lookups by the core version or extension that contains the functions:
+    ```c
+        const char* vkadDeviceFunctionGroupName(uint32_t group);
+    ```
+    This returns names like `"VK_VERSION_1_1"` or `"VK_KHR_swapchain"` for the indices up to `VKAD_DEVICE_FUNCTION_GROUP_COUNT`. If the difference between the whole time and the loader time is large, the time goes to vkad itself; otherwise, tracing the loader or the driver tells more. The times use `CLOCK_MONOTONIC` if `time.h` declares it (on POSIX systems, it may need `_POSIX_C_SOURCE`), and `clock()` otherwise. Shared tables that are found in the cache report zero lookups. Only the load functions that take a load info fill the statistics: `vkadLoadGlobalFunctions`, which only looks up the few global functions, has none, and neither have the lazy loaders, including the lookups `vkadLoadDeviceFunctionsPreloaded` makes right away, so their time has to be taken around the call. `groupNanoseconds` is only filled by device loads and stays zero for instance loads, although the instance functions have groups too.
+    
+    vkad needs no build, but the repository has a CMake build with an interface target `vkad` (which also finds the Vulkan headers) and the benchmarks in `bench`, which run without a GPU on a mock driver:
+    ```sh
+        cmake -S . -B build
+        cmake --build build
+        ctest --test-dir build
+    ```
+    `vkad_mock_driver` is a driver with one physical device, which knows every function but only implements the few the benchmarks need. `VKAD_MOCK_LOOKUP_NANOSECONDS` makes every lookup take the given time, and `VKAD_MOCK_FUNCTIONS` names a load manifest with the only functions the driver has, to model real drivers. `vkad_bench_load <manifest> [runs]` measures the load functions of the three tables, filtered and lazy loading, and the share of the driver in the device loading; `vkad_bench_calls` compares calls through a table, through the `vk*` macros, through the macros with thread-local dispatch and directly to a statically linked driver; `vkad_bench_startup` is the startup benchmark from above; `vkad_test_fold` checks that `VKAD_LOAD_FOLD_ALIASES_BIT` fills `CmdDrawIndirectCount` from a driver that only has `vkCmdDrawIndirectCountKHR`; `vkad_test_filter` checks that a headless instance skips the surface functions and that `vkadCheckPhysicalDeviceFunctions` clears the commands of device extensions the physical device lacks; `vkad_test_used` builds the C++ front end with `-Wall -Wextra -Werror` and checks that `vkad::loadUsedInstanceFunctions` and `vkad::loadUsedDeviceFunctions` load exactly the members used with `vkad::call` and `vkad::get`; `vkad_test_lazy` calls members of a lazily loaded table and checks that exactly these are resolved, recorded, written to a load manifest and preloaded from it; `vkad_test_instrument` checks the call counts, sampling and trace of instrumented tables (and is skipped on platforms without the trampolines); and the target `vkad_size` prints the object size of the load functions for every profile. `ctest` runs every benchmark briefly and every test on the mock driver, the manifest of which is `build/bench/vkad_mock_driver.json`.
+    
+    Including vkad in many files costs compile time for the tables and functions in every one of them. Like other single header libraries, vkad can instead define its functions in only one file: define `VKAD_SPLIT_IMPLEMENTATION` for all files (for example with `target_compile_definitions`), and additionally `VKAD_IMPLEMENTATION` in exactly one of them:
+    ```c
+        #define VKAD_IMPLEMENTATION
+        #include "vkad.h"
+    ```
+    All other files then only get the types, IDs, macros and function declarations, without the tables, the thunks and the platform headers, which also makes vkad suitable for a precompiled header. The file with `VKAD_IMPLEMENTATION` defines the functions with external linkage (and C linkage in C++); `VKAD_API` (`extern` by default) can be defined to give them attributes like `__declspec(dllexport)`. That file has to enable all optional parts (`VKAD_LAZY_LOADING`, `VKAD_INSTRUMENTATION` and so on) that any other file uses. The `VKAD_NO_*_EXTENSIONS` macros, `VKAD_HOT_COLD_LAYOUT` and `VKAD_MAX_SHARED_TABLES` change the structs, so they have to be the same in all files, but the platform macros may still differ between them, since they do not change the size of the structs. Without `VKAD_SPLIT_IMPLEMENTATION`, every file still gets its own static copy of everything.
+    
+    Loading a device table can also overlap with the rest of the initialization:
+    ```c
+        VkadAsyncLoad* vkadLoadDeviceFunctionsAsync(PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkadDeviceLoadInfo* loadInfo, const VkadDeviceFunctionSet* hot, VkadDeviceFunctions* functions);
+        void           vkadWaitDeviceFunctions     (VkadAsyncLoad* load);
+    ```
+    `vkadLoadDeviceFunctionsAsync` loads the members in `hot` (for example a set read from a load manifest, or none if it is `NULL`) before it returns, so they can be called right away, and starts a thread that loads the others with `loadInfo` (or everything if it is `NULL`). The other members must not be used before `vkadWaitDeviceFunctions` has returned, which waits for the thread and frees the handle. `pCreateInfo` and `pSelection` are only read before the function returns, but `pAvailable` and `pStats` are written until the wait. The thread needs `VKAD_THREAD_POOL`; without it, or if no thread can be started, the whole table is loaded at once, and the function returns `NULL`, for which the wait does nothing.
+    
+    Many commands were promoted to core from extensions, and both tables have a member for each name, like `CmdDrawIndirectCount`, `CmdDrawIndirectCountKHR` and `CmdDrawIndirectCountAMD`, which the driver resolves separately. With `VKAD_LOAD_FOLD_ALIASES_BIT` in `flags`, the extended load functions look up each such family once: the core name first, then the KHR, EXT and vendor aliases until one returns a function, which is stored in all members of the family (and all of them are marked in `pAvailable`). Only names whose group is enabled by `pCreateInfo` are tried, so a version 1.1 device with `VK_KHR_draw_indirect_count` gets the KHR function in `CmdDrawIndirectCount` too, and a family is loaded if any of its members is in `pSelection`. Code can then call the core member on any driver that has one of the names. Lazily loaded tables do not fold aliases.
     
     By default, vkad defines cnvenience macros, so that if you set:
     ```c
@@ -23,18 +184,25 @@
         #define VKAD_USER_DEVICE   my_vkadDeviceFunctions
     ```
     with `my_vkadGlobalFunctions`, `my_vkadInstanceFunctions` and `my_vkadDeviceFunctions` pointing to a struct of the indicated type somewhere, then a call to `vkCreateCommandPool` will in fact be resolved to `my_vkadDeviceFunctions.CreateCommandPool`. If this macro resolution is not desired, and the user wants to create an alternative resolution to these shorter named symbols, all of these definitions can be suppressed by defining `VKAD_NO_GLOBAL_SYMBOLS`.
+    
+    With `VKAD_THREAD_LOCAL_DISPATCH` defined, vkad defines `VKAD_USER_DEVICE` itself (so it must not be defined by the user), and the `vk*` device macros call through a thread-local pointer to the current table of the calling thread, which is set with:
+    ```c
+        const VkadDeviceFunctions* vkadMakeCurrent(const VkadDeviceFunctions* functions);
+    ```
+    This returns the previous table of the thread, so a function can switch to another device and back. Every thread starts without a table, so each thread that calls `vk*` device commands has to make a table current first, and then it can never use another thread's device by mistake. The pointer uses the initial-exec TLS model with GCC and Clang, so reading it is one instruction relative to the thread pointer; a library that is loaded with `dlopen` may need the general model instead, which it gets by defining `VKAD_TLS_MODEL` empty. The global and instance macros still use `VKAD_USER_GLOBAL` and `VKAD_USER_INSTANCE`. Without `VKAD_SPLIT_IMPLEMENTATION`, every file has its own pointer, like the rest of vkad, so a multi-file program should use the split mode for this.
 */
 
 
 
 #pragma once
 
-/* only include vkad if the Vulkan headers are not included in another way, because we include them again, and they may have been included with prototypes */
-#if !(defined(VKAD_H)) && !(defined(VK_VERSION_1_0))
+/* only include vkad if the Vulkan headers are not included in another way, because we include them again, and they may have been included with prototypes;
+   with static dispatch the prototypes are used, so there they may have been included before */
+#if !(defined(VKAD_H)) && (!(defined(VK_VERSION_1_0)) || defined(VKAD_STATIC_DISPATCH))
 #define VKAD_H
 
 /* revision date */
-#define VKAD_HEADER_REVISION 0x20250323
+#define VKAD_HEADER_REVISION 0x20261017
 
 #ifdef __cplusplus
 #define REINTERPRET_CAST(X,Y) reinterpret_cast<X>(Y)
@@ -42,6 +210,58 @@
 #define REINTERPRET_CAST(X,Y) ((X) Y)
 #endif
 
+/* with VKAD_SPLIT_IMPLEMENTATION defined in all files, vkad only declares its functions, and the one file that also defines VKAD_IMPLEMENTATION defines them
+   with external linkage; otherwise every file gets its own static copy of everything */
+#ifdef VKAD_SPLIT_IMPLEMENTATION
+#ifndef VKAD_API
+#define VKAD_API extern
+#endif
+#ifdef VKAD_IMPLEMENTATION
+#define VKAD_HAS_DEFINITIONS 1
+#else
+#define VKAD_HAS_DEFINITIONS 0
+#endif
+#else
+#define VKAD_API static
+#define VKAD_HAS_DEFINITIONS 1
+#endif
+
+/* only the definitions need the platform libraries */
+#if VKAD_HAS_DEFINITIONS
+/* the internal threads of the batch and asynchronous loading are optional, since they need the platform thread library */
+#ifdef VKAD_THREAD_POOL
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#endif
+/* the same for opening the Vulkan library */
+#ifdef VKAD_LIBRARY_LOADING
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+#endif
+/* and for reading and writing load manifests */
+#ifdef VKAD_LOAD_MANIFESTS
+#include <stdio.h>
+#endif
+/* the instrumentation keeps its counters per thread, needs a monotonic clock and writes traces */
+#ifdef VKAD_INSTRUMENTATION
+#include <stdio.h>
+#if !defined(_WIN32)
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#endif
+#endif
+#endif /* VKAD_HAS_DEFINITIONS */
+
 #if defined(__cplusplus)
 extern "C" {
 #endif
@@ -51,17 +271,45 @@ extern "C" {
 #error Nvidia Sci Platform only supported on Vulkan SC, not main Vulkan!
 #endif
 
-/* unconditionally excölude prototypes. */
-#ifndef VK_NO_PROTOTYPES
+/* unconditionally excölude prototypes, except for static dispatch, where the vk* names are the functions of a driver linked to the application. */
+#if !defined(VK_NO_PROTOTYPES) && !defined(VKAD_STATIC_DISPATCH)
 #define VK_NO_PROTOTYPES
 #endif
 
 #include <vulkan/vulkan.h>
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
 
 #if VK_HEADER_VERSION < 309
 #error "Vulkan headers are out of date! Download at least 1.4.309."
 #endif
 
+/* profiles: shorthands for the VKAD_NO_*_EXTENSIONS macros, which leave out the members, load entries and vk* macros of a kind of extensions.
+   The function IDs keep their values in every profile, and the left out functions are never loaded. */
+#if defined(VKAD_PROFILE_FULL) && (defined(VKAD_PROFILE_COMPUTE) || defined(VKAD_PROFILE_HEADLESS_GRAPHICS))
+#error "VKAD_PROFILE_FULL can not be combined with another profile!"
+#endif
+#if defined(VKAD_PROFILE_COMPUTE) || defined(VKAD_PROFILE_HEADLESS_GRAPHICS)
+#ifndef VKAD_NO_WSI_EXTENSIONS
+#define VKAD_NO_WSI_EXTENSIONS
+#endif
+#ifndef VKAD_NO_VIDEO_EXTENSIONS
+#define VKAD_NO_VIDEO_EXTENSIONS
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+#define VKAD_NO_VENDOR_EXTENSIONS
+#endif
+#endif
+#ifdef VKAD_PROFILE_COMPUTE
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
+#define VKAD_NO_RAY_TRACING_EXTENSIONS
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+#define VKAD_NO_GRAPHICS_EXTENSIONS
+#endif
+#endif
+
 /* define all platform pointers as void functions in case the headers do not get included; since they have to be convertible from that by a cast, the code should be compatible */
 #ifndef VK_USE_PLATFORM_ANDROID_KHR
 typedef PFN_vkVoidFunction PFN_vkCreateAndroidSurfaceKHR;
@@ -187,6 +435,7 @@ typedef struct VkadInstanceFunctions {
     PFN_vkGetPhysicalDeviceExternalSemaphoreProperties                      GetPhysicalDeviceExternalSemaphoreProperties                    ;
     /* VK_VERSION_1_3 */                                                    
     PFN_vkGetPhysicalDeviceToolProperties                                   GetPhysicalDeviceToolProperties                                 ;
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_KHR_surface spec_version 25  */                                                                                                   
     PFN_vkDestroySurfaceKHR                                                 DestroySurfaceKHR                                               ;
     PFN_vkGetPhysicalDeviceSurfaceSupportKHR                                GetPhysicalDeviceSurfaceSupportKHR                              ;
@@ -203,9 +452,12 @@ typedef struct VkadInstanceFunctions {
     PFN_vkCreateDisplayModeKHR                                              CreateDisplayModeKHR                                            ;
     PFN_vkGetDisplayPlaneCapabilitiesKHR                                    GetDisplayPlaneCapabilitiesKHR                                  ;
     PFN_vkCreateDisplayPlaneSurfaceKHR                                      CreateDisplayPlaneSurfaceKHR                                    ;
+#endif
+#ifndef VKAD_NO_VIDEO_EXTENSIONS
     /* VK_KHR_video_queue spec_version 8 */                                                                                                 
     PFN_vkGetPhysicalDeviceVideoCapabilitiesKHR                             GetPhysicalDeviceVideoCapabilitiesKHR                           ;
     PFN_vkGetPhysicalDeviceVideoFormatPropertiesKHR                         GetPhysicalDeviceVideoFormatPropertiesKHR                       ;
+#endif
     /* VK_KHR_get_physical_device_properties2 spec_version 2 */                                                                             
     PFN_vkGetPhysicalDeviceFeatures2KHR                                     GetPhysicalDeviceFeatures2KHR                                   ;
     PFN_vkGetPhysicalDeviceProperties2KHR                                   GetPhysicalDeviceProperties2KHR                                 ;
@@ -225,6 +477,7 @@ typedef struct VkadInstanceFunctions {
     /* VK_KHR_performance_query spec_version 1 */
     PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR     EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR   ;
     PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR             GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR           ;
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_KHR_get_surface_capabilities2 spec_version 1 */
     PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR                          GetPhysicalDeviceSurfaceCapabilities2KHR                        ;
     PFN_vkGetPhysicalDeviceSurfaceFormats2KHR                               GetPhysicalDeviceSurfaceFormats2KHR                             ;
@@ -233,10 +486,15 @@ typedef struct VkadInstanceFunctions {
     PFN_vkGetPhysicalDeviceDisplayPlaneProperties2KHR                       GetPhysicalDeviceDisplayPlaneProperties2KHR                     ;  
     PFN_vkGetDisplayModeProperties2KHR                                      GetDisplayModeProperties2KHR                                    ;
     PFN_vkGetDisplayPlaneCapabilities2KHR                                   GetDisplayPlaneCapabilities2KHR                                 ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_KHR_fragment_shading_rate spec_version 2 */
     PFN_vkGetPhysicalDeviceFragmentShadingRatesKHR                          GetPhysicalDeviceFragmentShadingRatesKHR                        ;
+#endif
+#ifndef VKAD_NO_VIDEO_EXTENSIONS
     /* VK_KHR_video_encode_queue spec_version 12 */
     PFN_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR             GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR           ;
+#endif
     /* VK_KHR_cooperative_matrix spec_version 2 */
     PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR                   GetPhysicalDeviceCooperativeMatrixPropertiesKHR                 ;
     /* VK_KHR_calibrated_timestamps spec_version 1 */
@@ -245,33 +503,46 @@ typedef struct VkadInstanceFunctions {
     PFN_vkCreateDebugReportCallbackEXT                                      CreateDebugReportCallbackEXT                                    ;
     PFN_vkDestroyDebugReportCallbackEXT                                     DestroyDebugReportCallbackEXT                                   ;
     PFN_vkDebugReportMessageEXT                                             DebugReportMessageEXT                                           ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_external_memory_capabilities spec_version 1 */
     PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV                  GetPhysicalDeviceExternalImageFormatPropertiesNV                ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_EXT_direct_mode_display spec_version 1 */
     PFN_vkReleaseDisplayEXT                                                 ReleaseDisplayEXT                                               ;
     /* VK_EXT_display_surface_counter spec_version 1 */
     PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT                          GetPhysicalDeviceSurfaceCapabilities2EXT                        ;
+#endif
     /* VK_EXT_debug_utils spec_version 2 */
     PFN_vkCreateDebugUtilsMessengerEXT                                      CreateDebugUtilsMessengerEXT                                    ;
     PFN_vkDestroyDebugUtilsMessengerEXT                                     DestroyDebugUtilsMessengerEXT                                   ;
     PFN_vkSubmitDebugUtilsMessageEXT                                        SubmitDebugUtilsMessageEXT                                      ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_EXT_sample_locations spec_version 1 */
     PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT                         GetPhysicalDeviceMultisamplePropertiesEXT                       ;
+#endif
     /* VK_EXT_calibrated_timestamps spec_version 2 */
     PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT                      GetPhysicalDeviceCalibrateableTimeDomainsEXT                    ;
     /* VK_EXT_tooling_info spec_version 1 */
     PFN_vkGetPhysicalDeviceToolPropertiesEXT                                GetPhysicalDeviceToolPropertiesEXT                              ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_cooperative_matrix spec_version 1 */
     PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV                    GetPhysicalDeviceCooperativeMatrixPropertiesNV                  ;
     /* VK_NV_coverage_reduction_mode spec_version 1 */
     PFN_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV   GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_EXT_headless_surface spec_version 1 */
     PFN_vkCreateHeadlessSurfaceEXT                                          CreateHeadlessSurfaceEXT                                        ;
     /* VK_EXT_acquire_drm_display spec_version 1 */
     PFN_vkAcquireDrmDisplayEXT                                              AcquireDrmDisplayEXT                                            ;
     PFN_vkGetDrmDisplayEXT                                                  GetDrmDisplayEXT                                                ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_optical_flow spec_version 1 */
     PFN_vkGetPhysicalDeviceOpticalFlowImageFormatsNV                        GetPhysicalDeviceOpticalFlowImageFormatsNV                      ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_KHR_android_surface spec_version 6 */
     PFN_vkCreateAndroidSurfaceKHR                                           CreateAndroidSurfaceKHR                                         ;
     /* VK_FUCHSIA_imagepipe_surface spec_version 1 */
@@ -312,17 +583,116 @@ typedef struct VkadInstanceFunctions {
     /* VK_QNX_screen_surface spec_version 1 */
     PFN_vkCreateScreenSurfaceQNX                                            CreateScreenSurfaceQNX                                          ;
     PFN_vkGetPhysicalDeviceScreenPresentationSupportQNX                     GetPhysicalDeviceScreenPresentationSupportQNX                   ;
+#endif
         /* Additions from 1.3.284 to 1.4.309: */
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_cooperative_vector spec_version 4 */
     PFN_vkGetPhysicalDeviceCooperativeVectorPropertiesNV                    GetPhysicalDeviceCooperativeVectorPropertiesNV                  ;
     /* VK_NV_cooperative_matrix2 spec_version 1 */
     PFN_vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV  GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV;
+#endif
 } VkadInstanceFunctions;
+#ifdef VKAD_HOT_COLD_LAYOUT
+#if defined(__cplusplus) && __cplusplus >= 201103L
+#define VKAD_ALIGNAS(N) alignas(N)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define VKAD_ALIGNAS(N) _Alignas(N)
+#elif defined(_MSC_VER)
+#define VKAD_ALIGNAS(N) __declspec(align(N))
+#else
+#define VKAD_ALIGNAS(N) __attribute__((aligned(N)))
+#endif
+/* the same members, but the ones used for recording and submitting most frames come first, starting on a cache line, and the others follow from the next cache line on */
 typedef struct VkadDeviceFunctions {
+    /* hot: recording and submission */
+    VKAD_ALIGNAS(64) PFN_vkBeginCommandBuffer                               BeginCommandBuffer                                              ;
+    PFN_vkEndCommandBuffer                                                  EndCommandBuffer                                                ;
+    PFN_vkResetCommandPool                                                  ResetCommandPool                                                ;
+    PFN_vkQueueSubmit                                                       QueueSubmit                                                     ;
+    PFN_vkQueueSubmit2                                                      QueueSubmit2                                                    ;
+#ifndef VKAD_NO_WSI_EXTENSIONS
+    PFN_vkAcquireNextImageKHR                                               AcquireNextImageKHR                                             ;
+    PFN_vkQueuePresentKHR                                                   QueuePresentKHR                                                 ;
+#endif
+    PFN_vkWaitForFences                                                     WaitForFences                                                   ;
+    PFN_vkResetFences                                                       ResetFences                                                     ;
+    /* hot: render passes */
+    PFN_vkCmdBeginRendering                                                 CmdBeginRendering                                               ;
+    PFN_vkCmdEndRendering                                                   CmdEndRendering                                                 ;
+    PFN_vkCmdBeginRenderPass                                                CmdBeginRenderPass                                              ;
+    PFN_vkCmdNextSubpass                                                    CmdNextSubpass                                                  ;
+    PFN_vkCmdEndRenderPass                                                  CmdEndRenderPass                                                ;
+    PFN_vkCmdBeginRenderPass2                                               CmdBeginRenderPass2                                             ;
+    PFN_vkCmdEndRenderPass2                                                 CmdEndRenderPass2                                               ;
+    /* hot: bindings */
+    PFN_vkCmdBindPipeline                                                   CmdBindPipeline                                                 ;
+    PFN_vkCmdBindDescriptorSets                                             CmdBindDescriptorSets                                           ;
+    PFN_vkCmdBindVertexBuffers                                              CmdBindVertexBuffers                                            ;
+    PFN_vkCmdBindIndexBuffer                                                CmdBindIndexBuffer                                              ;
+    PFN_vkCmdPushConstants                                                  CmdPushConstants                                                ;
+    PFN_vkCmdBindVertexBuffers2                                             CmdBindVertexBuffers2                                           ;
+    PFN_vkCmdBindDescriptorSets2                                            CmdBindDescriptorSets2                                          ;
+    PFN_vkCmdPushConstants2                                                 CmdPushConstants2                                               ;
+    PFN_vkCmdPushDescriptorSet                                              CmdPushDescriptorSet                                            ;
+    PFN_vkCmdBindDescriptorBuffersEXT                                       CmdBindDescriptorBuffersEXT                                     ;
+    PFN_vkCmdSetDescriptorBufferOffsetsEXT                                  CmdSetDescriptorBufferOffsetsEXT                                ;
+    PFN_vkCmdBindShadersEXT                                                 CmdBindShadersEXT                                               ;
+    /* hot: draws and dispatches */
+    PFN_vkCmdDraw                                                           CmdDraw                                                         ;
+    PFN_vkCmdDrawIndexed                                                    CmdDrawIndexed                                                  ;
+    PFN_vkCmdDrawIndirect                                                   CmdDrawIndirect                                                 ;
+    PFN_vkCmdDrawIndexedIndirect                                            CmdDrawIndexedIndirect                                          ;
+    PFN_vkCmdDrawIndirectCount                                              CmdDrawIndirectCount                                            ;
+    PFN_vkCmdDrawIndexedIndirectCount                                       CmdDrawIndexedIndirectCount                                     ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    PFN_vkCmdDrawMeshTasksEXT                                               CmdDrawMeshTasksEXT                                             ;
+    PFN_vkCmdDrawMeshTasksIndirectEXT                                       CmdDrawMeshTasksIndirectEXT                                     ;
+    PFN_vkCmdDrawMeshTasksIndirectCountEXT                                  CmdDrawMeshTasksIndirectCountEXT                                ;
+#endif
+    PFN_vkCmdDispatch                                                       CmdDispatch                                                     ;
+    PFN_vkCmdDispatchIndirect                                               CmdDispatchIndirect                                             ;
+    /* hot: barriers */
+    PFN_vkCmdPipelineBarrier                                                CmdPipelineBarrier                                              ;
+    PFN_vkCmdPipelineBarrier2                                               CmdPipelineBarrier2                                             ;
+    /* hot: dynamic state */
+    PFN_vkCmdSetViewport                                                    CmdSetViewport                                                  ;
+    PFN_vkCmdSetScissor                                                     CmdSetScissor                                                   ;
+    PFN_vkCmdSetViewportWithCount                                           CmdSetViewportWithCount                                         ;
+    PFN_vkCmdSetScissorWithCount                                            CmdSetScissorWithCount                                          ;
+    PFN_vkCmdSetCullMode                                                    CmdSetCullMode                                                  ;
+    PFN_vkCmdSetFrontFace                                                   CmdSetFrontFace                                                 ;
+    PFN_vkCmdSetPrimitiveTopology                                           CmdSetPrimitiveTopology                                         ;
+    PFN_vkCmdSetDepthTestEnable                                             CmdSetDepthTestEnable                                           ;
+    PFN_vkCmdSetDepthWriteEnable                                            CmdSetDepthWriteEnable                                          ;
+    PFN_vkCmdSetDepthCompareOp                                              CmdSetDepthCompareOp                                            ;
+    PFN_vkCmdSetStencilTestEnable                                           CmdSetStencilTestEnable                                         ;
+    PFN_vkCmdSetStencilOp                                                   CmdSetStencilOp                                                 ;
+    PFN_vkCmdSetStencilReference                                            CmdSetStencilReference                                          ;
+    PFN_vkCmdSetDepthBias                                                   CmdSetDepthBias                                                 ;
+    PFN_vkCmdSetBlendConstants                                              CmdSetBlendConstants                                            ;
+    PFN_vkCmdSetLineWidth                                                   CmdSetLineWidth                                                 ;
+    PFN_vkCmdSetDepthBiasEnable                                             CmdSetDepthBiasEnable                                           ;
+    PFN_vkCmdSetRasterizerDiscardEnable                                     CmdSetRasterizerDiscardEnable                                   ;
+    PFN_vkCmdSetPrimitiveRestartEnable                                      CmdSetPrimitiveRestartEnable                                    ;
+    PFN_vkCmdSetStencilCompareMask                                          CmdSetStencilCompareMask                                        ;
+    PFN_vkCmdSetStencilWriteMask                                            CmdSetStencilWriteMask                                          ;
+    PFN_vkCmdSetDepthBounds                                                 CmdSetDepthBounds                                               ;
+    PFN_vkCmdSetDepthBoundsTestEnable                                       CmdSetDepthBoundsTestEnable                                     ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    PFN_vkCmdSetVertexInputEXT                                              CmdSetVertexInputEXT                                            ;
+#endif
+    /* hot: queries and labels */
+    PFN_vkCmdBeginQuery                                                     CmdBeginQuery                                                   ;
+    PFN_vkCmdEndQuery                                                       CmdEndQuery                                                     ;
+    PFN_vkCmdWriteTimestamp                                                 CmdWriteTimestamp                                               ;
+    PFN_vkCmdWriteTimestamp2                                                CmdWriteTimestamp2                                              ;
+    PFN_vkCmdBeginDebugUtilsLabelEXT                                        CmdBeginDebugUtilsLabelEXT                                      ;
+    PFN_vkCmdEndDebugUtilsLabelEXT                                          CmdEndDebugUtilsLabelEXT                                        ;
+    PFN_vkCmdInsertDebugUtilsLabelEXT                                       CmdInsertDebugUtilsLabelEXT                                     ;
+    /* cold: everything else, in the usual order */
     /* VK_VERSION_1_0 */
-    PFN_vkDestroyDevice                                                     DestroyDevice                                                   ;
+    VKAD_ALIGNAS(64) PFN_vkDestroyDevice                                    DestroyDevice                                                   ;
     PFN_vkGetDeviceQueue                                                    GetDeviceQueue                                                  ;
-    PFN_vkQueueSubmit                                                       QueueSubmit                                                     ;
     PFN_vkQueueWaitIdle                                                     QueueWaitIdle                                                   ;
     PFN_vkDeviceWaitIdle                                                    DeviceWaitIdle                                                  ;
     PFN_vkAllocateMemory                                                    AllocateMemory                                                  ;
@@ -340,9 +710,7 @@ typedef struct VkadDeviceFunctions {
     PFN_vkQueueBindSparse                                                   QueueBindSparse                                                 ;
     PFN_vkCreateFence                                                       CreateFence                                                     ;
     PFN_vkDestroyFence                                                      DestroyFence                                                    ;
-    PFN_vkResetFences                                                       ResetFences                                                     ;
     PFN_vkGetFenceStatus                                                    GetFenceStatus                                                  ;
-    PFN_vkWaitForFences                                                     WaitForFences                                                   ;
     PFN_vkCreateSemaphore                                                   CreateSemaphore                                                 ;
     PFN_vkDestroySemaphore                                                  DestroySemaphore                                                ;
     PFN_vkCreateEvent                                                       CreateEvent                                                     ;
@@ -390,31 +758,9 @@ typedef struct VkadDeviceFunctions {
     PFN_vkGetRenderAreaGranularity                                          GetRenderAreaGranularity                                        ;
     PFN_vkCreateCommandPool                                                 CreateCommandPool                                               ;
     PFN_vkDestroyCommandPool                                                DestroyCommandPool                                              ;
-    PFN_vkResetCommandPool                                                  ResetCommandPool                                                ;
     PFN_vkAllocateCommandBuffers                                            AllocateCommandBuffers                                          ;
     PFN_vkFreeCommandBuffers                                                FreeCommandBuffers                                              ;
-    PFN_vkBeginCommandBuffer                                                BeginCommandBuffer                                              ;
-    PFN_vkEndCommandBuffer                                                  EndCommandBuffer                                                ;
     PFN_vkResetCommandBuffer                                                ResetCommandBuffer                                              ;
-    PFN_vkCmdBindPipeline                                                   CmdBindPipeline                                                 ;
-    PFN_vkCmdSetViewport                                                    CmdSetViewport                                                  ;
-    PFN_vkCmdSetScissor                                                     CmdSetScissor                                                   ;
-    PFN_vkCmdSetLineWidth                                                   CmdSetLineWidth                                                 ;
-    PFN_vkCmdSetDepthBias                                                   CmdSetDepthBias                                                 ;
-    PFN_vkCmdSetBlendConstants                                              CmdSetBlendConstants                                            ;
-    PFN_vkCmdSetDepthBounds                                                 CmdSetDepthBounds                                               ;
-    PFN_vkCmdSetStencilCompareMask                                          CmdSetStencilCompareMask                                        ;
-    PFN_vkCmdSetStencilWriteMask                                            CmdSetStencilWriteMask                                          ;
-    PFN_vkCmdSetStencilReference                                            CmdSetStencilReference                                          ;
-    PFN_vkCmdBindDescriptorSets                                             CmdBindDescriptorSets                                           ;
-    PFN_vkCmdBindIndexBuffer                                                CmdBindIndexBuffer                                              ;
-    PFN_vkCmdBindVertexBuffers                                              CmdBindVertexBuffers                                            ;
-    PFN_vkCmdDraw                                                           CmdDraw                                                         ;
-    PFN_vkCmdDrawIndexed                                                    CmdDrawIndexed                                                  ;
-    PFN_vkCmdDrawIndirect                                                   CmdDrawIndirect                                                 ;
-    PFN_vkCmdDrawIndexedIndirect                                            CmdDrawIndexedIndirect                                          ;
-    PFN_vkCmdDispatch                                                       CmdDispatch                                                     ;
-    PFN_vkCmdDispatchIndirect                                               CmdDispatchIndirect                                             ;
     PFN_vkCmdCopyBuffer                                                     CmdCopyBuffer                                                   ;
     PFN_vkCmdCopyImage                                                      CmdCopyImage                                                    ;
     PFN_vkCmdBlitImage                                                      CmdBlitImage                                                    ;
@@ -429,16 +775,8 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdSetEvent                                                       CmdSetEvent                                                     ;
     PFN_vkCmdResetEvent                                                     CmdResetEvent                                                   ;
     PFN_vkCmdWaitEvents                                                     CmdWaitEvents                                                   ;
-    PFN_vkCmdPipelineBarrier                                                CmdPipelineBarrier                                              ;
-    PFN_vkCmdBeginQuery                                                     CmdBeginQuery                                                   ;
-    PFN_vkCmdEndQuery                                                       CmdEndQuery                                                     ;
     PFN_vkCmdResetQueryPool                                                 CmdResetQueryPool                                               ;
-    PFN_vkCmdWriteTimestamp                                                 CmdWriteTimestamp                                               ;
     PFN_vkCmdCopyQueryPoolResults                                           CmdCopyQueryPoolResults                                         ;
-    PFN_vkCmdPushConstants                                                  CmdPushConstants                                                ;
-    PFN_vkCmdBeginRenderPass                                                CmdBeginRenderPass                                              ;
-    PFN_vkCmdNextSubpass                                                    CmdNextSubpass                                                  ;
-    PFN_vkCmdEndRenderPass                                                  CmdEndRenderPass                                                ;
     PFN_vkCmdExecuteCommands                                                CmdExecuteCommands                                              ;
     /* VK_VERSION_1_1 */
     PFN_vkBindBufferMemory2                                                 BindBufferMemory2                                               ;
@@ -458,12 +796,8 @@ typedef struct VkadDeviceFunctions {
     PFN_vkUpdateDescriptorSetWithTemplate                                   UpdateDescriptorSetWithTemplate                                 ;
     PFN_vkGetDescriptorSetLayoutSupport                                     GetDescriptorSetLayoutSupport                                   ;
     /* VK_VERSION_1_2 */
-    PFN_vkCmdDrawIndirectCount                                              CmdDrawIndirectCount                                            ;
-    PFN_vkCmdDrawIndexedIndirectCount                                       CmdDrawIndexedIndirectCount                                     ;
     PFN_vkCreateRenderPass2                                                 CreateRenderPass2                                               ;
-    PFN_vkCmdBeginRenderPass2                                               CmdBeginRenderPass2                                             ;
     PFN_vkCmdNextSubpass2                                                   CmdNextSubpass2                                                 ;
-    PFN_vkCmdEndRenderPass2                                                 CmdEndRenderPass2                                               ;
     PFN_vkResetQueryPool                                                    ResetQueryPool                                                  ;
     PFN_vkGetSemaphoreCounterValue                                          GetSemaphoreCounterValue                                        ;
     PFN_vkWaitSemaphores                                                    WaitSemaphores                                                  ;
@@ -479,46 +813,27 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdSetEvent2                                                      CmdSetEvent2                                                    ;
     PFN_vkCmdResetEvent2                                                    CmdResetEvent2                                                  ;
     PFN_vkCmdWaitEvents2                                                    CmdWaitEvents2                                                  ;
-    PFN_vkCmdPipelineBarrier2                                               CmdPipelineBarrier2                                             ;
-    PFN_vkCmdWriteTimestamp2                                                CmdWriteTimestamp2                                              ;
-    PFN_vkQueueSubmit2                                                      QueueSubmit2                                                    ;
     PFN_vkCmdCopyBuffer2                                                    CmdCopyBuffer2                                                  ;
     PFN_vkCmdCopyImage2                                                     CmdCopyImage2                                                   ;
     PFN_vkCmdCopyBufferToImage2                                             CmdCopyBufferToImage2                                           ;
     PFN_vkCmdCopyImageToBuffer2                                             CmdCopyImageToBuffer2                                           ;
     PFN_vkCmdBlitImage2                                                     CmdBlitImage2                                                   ;
     PFN_vkCmdResolveImage2                                                  CmdResolveImage2                                                ;
-    PFN_vkCmdBeginRendering                                                 CmdBeginRendering                                               ;
-    PFN_vkCmdEndRendering                                                   CmdEndRendering                                                 ;
-    PFN_vkCmdSetCullMode                                                    CmdSetCullMode                                                  ;
-    PFN_vkCmdSetFrontFace                                                   CmdSetFrontFace                                                 ;
-    PFN_vkCmdSetPrimitiveTopology                                           CmdSetPrimitiveTopology                                         ;
-    PFN_vkCmdSetViewportWithCount                                           CmdSetViewportWithCount                                         ;
-    PFN_vkCmdSetScissorWithCount                                            CmdSetScissorWithCount                                          ;
-    PFN_vkCmdBindVertexBuffers2                                             CmdBindVertexBuffers2                                           ;
-    PFN_vkCmdSetDepthTestEnable                                             CmdSetDepthTestEnable                                           ;
-    PFN_vkCmdSetDepthWriteEnable                                            CmdSetDepthWriteEnable                                          ;
-    PFN_vkCmdSetDepthCompareOp                                              CmdSetDepthCompareOp                                            ;
-    PFN_vkCmdSetDepthBoundsTestEnable                                       CmdSetDepthBoundsTestEnable                                     ;
-    PFN_vkCmdSetStencilTestEnable                                           CmdSetStencilTestEnable                                         ;
-    PFN_vkCmdSetStencilOp                                                   CmdSetStencilOp                                                 ;
-    PFN_vkCmdSetRasterizerDiscardEnable                                     CmdSetRasterizerDiscardEnable                                   ;
-    PFN_vkCmdSetDepthBiasEnable                                             CmdSetDepthBiasEnable                                           ;
-    PFN_vkCmdSetPrimitiveRestartEnable                                      CmdSetPrimitiveRestartEnable                                    ;
     PFN_vkGetDeviceBufferMemoryRequirements                                 GetDeviceBufferMemoryRequirements                               ;
     PFN_vkGetDeviceImageMemoryRequirements                                  GetDeviceImageMemoryRequirements                                ;
     PFN_vkGetDeviceImageSparseMemoryRequirements                            GetDeviceImageSparseMemoryRequirements                          ;
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_KHR_swapchain spec_version 70  */
     PFN_vkCreateSwapchainKHR                                                CreateSwapchainKHR                                              ;
     PFN_vkDestroySwapchainKHR                                               DestroySwapchainKHR                                             ;
     PFN_vkGetSwapchainImagesKHR                                             GetSwapchainImagesKHR                                           ;
-    PFN_vkAcquireNextImageKHR                                               AcquireNextImageKHR                                             ;
-    PFN_vkQueuePresentKHR                                                   QueuePresentKHR                                                 ;
     PFN_vkGetDeviceGroupPresentCapabilitiesKHR                              GetDeviceGroupPresentCapabilitiesKHR                            ;
     PFN_vkGetDeviceGroupSurfacePresentModesKHR                              GetDeviceGroupSurfacePresentModesKHR                            ;
     PFN_vkAcquireNextImage2KHR                                              AcquireNextImage2KHR                                            ;
     /* VK_KHR_display_swapchain spec_version 10  */
     PFN_vkCreateSharedSwapchainsKHR                                         CreateSharedSwapchainsKHR                                       ;
+#endif
+#ifndef VKAD_NO_VIDEO_EXTENSIONS
     /* VK_KHR_video_queue spec_version 8 */
     PFN_vkCreateVideoSessionKHR                                             CreateVideoSessionKHR                                           ;
     PFN_vkDestroyVideoSessionKHR                                            DestroyVideoSessionKHR                                          ;
@@ -532,9 +847,12 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdControlVideoCodingKHR                                          CmdControlVideoCodingKHR                                        ;
     /* VK_KHR_video_decode_queue spec_version 8 */
     PFN_vkCmdDecodeVideoKHR                                                 CmdDecodeVideoKHR                                               ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_KHR_dynamic_rendering spec_version 1 */
     PFN_vkCmdBeginRenderingKHR                                              CmdBeginRenderingKHR                                            ;
     PFN_vkCmdEndRenderingKHR                                                CmdEndRenderingKHR                                              ;
+#endif
     /* VK_KHR_device_group spec_version 4 */
     PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR                               GetDeviceGroupPeerMemoryFeaturesKHR                             ;
     PFN_vkCmdSetDeviceMaskKHR                                               CmdSetDeviceMaskKHR                                             ;
@@ -554,13 +872,17 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCreateDescriptorUpdateTemplateKHR                                 CreateDescriptorUpdateTemplateKHR                               ;
     PFN_vkDestroyDescriptorUpdateTemplateKHR                                DestroyDescriptorUpdateTemplateKHR                              ;
     PFN_vkUpdateDescriptorSetWithTemplateKHR                                UpdateDescriptorSetWithTemplateKHR                              ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_KHR_create_renderpass2 spec_version 1 */
     PFN_vkCreateRenderPass2KHR                                              CreateRenderPass2KHR                                            ;
     PFN_vkCmdBeginRenderPass2KHR                                            CmdBeginRenderPass2KHR                                          ;
     PFN_vkCmdNextSubpass2KHR                                                CmdNextSubpass2KHR                                              ;
     PFN_vkCmdEndRenderPass2KHR                                              CmdEndRenderPass2KHR                                            ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_KHR_shared_presentable_image spec_version 1 */
     PFN_vkGetSwapchainStatusKHR                                             GetSwapchainStatusKHR                                           ;
+#endif
     /* VK_KHR_external_fence_fd spec_version 1 */
     PFN_vkImportFenceFdKHR                                                  ImportFenceFdKHR                                                ;
     PFN_vkGetFenceFdKHR                                                     GetFenceFdKHR                                                   ;
@@ -579,20 +901,26 @@ typedef struct VkadDeviceFunctions {
     PFN_vkBindImageMemory2KHR                                               BindImageMemory2KHR                                             ;
     /* VK_KHR_maintenance3 spec_version 1 */
     PFN_vkGetDescriptorSetLayoutSupportKHR                                  GetDescriptorSetLayoutSupportKHR                                ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_KHR_draw_indirect_count spec_version 1 */
     PFN_vkCmdDrawIndirectCountKHR                                           CmdDrawIndirectCountKHR                                         ;
     PFN_vkCmdDrawIndexedIndirectCountKHR                                    CmdDrawIndexedIndirectCountKHR                                  ;
+#endif
     /* VK_KHR_timeline_semaphore spec_version 2 */
     PFN_vkGetSemaphoreCounterValueKHR                                       GetSemaphoreCounterValueKHR                                     ;
     PFN_vkWaitSemaphoresKHR                                                 WaitSemaphoresKHR                                               ;
     PFN_vkSignalSemaphoreKHR                                                SignalSemaphoreKHR                                              ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_KHR_fragment_shading_rate spec_version 2 */
     PFN_vkCmdSetFragmentShadingRateKHR                                      CmdSetFragmentShadingRateKHR                                    ;
     /* VK_KHR_dynamic_rendering_local_read spec_version 1 */
     PFN_vkCmdSetRenderingAttachmentLocationsKHR                             CmdSetRenderingAttachmentLocationsKHR                           ;
     PFN_vkCmdSetRenderingInputAttachmentIndicesKHR                          CmdSetRenderingInputAttachmentIndicesKHR                        ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_KHR_present_wait spec_version 1 */
     PFN_vkWaitForPresentKHR                                                 WaitForPresentKHR                                               ;
+#endif
     /* VK_KHR_buffer_device_address spec_version 1 */
     PFN_vkGetBufferDeviceAddressKHR                                         GetBufferDeviceAddressKHR                                       ;
     PFN_vkGetBufferOpaqueCaptureAddressKHR                                  GetBufferOpaqueCaptureAddressKHR                                ;
@@ -610,9 +938,11 @@ typedef struct VkadDeviceFunctions {
     /* VK_KHR_map_memory2 spec_version 1 */
     PFN_vkMapMemory2KHR                                                     MapMemory2KHR                                                   ;
     PFN_vkUnmapMemory2KHR                                                   UnmapMemory2KHR                                                 ;
+#ifndef VKAD_NO_VIDEO_EXTENSIONS
     /* VK_KHR_video_encode_queue spec_version 12 */
     PFN_vkGetEncodedVideoSessionParametersKHR                               GetEncodedVideoSessionParametersKHR                             ;
     PFN_vkCmdEncodeVideoKHR                                                 CmdEncodeVideoKHR                                               ;
+#endif
     /* VK_KHR_synchronization2 spec_version 1 */
     PFN_vkCmdSetEvent2KHR                                                   CmdSetEvent2KHR                                                 ;
     PFN_vkCmdResetEvent2KHR                                                 CmdResetEvent2KHR                                               ;
@@ -620,8 +950,10 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdPipelineBarrier2KHR                                            CmdPipelineBarrier2KHR                                          ;
     PFN_vkCmdWriteTimestamp2KHR                                             CmdWriteTimestamp2KHR                                           ;
     PFN_vkQueueSubmit2KHR                                                   QueueSubmit2KHR                                                 ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     PFN_vkCmdWriteBufferMarker2AMD                                          CmdWriteBufferMarker2AMD                                        ;
     PFN_vkGetQueueCheckpointData2NV                                         GetQueueCheckpointData2NV                                       ;
+#endif
                 /* NOTE: The function vkCmdWriteBufferMarker2AMD was moved into VK_AMD_buffer_marker and vkGetQueueCheckpointData2NV into VK_NV_device_diagnostic_checkpoints from 1.3.284 to 1.4.309;
                    they are kept here in their old position for the sake of preserving the memory layout of the old portion of the structs */
     /* VK_KHR_copy_commands2 spec_version 1 */
@@ -631,8 +963,10 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdCopyImageToBuffer2KHR                                          CmdCopyImageToBuffer2KHR                                        ;
     PFN_vkCmdBlitImage2KHR                                                  CmdBlitImage2KHR                                                ;
     PFN_vkCmdResolveImage2KHR                                               CmdResolveImage2KHR                                             ;
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
     /* VK_KHR_ray_tracing_maintenance1 spec_version 1 */
     PFN_vkCmdTraceRaysIndirect2KHR                                          CmdTraceRaysIndirect2KHR                                        ;
+#endif
     /* VK_KHR_maintenance4 spec_version 2 */
     PFN_vkGetDeviceBufferMemoryRequirementsKHR                              GetDeviceBufferMemoryRequirementsKHR                            ;
     PFN_vkGetDeviceImageMemoryRequirementsKHR                               GetDeviceImageMemoryRequirementsKHR                             ;
@@ -642,8 +976,10 @@ typedef struct VkadDeviceFunctions {
     PFN_vkGetRenderingAreaGranularityKHR                                    GetRenderingAreaGranularityKHR                                  ;
     PFN_vkGetDeviceImageSubresourceLayoutKHR                                GetDeviceImageSubresourceLayoutKHR                              ;
     PFN_vkGetImageSubresourceLayout2KHR                                     GetImageSubresourceLayout2KHR                                   ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_KHR_line_rasterization spec_version 1 */
     PFN_vkCmdSetLineStippleKHR                                              CmdSetLineStippleKHR                                            ;
+#endif
     /* VK_KHR_calibrated_timestamps spec_version 1 */
     PFN_vkGetCalibratedTimestampsKHR                                        GetCalibratedTimestampsKHR                                      ;
     /* VK_KHR_maintenance6 spec_version 1 */
@@ -659,6 +995,7 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdDebugMarkerBeginEXT                                            CmdDebugMarkerBeginEXT                                          ;
     PFN_vkCmdDebugMarkerEndEXT                                              CmdDebugMarkerEndEXT                                            ;
     PFN_vkCmdDebugMarkerInsertEXT                                           CmdDebugMarkerInsertEXT                                         ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_EXT_transform_feedback spec_version 1 */
     PFN_vkCmdBindTransformFeedbackBuffersEXT                                CmdBindTransformFeedbackBuffersEXT                              ;
     PFN_vkCmdBeginTransformFeedbackEXT                                      CmdBeginTransformFeedbackEXT                                    ;
@@ -666,6 +1003,8 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdBeginQueryIndexedEXT                                           CmdBeginQueryIndexedEXT                                         ;
     PFN_vkCmdEndQueryIndexedEXT                                             CmdEndQueryIndexedEXT                                           ;
     PFN_vkCmdDrawIndirectByteCountEXT                                       CmdDrawIndirectByteCountEXT                                     ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NVX_binary_import spec_version 2 */
     PFN_vkCreateCuModuleNVX                                                 CreateCuModuleNVX                                               ;
     PFN_vkCreateCuFunctionNVX                                               CreateCuFunctionNVX                                             ;
@@ -680,11 +1019,15 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdDrawIndexedIndirectCountAMD                                    CmdDrawIndexedIndirectCountAMD                                  ;
     /* VK_AMD_shader_info spec_version 1 */                                 
     PFN_vkGetShaderInfoAMD                                                  GetShaderInfoAMD                                                ;
+#endif
     /* VK_EXT_conditional_rendering spec_version 2 */                       
     PFN_vkCmdBeginConditionalRenderingEXT                                   CmdBeginConditionalRenderingEXT                                 ;
     PFN_vkCmdEndConditionalRenderingEXT                                     CmdEndConditionalRenderingEXT                                   ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_clip_space_w_scaling spec_version 1 */                         
     PFN_vkCmdSetViewportWScalingNV                                          CmdSetViewportWScalingNV                                        ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_EXT_display_control spec_version 1 */                             
     PFN_vkDisplayPowerControlEXT                                            DisplayPowerControlEXT                                          ;
     PFN_vkRegisterDeviceEventEXT                                            RegisterDeviceEventEXT                                          ;
@@ -693,23 +1036,27 @@ typedef struct VkadDeviceFunctions {
     /* VK_GOOGLE_display_timing spec_version 1 */                           
     PFN_vkGetRefreshCycleDurationGOOGLE                                     GetRefreshCycleDurationGOOGLE                                   ;
     PFN_vkGetPastPresentationTimingGOOGLE                                   GetPastPresentationTimingGOOGLE                                 ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_EXT_discard_rectangles spec_version 2 */                          
     PFN_vkCmdSetDiscardRectangleEXT                                         CmdSetDiscardRectangleEXT                                       ;
     PFN_vkCmdSetDiscardRectangleEnableEXT                                   CmdSetDiscardRectangleEnableEXT                                 ;
     PFN_vkCmdSetDiscardRectangleModeEXT                                     CmdSetDiscardRectangleModeEXT                                   ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_EXT_hdr_metadata spec_version 3 */
     PFN_vkSetHdrMetadataEXT                                                 SetHdrMetadataEXT                                               ;
+#endif
     /* VK_EXT_debug_utils spec_version 2 */                                 
     PFN_vkSetDebugUtilsObjectNameEXT                                        SetDebugUtilsObjectNameEXT                                      ;
     PFN_vkSetDebugUtilsObjectTagEXT                                         SetDebugUtilsObjectTagEXT                                       ;
     PFN_vkQueueBeginDebugUtilsLabelEXT                                      QueueBeginDebugUtilsLabelEXT                                    ;
     PFN_vkQueueEndDebugUtilsLabelEXT                                        QueueEndDebugUtilsLabelEXT                                      ;
     PFN_vkQueueInsertDebugUtilsLabelEXT                                     QueueInsertDebugUtilsLabelEXT                                   ;
-    PFN_vkCmdBeginDebugUtilsLabelEXT                                        CmdBeginDebugUtilsLabelEXT                                      ;
-    PFN_vkCmdEndDebugUtilsLabelEXT                                          CmdEndDebugUtilsLabelEXT                                        ;
-    PFN_vkCmdInsertDebugUtilsLabelEXT                                       CmdInsertDebugUtilsLabelEXT                                     ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_EXT_sample_locations spec_version 1 */                            
     PFN_vkCmdSetSampleLocationsEXT                                          CmdSetSampleLocationsEXT                                        ;
+#endif
     /* VK_EXT_image_drm_format_modifier spec_version 2 */                   
     PFN_vkGetImageDrmFormatModifierPropertiesEXT                            GetImageDrmFormatModifierPropertiesEXT                          ;
     /* VK_EXT_validation_cache spec_version 1 */                            
@@ -717,10 +1064,13 @@ typedef struct VkadDeviceFunctions {
     PFN_vkDestroyValidationCacheEXT                                         DestroyValidationCacheEXT                                       ;
     PFN_vkMergeValidationCachesEXT                                          MergeValidationCachesEXT                                        ;
     PFN_vkGetValidationCacheDataEXT                                         GetValidationCacheDataEXT                                       ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_shading_rate_image spec_version 3 */                           
     PFN_vkCmdBindShadingRateImageNV                                         CmdBindShadingRateImageNV                                       ;
     PFN_vkCmdSetViewportShadingRatePaletteNV                                CmdSetViewportShadingRatePaletteNV                              ;
     PFN_vkCmdSetCoarseSampleOrderNV                                         CmdSetCoarseSampleOrderNV                                       ;
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
     /* VK_NV_ray_tracing spec_version 3 */                                  
     PFN_vkCreateAccelerationStructureNV                                     CreateAccelerationStructureNV                                   ;
     PFN_vkDestroyAccelerationStructureNV                                    DestroyAccelerationStructureNV                                  ;
@@ -735,12 +1085,16 @@ typedef struct VkadDeviceFunctions {
     PFN_vkGetAccelerationStructureHandleNV                                  GetAccelerationStructureHandleNV                                ;
     PFN_vkCmdWriteAccelerationStructuresPropertiesNV                        CmdWriteAccelerationStructuresPropertiesNV                      ;
     PFN_vkCompileDeferredNV                                                 CompileDeferredNV                                               ;
+#endif
     /* VK_EXT_external_memory_host spec_version 1 */                        
     PFN_vkGetMemoryHostPointerPropertiesEXT                                 GetMemoryHostPointerPropertiesEXT                               ;                                 
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_AMD_buffer_marker spec_version 1 */                               
     PFN_vkCmdWriteBufferMarkerAMD                                           CmdWriteBufferMarkerAMD                                         ;
+#endif
     /* VK_EXT_calibrated_timestamps spec_version 2 */                       
     PFN_vkGetCalibratedTimestampsEXT                                        GetCalibratedTimestampsEXT                                      ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_mesh_shader spec_version 1 */                                  
     PFN_vkCmdDrawMeshTasksNV                                                CmdDrawMeshTasksNV                                              ;
     PFN_vkCmdDrawMeshTasksIndirectNV                                        CmdDrawMeshTasksIndirectNV                                      ;
@@ -761,14 +1115,20 @@ typedef struct VkadDeviceFunctions {
     PFN_vkReleasePerformanceConfigurationINTEL                              ReleasePerformanceConfigurationINTEL                            ;
     PFN_vkQueueSetPerformanceConfigurationINTEL                             QueueSetPerformanceConfigurationINTEL                           ;
     PFN_vkGetPerformanceParameterINTEL                                      GetPerformanceParameterINTEL                                    ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_AMD_display_native_hdr spec_version 1 */                          
     PFN_vkSetLocalDimmingAMD                                                SetLocalDimmingAMD                                              ;
+#endif
     /* VK_EXT_buffer_device_address spec_version 2 */                       
     PFN_vkGetBufferDeviceAddressEXT                                         GetBufferDeviceAddressEXT                                       ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_EXT_line_rasterization spec_version 1 */                          
     PFN_vkCmdSetLineStippleEXT                                              CmdSetLineStippleEXT                                            ;
+#endif
     /* VK_EXT_host_query_reset spec_version 1 */                            
     PFN_vkResetQueryPoolEXT                                                 ResetQueryPoolEXT                                               ;                                                 
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_EXT_extended_dynamic_state spec_version 1 */                      
     PFN_vkCmdSetCullModeEXT                                                 CmdSetCullModeEXT                                               ;
     PFN_vkCmdSetFrontFaceEXT                                                CmdSetFrontFaceEXT                                              ;
@@ -782,14 +1142,18 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdSetDepthBoundsTestEnableEXT                                    CmdSetDepthBoundsTestEnableEXT                                  ;
     PFN_vkCmdSetStencilTestEnableEXT                                        CmdSetStencilTestEnableEXT                                      ;
     PFN_vkCmdSetStencilOpEXT                                                CmdSetStencilOpEXT                                              ;
+#endif
     /* VK_EXT_host_image_copy spec_version 1 */                             
     PFN_vkCopyMemoryToImageEXT                                              CopyMemoryToImageEXT                                            ;
     PFN_vkCopyImageToMemoryEXT                                              CopyImageToMemoryEXT                                            ;
     PFN_vkCopyImageToImageEXT                                               CopyImageToImageEXT                                             ;
     PFN_vkTransitionImageLayoutEXT                                          TransitionImageLayoutEXT                                        ;
     PFN_vkGetImageSubresourceLayout2EXT                                     GetImageSubresourceLayout2EXT                                   ;
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_EXT_swapchain_maintenance1 spec_version 1 */                      
     PFN_vkReleaseSwapchainImagesEXT                                         ReleaseSwapchainImagesEXT                                       ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_device_generated_commands spec_version 3 */                    
     PFN_vkGetGeneratedCommandsMemoryRequirementsNV                          GetGeneratedCommandsMemoryRequirementsNV                        ;
     PFN_vkCmdPreprocessGeneratedCommandsNV                                  CmdPreprocessGeneratedCommandsNV                                ;
@@ -797,13 +1161,17 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdBindPipelineShaderGroupNV                                      CmdBindPipelineShaderGroupNV                                    ;
     PFN_vkCreateIndirectCommandsLayoutNV                                    CreateIndirectCommandsLayoutNV                                  ;
     PFN_vkDestroyIndirectCommandsLayoutNV                                   DestroyIndirectCommandsLayoutNV                                 ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_EXT_depth_bias_control spec_version 1 */                          
     PFN_vkCmdSetDepthBias2EXT                                               CmdSetDepthBias2EXT                                             ;
+#endif
     /* VK_EXT_private_data spec_version 1 */                                
     PFN_vkCreatePrivateDataSlotEXT                                          CreatePrivateDataSlotEXT                                        ;
     PFN_vkDestroyPrivateDataSlotEXT                                         DestroyPrivateDataSlotEXT                                       ;
     PFN_vkSetPrivateDataEXT                                                 SetPrivateDataEXT                                               ;
     PFN_vkGetPrivateDataEXT                                                 GetPrivateDataEXT                                               ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_cuda_kernel_launch spec_version 2 */                           
     PFN_vkCreateCudaModuleNV                                                CreateCudaModuleNV                                              ;
     PFN_vkGetCudaModuleCacheNV                                              GetCudaModuleCacheNV                                            ;
@@ -811,24 +1179,24 @@ typedef struct VkadDeviceFunctions {
     PFN_vkDestroyCudaModuleNV                                               DestroyCudaModuleNV                                             ;
     PFN_vkDestroyCudaFunctionNV                                             DestroyCudaFunctionNV                                           ;
     PFN_vkCmdCudaLaunchKernelNV                                             CmdCudaLaunchKernelNV                                           ;
+#endif
     /* VK_EXT_descriptor_buffer spec_version 1 */                           
     PFN_vkGetDescriptorSetLayoutSizeEXT                                     GetDescriptorSetLayoutSizeEXT                                   ;
     PFN_vkGetDescriptorSetLayoutBindingOffsetEXT                            GetDescriptorSetLayoutBindingOffsetEXT                          ;
     PFN_vkGetDescriptorEXT                                                  GetDescriptorEXT                                                ;
-    PFN_vkCmdBindDescriptorBuffersEXT                                       CmdBindDescriptorBuffersEXT                                     ;
-    PFN_vkCmdSetDescriptorBufferOffsetsEXT                                  CmdSetDescriptorBufferOffsetsEXT                                ;
     PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT                        CmdBindDescriptorBufferEmbeddedSamplersEXT                      ;
     PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT                           GetBufferOpaqueCaptureDescriptorDataEXT                         ;
     PFN_vkGetImageOpaqueCaptureDescriptorDataEXT                            GetImageOpaqueCaptureDescriptorDataEXT                          ;
     PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT                        GetImageViewOpaqueCaptureDescriptorDataEXT                      ;
     PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT                          GetSamplerOpaqueCaptureDescriptorDataEXT                        ;
     PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT            GetAccelerationStructureOpaqueCaptureDescriptorDataEXT          ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_fragment_shading_rate_enums spec_version 1 */                  
     PFN_vkCmdSetFragmentShadingRateEnumNV                                   CmdSetFragmentShadingRateEnumNV                                 ;
+#endif
     /* VK_EXT_device_fault spec_version 2 */                                
     PFN_vkGetDeviceFaultInfoEXT                                             GetDeviceFaultInfoEXT                                           ;
-    /* VK_EXT_vertex_input_dynamic_state spec_version 2 */                  
-    PFN_vkCmdSetVertexInputEXT                                              CmdSetVertexInputEXT                                            ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_HUAWEI_subpass_shading spec_version 3 */                          
     PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI                     GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI                   ;
     PFN_vkCmdSubpassShadingHUAWEI                                           CmdSubpassShadingHUAWEI                                         ;
@@ -836,8 +1204,10 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdBindInvocationMaskHUAWEI                                       CmdBindInvocationMaskHUAWEI                                     ;
     /* VK_NV_external_memory_rdma spec_version 1 */                         
     PFN_vkGetMemoryRemoteAddressNV                                          GetMemoryRemoteAddressNV                                        ;
+#endif
     /* VK_EXT_pipeline_properties spec_version 1 */                         
     PFN_vkGetPipelinePropertiesEXT                                          GetPipelinePropertiesEXT                                        ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_EXT_extended_dynamic_state2 spec_version 1 */                     
     PFN_vkCmdSetPatchControlPointsEXT                                       CmdSetPatchControlPointsEXT                                     ;
     PFN_vkCmdSetRasterizerDiscardEnableEXT                                  CmdSetRasterizerDiscardEnableEXT                                ;
@@ -849,6 +1219,8 @@ typedef struct VkadDeviceFunctions {
     /* VK_EXT_multi_draw spec_version 1 */                                  
     PFN_vkCmdDrawMultiEXT                                                   CmdDrawMultiEXT                                                 ;
     PFN_vkCmdDrawMultiIndexedEXT                                            CmdDrawMultiIndexedEXT                                          ;
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
     /* VK_EXT_opacity_micromap spec_version 2 */                            
     PFN_vkCreateMicromapEXT                                                 CreateMicromapEXT                                               ;
     PFN_vkDestroyMicromapEXT                                                DestroyMicromapEXT                                              ;
@@ -864,11 +1236,15 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdWriteMicromapsPropertiesEXT                                    CmdWriteMicromapsPropertiesEXT                                  ;
     PFN_vkGetDeviceMicromapCompatibilityEXT                                 GetDeviceMicromapCompatibilityEXT                               ;
     PFN_vkGetMicromapBuildSizesEXT                                          GetMicromapBuildSizesEXT                                        ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_HUAWEI_cluster_culling_shader spec_version 3 */                   
     PFN_vkCmdDrawClusterHUAWEI                                              CmdDrawClusterHUAWEI                                            ;
     PFN_vkCmdDrawClusterIndirectHUAWEI                                      CmdDrawClusterIndirectHUAWEI                                    ;
+#endif
     /* VK_EXT_pageable_device_local_memory spec_version 1 */                
     PFN_vkSetDeviceMemoryPriorityEXT                                        SetDeviceMemoryPriorityEXT                                      ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_VALVE_descriptor_set_host_mapping spec_version 1 */               
     PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE                        GetDescriptorSetLayoutHostMappingInfoVALVE                      ;
     PFN_vkGetDescriptorSetHostMappingVALVE                                  GetDescriptorSetHostMappingVALVE                                ;
@@ -882,6 +1258,8 @@ typedef struct VkadDeviceFunctions {
     PFN_vkGetPipelineIndirectMemoryRequirementsNV                           GetPipelineIndirectMemoryRequirementsNV                         ;
     PFN_vkCmdUpdatePipelineIndirectBufferNV                                 CmdUpdatePipelineIndirectBufferNV                               ;
     PFN_vkGetPipelineIndirectDeviceAddressNV                                GetPipelineIndirectDeviceAddressNV                              ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_EXT_extended_dynamic_state3 spec_version 2 */                     
     PFN_vkCmdSetDepthClampEnableEXT                                         CmdSetDepthClampEnableEXT                                       ;
     PFN_vkCmdSetPolygonModeEXT                                              CmdSetPolygonModeEXT                                            ;
@@ -914,19 +1292,22 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdSetShadingRateImageEnableNV                                    CmdSetShadingRateImageEnableNV                                  ;
     PFN_vkCmdSetRepresentativeFragmentTestEnableNV                          CmdSetRepresentativeFragmentTestEnableNV                        ;
     PFN_vkCmdSetCoverageReductionModeNV                                     CmdSetCoverageReductionModeNV                                   ;
+#endif
     /* VK_EXT_shader_module_identifier spec_version 1 */                    
     PFN_vkGetShaderModuleIdentifierEXT                                      GetShaderModuleIdentifierEXT                                    ;
     PFN_vkGetShaderModuleCreateInfoIdentifierEXT                            GetShaderModuleCreateInfoIdentifierEXT                          ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_optical_flow spec_version 1 */                                 
     PFN_vkCreateOpticalFlowSessionNV                                        CreateOpticalFlowSessionNV                                      ;
     PFN_vkDestroyOpticalFlowSessionNV                                       DestroyOpticalFlowSessionNV                                     ;
     PFN_vkBindOpticalFlowSessionImageNV                                     BindOpticalFlowSessionImageNV                                   ;
     PFN_vkCmdOpticalFlowExecuteNV                                           CmdOpticalFlowExecuteNV                                         ;
+#endif
     /* VK_EXT_shader_object spec_version 1 */                               
     PFN_vkCreateShadersEXT                                                  CreateShadersEXT                                                ;
     PFN_vkDestroyShaderEXT                                                  DestroyShaderEXT                                                ;
     PFN_vkGetShaderBinaryDataEXT                                            GetShaderBinaryDataEXT                                          ;
-    PFN_vkCmdBindShadersEXT                                                 CmdBindShadersEXT                                               ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_QCOM_tile_properties spec_version 1 */                            
     PFN_vkGetFramebufferTilePropertiesQCOM                                  GetFramebufferTilePropertiesQCOM                                ;
     PFN_vkGetDynamicRenderingTilePropertiesQCOM                             GetDynamicRenderingTilePropertiesQCOM                           ;
@@ -936,8 +1317,12 @@ typedef struct VkadDeviceFunctions {
     PFN_vkSetLatencyMarkerNV                                                SetLatencyMarkerNV                                              ;
     PFN_vkGetLatencyTimingsNV                                               GetLatencyTimingsNV                                             ;
     PFN_vkQueueNotifyOutOfBandNV                                            QueueNotifyOutOfBandNV                                          ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* VK_EXT_attachment_feedback_loop_dynamic_state spec_version 1 */      
     PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT                             CmdSetAttachmentFeedbackLoopEnableEXT                           ;
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
     /* VK_KHR_acceleration_structure spec_version 13 */                     
     PFN_vkCreateAccelerationStructureKHR                                    CreateAccelerationStructureKHR                                  ;
     PFN_vkDestroyAccelerationStructureKHR                                   DestroyAccelerationStructureKHR                                 ;
@@ -962,10 +1347,8 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdTraceRaysIndirectKHR                                           CmdTraceRaysIndirectKHR                                         ;
     PFN_vkGetRayTracingShaderGroupStackSizeKHR                              GetRayTracingShaderGroupStackSizeKHR                            ;
     PFN_vkCmdSetRayTracingPipelineStackSizeKHR                              CmdSetRayTracingPipelineStackSizeKHR                            ;
-    /* VK_EXT_mesh_shader spec_version 1 */                                 
-    PFN_vkCmdDrawMeshTasksEXT                                               CmdDrawMeshTasksEXT                                             ;
-    PFN_vkCmdDrawMeshTasksIndirectEXT                                       CmdDrawMeshTasksIndirectEXT                                     ;
-    PFN_vkCmdDrawMeshTasksIndirectCountEXT                                  CmdDrawMeshTasksIndirectCountEXT                                ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_ANDROID_external_memory_android_hardware_buffer spec_version 5 */ 
     PFN_vkGetAndroidHardwareBufferPropertiesANDROID                         GetAndroidHardwareBufferPropertiesANDROID                       ;
     PFN_vkGetMemoryAndroidHardwareBufferANDROID                             GetMemoryAndroidHardwareBufferANDROID                           ;
@@ -981,6 +1364,7 @@ typedef struct VkadDeviceFunctions {
     PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA                       SetBufferCollectionBufferConstraintsFUCHSIA                     ;
     PFN_vkDestroyBufferCollectionFUCHSIA                                    DestroyBufferCollectionFUCHSIA                                  ;
     PFN_vkGetBufferCollectionPropertiesFUCHSIA                              GetBufferCollectionPropertiesFUCHSIA                            ;
+#endif
     /* VK_EXT_metal_objects spec_version 2 */                               
     PFN_vkExportMetalObjectsEXT                                             ExportMetalObjectsEXT                                           ;
     /* VK_KHR_external_memory_win32 spec_version 1 */                       
@@ -992,12 +1376,17 @@ typedef struct VkadDeviceFunctions {
     /* VK_KHR_external_fence_win32 spec_version 1 */                        
     PFN_vkImportFenceWin32HandleKHR                                         ImportFenceWin32HandleKHR                                       ;
     PFN_vkGetFenceWin32HandleKHR                                            GetFenceWin32HandleKHR                                          ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_NV_external_memory_win32 spec_version 1 */                        
     PFN_vkGetMemoryWin32HandleNV                                            GetMemoryWin32HandleNV                                          ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
     /* VK_EXT_full_screen_exclusive spec_version 4 */                       
     PFN_vkAcquireFullScreenExclusiveModeEXT                                 AcquireFullScreenExclusiveModeEXT                               ;
     PFN_vkReleaseFullScreenExclusiveModeEXT                                 ReleaseFullScreenExclusiveModeEXT                               ;
     PFN_vkGetDeviceGroupSurfacePresentModes2EXT                             GetDeviceGroupSurfacePresentModes2EXT                           ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_QNX_external_memory_screen_buffer spec_version 1 */               
     PFN_vkGetScreenBufferPropertiesQNX                                      GetScreenBufferPropertiesQNX                                    ;
     /* VK_AMDX_shader_enqueue spec_version 2 */
@@ -1008,11 +1397,16 @@ typedef struct VkadDeviceFunctions {
     PFN_vkCmdDispatchGraphAMDX                                              CmdDispatchGraphAMDX                                            ;
     PFN_vkCmdDispatchGraphIndirectAMDX                                      CmdDispatchGraphIndirectAMDX                                    ;
     PFN_vkCmdDispatchGraphIndirectCountAMDX                                 CmdDispatchGraphIndirectCountAMDX                               ;
+#endif
         /* Additions from 1.3.284 to 1.4.309: */
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* to VK_NVX_image_view_handle spec_version 3 */
     PFN_vkGetImageViewHandle64NVX                                           GetImageViewHandle64NVX                                         ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
     /* to VK_EXT_shader_object spec_version 1 */
     PFN_vkCmdSetDepthClampRangeEXT                                          CmdSetDepthClampRangeEXT                                        ;
+#endif
     /* VK_VERSION_1_4 */
     PFN_vkCmdSetLineStipple                                                 CmdSetLineStipple                                               ;
     PFN_vkMapMemory2                                                        MapMemory2                                                      ;
@@ -1021,12 +1415,9 @@ typedef struct VkadDeviceFunctions {
     PFN_vkGetRenderingAreaGranularity                                       GetRenderingAreaGranularity                                     ;
     PFN_vkGetDeviceImageSubresourceLayout                                   GetDeviceImageSubresourceLayout                                 ;
     PFN_vkGetImageSubresourceLayout2                                        GetImageSubresourceLayout2                                      ;
-    PFN_vkCmdPushDescriptorSet                                              CmdPushDescriptorSet                                            ;
     PFN_vkCmdPushDescriptorSetWithTemplate                                  CmdPushDescriptorSetWithTemplate                                ;
     PFN_vkCmdSetRenderingAttachmentLocations                                CmdSetRenderingAttachmentLocations                              ;
     PFN_vkCmdSetRenderingInputAttachmentIndices                             CmdSetRenderingInputAttachmentIndices                           ;
-    PFN_vkCmdBindDescriptorSets2                                            CmdBindDescriptorSets2                                          ;
-    PFN_vkCmdPushConstants2                                                 CmdPushConstants2                                               ;
     PFN_vkCmdPushDescriptorSet2                                             CmdPushDescriptorSet2                                           ;
     PFN_vkCmdPushDescriptorSetWithTemplate2                                 CmdPushDescriptorSetWithTemplate2                               ;
     PFN_vkCopyMemoryToImage                                                 CopyMemoryToImage                                               ;
@@ -1039,17 +1430,21 @@ typedef struct VkadDeviceFunctions {
     PFN_vkGetPipelineKeyKHR                                                 GetPipelineKeyKHR                                               ;
     PFN_vkGetPipelineBinaryDataKHR                                          GetPipelineBinaryDataKHR                                        ;
     PFN_vkReleaseCapturedPipelineDataKHR                                    ReleaseCapturedPipelineDataKHR                                  ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
     /* VK_AMD_anti_lag spec_version 1 */
     PFN_vkAntiLagUpdateAMD                                                  AntiLagUpdateAMD                                                ;
     /* VK_NV_cooperative_vector spec_version 4 */
     PFN_vkConvertCooperativeVectorMatrixNV                                  ConvertCooperativeVectorMatrixNV                                ;
     PFN_vkCmdConvertCooperativeVectorMatrixNV                               CmdConvertCooperativeVectorMatrixNV                             ;
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
     /* VK_NV_cluster_acceleration_structure spec_version 2 */
     PFN_vkGetClusterAccelerationStructureBuildSizesNV                       GetClusterAccelerationStructureBuildSizesNV                     ;
     PFN_vkCmdBuildClusterAccelerationStructureIndirectNV                    CmdBuildClusterAccelerationStructureIndirectNV                  ;
     /* VK_NV_partitioned_acceleration_structure spec_version 1 */
     PFN_vkGetPartitionedAccelerationStructuresBuildSizesNV                  GetPartitionedAccelerationStructuresBuildSizesNV                ;
     PFN_vkCmdBuildPartitionedAccelerationStructuresNV                       CmdBuildPartitionedAccelerationStructuresNV                     ;
+#endif
     /* VK_EXT_device_generated_commands spec_version 1 */
     PFN_vkGetGeneratedCommandsMemoryRequirementsEXT                         GetGeneratedCommandsMemoryRequirementsEXT                       ;
     PFN_vkCmdPreprocessGeneratedCommandsEXT                                 CmdPreprocessGeneratedCommandsEXT                               ;
@@ -1064,214 +1459,1973 @@ typedef struct VkadDeviceFunctions {
     PFN_vkGetMemoryMetalHandleEXT                                           GetMemoryMetalHandleEXT                                         ;
     PFN_vkGetMemoryMetalHandlePropertiesEXT                                 GetMemoryMetalHandlePropertiesEXT                               ;
 } VkadDeviceFunctions;
-/* extensions without function pointers:
-    VK_KHR_sampler_mirror_clamp_to_edge spec_version 3
-    VK_KHR_video_encode_h264 spec_version 14
-    VK_KHR_video_encode_h265 spec_version 14
-    VK_KHR_video_decode_h264 spec_version 9
-    VK_KHR_multiview spec_version 1
-    VK_KHR_shader_draw_parameters spec_version 1
-    VK_KHR_external_memory spec_version 1
-    VK_KHR_external_semaphore spec_version 1
-    VK_KHR_shader_float16_int8 spec_version 1
-    VK_KHR_16bit_storage spec_version 1
-    VK_KHR_incremental_present spec_version 2
-    VK_KHR_imageless_framebuffer spec_version 1
-    VK_KHR_external_fence spec_version 1
-    VK_KHR_maintenance2 spec_version 1
-    VK_KHR_variable_pointers spec_version 1
-    VK_KHR_dedicated_allocation spec_version 3
-    VK_KHR_storage_buffer_storage_class spec_version 1
-    VK_KHR_relaxed_block_layout spec_version 1
-    VK_KHR_image_format_list spec_version 1
-    VK_KHR_shader_subgroup_extended_types spec_version 1
-    VK_KHR_8bit_storage spec_version 1
-    VK_KHR_shader_atomic_int64 spec_version 1
-    VK_KHR_shader_clock spec_version 1
-    VK_KHR_video_decode_h265 spec_version 8
-    VK_KHR_global_priority spec_version 1
-    VK_KHR_driver_properties spec_version 1
-    VK_KHR_shader_float_controls spec_version 4
-    VK_KHR_depth_stencil_resolve spec_version 1
-    VK_KHR_swapchain_mutable_format spec_version 1
-    VK_KHR_vulkan_memory_model spec_version 3
-    VK_KHR_shader_terminate_invocation spec_version 1
-    VK_KHR_shader_quad_control spec_version 1
-    VK_KHR_spirv_1_4 spec_version 1
-    VK_KHR_surface_protected_capabilities spec_version 1
-    VK_KHR_separate_depth_stencil_layouts spec_version 1
-    VK_KHR_uniform_buffer_standard_layout spec_version 1
-    VK_KHR_shader_integer_dot_product spec_version 1
-    VK_KHR_pipeline_library spec_version 1
-    VK_KHR_shader_non_semantic_info spec_version 1
-    VK_KHR_present_id spec_version 1
-    VK_KHR_fragment_shader_barycentric spec_version 1
-    VK_KHR_shader_subgroup_uniform_control_flow spec_version 1
-    VK_KHR_zero_initialize_workgroup_memory spec_version 1
-    VK_KHR_workgroup_memory_explicit_layout spec_version 1
-    VK_KHR_format_feature_flags2 spec_version 2
-    VK_KHR_portability_enumeration spec_version 1
-    VK_KHR_shader_subgroup_rotate spec_version 2
-    VK_KHR_shader_maximal_reconvergence spec_version 1
-    VK_KHR_ray_tracing_position_fetch spec_version 1
-    VK_KHR_video_decode_av1 spec_version 1
-    VK_KHR_video_maintenance1 spec_version 1
-    VK_KHR_vertex_attribute_divisor spec_version 1
-    VK_KHR_load_store_op_none spec_version 1
-    VK_KHR_shader_float_controls2 spec_version 1
-    VK_KHR_index_type_uint8 spec_version 1
-    VK_KHR_shader_expect_assume spec_version 1
-    VK_NV_glsl_shader spec_version 1
-    VK_EXT_depth_range_unrestricted spec_version 1
-    VK_IMG_filter_cubic spec_version 1
-    VK_AMD_rasterization_order spec_version 1
-    VK_AMD_shader_trinary_minmax spec_version 1
-    VK_AMD_shader_explicit_vertex_parameter spec_version 1
-    VK_AMD_gcn_shader spec_version 1
-    VK_NV_dedicated_allocation spec_version 1
-    VK_AMD_negative_viewport_height spec_version 1
-    VK_AMD_gpu_shader_half_float spec_version 2
-    VK_AMD_shader_ballot spec_version 1
-    VK_AMD_texture_gather_bias_lod spec_version 1
-    VK_AMD_shader_image_load_store_lod spec_version 1
-    VK_NV_corner_sampled_image spec_version 2
-    VK_IMG_format_pvrtc spec_version 1
-    VK_NV_external_memory spec_version 1
-    VK_EXT_validation_flags spec_version 3
-    VK_EXT_shader_subgroup_ballot spec_version 1
-    VK_EXT_shader_subgroup_vote spec_version 1
-    VK_EXT_texture_compression_astc_hdr spec_version 1
-    VK_EXT_astc_decode_mode spec_version 1
-    VK_EXT_pipeline_robustness spec_version 1
-    VK_NV_sample_mask_override_coverage spec_version 1
-    VK_NV_geometry_shader_passthrough spec_version 1
-    VK_NV_viewport_array2 spec_version 1
-    VK_NVX_multiview_per_view_attributes spec_version 1
-    VK_NV_viewport_swizzle spec_version 1
-    VK_EXT_conservative_rasterization spec_version 1
-    VK_EXT_depth_clip_enable spec_version 1
-    VK_EXT_swapchain_colorspace spec_version 5
-    VK_IMG_relaxed_line_rasterization spec_version 1
-    VK_EXT_external_memory_dma_buf spec_version 1
-    VK_EXT_queue_family_foreign spec_version 1
-    VK_EXT_sampler_filter_minmax spec_version 2
-    VK_AMD_gpu_shader_int16 spec_version 2
-    VK_AMD_mixed_attachment_samples spec_version 1
-    VK_AMD_shader_fragment_mask spec_version 1
-    VK_EXT_inline_uniform_block spec_version 1
-    VK_EXT_shader_stencil_export spec_version 1
-    VK_EXT_blend_operation_advanced spec_version 2
-    VK_NV_fragment_coverage_to_color spec_version 1
-    VK_NV_framebuffer_mixed_samples spec_version 1
-    VK_NV_fill_rectangle spec_version 1
-    VK_NV_shader_sm_builtins spec_version 1
-    VK_EXT_post_depth_coverage spec_version 1
-    VK_EXT_descriptor_indexing spec_version 2
-    VK_EXT_shader_viewport_index_layer spec_version 1
-    VK_NV_representative_fragment_test spec_version 2
-    VK_EXT_filter_cubic spec_version 3
-    VK_QCOM_render_pass_shader_resolve spec_version 4
-    VK_EXT_global_priority spec_version 2
-    VK_AMD_pipeline_compiler_control spec_version 1
-    VK_AMD_shader_core_properties spec_version 2
-    VK_AMD_memory_overallocation_behavior spec_version 1
-    VK_EXT_vertex_attribute_divisor spec_version 3
-    VK_EXT_pipeline_creation_feedback spec_version 1
-    VK_NV_shader_subgroup_partitioned spec_version 1
-    VK_NV_compute_shader_derivatives spec_version 1
-    VK_NV_fragment_shader_barycentric spec_version 1
-    VK_NV_shader_image_footprint spec_version 2
-    VK_INTEL_shader_integer_functions2 spec_version 1
-    VK_EXT_pci_bus_info spec_version 2
-    VK_EXT_fragment_density_map spec_version 2
-    VK_EXT_scalar_block_layout spec_version 1
-    VK_GOOGLE_hlsl_functionality1 spec_version 1
-    VK_GOOGLE_decorate_string spec_version 1
-    VK_EXT_subgroup_size_control spec_version 2
-    VK_AMD_shader_core_properties2 spec_version 1
-    VK_AMD_device_coherent_memory spec_version 1
-    VK_EXT_shader_image_atomic_int64 spec_version 1
-    VK_EXT_memory_budget spec_version 1
-    VK_EXT_memory_priority spec_version 1
-    VK_NV_dedicated_allocation_image_aliasing spec_version 1
-    VK_EXT_separate_stencil_usage spec_version 1
-    VK_EXT_validation_features spec_version 6
-    VK_EXT_fragment_shader_interlock spec_version 1
-    VK_EXT_ycbcr_image_arrays spec_version 1
-    VK_EXT_provoking_vertex spec_version 1
-    VK_EXT_shader_atomic_float spec_version 1
-    VK_EXT_index_type_uint8 spec_version 1
-    VK_EXT_map_memory_placed spec_version 1
-    VK_EXT_shader_atomic_float2 spec_version 1
-    VK_EXT_surface_maintenance1 spec_version 1
-    VK_EXT_shader_demote_to_helper_invocation spec_version 1
-    VK_NV_inherited_viewport_scissor spec_version 1
-    VK_EXT_texel_buffer_alignment spec_version 1
-    VK_QCOM_render_pass_transform spec_version 4
-    VK_EXT_device_memory_report spec_version 2
-    VK_EXT_robustness2 spec_version 1
-    VK_EXT_custom_border_color spec_version 12
-    VK_GOOGLE_user_type spec_version 1
-    VK_NV_present_barrier spec_version 1
-    VK_EXT_pipeline_creation_cache_control spec_version 3
-    VK_NV_device_diagnostics_config spec_version 2
-    VK_QCOM_render_pass_store_ops spec_version 2
-    VK_NV_low_latency spec_version 1
-    VK_EXT_graphics_pipeline_library spec_version 1
-    VK_AMD_shader_early_and_late_fragment_tests spec_version 1
-    VK_NV_ray_tracing_motion_blur spec_version 1
-    VK_EXT_ycbcr_2plane_444_formats spec_version 1
-    VK_EXT_fragment_density_map2 spec_version 1
-    VK_QCOM_rotated_copy_commands spec_version 2
-    VK_EXT_image_robustness spec_version 1
-    VK_EXT_image_compression_control spec_version 1
-    VK_EXT_attachment_feedback_loop_layout spec_version 2
-    VK_EXT_4444_formats spec_version 1
-    VK_ARM_rasterization_order_attachment_access spec_version 1
-    VK_EXT_rgba10x6_formats spec_version 1
-    VK_VALVE_mutable_descriptor_type spec_version 1
-    VK_EXT_physical_device_drm spec_version 1
-    VK_EXT_device_address_binding_report spec_version 1
-    VK_EXT_depth_clip_control spec_version 1
-    VK_EXT_primitive_topology_list_restart spec_version 1
-    VK_EXT_frame_boundary spec_version 1
-    VK_EXT_multisampled_render_to_single_sampled spec_version 1
-    VK_EXT_primitives_generated_query spec_version 1
-    VK_EXT_global_priority_query spec_version 1
-    VK_EXT_image_view_min_lod spec_version 1
-    VK_EXT_image_2d_view_of_3d spec_version 1
-    VK_EXT_shader_tile_image spec_version 1
-    VK_EXT_load_store_op_none spec_version 1
-    VK_EXT_border_color_swizzle spec_version 1
-    VK_ARM_shader_core_properties spec_version 1
-    VK_ARM_scheduling_controls spec_version 1
-    VK_EXT_image_sliced_view_of_3d spec_version 1
-    VK_EXT_depth_clamp_zero_one spec_version 1
-    VK_EXT_non_seamless_cube_map spec_version 1
-    VK_ARM_render_pass_striped spec_version 1
-    VK_QCOM_fragment_density_map_offset spec_version 2
-    VK_NV_linear_color_attachment spec_version 1
-    VK_GOOGLE_surfaceless_query spec_version 2
-    VK_EXT_image_compression_control_swapchain spec_version 1
-    VK_QCOM_image_processing spec_version 1
-    VK_EXT_nested_command_buffer spec_version 1
-    VK_EXT_external_memory_acquire_unmodified spec_version 1
-    VK_EXT_subpass_merge_feedback spec_version 2
-    VK_LUNARG_direct_driver_loading spec_version 1
-    VK_EXT_rasterization_order_attachment_access spec_version 1
-    VK_EXT_legacy_dithering spec_version 2
-    VK_EXT_pipeline_protected_access spec_version 1
-    VK_SEC_amigo_profiling spec_version 1
-    VK_QCOM_multiview_per_view_viewports spec_version 1
-    VK_NV_ray_tracing_invocation_reorder spec_version 1
-    VK_NV_extended_sparse_address_space spec_version 1
-    VK_EXT_mutable_descriptor_type spec_version 1
-    VK_EXT_legacy_vertex_attributes spec_version 1
-    VK_EXT_layer_settings spec_version 2
-    VK_ARM_shader_core_builtins spec_version 2
-    VK_EXT_pipeline_library_group_handles spec_version 1
-    VK_EXT_dynamic_rendering_unused_attachments spec_version 1
-    VK_QCOM_multiview_per_view_render_areas spec_version 1
+#else
+typedef struct VkadDeviceFunctions {
+    /* VK_VERSION_1_0 */
+    PFN_vkDestroyDevice                                                     DestroyDevice                                                   ;
+    PFN_vkGetDeviceQueue                                                    GetDeviceQueue                                                  ;
+    PFN_vkQueueSubmit                                                       QueueSubmit                                                     ;
+    PFN_vkQueueWaitIdle                                                     QueueWaitIdle                                                   ;
+    PFN_vkDeviceWaitIdle                                                    DeviceWaitIdle                                                  ;
+    PFN_vkAllocateMemory                                                    AllocateMemory                                                  ;
+    PFN_vkFreeMemory                                                        FreeMemory                                                      ;
+    PFN_vkMapMemory                                                         MapMemory                                                       ;
+    PFN_vkUnmapMemory                                                       UnmapMemory                                                     ;
+    PFN_vkFlushMappedMemoryRanges                                           FlushMappedMemoryRanges                                         ;
+    PFN_vkInvalidateMappedMemoryRanges                                      InvalidateMappedMemoryRanges                                    ;
+    PFN_vkGetDeviceMemoryCommitment                                         GetDeviceMemoryCommitment                                       ;
+    PFN_vkBindBufferMemory                                                  BindBufferMemory                                                ;
+    PFN_vkBindImageMemory                                                   BindImageMemory                                                 ;
+    PFN_vkGetBufferMemoryRequirements                                       GetBufferMemoryRequirements                                     ;
+    PFN_vkGetImageMemoryRequirements                                        GetImageMemoryRequirements                                      ;
+    PFN_vkGetImageSparseMemoryRequirements                                  GetImageSparseMemoryRequirements                                ;
+    PFN_vkQueueBindSparse                                                   QueueBindSparse                                                 ;
+    PFN_vkCreateFence                                                       CreateFence                                                     ;
+    PFN_vkDestroyFence                                                      DestroyFence                                                    ;
+    PFN_vkResetFences                                                       ResetFences                                                     ;
+    PFN_vkGetFenceStatus                                                    GetFenceStatus                                                  ;
+    PFN_vkWaitForFences                                                     WaitForFences                                                   ;
+    PFN_vkCreateSemaphore                                                   CreateSemaphore                                                 ;
+    PFN_vkDestroySemaphore                                                  DestroySemaphore                                                ;
+    PFN_vkCreateEvent                                                       CreateEvent                                                     ;
+    PFN_vkDestroyEvent                                                      DestroyEvent                                                    ;
+    PFN_vkGetEventStatus                                                    GetEventStatus                                                  ;
+    PFN_vkSetEvent                                                          SetEvent                                                        ;
+    PFN_vkResetEvent                                                        ResetEvent                                                      ;
+    PFN_vkCreateQueryPool                                                   CreateQueryPool                                                 ;
+    PFN_vkDestroyQueryPool                                                  DestroyQueryPool                                                ;
+    PFN_vkGetQueryPoolResults                                               GetQueryPoolResults                                             ;
+    PFN_vkCreateBuffer                                                      CreateBuffer                                                    ;
+    PFN_vkDestroyBuffer                                                     DestroyBuffer                                                   ;
+    PFN_vkCreateBufferView                                                  CreateBufferView                                                ;
+    PFN_vkDestroyBufferView                                                 DestroyBufferView                                               ;
+    PFN_vkCreateImage                                                       CreateImage                                                     ;
+    PFN_vkDestroyImage                                                      DestroyImage                                                    ;
+    PFN_vkGetImageSubresourceLayout                                         GetImageSubresourceLayout                                       ;
+    PFN_vkCreateImageView                                                   CreateImageView                                                 ;
+    PFN_vkDestroyImageView                                                  DestroyImageView                                                ;
+    PFN_vkCreateShaderModule                                                CreateShaderModule                                              ;
+    PFN_vkDestroyShaderModule                                               DestroyShaderModule                                             ;
+    PFN_vkCreatePipelineCache                                               CreatePipelineCache                                             ;
+    PFN_vkDestroyPipelineCache                                              DestroyPipelineCache                                            ;
+    PFN_vkGetPipelineCacheData                                              GetPipelineCacheData                                            ;
+    PFN_vkMergePipelineCaches                                               MergePipelineCaches                                             ;
+    PFN_vkCreateGraphicsPipelines                                           CreateGraphicsPipelines                                         ;
+    PFN_vkCreateComputePipelines                                            CreateComputePipelines                                          ;
+    PFN_vkDestroyPipeline                                                   DestroyPipeline                                                 ;
+    PFN_vkCreatePipelineLayout                                              CreatePipelineLayout                                            ;
+    PFN_vkDestroyPipelineLayout                                             DestroyPipelineLayout                                           ;
+    PFN_vkCreateSampler                                                     CreateSampler                                                   ;
+    PFN_vkDestroySampler                                                    DestroySampler                                                  ;
+    PFN_vkCreateDescriptorSetLayout                                         CreateDescriptorSetLayout                                       ;
+    PFN_vkDestroyDescriptorSetLayout                                        DestroyDescriptorSetLayout                                      ;
+    PFN_vkCreateDescriptorPool                                              CreateDescriptorPool                                            ;
+    PFN_vkDestroyDescriptorPool                                             DestroyDescriptorPool                                           ;
+    PFN_vkResetDescriptorPool                                               ResetDescriptorPool                                             ;
+    PFN_vkAllocateDescriptorSets                                            AllocateDescriptorSets                                          ;
+    PFN_vkFreeDescriptorSets                                                FreeDescriptorSets                                              ;
+    PFN_vkUpdateDescriptorSets                                              UpdateDescriptorSets                                            ;
+    PFN_vkCreateFramebuffer                                                 CreateFramebuffer                                               ;
+    PFN_vkDestroyFramebuffer                                                DestroyFramebuffer                                              ;
+    PFN_vkCreateRenderPass                                                  CreateRenderPass                                                ;
+    PFN_vkDestroyRenderPass                                                 DestroyRenderPass                                               ;
+    PFN_vkGetRenderAreaGranularity                                          GetRenderAreaGranularity                                        ;
+    PFN_vkCreateCommandPool                                                 CreateCommandPool                                               ;
+    PFN_vkDestroyCommandPool                                                DestroyCommandPool                                              ;
+    PFN_vkResetCommandPool                                                  ResetCommandPool                                                ;
+    PFN_vkAllocateCommandBuffers                                            AllocateCommandBuffers                                          ;
+    PFN_vkFreeCommandBuffers                                                FreeCommandBuffers                                              ;
+    PFN_vkBeginCommandBuffer                                                BeginCommandBuffer                                              ;
+    PFN_vkEndCommandBuffer                                                  EndCommandBuffer                                                ;
+    PFN_vkResetCommandBuffer                                                ResetCommandBuffer                                              ;
+    PFN_vkCmdBindPipeline                                                   CmdBindPipeline                                                 ;
+    PFN_vkCmdSetViewport                                                    CmdSetViewport                                                  ;
+    PFN_vkCmdSetScissor                                                     CmdSetScissor                                                   ;
+    PFN_vkCmdSetLineWidth                                                   CmdSetLineWidth                                                 ;
+    PFN_vkCmdSetDepthBias                                                   CmdSetDepthBias                                                 ;
+    PFN_vkCmdSetBlendConstants                                              CmdSetBlendConstants                                            ;
+    PFN_vkCmdSetDepthBounds                                                 CmdSetDepthBounds                                               ;
+    PFN_vkCmdSetStencilCompareMask                                          CmdSetStencilCompareMask                                        ;
+    PFN_vkCmdSetStencilWriteMask                                            CmdSetStencilWriteMask                                          ;
+    PFN_vkCmdSetStencilReference                                            CmdSetStencilReference                                          ;
+    PFN_vkCmdBindDescriptorSets                                             CmdBindDescriptorSets                                           ;
+    PFN_vkCmdBindIndexBuffer                                                CmdBindIndexBuffer                                              ;
+    PFN_vkCmdBindVertexBuffers                                              CmdBindVertexBuffers                                            ;
+    PFN_vkCmdDraw                                                           CmdDraw                                                         ;
+    PFN_vkCmdDrawIndexed                                                    CmdDrawIndexed                                                  ;
+    PFN_vkCmdDrawIndirect                                                   CmdDrawIndirect                                                 ;
+    PFN_vkCmdDrawIndexedIndirect                                            CmdDrawIndexedIndirect                                          ;
+    PFN_vkCmdDispatch                                                       CmdDispatch                                                     ;
+    PFN_vkCmdDispatchIndirect                                               CmdDispatchIndirect                                             ;
+    PFN_vkCmdCopyBuffer                                                     CmdCopyBuffer                                                   ;
+    PFN_vkCmdCopyImage                                                      CmdCopyImage                                                    ;
+    PFN_vkCmdBlitImage                                                      CmdBlitImage                                                    ;
+    PFN_vkCmdCopyBufferToImage                                              CmdCopyBufferToImage                                            ;
+    PFN_vkCmdCopyImageToBuffer                                              CmdCopyImageToBuffer                                            ;
+    PFN_vkCmdUpdateBuffer                                                   CmdUpdateBuffer                                                 ;
+    PFN_vkCmdFillBuffer                                                     CmdFillBuffer                                                   ;
+    PFN_vkCmdClearColorImage                                                CmdClearColorImage                                              ;
+    PFN_vkCmdClearDepthStencilImage                                         CmdClearDepthStencilImage                                       ;
+    PFN_vkCmdClearAttachments                                               CmdClearAttachments                                             ;
+    PFN_vkCmdResolveImage                                                   CmdResolveImage                                                 ;
+    PFN_vkCmdSetEvent                                                       CmdSetEvent                                                     ;
+    PFN_vkCmdResetEvent                                                     CmdResetEvent                                                   ;
+    PFN_vkCmdWaitEvents                                                     CmdWaitEvents                                                   ;
+    PFN_vkCmdPipelineBarrier                                                CmdPipelineBarrier                                              ;
+    PFN_vkCmdBeginQuery                                                     CmdBeginQuery                                                   ;
+    PFN_vkCmdEndQuery                                                       CmdEndQuery                                                     ;
+    PFN_vkCmdResetQueryPool                                                 CmdResetQueryPool                                               ;
+    PFN_vkCmdWriteTimestamp                                                 CmdWriteTimestamp                                               ;
+    PFN_vkCmdCopyQueryPoolResults                                           CmdCopyQueryPoolResults                                         ;
+    PFN_vkCmdPushConstants                                                  CmdPushConstants                                                ;
+    PFN_vkCmdBeginRenderPass                                                CmdBeginRenderPass                                              ;
+    PFN_vkCmdNextSubpass                                                    CmdNextSubpass                                                  ;
+    PFN_vkCmdEndRenderPass                                                  CmdEndRenderPass                                                ;
+    PFN_vkCmdExecuteCommands                                                CmdExecuteCommands                                              ;
+    /* VK_VERSION_1_1 */
+    PFN_vkBindBufferMemory2                                                 BindBufferMemory2                                               ;
+    PFN_vkBindImageMemory2                                                  BindImageMemory2                                                ;
+    PFN_vkGetDeviceGroupPeerMemoryFeatures                                  GetDeviceGroupPeerMemoryFeatures                                ;
+    PFN_vkCmdSetDeviceMask                                                  CmdSetDeviceMask                                                ;
+    PFN_vkCmdDispatchBase                                                   CmdDispatchBase                                                 ;
+    PFN_vkGetImageMemoryRequirements2                                       GetImageMemoryRequirements2                                     ;
+    PFN_vkGetBufferMemoryRequirements2                                      GetBufferMemoryRequirements2                                    ;
+    PFN_vkGetImageSparseMemoryRequirements2                                 GetImageSparseMemoryRequirements2                               ;
+    PFN_vkTrimCommandPool                                                   TrimCommandPool                                                 ;
+    PFN_vkGetDeviceQueue2                                                   GetDeviceQueue2                                                 ;
+    PFN_vkCreateSamplerYcbcrConversion                                      CreateSamplerYcbcrConversion                                    ;
+    PFN_vkDestroySamplerYcbcrConversion                                     DestroySamplerYcbcrConversion                                   ;
+    PFN_vkCreateDescriptorUpdateTemplate                                    CreateDescriptorUpdateTemplate                                  ;
+    PFN_vkDestroyDescriptorUpdateTemplate                                   DestroyDescriptorUpdateTemplate                                 ;
+    PFN_vkUpdateDescriptorSetWithTemplate                                   UpdateDescriptorSetWithTemplate                                 ;
+    PFN_vkGetDescriptorSetLayoutSupport                                     GetDescriptorSetLayoutSupport                                   ;
+    /* VK_VERSION_1_2 */
+    PFN_vkCmdDrawIndirectCount                                              CmdDrawIndirectCount                                            ;
+    PFN_vkCmdDrawIndexedIndirectCount                                       CmdDrawIndexedIndirectCount                                     ;
+    PFN_vkCreateRenderPass2                                                 CreateRenderPass2                                               ;
+    PFN_vkCmdBeginRenderPass2                                               CmdBeginRenderPass2                                             ;
+    PFN_vkCmdNextSubpass2                                                   CmdNextSubpass2                                                 ;
+    PFN_vkCmdEndRenderPass2                                                 CmdEndRenderPass2                                               ;
+    PFN_vkResetQueryPool                                                    ResetQueryPool                                                  ;
+    PFN_vkGetSemaphoreCounterValue                                          GetSemaphoreCounterValue                                        ;
+    PFN_vkWaitSemaphores                                                    WaitSemaphores                                                  ;
+    PFN_vkSignalSemaphore                                                   SignalSemaphore                                                 ;
+    PFN_vkGetBufferDeviceAddress                                            GetBufferDeviceAddress                                          ;
+    PFN_vkGetBufferOpaqueCaptureAddress                                     GetBufferOpaqueCaptureAddress                                   ;
+    PFN_vkGetDeviceMemoryOpaqueCaptureAddress                               GetDeviceMemoryOpaqueCaptureAddress                             ;
+    /* VK_VERSION_1_3 */
+    PFN_vkCreatePrivateDataSlot                                             CreatePrivateDataSlot                                           ;
+    PFN_vkDestroyPrivateDataSlot                                            DestroyPrivateDataSlot                                          ;
+    PFN_vkSetPrivateData                                                    SetPrivateData                                                  ;
+    PFN_vkGetPrivateData                                                    GetPrivateData                                                  ;
+    PFN_vkCmdSetEvent2                                                      CmdSetEvent2                                                    ;
+    PFN_vkCmdResetEvent2                                                    CmdResetEvent2                                                  ;
+    PFN_vkCmdWaitEvents2                                                    CmdWaitEvents2                                                  ;
+    PFN_vkCmdPipelineBarrier2                                               CmdPipelineBarrier2                                             ;
+    PFN_vkCmdWriteTimestamp2                                                CmdWriteTimestamp2                                              ;
+    PFN_vkQueueSubmit2                                                      QueueSubmit2                                                    ;
+    PFN_vkCmdCopyBuffer2                                                    CmdCopyBuffer2                                                  ;
+    PFN_vkCmdCopyImage2                                                     CmdCopyImage2                                                   ;
+    PFN_vkCmdCopyBufferToImage2                                             CmdCopyBufferToImage2                                           ;
+    PFN_vkCmdCopyImageToBuffer2                                             CmdCopyImageToBuffer2                                           ;
+    PFN_vkCmdBlitImage2                                                     CmdBlitImage2                                                   ;
+    PFN_vkCmdResolveImage2                                                  CmdResolveImage2                                                ;
+    PFN_vkCmdBeginRendering                                                 CmdBeginRendering                                               ;
+    PFN_vkCmdEndRendering                                                   CmdEndRendering                                                 ;
+    PFN_vkCmdSetCullMode                                                    CmdSetCullMode                                                  ;
+    PFN_vkCmdSetFrontFace                                                   CmdSetFrontFace                                                 ;
+    PFN_vkCmdSetPrimitiveTopology                                           CmdSetPrimitiveTopology                                         ;
+    PFN_vkCmdSetViewportWithCount                                           CmdSetViewportWithCount                                         ;
+    PFN_vkCmdSetScissorWithCount                                            CmdSetScissorWithCount                                          ;
+    PFN_vkCmdBindVertexBuffers2                                             CmdBindVertexBuffers2                                           ;
+    PFN_vkCmdSetDepthTestEnable                                             CmdSetDepthTestEnable                                           ;
+    PFN_vkCmdSetDepthWriteEnable                                            CmdSetDepthWriteEnable                                          ;
+    PFN_vkCmdSetDepthCompareOp                                              CmdSetDepthCompareOp                                            ;
+    PFN_vkCmdSetDepthBoundsTestEnable                                       CmdSetDepthBoundsTestEnable                                     ;
+    PFN_vkCmdSetStencilTestEnable                                           CmdSetStencilTestEnable                                         ;
+    PFN_vkCmdSetStencilOp                                                   CmdSetStencilOp                                                 ;
+    PFN_vkCmdSetRasterizerDiscardEnable                                     CmdSetRasterizerDiscardEnable                                   ;
+    PFN_vkCmdSetDepthBiasEnable                                             CmdSetDepthBiasEnable                                           ;
+    PFN_vkCmdSetPrimitiveRestartEnable                                      CmdSetPrimitiveRestartEnable                                    ;
+    PFN_vkGetDeviceBufferMemoryRequirements                                 GetDeviceBufferMemoryRequirements                               ;
+    PFN_vkGetDeviceImageMemoryRequirements                                  GetDeviceImageMemoryRequirements                                ;
+    PFN_vkGetDeviceImageSparseMemoryRequirements                            GetDeviceImageSparseMemoryRequirements                          ;
+#ifndef VKAD_NO_WSI_EXTENSIONS
+    /* VK_KHR_swapchain spec_version 70  */
+    PFN_vkCreateSwapchainKHR                                                CreateSwapchainKHR                                              ;
+    PFN_vkDestroySwapchainKHR                                               DestroySwapchainKHR                                             ;
+    PFN_vkGetSwapchainImagesKHR                                             GetSwapchainImagesKHR                                           ;
+    PFN_vkAcquireNextImageKHR                                               AcquireNextImageKHR                                             ;
+    PFN_vkQueuePresentKHR                                                   QueuePresentKHR                                                 ;
+    PFN_vkGetDeviceGroupPresentCapabilitiesKHR                              GetDeviceGroupPresentCapabilitiesKHR                            ;
+    PFN_vkGetDeviceGroupSurfacePresentModesKHR                              GetDeviceGroupSurfacePresentModesKHR                            ;
+    PFN_vkAcquireNextImage2KHR                                              AcquireNextImage2KHR                                            ;
+    /* VK_KHR_display_swapchain spec_version 10  */
+    PFN_vkCreateSharedSwapchainsKHR                                         CreateSharedSwapchainsKHR                                       ;
+#endif
+#ifndef VKAD_NO_VIDEO_EXTENSIONS
+    /* VK_KHR_video_queue spec_version 8 */
+    PFN_vkCreateVideoSessionKHR                                             CreateVideoSessionKHR                                           ;
+    PFN_vkDestroyVideoSessionKHR                                            DestroyVideoSessionKHR                                          ;
+    PFN_vkGetVideoSessionMemoryRequirementsKHR                              GetVideoSessionMemoryRequirementsKHR                            ;
+    PFN_vkBindVideoSessionMemoryKHR                                         BindVideoSessionMemoryKHR                                       ;
+    PFN_vkCreateVideoSessionParametersKHR                                   CreateVideoSessionParametersKHR                                 ;
+    PFN_vkUpdateVideoSessionParametersKHR                                   UpdateVideoSessionParametersKHR                                 ;
+    PFN_vkDestroyVideoSessionParametersKHR                                  DestroyVideoSessionParametersKHR                                ;
+    PFN_vkCmdBeginVideoCodingKHR                                            CmdBeginVideoCodingKHR                                          ;
+    PFN_vkCmdEndVideoCodingKHR                                              CmdEndVideoCodingKHR                                            ;
+    PFN_vkCmdControlVideoCodingKHR                                          CmdControlVideoCodingKHR                                        ;
+    /* VK_KHR_video_decode_queue spec_version 8 */
+    PFN_vkCmdDecodeVideoKHR                                                 CmdDecodeVideoKHR                                               ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_KHR_dynamic_rendering spec_version 1 */
+    PFN_vkCmdBeginRenderingKHR                                              CmdBeginRenderingKHR                                            ;
+    PFN_vkCmdEndRenderingKHR                                                CmdEndRenderingKHR                                              ;
+#endif
+    /* VK_KHR_device_group spec_version 4 */
+    PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR                               GetDeviceGroupPeerMemoryFeaturesKHR                             ;
+    PFN_vkCmdSetDeviceMaskKHR                                               CmdSetDeviceMaskKHR                                             ;
+    PFN_vkCmdDispatchBaseKHR                                                CmdDispatchBaseKHR                                              ;
+    /* VK_KHR_maintenance1 spec_version 2 */
+    PFN_vkTrimCommandPoolKHR                                                TrimCommandPoolKHR                                              ;
+    /* VK_KHR_external_memory_fd spec_version 1 */
+    PFN_vkGetMemoryFdKHR                                                    GetMemoryFdKHR                                                  ;
+    PFN_vkGetMemoryFdPropertiesKHR                                          GetMemoryFdPropertiesKHR                                        ;
+    /* VK_KHR_external_semaphore_fd spec_version 1 */
+    PFN_vkImportSemaphoreFdKHR                                              ImportSemaphoreFdKHR                                            ;
+    PFN_vkGetSemaphoreFdKHR                                                 GetSemaphoreFdKHR                                               ;
+    /* VK_KHR_push_descriptor spec_version 2 */
+    PFN_vkCmdPushDescriptorSetKHR                                           CmdPushDescriptorSetKHR                                         ;
+    PFN_vkCmdPushDescriptorSetWithTemplateKHR                               CmdPushDescriptorSetWithTemplateKHR                             ;
+    /* VK_KHR_descriptor_update_template spec_version 1 */
+    PFN_vkCreateDescriptorUpdateTemplateKHR                                 CreateDescriptorUpdateTemplateKHR                               ;
+    PFN_vkDestroyDescriptorUpdateTemplateKHR                                DestroyDescriptorUpdateTemplateKHR                              ;
+    PFN_vkUpdateDescriptorSetWithTemplateKHR                                UpdateDescriptorSetWithTemplateKHR                              ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_KHR_create_renderpass2 spec_version 1 */
+    PFN_vkCreateRenderPass2KHR                                              CreateRenderPass2KHR                                            ;
+    PFN_vkCmdBeginRenderPass2KHR                                            CmdBeginRenderPass2KHR                                          ;
+    PFN_vkCmdNextSubpass2KHR                                                CmdNextSubpass2KHR                                              ;
+    PFN_vkCmdEndRenderPass2KHR                                              CmdEndRenderPass2KHR                                            ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
+    /* VK_KHR_shared_presentable_image spec_version 1 */
+    PFN_vkGetSwapchainStatusKHR                                             GetSwapchainStatusKHR                                           ;
+#endif
+    /* VK_KHR_external_fence_fd spec_version 1 */
+    PFN_vkImportFenceFdKHR                                                  ImportFenceFdKHR                                                ;
+    PFN_vkGetFenceFdKHR                                                     GetFenceFdKHR                                                   ;
+    /* VK_KHR_performance_query spec_version 1 */
+    PFN_vkAcquireProfilingLockKHR                                           AcquireProfilingLockKHR                                         ;
+    PFN_vkReleaseProfilingLockKHR                                           ReleaseProfilingLockKHR                                         ;
+    /* VK_KHR_get_memory_requirements2 spec_version 1 */
+    PFN_vkGetImageMemoryRequirements2KHR                                    GetImageMemoryRequirements2KHR                                  ;
+    PFN_vkGetBufferMemoryRequirements2KHR                                   GetBufferMemoryRequirements2KHR                                 ;
+    PFN_vkGetImageSparseMemoryRequirements2KHR                              GetImageSparseMemoryRequirements2KHR                            ;
+    /* VK_KHR_sampler_ycbcr_conversion spec_version 14 */
+    PFN_vkCreateSamplerYcbcrConversionKHR                                   CreateSamplerYcbcrConversionKHR                                 ;
+    PFN_vkDestroySamplerYcbcrConversionKHR                                  DestroySamplerYcbcrConversionKHR                                ;
+    /* VK_KHR_bind_memory2 spec_version 1 */
+    PFN_vkBindBufferMemory2KHR                                              BindBufferMemory2KHR                                            ;
+    PFN_vkBindImageMemory2KHR                                               BindImageMemory2KHR                                             ;
+    /* VK_KHR_maintenance3 spec_version 1 */
+    PFN_vkGetDescriptorSetLayoutSupportKHR                                  GetDescriptorSetLayoutSupportKHR                                ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_KHR_draw_indirect_count spec_version 1 */
+    PFN_vkCmdDrawIndirectCountKHR                                           CmdDrawIndirectCountKHR                                         ;
+    PFN_vkCmdDrawIndexedIndirectCountKHR                                    CmdDrawIndexedIndirectCountKHR                                  ;
+#endif
+    /* VK_KHR_timeline_semaphore spec_version 2 */
+    PFN_vkGetSemaphoreCounterValueKHR                                       GetSemaphoreCounterValueKHR                                     ;
+    PFN_vkWaitSemaphoresKHR                                                 WaitSemaphoresKHR                                               ;
+    PFN_vkSignalSemaphoreKHR                                                SignalSemaphoreKHR                                              ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_KHR_fragment_shading_rate spec_version 2 */
+    PFN_vkCmdSetFragmentShadingRateKHR                                      CmdSetFragmentShadingRateKHR                                    ;
+    /* VK_KHR_dynamic_rendering_local_read spec_version 1 */
+    PFN_vkCmdSetRenderingAttachmentLocationsKHR                             CmdSetRenderingAttachmentLocationsKHR                           ;
+    PFN_vkCmdSetRenderingInputAttachmentIndicesKHR                          CmdSetRenderingInputAttachmentIndicesKHR                        ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
+    /* VK_KHR_present_wait spec_version 1 */
+    PFN_vkWaitForPresentKHR                                                 WaitForPresentKHR                                               ;
+#endif
+    /* VK_KHR_buffer_device_address spec_version 1 */
+    PFN_vkGetBufferDeviceAddressKHR                                         GetBufferDeviceAddressKHR                                       ;
+    PFN_vkGetBufferOpaqueCaptureAddressKHR                                  GetBufferOpaqueCaptureAddressKHR                                ;
+    PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR                            GetDeviceMemoryOpaqueCaptureAddressKHR                          ;
+    /* VK_KHR_deferred_host_operations spec_version 4 */
+    PFN_vkCreateDeferredOperationKHR                                        CreateDeferredOperationKHR                                      ;
+    PFN_vkDestroyDeferredOperationKHR                                       DestroyDeferredOperationKHR                                     ;
+    PFN_vkGetDeferredOperationMaxConcurrencyKHR                             GetDeferredOperationMaxConcurrencyKHR                           ;
+    PFN_vkGetDeferredOperationResultKHR                                     GetDeferredOperationResultKHR                                   ;
+    PFN_vkDeferredOperationJoinKHR                                          DeferredOperationJoinKHR                                        ;
+    /* VK_KHR_pipeline_executable_properties spec_version 1 */
+    PFN_vkGetPipelineExecutablePropertiesKHR                                GetPipelineExecutablePropertiesKHR                              ;
+    PFN_vkGetPipelineExecutableStatisticsKHR                                GetPipelineExecutableStatisticsKHR                              ;
+    PFN_vkGetPipelineExecutableInternalRepresentationsKHR                   GetPipelineExecutableInternalRepresentationsKHR                 ;
+    /* VK_KHR_map_memory2 spec_version 1 */
+    PFN_vkMapMemory2KHR                                                     MapMemory2KHR                                                   ;
+    PFN_vkUnmapMemory2KHR                                                   UnmapMemory2KHR                                                 ;
+#ifndef VKAD_NO_VIDEO_EXTENSIONS
+    /* VK_KHR_video_encode_queue spec_version 12 */
+    PFN_vkGetEncodedVideoSessionParametersKHR                               GetEncodedVideoSessionParametersKHR                             ;
+    PFN_vkCmdEncodeVideoKHR                                                 CmdEncodeVideoKHR                                               ;
+#endif
+    /* VK_KHR_synchronization2 spec_version 1 */
+    PFN_vkCmdSetEvent2KHR                                                   CmdSetEvent2KHR                                                 ;
+    PFN_vkCmdResetEvent2KHR                                                 CmdResetEvent2KHR                                               ;
+    PFN_vkCmdWaitEvents2KHR                                                 CmdWaitEvents2KHR                                               ;
+    PFN_vkCmdPipelineBarrier2KHR                                            CmdPipelineBarrier2KHR                                          ;
+    PFN_vkCmdWriteTimestamp2KHR                                             CmdWriteTimestamp2KHR                                           ;
+    PFN_vkQueueSubmit2KHR                                                   QueueSubmit2KHR                                                 ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    PFN_vkCmdWriteBufferMarker2AMD                                          CmdWriteBufferMarker2AMD                                        ;
+    PFN_vkGetQueueCheckpointData2NV                                         GetQueueCheckpointData2NV                                       ;
+#endif
+                /* NOTE: The function vkCmdWriteBufferMarker2AMD was moved into VK_AMD_buffer_marker and vkGetQueueCheckpointData2NV into VK_NV_device_diagnostic_checkpoints from 1.3.284 to 1.4.309;
+                   they are kept here in their old position for the sake of preserving the memory layout of the old portion of the structs */
+    /* VK_KHR_copy_commands2 spec_version 1 */
+    PFN_vkCmdCopyBuffer2KHR                                                 CmdCopyBuffer2KHR                                               ;
+    PFN_vkCmdCopyImage2KHR                                                  CmdCopyImage2KHR                                                ;
+    PFN_vkCmdCopyBufferToImage2KHR                                          CmdCopyBufferToImage2KHR                                        ;
+    PFN_vkCmdCopyImageToBuffer2KHR                                          CmdCopyImageToBuffer2KHR                                        ;
+    PFN_vkCmdBlitImage2KHR                                                  CmdBlitImage2KHR                                                ;
+    PFN_vkCmdResolveImage2KHR                                               CmdResolveImage2KHR                                             ;
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
+    /* VK_KHR_ray_tracing_maintenance1 spec_version 1 */
+    PFN_vkCmdTraceRaysIndirect2KHR                                          CmdTraceRaysIndirect2KHR                                        ;
+#endif
+    /* VK_KHR_maintenance4 spec_version 2 */
+    PFN_vkGetDeviceBufferMemoryRequirementsKHR                              GetDeviceBufferMemoryRequirementsKHR                            ;
+    PFN_vkGetDeviceImageMemoryRequirementsKHR                               GetDeviceImageMemoryRequirementsKHR                             ;
+    PFN_vkGetDeviceImageSparseMemoryRequirementsKHR                         GetDeviceImageSparseMemoryRequirementsKHR                       ;
+    /* VK_KHR_maintenance5 spec_version 1 */
+    PFN_vkCmdBindIndexBuffer2KHR                                            CmdBindIndexBuffer2KHR                                          ;
+    PFN_vkGetRenderingAreaGranularityKHR                                    GetRenderingAreaGranularityKHR                                  ;
+    PFN_vkGetDeviceImageSubresourceLayoutKHR                                GetDeviceImageSubresourceLayoutKHR                              ;
+    PFN_vkGetImageSubresourceLayout2KHR                                     GetImageSubresourceLayout2KHR                                   ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_KHR_line_rasterization spec_version 1 */
+    PFN_vkCmdSetLineStippleKHR                                              CmdSetLineStippleKHR                                            ;
+#endif
+    /* VK_KHR_calibrated_timestamps spec_version 1 */
+    PFN_vkGetCalibratedTimestampsKHR                                        GetCalibratedTimestampsKHR                                      ;
+    /* VK_KHR_maintenance6 spec_version 1 */
+    PFN_vkCmdBindDescriptorSets2KHR                                         CmdBindDescriptorSets2KHR                                       ;
+    PFN_vkCmdPushConstants2KHR                                              CmdPushConstants2KHR                                            ;
+    PFN_vkCmdPushDescriptorSet2KHR                                          CmdPushDescriptorSet2KHR                                        ;
+    PFN_vkCmdPushDescriptorSetWithTemplate2KHR                              CmdPushDescriptorSetWithTemplate2KHR                            ;
+    PFN_vkCmdSetDescriptorBufferOffsets2EXT                                 CmdSetDescriptorBufferOffsets2EXT                               ;
+    PFN_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT                       CmdBindDescriptorBufferEmbeddedSamplers2EXT                     ;
+    /* VK_EXT_debug_marker spec_version 4 */
+    PFN_vkDebugMarkerSetObjectTagEXT                                        DebugMarkerSetObjectTagEXT                                      ;
+    PFN_vkDebugMarkerSetObjectNameEXT                                       DebugMarkerSetObjectNameEXT                                     ;
+    PFN_vkCmdDebugMarkerBeginEXT                                            CmdDebugMarkerBeginEXT                                          ;
+    PFN_vkCmdDebugMarkerEndEXT                                              CmdDebugMarkerEndEXT                                            ;
+    PFN_vkCmdDebugMarkerInsertEXT                                           CmdDebugMarkerInsertEXT                                         ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_EXT_transform_feedback spec_version 1 */
+    PFN_vkCmdBindTransformFeedbackBuffersEXT                                CmdBindTransformFeedbackBuffersEXT                              ;
+    PFN_vkCmdBeginTransformFeedbackEXT                                      CmdBeginTransformFeedbackEXT                                    ;
+    PFN_vkCmdEndTransformFeedbackEXT                                        CmdEndTransformFeedbackEXT                                      ;
+    PFN_vkCmdBeginQueryIndexedEXT                                           CmdBeginQueryIndexedEXT                                         ;
+    PFN_vkCmdEndQueryIndexedEXT                                             CmdEndQueryIndexedEXT                                           ;
+    PFN_vkCmdDrawIndirectByteCountEXT                                       CmdDrawIndirectByteCountEXT                                     ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_NVX_binary_import spec_version 2 */
+    PFN_vkCreateCuModuleNVX                                                 CreateCuModuleNVX                                               ;
+    PFN_vkCreateCuFunctionNVX                                               CreateCuFunctionNVX                                             ;
+    PFN_vkDestroyCuModuleNVX                                                DestroyCuModuleNVX                                              ;
+    PFN_vkDestroyCuFunctionNVX                                              DestroyCuFunctionNVX                                            ;
+    PFN_vkCmdCuLaunchKernelNVX                                              CmdCuLaunchKernelNVX                                            ;
+    /* VK_NVX_image_view_handle spec_version 3 */
+    PFN_vkGetImageViewHandleNVX                                             GetImageViewHandleNVX                                           ;
+    PFN_vkGetImageViewAddressNVX                                            GetImageViewAddressNVX                                          ;
+    /* VK_AMD_draw_indirect_count spec_version 2 */                         
+    PFN_vkCmdDrawIndirectCountAMD                                           CmdDrawIndirectCountAMD                                         ;
+    PFN_vkCmdDrawIndexedIndirectCountAMD                                    CmdDrawIndexedIndirectCountAMD                                  ;
+    /* VK_AMD_shader_info spec_version 1 */                                 
+    PFN_vkGetShaderInfoAMD                                                  GetShaderInfoAMD                                                ;
+#endif
+    /* VK_EXT_conditional_rendering spec_version 2 */                       
+    PFN_vkCmdBeginConditionalRenderingEXT                                   CmdBeginConditionalRenderingEXT                                 ;
+    PFN_vkCmdEndConditionalRenderingEXT                                     CmdEndConditionalRenderingEXT                                   ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_NV_clip_space_w_scaling spec_version 1 */                         
+    PFN_vkCmdSetViewportWScalingNV                                          CmdSetViewportWScalingNV                                        ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
+    /* VK_EXT_display_control spec_version 1 */                             
+    PFN_vkDisplayPowerControlEXT                                            DisplayPowerControlEXT                                          ;
+    PFN_vkRegisterDeviceEventEXT                                            RegisterDeviceEventEXT                                          ;
+    PFN_vkRegisterDisplayEventEXT                                           RegisterDisplayEventEXT                                         ;
+    PFN_vkGetSwapchainCounterEXT                                            GetSwapchainCounterEXT                                          ;
+    /* VK_GOOGLE_display_timing spec_version 1 */                           
+    PFN_vkGetRefreshCycleDurationGOOGLE                                     GetRefreshCycleDurationGOOGLE                                   ;
+    PFN_vkGetPastPresentationTimingGOOGLE                                   GetPastPresentationTimingGOOGLE                                 ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_EXT_discard_rectangles spec_version 2 */                          
+    PFN_vkCmdSetDiscardRectangleEXT                                         CmdSetDiscardRectangleEXT                                       ;
+    PFN_vkCmdSetDiscardRectangleEnableEXT                                   CmdSetDiscardRectangleEnableEXT                                 ;
+    PFN_vkCmdSetDiscardRectangleModeEXT                                     CmdSetDiscardRectangleModeEXT                                   ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
+    /* VK_EXT_hdr_metadata spec_version 3 */
+    PFN_vkSetHdrMetadataEXT                                                 SetHdrMetadataEXT                                               ;
+#endif
+    /* VK_EXT_debug_utils spec_version 2 */                                 
+    PFN_vkSetDebugUtilsObjectNameEXT                                        SetDebugUtilsObjectNameEXT                                      ;
+    PFN_vkSetDebugUtilsObjectTagEXT                                         SetDebugUtilsObjectTagEXT                                       ;
+    PFN_vkQueueBeginDebugUtilsLabelEXT                                      QueueBeginDebugUtilsLabelEXT                                    ;
+    PFN_vkQueueEndDebugUtilsLabelEXT                                        QueueEndDebugUtilsLabelEXT                                      ;
+    PFN_vkQueueInsertDebugUtilsLabelEXT                                     QueueInsertDebugUtilsLabelEXT                                   ;
+    PFN_vkCmdBeginDebugUtilsLabelEXT                                        CmdBeginDebugUtilsLabelEXT                                      ;
+    PFN_vkCmdEndDebugUtilsLabelEXT                                          CmdEndDebugUtilsLabelEXT                                        ;
+    PFN_vkCmdInsertDebugUtilsLabelEXT                                       CmdInsertDebugUtilsLabelEXT                                     ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_EXT_sample_locations spec_version 1 */                            
+    PFN_vkCmdSetSampleLocationsEXT                                          CmdSetSampleLocationsEXT                                        ;
+#endif
+    /* VK_EXT_image_drm_format_modifier spec_version 2 */                   
+    PFN_vkGetImageDrmFormatModifierPropertiesEXT                            GetImageDrmFormatModifierPropertiesEXT                          ;
+    /* VK_EXT_validation_cache spec_version 1 */                            
+    PFN_vkCreateValidationCacheEXT                                          CreateValidationCacheEXT                                        ;
+    PFN_vkDestroyValidationCacheEXT                                         DestroyValidationCacheEXT                                       ;
+    PFN_vkMergeValidationCachesEXT                                          MergeValidationCachesEXT                                        ;
+    PFN_vkGetValidationCacheDataEXT                                         GetValidationCacheDataEXT                                       ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_NV_shading_rate_image spec_version 3 */                           
+    PFN_vkCmdBindShadingRateImageNV                                         CmdBindShadingRateImageNV                                       ;
+    PFN_vkCmdSetViewportShadingRatePaletteNV                                CmdSetViewportShadingRatePaletteNV                              ;
+    PFN_vkCmdSetCoarseSampleOrderNV                                         CmdSetCoarseSampleOrderNV                                       ;
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
+    /* VK_NV_ray_tracing spec_version 3 */                                  
+    PFN_vkCreateAccelerationStructureNV                                     CreateAccelerationStructureNV                                   ;
+    PFN_vkDestroyAccelerationStructureNV                                    DestroyAccelerationStructureNV                                  ;
+    PFN_vkGetAccelerationStructureMemoryRequirementsNV                      GetAccelerationStructureMemoryRequirementsNV                    ;
+    PFN_vkBindAccelerationStructureMemoryNV                                 BindAccelerationStructureMemoryNV                               ;
+    PFN_vkCmdBuildAccelerationStructureNV                                   CmdBuildAccelerationStructureNV                                 ;
+    PFN_vkCmdCopyAccelerationStructureNV                                    CmdCopyAccelerationStructureNV                                  ;
+    PFN_vkCmdTraceRaysNV                                                    CmdTraceRaysNV                                                  ;
+    PFN_vkCreateRayTracingPipelinesNV                                       CreateRayTracingPipelinesNV                                     ;
+    PFN_vkGetRayTracingShaderGroupHandlesKHR                                GetRayTracingShaderGroupHandlesKHR                              ;
+    PFN_vkGetRayTracingShaderGroupHandlesNV                                 GetRayTracingShaderGroupHandlesNV                               ;
+    PFN_vkGetAccelerationStructureHandleNV                                  GetAccelerationStructureHandleNV                                ;
+    PFN_vkCmdWriteAccelerationStructuresPropertiesNV                        CmdWriteAccelerationStructuresPropertiesNV                      ;
+    PFN_vkCompileDeferredNV                                                 CompileDeferredNV                                               ;
+#endif
+    /* VK_EXT_external_memory_host spec_version 1 */                        
+    PFN_vkGetMemoryHostPointerPropertiesEXT                                 GetMemoryHostPointerPropertiesEXT                               ;                                 
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_AMD_buffer_marker spec_version 1 */                               
+    PFN_vkCmdWriteBufferMarkerAMD                                           CmdWriteBufferMarkerAMD                                         ;
+#endif
+    /* VK_EXT_calibrated_timestamps spec_version 2 */                       
+    PFN_vkGetCalibratedTimestampsEXT                                        GetCalibratedTimestampsEXT                                      ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_NV_mesh_shader spec_version 1 */                                  
+    PFN_vkCmdDrawMeshTasksNV                                                CmdDrawMeshTasksNV                                              ;
+    PFN_vkCmdDrawMeshTasksIndirectNV                                        CmdDrawMeshTasksIndirectNV                                      ;
+    PFN_vkCmdDrawMeshTasksIndirectCountNV                                   CmdDrawMeshTasksIndirectCountNV                                 ;
+    /* VK_NV_scissor_exclusive spec_version 2 */                            
+    PFN_vkCmdSetExclusiveScissorEnableNV                                    CmdSetExclusiveScissorEnableNV                                  ;
+    PFN_vkCmdSetExclusiveScissorNV                                          CmdSetExclusiveScissorNV                                        ;
+    /* VK_NV_device_diagnostic_checkpoints spec_version 2 */                
+    PFN_vkCmdSetCheckpointNV                                                CmdSetCheckpointNV                                              ;
+    PFN_vkGetQueueCheckpointDataNV                                          GetQueueCheckpointDataNV                                        ;
+    /* VK_INTEL_performance_query spec_version 2 */                         
+    PFN_vkInitializePerformanceApiINTEL                                     InitializePerformanceApiINTEL                                   ;
+    PFN_vkUninitializePerformanceApiINTEL                                   UninitializePerformanceApiINTEL                                 ;
+    PFN_vkCmdSetPerformanceMarkerINTEL                                      CmdSetPerformanceMarkerINTEL                                    ;
+    PFN_vkCmdSetPerformanceStreamMarkerINTEL                                CmdSetPerformanceStreamMarkerINTEL                              ;
+    PFN_vkCmdSetPerformanceOverrideINTEL                                    CmdSetPerformanceOverrideINTEL                                  ;
+    PFN_vkAcquirePerformanceConfigurationINTEL                              AcquirePerformanceConfigurationINTEL                            ;
+    PFN_vkReleasePerformanceConfigurationINTEL                              ReleasePerformanceConfigurationINTEL                            ;
+    PFN_vkQueueSetPerformanceConfigurationINTEL                             QueueSetPerformanceConfigurationINTEL                           ;
+    PFN_vkGetPerformanceParameterINTEL                                      GetPerformanceParameterINTEL                                    ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
+    /* VK_AMD_display_native_hdr spec_version 1 */                          
+    PFN_vkSetLocalDimmingAMD                                                SetLocalDimmingAMD                                              ;
+#endif
+    /* VK_EXT_buffer_device_address spec_version 2 */                       
+    PFN_vkGetBufferDeviceAddressEXT                                         GetBufferDeviceAddressEXT                                       ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_EXT_line_rasterization spec_version 1 */                          
+    PFN_vkCmdSetLineStippleEXT                                              CmdSetLineStippleEXT                                            ;
+#endif
+    /* VK_EXT_host_query_reset spec_version 1 */                            
+    PFN_vkResetQueryPoolEXT                                                 ResetQueryPoolEXT                                               ;                                                 
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_EXT_extended_dynamic_state spec_version 1 */                      
+    PFN_vkCmdSetCullModeEXT                                                 CmdSetCullModeEXT                                               ;
+    PFN_vkCmdSetFrontFaceEXT                                                CmdSetFrontFaceEXT                                              ;
+    PFN_vkCmdSetPrimitiveTopologyEXT                                        CmdSetPrimitiveTopologyEXT                                      ;
+    PFN_vkCmdSetViewportWithCountEXT                                        CmdSetViewportWithCountEXT                                      ;
+    PFN_vkCmdSetScissorWithCountEXT                                         CmdSetScissorWithCountEXT                                       ;
+    PFN_vkCmdBindVertexBuffers2EXT                                          CmdBindVertexBuffers2EXT                                        ;
+    PFN_vkCmdSetDepthTestEnableEXT                                          CmdSetDepthTestEnableEXT                                        ;
+    PFN_vkCmdSetDepthWriteEnableEXT                                         CmdSetDepthWriteEnableEXT                                       ;
+    PFN_vkCmdSetDepthCompareOpEXT                                           CmdSetDepthCompareOpEXT                                         ;
+    PFN_vkCmdSetDepthBoundsTestEnableEXT                                    CmdSetDepthBoundsTestEnableEXT                                  ;
+    PFN_vkCmdSetStencilTestEnableEXT                                        CmdSetStencilTestEnableEXT                                      ;
+    PFN_vkCmdSetStencilOpEXT                                                CmdSetStencilOpEXT                                              ;
+#endif
+    /* VK_EXT_host_image_copy spec_version 1 */                             
+    PFN_vkCopyMemoryToImageEXT                                              CopyMemoryToImageEXT                                            ;
+    PFN_vkCopyImageToMemoryEXT                                              CopyImageToMemoryEXT                                            ;
+    PFN_vkCopyImageToImageEXT                                               CopyImageToImageEXT                                             ;
+    PFN_vkTransitionImageLayoutEXT                                          TransitionImageLayoutEXT                                        ;
+    PFN_vkGetImageSubresourceLayout2EXT                                     GetImageSubresourceLayout2EXT                                   ;
+#ifndef VKAD_NO_WSI_EXTENSIONS
+    /* VK_EXT_swapchain_maintenance1 spec_version 1 */                      
+    PFN_vkReleaseSwapchainImagesEXT                                         ReleaseSwapchainImagesEXT                                       ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_NV_device_generated_commands spec_version 3 */                    
+    PFN_vkGetGeneratedCommandsMemoryRequirementsNV                          GetGeneratedCommandsMemoryRequirementsNV                        ;
+    PFN_vkCmdPreprocessGeneratedCommandsNV                                  CmdPreprocessGeneratedCommandsNV                                ;
+    PFN_vkCmdExecuteGeneratedCommandsNV                                     CmdExecuteGeneratedCommandsNV                                   ;
+    PFN_vkCmdBindPipelineShaderGroupNV                                      CmdBindPipelineShaderGroupNV                                    ;
+    PFN_vkCreateIndirectCommandsLayoutNV                                    CreateIndirectCommandsLayoutNV                                  ;
+    PFN_vkDestroyIndirectCommandsLayoutNV                                   DestroyIndirectCommandsLayoutNV                                 ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_EXT_depth_bias_control spec_version 1 */                          
+    PFN_vkCmdSetDepthBias2EXT                                               CmdSetDepthBias2EXT                                             ;
+#endif
+    /* VK_EXT_private_data spec_version 1 */                                
+    PFN_vkCreatePrivateDataSlotEXT                                          CreatePrivateDataSlotEXT                                        ;
+    PFN_vkDestroyPrivateDataSlotEXT                                         DestroyPrivateDataSlotEXT                                       ;
+    PFN_vkSetPrivateDataEXT                                                 SetPrivateDataEXT                                               ;
+    PFN_vkGetPrivateDataEXT                                                 GetPrivateDataEXT                                               ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_NV_cuda_kernel_launch spec_version 2 */                           
+    PFN_vkCreateCudaModuleNV                                                CreateCudaModuleNV                                              ;
+    PFN_vkGetCudaModuleCacheNV                                              GetCudaModuleCacheNV                                            ;
+    PFN_vkCreateCudaFunctionNV                                              CreateCudaFunctionNV                                            ;
+    PFN_vkDestroyCudaModuleNV                                               DestroyCudaModuleNV                                             ;
+    PFN_vkDestroyCudaFunctionNV                                             DestroyCudaFunctionNV                                           ;
+    PFN_vkCmdCudaLaunchKernelNV                                             CmdCudaLaunchKernelNV                                           ;
+#endif
+    /* VK_EXT_descriptor_buffer spec_version 1 */                           
+    PFN_vkGetDescriptorSetLayoutSizeEXT                                     GetDescriptorSetLayoutSizeEXT                                   ;
+    PFN_vkGetDescriptorSetLayoutBindingOffsetEXT                            GetDescriptorSetLayoutBindingOffsetEXT                          ;
+    PFN_vkGetDescriptorEXT                                                  GetDescriptorEXT                                                ;
+    PFN_vkCmdBindDescriptorBuffersEXT                                       CmdBindDescriptorBuffersEXT                                     ;
+    PFN_vkCmdSetDescriptorBufferOffsetsEXT                                  CmdSetDescriptorBufferOffsetsEXT                                ;
+    PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT                        CmdBindDescriptorBufferEmbeddedSamplersEXT                      ;
+    PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT                           GetBufferOpaqueCaptureDescriptorDataEXT                         ;
+    PFN_vkGetImageOpaqueCaptureDescriptorDataEXT                            GetImageOpaqueCaptureDescriptorDataEXT                          ;
+    PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT                        GetImageViewOpaqueCaptureDescriptorDataEXT                      ;
+    PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT                          GetSamplerOpaqueCaptureDescriptorDataEXT                        ;
+    PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT            GetAccelerationStructureOpaqueCaptureDescriptorDataEXT          ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_NV_fragment_shading_rate_enums spec_version 1 */                  
+    PFN_vkCmdSetFragmentShadingRateEnumNV                                   CmdSetFragmentShadingRateEnumNV                                 ;
+#endif
+    /* VK_EXT_device_fault spec_version 2 */                                
+    PFN_vkGetDeviceFaultInfoEXT                                             GetDeviceFaultInfoEXT                                           ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_EXT_vertex_input_dynamic_state spec_version 2 */                  
+    PFN_vkCmdSetVertexInputEXT                                              CmdSetVertexInputEXT                                            ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_HUAWEI_subpass_shading spec_version 3 */                          
+    PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI                     GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI                   ;
+    PFN_vkCmdSubpassShadingHUAWEI                                           CmdSubpassShadingHUAWEI                                         ;
+    /* VK_HUAWEI_invocation_mask spec_version 1 */                          
+    PFN_vkCmdBindInvocationMaskHUAWEI                                       CmdBindInvocationMaskHUAWEI                                     ;
+    /* VK_NV_external_memory_rdma spec_version 1 */                         
+    PFN_vkGetMemoryRemoteAddressNV                                          GetMemoryRemoteAddressNV                                        ;
+#endif
+    /* VK_EXT_pipeline_properties spec_version 1 */                         
+    PFN_vkGetPipelinePropertiesEXT                                          GetPipelinePropertiesEXT                                        ;
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_EXT_extended_dynamic_state2 spec_version 1 */                     
+    PFN_vkCmdSetPatchControlPointsEXT                                       CmdSetPatchControlPointsEXT                                     ;
+    PFN_vkCmdSetRasterizerDiscardEnableEXT                                  CmdSetRasterizerDiscardEnableEXT                                ;
+    PFN_vkCmdSetDepthBiasEnableEXT                                          CmdSetDepthBiasEnableEXT                                        ;
+    PFN_vkCmdSetLogicOpEXT                                                  CmdSetLogicOpEXT                                                ;
+    PFN_vkCmdSetPrimitiveRestartEnableEXT                                   CmdSetPrimitiveRestartEnableEXT                                 ;
+    /* VK_EXT_color_write_enable spec_version 1 */                          
+    PFN_vkCmdSetColorWriteEnableEXT                                         CmdSetColorWriteEnableEXT                                       ;
+    /* VK_EXT_multi_draw spec_version 1 */                                  
+    PFN_vkCmdDrawMultiEXT                                                   CmdDrawMultiEXT                                                 ;
+    PFN_vkCmdDrawMultiIndexedEXT                                            CmdDrawMultiIndexedEXT                                          ;
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
+    /* VK_EXT_opacity_micromap spec_version 2 */                            
+    PFN_vkCreateMicromapEXT                                                 CreateMicromapEXT                                               ;
+    PFN_vkDestroyMicromapEXT                                                DestroyMicromapEXT                                              ;
+    PFN_vkCmdBuildMicromapsEXT                                              CmdBuildMicromapsEXT                                            ;
+    PFN_vkBuildMicromapsEXT                                                 BuildMicromapsEXT                                               ;
+    PFN_vkCopyMicromapEXT                                                   CopyMicromapEXT                                                 ;
+    PFN_vkCopyMicromapToMemoryEXT                                           CopyMicromapToMemoryEXT                                         ;
+    PFN_vkCopyMemoryToMicromapEXT                                           CopyMemoryToMicromapEXT                                         ;
+    PFN_vkWriteMicromapsPropertiesEXT                                       WriteMicromapsPropertiesEXT                                     ;
+    PFN_vkCmdCopyMicromapEXT                                                CmdCopyMicromapEXT                                              ;
+    PFN_vkCmdCopyMicromapToMemoryEXT                                        CmdCopyMicromapToMemoryEXT                                      ;
+    PFN_vkCmdCopyMemoryToMicromapEXT                                        CmdCopyMemoryToMicromapEXT                                      ;
+    PFN_vkCmdWriteMicromapsPropertiesEXT                                    CmdWriteMicromapsPropertiesEXT                                  ;
+    PFN_vkGetDeviceMicromapCompatibilityEXT                                 GetDeviceMicromapCompatibilityEXT                               ;
+    PFN_vkGetMicromapBuildSizesEXT                                          GetMicromapBuildSizesEXT                                        ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_HUAWEI_cluster_culling_shader spec_version 3 */                   
+    PFN_vkCmdDrawClusterHUAWEI                                              CmdDrawClusterHUAWEI                                            ;
+    PFN_vkCmdDrawClusterIndirectHUAWEI                                      CmdDrawClusterIndirectHUAWEI                                    ;
+#endif
+    /* VK_EXT_pageable_device_local_memory spec_version 1 */                
+    PFN_vkSetDeviceMemoryPriorityEXT                                        SetDeviceMemoryPriorityEXT                                      ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_VALVE_descriptor_set_host_mapping spec_version 1 */               
+    PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE                        GetDescriptorSetLayoutHostMappingInfoVALVE                      ;
+    PFN_vkGetDescriptorSetHostMappingVALVE                                  GetDescriptorSetHostMappingVALVE                                ;
+    /* VK_NV_copy_memory_indirect spec_version 1 */                         
+    PFN_vkCmdCopyMemoryIndirectNV                                           CmdCopyMemoryIndirectNV                                         ;
+    PFN_vkCmdCopyMemoryToImageIndirectNV                                    CmdCopyMemoryToImageIndirectNV                                  ;
+    /* VK_NV_memory_decompression spec_version 1 */                         
+    PFN_vkCmdDecompressMemoryNV                                             CmdDecompressMemoryNV                                           ;
+    PFN_vkCmdDecompressMemoryIndirectCountNV                                CmdDecompressMemoryIndirectCountNV                              ;
+    /* VK_NV_device_generated_commands_compute spec_version 2 */            
+    PFN_vkGetPipelineIndirectMemoryRequirementsNV                           GetPipelineIndirectMemoryRequirementsNV                         ;
+    PFN_vkCmdUpdatePipelineIndirectBufferNV                                 CmdUpdatePipelineIndirectBufferNV                               ;
+    PFN_vkGetPipelineIndirectDeviceAddressNV                                GetPipelineIndirectDeviceAddressNV                              ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_EXT_extended_dynamic_state3 spec_version 2 */                     
+    PFN_vkCmdSetDepthClampEnableEXT                                         CmdSetDepthClampEnableEXT                                       ;
+    PFN_vkCmdSetPolygonModeEXT                                              CmdSetPolygonModeEXT                                            ;
+    PFN_vkCmdSetRasterizationSamplesEXT                                     CmdSetRasterizationSamplesEXT                                   ;
+    PFN_vkCmdSetSampleMaskEXT                                               CmdSetSampleMaskEXT                                             ;
+    PFN_vkCmdSetAlphaToCoverageEnableEXT                                    CmdSetAlphaToCoverageEnableEXT                                  ;
+    PFN_vkCmdSetAlphaToOneEnableEXT                                         CmdSetAlphaToOneEnableEXT                                       ;
+    PFN_vkCmdSetLogicOpEnableEXT                                            CmdSetLogicOpEnableEXT                                          ;
+    PFN_vkCmdSetColorBlendEnableEXT                                         CmdSetColorBlendEnableEXT                                       ;
+    PFN_vkCmdSetColorBlendEquationEXT                                       CmdSetColorBlendEquationEXT                                     ;
+    PFN_vkCmdSetColorWriteMaskEXT                                           CmdSetColorWriteMaskEXT                                         ;
+    PFN_vkCmdSetTessellationDomainOriginEXT                                 CmdSetTessellationDomainOriginEXT                               ;
+    PFN_vkCmdSetRasterizationStreamEXT                                      CmdSetRasterizationStreamEXT                                    ;
+    PFN_vkCmdSetConservativeRasterizationModeEXT                            CmdSetConservativeRasterizationModeEXT                          ;
+    PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT                         CmdSetExtraPrimitiveOverestimationSizeEXT                       ;
+    PFN_vkCmdSetDepthClipEnableEXT                                          CmdSetDepthClipEnableEXT                                        ;
+    PFN_vkCmdSetSampleLocationsEnableEXT                                    CmdSetSampleLocationsEnableEXT                                  ;
+    PFN_vkCmdSetColorBlendAdvancedEXT                                       CmdSetColorBlendAdvancedEXT                                     ;
+    PFN_vkCmdSetProvokingVertexModeEXT                                      CmdSetProvokingVertexModeEXT                                    ;
+    PFN_vkCmdSetLineRasterizationModeEXT                                    CmdSetLineRasterizationModeEXT                                  ;
+    PFN_vkCmdSetLineStippleEnableEXT                                        CmdSetLineStippleEnableEXT                                      ;
+    PFN_vkCmdSetDepthClipNegativeOneToOneEXT                                CmdSetDepthClipNegativeOneToOneEXT                              ;
+    PFN_vkCmdSetViewportWScalingEnableNV                                    CmdSetViewportWScalingEnableNV                                  ;
+    PFN_vkCmdSetViewportSwizzleNV                                           CmdSetViewportSwizzleNV                                         ;
+    PFN_vkCmdSetCoverageToColorEnableNV                                     CmdSetCoverageToColorEnableNV                                   ;
+    PFN_vkCmdSetCoverageToColorLocationNV                                   CmdSetCoverageToColorLocationNV                                 ;
+    PFN_vkCmdSetCoverageModulationModeNV                                    CmdSetCoverageModulationModeNV                                  ;
+    PFN_vkCmdSetCoverageModulationTableEnableNV                             CmdSetCoverageModulationTableEnableNV                           ;
+    PFN_vkCmdSetCoverageModulationTableNV                                   CmdSetCoverageModulationTableNV                                 ;
+    PFN_vkCmdSetShadingRateImageEnableNV                                    CmdSetShadingRateImageEnableNV                                  ;
+    PFN_vkCmdSetRepresentativeFragmentTestEnableNV                          CmdSetRepresentativeFragmentTestEnableNV                        ;
+    PFN_vkCmdSetCoverageReductionModeNV                                     CmdSetCoverageReductionModeNV                                   ;
+#endif
+    /* VK_EXT_shader_module_identifier spec_version 1 */                    
+    PFN_vkGetShaderModuleIdentifierEXT                                      GetShaderModuleIdentifierEXT                                    ;
+    PFN_vkGetShaderModuleCreateInfoIdentifierEXT                            GetShaderModuleCreateInfoIdentifierEXT                          ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_NV_optical_flow spec_version 1 */                                 
+    PFN_vkCreateOpticalFlowSessionNV                                        CreateOpticalFlowSessionNV                                      ;
+    PFN_vkDestroyOpticalFlowSessionNV                                       DestroyOpticalFlowSessionNV                                     ;
+    PFN_vkBindOpticalFlowSessionImageNV                                     BindOpticalFlowSessionImageNV                                   ;
+    PFN_vkCmdOpticalFlowExecuteNV                                           CmdOpticalFlowExecuteNV                                         ;
+#endif
+    /* VK_EXT_shader_object spec_version 1 */                               
+    PFN_vkCreateShadersEXT                                                  CreateShadersEXT                                                ;
+    PFN_vkDestroyShaderEXT                                                  DestroyShaderEXT                                                ;
+    PFN_vkGetShaderBinaryDataEXT                                            GetShaderBinaryDataEXT                                          ;
+    PFN_vkCmdBindShadersEXT                                                 CmdBindShadersEXT                                               ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_QCOM_tile_properties spec_version 1 */                            
+    PFN_vkGetFramebufferTilePropertiesQCOM                                  GetFramebufferTilePropertiesQCOM                                ;
+    PFN_vkGetDynamicRenderingTilePropertiesQCOM                             GetDynamicRenderingTilePropertiesQCOM                           ;
+    /* VK_NV_low_latency2 spec_version 2 */                                 
+    PFN_vkSetLatencySleepModeNV                                             SetLatencySleepModeNV                                           ;
+    PFN_vkLatencySleepNV                                                    LatencySleepNV                                                  ;
+    PFN_vkSetLatencyMarkerNV                                                SetLatencyMarkerNV                                              ;
+    PFN_vkGetLatencyTimingsNV                                               GetLatencyTimingsNV                                             ;
+    PFN_vkQueueNotifyOutOfBandNV                                            QueueNotifyOutOfBandNV                                          ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_EXT_attachment_feedback_loop_dynamic_state spec_version 1 */      
+    PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT                             CmdSetAttachmentFeedbackLoopEnableEXT                           ;
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
+    /* VK_KHR_acceleration_structure spec_version 13 */                     
+    PFN_vkCreateAccelerationStructureKHR                                    CreateAccelerationStructureKHR                                  ;
+    PFN_vkDestroyAccelerationStructureKHR                                   DestroyAccelerationStructureKHR                                 ;
+    PFN_vkCmdBuildAccelerationStructuresKHR                                 CmdBuildAccelerationStructuresKHR                               ;
+    PFN_vkCmdBuildAccelerationStructuresIndirectKHR                         CmdBuildAccelerationStructuresIndirectKHR                       ;
+    PFN_vkBuildAccelerationStructuresKHR                                    BuildAccelerationStructuresKHR                                  ;
+    PFN_vkCopyAccelerationStructureKHR                                      CopyAccelerationStructureKHR                                    ;
+    PFN_vkCopyAccelerationStructureToMemoryKHR                              CopyAccelerationStructureToMemoryKHR                            ;
+    PFN_vkCopyMemoryToAccelerationStructureKHR                              CopyMemoryToAccelerationStructureKHR                            ;
+    PFN_vkWriteAccelerationStructuresPropertiesKHR                          WriteAccelerationStructuresPropertiesKHR                        ;
+    PFN_vkCmdCopyAccelerationStructureKHR                                   CmdCopyAccelerationStructureKHR                                 ;
+    PFN_vkCmdCopyAccelerationStructureToMemoryKHR                           CmdCopyAccelerationStructureToMemoryKHR                         ;
+    PFN_vkCmdCopyMemoryToAccelerationStructureKHR                           CmdCopyMemoryToAccelerationStructureKHR                         ;
+    PFN_vkGetAccelerationStructureDeviceAddressKHR                          GetAccelerationStructureDeviceAddressKHR                        ;
+    PFN_vkCmdWriteAccelerationStructuresPropertiesKHR                       CmdWriteAccelerationStructuresPropertiesKHR                     ;
+    PFN_vkGetDeviceAccelerationStructureCompatibilityKHR                    GetDeviceAccelerationStructureCompatibilityKHR                  ;
+    PFN_vkGetAccelerationStructureBuildSizesKHR                             GetAccelerationStructureBuildSizesKHR                           ;
+    /* VK_KHR_ray_tracing_pipeline spec_version 1 */                        
+    PFN_vkCmdTraceRaysKHR                                                   CmdTraceRaysKHR                                                 ;
+    PFN_vkCreateRayTracingPipelinesKHR                                      CreateRayTracingPipelinesKHR                                    ;
+    PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR                   GetRayTracingCaptureReplayShaderGroupHandlesKHR                 ;
+    PFN_vkCmdTraceRaysIndirectKHR                                           CmdTraceRaysIndirectKHR                                         ;
+    PFN_vkGetRayTracingShaderGroupStackSizeKHR                              GetRayTracingShaderGroupStackSizeKHR                            ;
+    PFN_vkCmdSetRayTracingPipelineStackSizeKHR                              CmdSetRayTracingPipelineStackSizeKHR                            ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* VK_EXT_mesh_shader spec_version 1 */                                 
+    PFN_vkCmdDrawMeshTasksEXT                                               CmdDrawMeshTasksEXT                                             ;
+    PFN_vkCmdDrawMeshTasksIndirectEXT                                       CmdDrawMeshTasksIndirectEXT                                     ;
+    PFN_vkCmdDrawMeshTasksIndirectCountEXT                                  CmdDrawMeshTasksIndirectCountEXT                                ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_ANDROID_external_memory_android_hardware_buffer spec_version 5 */ 
+    PFN_vkGetAndroidHardwareBufferPropertiesANDROID                         GetAndroidHardwareBufferPropertiesANDROID                       ;
+    PFN_vkGetMemoryAndroidHardwareBufferANDROID                             GetMemoryAndroidHardwareBufferANDROID                           ;
+    /* VK_FUCHSIA_external_memory spec_version 1 */                         
+    PFN_vkGetMemoryZirconHandleFUCHSIA                                      GetMemoryZirconHandleFUCHSIA                                    ;
+    PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA                            GetMemoryZirconHandlePropertiesFUCHSIA                          ;
+    /* VK_FUCHSIA_external_semaphore spec_version 1 */                      
+    PFN_vkImportSemaphoreZirconHandleFUCHSIA                                ImportSemaphoreZirconHandleFUCHSIA                              ;
+    PFN_vkGetSemaphoreZirconHandleFUCHSIA                                   GetSemaphoreZirconHandleFUCHSIA                                 ;
+    /* VK_FUCHSIA_buffer_collection spec_version 2 */                       
+    PFN_vkCreateBufferCollectionFUCHSIA                                     CreateBufferCollectionFUCHSIA                                   ;
+    PFN_vkSetBufferCollectionImageConstraintsFUCHSIA                        SetBufferCollectionImageConstraintsFUCHSIA                      ;
+    PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA                       SetBufferCollectionBufferConstraintsFUCHSIA                     ;
+    PFN_vkDestroyBufferCollectionFUCHSIA                                    DestroyBufferCollectionFUCHSIA                                  ;
+    PFN_vkGetBufferCollectionPropertiesFUCHSIA                              GetBufferCollectionPropertiesFUCHSIA                            ;
+#endif
+    /* VK_EXT_metal_objects spec_version 2 */                               
+    PFN_vkExportMetalObjectsEXT                                             ExportMetalObjectsEXT                                           ;
+    /* VK_KHR_external_memory_win32 spec_version 1 */                       
+    PFN_vkGetMemoryWin32HandleKHR                                           GetMemoryWin32HandleKHR                                         ;
+    PFN_vkGetMemoryWin32HandlePropertiesKHR                                 GetMemoryWin32HandlePropertiesKHR                               ;
+    /* VK_KHR_external_semaphore_win32 spec_version 1 */                    
+    PFN_vkImportSemaphoreWin32HandleKHR                                     ImportSemaphoreWin32HandleKHR                                   ;
+    PFN_vkGetSemaphoreWin32HandleKHR                                        GetSemaphoreWin32HandleKHR                                      ;
+    /* VK_KHR_external_fence_win32 spec_version 1 */                        
+    PFN_vkImportFenceWin32HandleKHR                                         ImportFenceWin32HandleKHR                                       ;
+    PFN_vkGetFenceWin32HandleKHR                                            GetFenceWin32HandleKHR                                          ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_NV_external_memory_win32 spec_version 1 */                        
+    PFN_vkGetMemoryWin32HandleNV                                            GetMemoryWin32HandleNV                                          ;
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
+    /* VK_EXT_full_screen_exclusive spec_version 4 */                       
+    PFN_vkAcquireFullScreenExclusiveModeEXT                                 AcquireFullScreenExclusiveModeEXT                               ;
+    PFN_vkReleaseFullScreenExclusiveModeEXT                                 ReleaseFullScreenExclusiveModeEXT                               ;
+    PFN_vkGetDeviceGroupSurfacePresentModes2EXT                             GetDeviceGroupSurfacePresentModes2EXT                           ;
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_QNX_external_memory_screen_buffer spec_version 1 */               
+    PFN_vkGetScreenBufferPropertiesQNX                                      GetScreenBufferPropertiesQNX                                    ;
+    /* VK_AMDX_shader_enqueue spec_version 2 */
+    PFN_vkCreateExecutionGraphPipelinesAMDX                                 CreateExecutionGraphPipelinesAMDX                               ;
+    PFN_vkGetExecutionGraphPipelineScratchSizeAMDX                          GetExecutionGraphPipelineScratchSizeAMDX                        ;
+    PFN_vkGetExecutionGraphPipelineNodeIndexAMDX                            GetExecutionGraphPipelineNodeIndexAMDX                          ;
+    PFN_vkCmdInitializeGraphScratchMemoryAMDX                               CmdInitializeGraphScratchMemoryAMDX                             ;
+    PFN_vkCmdDispatchGraphAMDX                                              CmdDispatchGraphAMDX                                            ;
+    PFN_vkCmdDispatchGraphIndirectAMDX                                      CmdDispatchGraphIndirectAMDX                                    ;
+    PFN_vkCmdDispatchGraphIndirectCountAMDX                                 CmdDispatchGraphIndirectCountAMDX                               ;
+#endif
+        /* Additions from 1.3.284 to 1.4.309: */
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* to VK_NVX_image_view_handle spec_version 3 */
+    PFN_vkGetImageViewHandle64NVX                                           GetImageViewHandle64NVX                                         ;
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
+    /* to VK_EXT_shader_object spec_version 1 */
+    PFN_vkCmdSetDepthClampRangeEXT                                          CmdSetDepthClampRangeEXT                                        ;
+#endif
+    /* VK_VERSION_1_4 */
+    PFN_vkCmdSetLineStipple                                                 CmdSetLineStipple                                               ;
+    PFN_vkMapMemory2                                                        MapMemory2                                                      ;
+    PFN_vkUnmapMemory2                                                      UnmapMemory2                                                    ;
+    PFN_vkCmdBindIndexBuffer2                                               CmdBindIndexBuffer2                                             ;
+    PFN_vkGetRenderingAreaGranularity                                       GetRenderingAreaGranularity                                     ;
+    PFN_vkGetDeviceImageSubresourceLayout                                   GetDeviceImageSubresourceLayout                                 ;
+    PFN_vkGetImageSubresourceLayout2                                        GetImageSubresourceLayout2                                      ;
+    PFN_vkCmdPushDescriptorSet                                              CmdPushDescriptorSet                                            ;
+    PFN_vkCmdPushDescriptorSetWithTemplate                                  CmdPushDescriptorSetWithTemplate                                ;
+    PFN_vkCmdSetRenderingAttachmentLocations                                CmdSetRenderingAttachmentLocations                              ;
+    PFN_vkCmdSetRenderingInputAttachmentIndices                             CmdSetRenderingInputAttachmentIndices                           ;
+    PFN_vkCmdBindDescriptorSets2                                            CmdBindDescriptorSets2                                          ;
+    PFN_vkCmdPushConstants2                                                 CmdPushConstants2                                               ;
+    PFN_vkCmdPushDescriptorSet2                                             CmdPushDescriptorSet2                                           ;
+    PFN_vkCmdPushDescriptorSetWithTemplate2                                 CmdPushDescriptorSetWithTemplate2                               ;
+    PFN_vkCopyMemoryToImage                                                 CopyMemoryToImage                                               ;
+    PFN_vkCopyImageToMemory                                                 CopyImageToMemory                                               ;
+    PFN_vkCopyImageToImage                                                  CopyImageToImage                                                ;
+    PFN_vkTransitionImageLayout                                             TransitionImageLayout                                           ;
+    /* VK_KHR_pipeline_binary spec_version 1 */
+    PFN_vkCreatePipelineBinariesKHR                                         CreatePipelineBinariesKHR                                       ;
+    PFN_vkDestroyPipelineBinaryKHR                                          DestroyPipelineBinaryKHR                                        ;
+    PFN_vkGetPipelineKeyKHR                                                 GetPipelineKeyKHR                                               ;
+    PFN_vkGetPipelineBinaryDataKHR                                          GetPipelineBinaryDataKHR                                        ;
+    PFN_vkReleaseCapturedPipelineDataKHR                                    ReleaseCapturedPipelineDataKHR                                  ;
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
+    /* VK_AMD_anti_lag spec_version 1 */
+    PFN_vkAntiLagUpdateAMD                                                  AntiLagUpdateAMD                                                ;
+    /* VK_NV_cooperative_vector spec_version 4 */
+    PFN_vkConvertCooperativeVectorMatrixNV                                  ConvertCooperativeVectorMatrixNV                                ;
+    PFN_vkCmdConvertCooperativeVectorMatrixNV                               CmdConvertCooperativeVectorMatrixNV                             ;
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
+    /* VK_NV_cluster_acceleration_structure spec_version 2 */
+    PFN_vkGetClusterAccelerationStructureBuildSizesNV                       GetClusterAccelerationStructureBuildSizesNV                     ;
+    PFN_vkCmdBuildClusterAccelerationStructureIndirectNV                    CmdBuildClusterAccelerationStructureIndirectNV                  ;
+    /* VK_NV_partitioned_acceleration_structure spec_version 1 */
+    PFN_vkGetPartitionedAccelerationStructuresBuildSizesNV                  GetPartitionedAccelerationStructuresBuildSizesNV                ;
+    PFN_vkCmdBuildPartitionedAccelerationStructuresNV                       CmdBuildPartitionedAccelerationStructuresNV                     ;
+#endif
+    /* VK_EXT_device_generated_commands spec_version 1 */
+    PFN_vkGetGeneratedCommandsMemoryRequirementsEXT                         GetGeneratedCommandsMemoryRequirementsEXT                       ;
+    PFN_vkCmdPreprocessGeneratedCommandsEXT                                 CmdPreprocessGeneratedCommandsEXT                               ;
+    PFN_vkCmdExecuteGeneratedCommandsEXT                                    CmdExecuteGeneratedCommandsEXT                                  ;
+    PFN_vkCreateIndirectCommandsLayoutEXT                                   CreateIndirectCommandsLayoutEXT                                 ;
+    PFN_vkDestroyIndirectCommandsLayoutEXT                                  DestroyIndirectCommandsLayoutEXT                                ;
+    PFN_vkCreateIndirectExecutionSetEXT                                     CreateIndirectExecutionSetEXT                                   ;
+    PFN_vkDestroyIndirectExecutionSetEXT                                    DestroyIndirectExecutionSetEXT                                  ;
+    PFN_vkUpdateIndirectExecutionSetPipelineEXT                             UpdateIndirectExecutionSetPipelineEXT                           ;
+    PFN_vkUpdateIndirectExecutionSetShaderEXT                               UpdateIndirectExecutionSetShaderEXT                             ;
+    /* VK_EXT_external_memory_metal spec_version 1 */
+    PFN_vkGetMemoryMetalHandleEXT                                           GetMemoryMetalHandleEXT                                         ;
+    PFN_vkGetMemoryMetalHandlePropertiesEXT                                 GetMemoryMetalHandlePropertiesEXT                               ;
+} VkadDeviceFunctions;
+#endif
+
+/* the index of every member in the order of the default layout, the same as in the load tables and availability sets below */
+typedef enum VkadInstanceFunctionId {
+    /* VK_VERSION_1_0 */
+    VKAD_INSTANCE_FUNCTION_ID_DestroyInstance,
+    VKAD_INSTANCE_FUNCTION_ID_EnumeratePhysicalDevices,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFeatures,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFormatProperties,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceImageFormatProperties,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceProperties,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceQueueFamilyProperties,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceMemoryProperties,
+    VKAD_INSTANCE_FUNCTION_ID_EnumerateDeviceExtensionProperties,
+    VKAD_INSTANCE_FUNCTION_ID_EnumerateDeviceLayerProperties,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSparseImageFormatProperties,
+    VKAD_INSTANCE_FUNCTION_ID_CreateDevice,
+    VKAD_INSTANCE_FUNCTION_ID_GetDeviceProcAddr,
+    /* VK_VERSION_1_1 */
+    VKAD_INSTANCE_FUNCTION_ID_EnumeratePhysicalDeviceGroups,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFeatures2,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceProperties2,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFormatProperties2,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceImageFormatProperties2,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceQueueFamilyProperties2,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceMemoryProperties2,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSparseImageFormatProperties2,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalBufferProperties,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalFenceProperties,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalSemaphoreProperties,
+    /* VK_VERSION_1_3 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceToolProperties,
+    /* VK_KHR_surface spec_version 25  */
+    VKAD_INSTANCE_FUNCTION_ID_DestroySurfaceKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfaceSupportKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfaceCapabilitiesKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfaceFormatsKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfacePresentModesKHR,
+    /* VK_KHR_swapchain spec_version 70  */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDevicePresentRectanglesKHR,
+    /* VK_KHR_display spec_version 23  */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceDisplayPropertiesKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceDisplayPlanePropertiesKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetDisplayPlaneSupportedDisplaysKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetDisplayModePropertiesKHR,
+    VKAD_INSTANCE_FUNCTION_ID_CreateDisplayModeKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetDisplayPlaneCapabilitiesKHR,
+    VKAD_INSTANCE_FUNCTION_ID_CreateDisplayPlaneSurfaceKHR,
+    /* VK_KHR_video_queue spec_version 8 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceVideoCapabilitiesKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceVideoFormatPropertiesKHR,
+    /* VK_KHR_get_physical_device_properties2 spec_version 2 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFeatures2KHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceProperties2KHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFormatProperties2KHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceImageFormatProperties2KHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceQueueFamilyProperties2KHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceMemoryProperties2KHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSparseImageFormatProperties2KHR,
+    /* VK_KHR_device_group_creation spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_EnumeratePhysicalDeviceGroupsKHR,
+    /* VK_KHR_external_memory_capabilities spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalBufferPropertiesKHR,
+    /* VK_KHR_external_semaphore_capabilities spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalSemaphorePropertiesKHR,
+    /* VK_KHR_external_fence_capabilities spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalFencePropertiesKHR,
+    /* VK_KHR_performance_query spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR,
+    /* VK_KHR_get_surface_capabilities2 spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfaceCapabilities2KHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfaceFormats2KHR,
+    /* VK_KHR_get_display_properties2 spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceDisplayProperties2KHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceDisplayPlaneProperties2KHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetDisplayModeProperties2KHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetDisplayPlaneCapabilities2KHR,
+    /* VK_KHR_fragment_shading_rate spec_version 2 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFragmentShadingRatesKHR,
+    /* VK_KHR_video_encode_queue spec_version 12 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR,
+    /* VK_KHR_cooperative_matrix spec_version 2 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceCooperativeMatrixPropertiesKHR,
+    /* VK_KHR_calibrated_timestamps spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceCalibrateableTimeDomainsKHR,
+    /* VK_EXT_debug_report spec_version 10 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateDebugReportCallbackEXT,
+    VKAD_INSTANCE_FUNCTION_ID_DestroyDebugReportCallbackEXT,
+    VKAD_INSTANCE_FUNCTION_ID_DebugReportMessageEXT,
+    /* VK_NV_external_memory_capabilities spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalImageFormatPropertiesNV,
+    /* VK_EXT_direct_mode_display spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_ReleaseDisplayEXT,
+    /* VK_EXT_display_surface_counter spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfaceCapabilities2EXT,
+    /* VK_EXT_debug_utils spec_version 2 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateDebugUtilsMessengerEXT,
+    VKAD_INSTANCE_FUNCTION_ID_DestroyDebugUtilsMessengerEXT,
+    VKAD_INSTANCE_FUNCTION_ID_SubmitDebugUtilsMessageEXT,
+    /* VK_EXT_sample_locations spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceMultisamplePropertiesEXT,
+    /* VK_EXT_calibrated_timestamps spec_version 2 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceCalibrateableTimeDomainsEXT,
+    /* VK_EXT_tooling_info spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceToolPropertiesEXT,
+    /* VK_NV_cooperative_matrix spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceCooperativeMatrixPropertiesNV,
+    /* VK_NV_coverage_reduction_mode spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV,
+    /* VK_EXT_headless_surface spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateHeadlessSurfaceEXT,
+    /* VK_EXT_acquire_drm_display spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_AcquireDrmDisplayEXT,
+    VKAD_INSTANCE_FUNCTION_ID_GetDrmDisplayEXT,
+    /* VK_NV_optical_flow spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceOpticalFlowImageFormatsNV,
+    /* VK_KHR_android_surface spec_version 6 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateAndroidSurfaceKHR,
+    /* VK_FUCHSIA_imagepipe_surface spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateImagePipeSurfaceFUCHSIA,
+    /* VK_MVK_ios_surface spec_version 3 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateIOSSurfaceMVK,
+    /* VK_MVK_macos_surface spec_version 3 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateMacOSSurfaceMVK,
+    /* VK_EXT_metal_surface spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateMetalSurfaceEXT,
+    /* VK_NN_vi_surface spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateViSurfaceNN,
+    /* VK_KHR_wayland_surface spec_version 6 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateWaylandSurfaceKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceWaylandPresentationSupportKHR,
+    /* VK_KHR_win32_surface spec_version 6 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateWin32SurfaceKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceWin32PresentationSupportKHR,
+    /* VK_EXT_full_screen_exclusive spec_version 4 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSurfacePresentModes2EXT,
+    /* VK_NV_acquire_winrt_display spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_AcquireWinrtDisplayNV,
+    VKAD_INSTANCE_FUNCTION_ID_GetWinrtDisplayNV,
+    /* VK_KHR_xcb_surface spec_version 6 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateXcbSurfaceKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceXcbPresentationSupportKHR,
+    /* VK_KHR_xlib_surface spec_version 6 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateXlibSurfaceKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceXlibPresentationSupportKHR,
+    /* VK_EXT_directfb_surface spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateDirectFBSurfaceEXT,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceDirectFBPresentationSupportEXT,
+    /* VK_EXT_acquire_xlib_display spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_AcquireXlibDisplayEXT,
+    VKAD_INSTANCE_FUNCTION_ID_GetRandROutputDisplayEXT,
+    /* VK_GGP_stream_descriptor_surface spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateStreamDescriptorSurfaceGGP,
+    /* VK_QNX_screen_surface spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_CreateScreenSurfaceQNX,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceScreenPresentationSupportQNX,
+    /* Additions from 1.3.284 to 1.4.309: */
+    /* VK_NV_cooperative_vector spec_version 4 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceCooperativeVectorPropertiesNV,
+    /* VK_NV_cooperative_matrix2 spec_version 1 */
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV,
+    VKAD_INSTANCE_FUNCTION_ID_COUNT
+} VkadInstanceFunctionId;
+typedef enum VkadDeviceFunctionId {
+    /* VK_VERSION_1_0 */
+    VKAD_DEVICE_FUNCTION_ID_DestroyDevice,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceQueue,
+    VKAD_DEVICE_FUNCTION_ID_QueueSubmit,
+    VKAD_DEVICE_FUNCTION_ID_QueueWaitIdle,
+    VKAD_DEVICE_FUNCTION_ID_DeviceWaitIdle,
+    VKAD_DEVICE_FUNCTION_ID_AllocateMemory,
+    VKAD_DEVICE_FUNCTION_ID_FreeMemory,
+    VKAD_DEVICE_FUNCTION_ID_MapMemory,
+    VKAD_DEVICE_FUNCTION_ID_UnmapMemory,
+    VKAD_DEVICE_FUNCTION_ID_FlushMappedMemoryRanges,
+    VKAD_DEVICE_FUNCTION_ID_InvalidateMappedMemoryRanges,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceMemoryCommitment,
+    VKAD_DEVICE_FUNCTION_ID_BindBufferMemory,
+    VKAD_DEVICE_FUNCTION_ID_BindImageMemory,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferMemoryRequirements,
+    VKAD_DEVICE_FUNCTION_ID_GetImageMemoryRequirements,
+    VKAD_DEVICE_FUNCTION_ID_GetImageSparseMemoryRequirements,
+    VKAD_DEVICE_FUNCTION_ID_QueueBindSparse,
+    VKAD_DEVICE_FUNCTION_ID_CreateFence,
+    VKAD_DEVICE_FUNCTION_ID_DestroyFence,
+    VKAD_DEVICE_FUNCTION_ID_ResetFences,
+    VKAD_DEVICE_FUNCTION_ID_GetFenceStatus,
+    VKAD_DEVICE_FUNCTION_ID_WaitForFences,
+    VKAD_DEVICE_FUNCTION_ID_CreateSemaphore,
+    VKAD_DEVICE_FUNCTION_ID_DestroySemaphore,
+    VKAD_DEVICE_FUNCTION_ID_CreateEvent,
+    VKAD_DEVICE_FUNCTION_ID_DestroyEvent,
+    VKAD_DEVICE_FUNCTION_ID_GetEventStatus,
+    VKAD_DEVICE_FUNCTION_ID_SetEvent,
+    VKAD_DEVICE_FUNCTION_ID_ResetEvent,
+    VKAD_DEVICE_FUNCTION_ID_CreateQueryPool,
+    VKAD_DEVICE_FUNCTION_ID_DestroyQueryPool,
+    VKAD_DEVICE_FUNCTION_ID_GetQueryPoolResults,
+    VKAD_DEVICE_FUNCTION_ID_CreateBuffer,
+    VKAD_DEVICE_FUNCTION_ID_DestroyBuffer,
+    VKAD_DEVICE_FUNCTION_ID_CreateBufferView,
+    VKAD_DEVICE_FUNCTION_ID_DestroyBufferView,
+    VKAD_DEVICE_FUNCTION_ID_CreateImage,
+    VKAD_DEVICE_FUNCTION_ID_DestroyImage,
+    VKAD_DEVICE_FUNCTION_ID_GetImageSubresourceLayout,
+    VKAD_DEVICE_FUNCTION_ID_CreateImageView,
+    VKAD_DEVICE_FUNCTION_ID_DestroyImageView,
+    VKAD_DEVICE_FUNCTION_ID_CreateShaderModule,
+    VKAD_DEVICE_FUNCTION_ID_DestroyShaderModule,
+    VKAD_DEVICE_FUNCTION_ID_CreatePipelineCache,
+    VKAD_DEVICE_FUNCTION_ID_DestroyPipelineCache,
+    VKAD_DEVICE_FUNCTION_ID_GetPipelineCacheData,
+    VKAD_DEVICE_FUNCTION_ID_MergePipelineCaches,
+    VKAD_DEVICE_FUNCTION_ID_CreateGraphicsPipelines,
+    VKAD_DEVICE_FUNCTION_ID_CreateComputePipelines,
+    VKAD_DEVICE_FUNCTION_ID_DestroyPipeline,
+    VKAD_DEVICE_FUNCTION_ID_CreatePipelineLayout,
+    VKAD_DEVICE_FUNCTION_ID_DestroyPipelineLayout,
+    VKAD_DEVICE_FUNCTION_ID_CreateSampler,
+    VKAD_DEVICE_FUNCTION_ID_DestroySampler,
+    VKAD_DEVICE_FUNCTION_ID_CreateDescriptorSetLayout,
+    VKAD_DEVICE_FUNCTION_ID_DestroyDescriptorSetLayout,
+    VKAD_DEVICE_FUNCTION_ID_CreateDescriptorPool,
+    VKAD_DEVICE_FUNCTION_ID_DestroyDescriptorPool,
+    VKAD_DEVICE_FUNCTION_ID_ResetDescriptorPool,
+    VKAD_DEVICE_FUNCTION_ID_AllocateDescriptorSets,
+    VKAD_DEVICE_FUNCTION_ID_FreeDescriptorSets,
+    VKAD_DEVICE_FUNCTION_ID_UpdateDescriptorSets,
+    VKAD_DEVICE_FUNCTION_ID_CreateFramebuffer,
+    VKAD_DEVICE_FUNCTION_ID_DestroyFramebuffer,
+    VKAD_DEVICE_FUNCTION_ID_CreateRenderPass,
+    VKAD_DEVICE_FUNCTION_ID_DestroyRenderPass,
+    VKAD_DEVICE_FUNCTION_ID_GetRenderAreaGranularity,
+    VKAD_DEVICE_FUNCTION_ID_CreateCommandPool,
+    VKAD_DEVICE_FUNCTION_ID_DestroyCommandPool,
+    VKAD_DEVICE_FUNCTION_ID_ResetCommandPool,
+    VKAD_DEVICE_FUNCTION_ID_AllocateCommandBuffers,
+    VKAD_DEVICE_FUNCTION_ID_FreeCommandBuffers,
+    VKAD_DEVICE_FUNCTION_ID_BeginCommandBuffer,
+    VKAD_DEVICE_FUNCTION_ID_EndCommandBuffer,
+    VKAD_DEVICE_FUNCTION_ID_ResetCommandBuffer,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindPipeline,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetViewport,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetScissor,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetLineWidth,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthBias,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetBlendConstants,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthBounds,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetStencilCompareMask,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetStencilWriteMask,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetStencilReference,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindDescriptorSets,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindIndexBuffer,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindVertexBuffers,
+    VKAD_DEVICE_FUNCTION_ID_CmdDraw,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndexed,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndirect,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndexedIndirect,
+    VKAD_DEVICE_FUNCTION_ID_CmdDispatch,
+    VKAD_DEVICE_FUNCTION_ID_CmdDispatchIndirect,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyBuffer,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyImage,
+    VKAD_DEVICE_FUNCTION_ID_CmdBlitImage,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyBufferToImage,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyImageToBuffer,
+    VKAD_DEVICE_FUNCTION_ID_CmdUpdateBuffer,
+    VKAD_DEVICE_FUNCTION_ID_CmdFillBuffer,
+    VKAD_DEVICE_FUNCTION_ID_CmdClearColorImage,
+    VKAD_DEVICE_FUNCTION_ID_CmdClearDepthStencilImage,
+    VKAD_DEVICE_FUNCTION_ID_CmdClearAttachments,
+    VKAD_DEVICE_FUNCTION_ID_CmdResolveImage,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetEvent,
+    VKAD_DEVICE_FUNCTION_ID_CmdResetEvent,
+    VKAD_DEVICE_FUNCTION_ID_CmdWaitEvents,
+    VKAD_DEVICE_FUNCTION_ID_CmdPipelineBarrier,
+    VKAD_DEVICE_FUNCTION_ID_CmdBeginQuery,
+    VKAD_DEVICE_FUNCTION_ID_CmdEndQuery,
+    VKAD_DEVICE_FUNCTION_ID_CmdResetQueryPool,
+    VKAD_DEVICE_FUNCTION_ID_CmdWriteTimestamp,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyQueryPoolResults,
+    VKAD_DEVICE_FUNCTION_ID_CmdPushConstants,
+    VKAD_DEVICE_FUNCTION_ID_CmdBeginRenderPass,
+    VKAD_DEVICE_FUNCTION_ID_CmdNextSubpass,
+    VKAD_DEVICE_FUNCTION_ID_CmdEndRenderPass,
+    VKAD_DEVICE_FUNCTION_ID_CmdExecuteCommands,
+    /* VK_VERSION_1_1 */
+    VKAD_DEVICE_FUNCTION_ID_BindBufferMemory2,
+    VKAD_DEVICE_FUNCTION_ID_BindImageMemory2,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceGroupPeerMemoryFeatures,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDeviceMask,
+    VKAD_DEVICE_FUNCTION_ID_CmdDispatchBase,
+    VKAD_DEVICE_FUNCTION_ID_GetImageMemoryRequirements2,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferMemoryRequirements2,
+    VKAD_DEVICE_FUNCTION_ID_GetImageSparseMemoryRequirements2,
+    VKAD_DEVICE_FUNCTION_ID_TrimCommandPool,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceQueue2,
+    VKAD_DEVICE_FUNCTION_ID_CreateSamplerYcbcrConversion,
+    VKAD_DEVICE_FUNCTION_ID_DestroySamplerYcbcrConversion,
+    VKAD_DEVICE_FUNCTION_ID_CreateDescriptorUpdateTemplate,
+    VKAD_DEVICE_FUNCTION_ID_DestroyDescriptorUpdateTemplate,
+    VKAD_DEVICE_FUNCTION_ID_UpdateDescriptorSetWithTemplate,
+    VKAD_DEVICE_FUNCTION_ID_GetDescriptorSetLayoutSupport,
+    /* VK_VERSION_1_2 */
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndirectCount,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndexedIndirectCount,
+    VKAD_DEVICE_FUNCTION_ID_CreateRenderPass2,
+    VKAD_DEVICE_FUNCTION_ID_CmdBeginRenderPass2,
+    VKAD_DEVICE_FUNCTION_ID_CmdNextSubpass2,
+    VKAD_DEVICE_FUNCTION_ID_CmdEndRenderPass2,
+    VKAD_DEVICE_FUNCTION_ID_ResetQueryPool,
+    VKAD_DEVICE_FUNCTION_ID_GetSemaphoreCounterValue,
+    VKAD_DEVICE_FUNCTION_ID_WaitSemaphores,
+    VKAD_DEVICE_FUNCTION_ID_SignalSemaphore,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferDeviceAddress,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferOpaqueCaptureAddress,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceMemoryOpaqueCaptureAddress,
+    /* VK_VERSION_1_3 */
+    VKAD_DEVICE_FUNCTION_ID_CreatePrivateDataSlot,
+    VKAD_DEVICE_FUNCTION_ID_DestroyPrivateDataSlot,
+    VKAD_DEVICE_FUNCTION_ID_SetPrivateData,
+    VKAD_DEVICE_FUNCTION_ID_GetPrivateData,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetEvent2,
+    VKAD_DEVICE_FUNCTION_ID_CmdResetEvent2,
+    VKAD_DEVICE_FUNCTION_ID_CmdWaitEvents2,
+    VKAD_DEVICE_FUNCTION_ID_CmdPipelineBarrier2,
+    VKAD_DEVICE_FUNCTION_ID_CmdWriteTimestamp2,
+    VKAD_DEVICE_FUNCTION_ID_QueueSubmit2,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyBuffer2,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyImage2,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyBufferToImage2,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyImageToBuffer2,
+    VKAD_DEVICE_FUNCTION_ID_CmdBlitImage2,
+    VKAD_DEVICE_FUNCTION_ID_CmdResolveImage2,
+    VKAD_DEVICE_FUNCTION_ID_CmdBeginRendering,
+    VKAD_DEVICE_FUNCTION_ID_CmdEndRendering,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetCullMode,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetFrontFace,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetPrimitiveTopology,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetViewportWithCount,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetScissorWithCount,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindVertexBuffers2,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthTestEnable,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthWriteEnable,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthCompareOp,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthBoundsTestEnable,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetStencilTestEnable,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetStencilOp,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetRasterizerDiscardEnable,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthBiasEnable,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetPrimitiveRestartEnable,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceBufferMemoryRequirements,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceImageMemoryRequirements,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceImageSparseMemoryRequirements,
+    /* VK_KHR_swapchain spec_version 70  */
+    VKAD_DEVICE_FUNCTION_ID_CreateSwapchainKHR,
+    VKAD_DEVICE_FUNCTION_ID_DestroySwapchainKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetSwapchainImagesKHR,
+    VKAD_DEVICE_FUNCTION_ID_AcquireNextImageKHR,
+    VKAD_DEVICE_FUNCTION_ID_QueuePresentKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceGroupPresentCapabilitiesKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceGroupSurfacePresentModesKHR,
+    VKAD_DEVICE_FUNCTION_ID_AcquireNextImage2KHR,
+    /* VK_KHR_display_swapchain spec_version 10  */
+    VKAD_DEVICE_FUNCTION_ID_CreateSharedSwapchainsKHR,
+    /* VK_KHR_video_queue spec_version 8 */
+    VKAD_DEVICE_FUNCTION_ID_CreateVideoSessionKHR,
+    VKAD_DEVICE_FUNCTION_ID_DestroyVideoSessionKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetVideoSessionMemoryRequirementsKHR,
+    VKAD_DEVICE_FUNCTION_ID_BindVideoSessionMemoryKHR,
+    VKAD_DEVICE_FUNCTION_ID_CreateVideoSessionParametersKHR,
+    VKAD_DEVICE_FUNCTION_ID_UpdateVideoSessionParametersKHR,
+    VKAD_DEVICE_FUNCTION_ID_DestroyVideoSessionParametersKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdBeginVideoCodingKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdEndVideoCodingKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdControlVideoCodingKHR,
+    /* VK_KHR_video_decode_queue spec_version 8 */
+    VKAD_DEVICE_FUNCTION_ID_CmdDecodeVideoKHR,
+    /* VK_KHR_dynamic_rendering spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdBeginRenderingKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdEndRenderingKHR,
+    /* VK_KHR_device_group spec_version 4 */
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceGroupPeerMemoryFeaturesKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDeviceMaskKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdDispatchBaseKHR,
+    /* VK_KHR_maintenance1 spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_TrimCommandPoolKHR,
+    /* VK_KHR_external_memory_fd spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryFdKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryFdPropertiesKHR,
+    /* VK_KHR_external_semaphore_fd spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_ImportSemaphoreFdKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetSemaphoreFdKHR,
+    /* VK_KHR_push_descriptor spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSetKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSetWithTemplateKHR,
+    /* VK_KHR_descriptor_update_template spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CreateDescriptorUpdateTemplateKHR,
+    VKAD_DEVICE_FUNCTION_ID_DestroyDescriptorUpdateTemplateKHR,
+    VKAD_DEVICE_FUNCTION_ID_UpdateDescriptorSetWithTemplateKHR,
+    /* VK_KHR_create_renderpass2 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CreateRenderPass2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdBeginRenderPass2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdNextSubpass2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdEndRenderPass2KHR,
+    /* VK_KHR_shared_presentable_image spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetSwapchainStatusKHR,
+    /* VK_KHR_external_fence_fd spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_ImportFenceFdKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetFenceFdKHR,
+    /* VK_KHR_performance_query spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_AcquireProfilingLockKHR,
+    VKAD_DEVICE_FUNCTION_ID_ReleaseProfilingLockKHR,
+    /* VK_KHR_get_memory_requirements2 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetImageMemoryRequirements2KHR,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferMemoryRequirements2KHR,
+    VKAD_DEVICE_FUNCTION_ID_GetImageSparseMemoryRequirements2KHR,
+    /* VK_KHR_sampler_ycbcr_conversion spec_version 14 */
+    VKAD_DEVICE_FUNCTION_ID_CreateSamplerYcbcrConversionKHR,
+    VKAD_DEVICE_FUNCTION_ID_DestroySamplerYcbcrConversionKHR,
+    /* VK_KHR_bind_memory2 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_BindBufferMemory2KHR,
+    VKAD_DEVICE_FUNCTION_ID_BindImageMemory2KHR,
+    /* VK_KHR_maintenance3 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetDescriptorSetLayoutSupportKHR,
+    /* VK_KHR_draw_indirect_count spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndirectCountKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndexedIndirectCountKHR,
+    /* VK_KHR_timeline_semaphore spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_GetSemaphoreCounterValueKHR,
+    VKAD_DEVICE_FUNCTION_ID_WaitSemaphoresKHR,
+    VKAD_DEVICE_FUNCTION_ID_SignalSemaphoreKHR,
+    /* VK_KHR_fragment_shading_rate spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetFragmentShadingRateKHR,
+    /* VK_KHR_dynamic_rendering_local_read spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetRenderingAttachmentLocationsKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetRenderingInputAttachmentIndicesKHR,
+    /* VK_KHR_present_wait spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_WaitForPresentKHR,
+    /* VK_KHR_buffer_device_address spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetBufferDeviceAddressKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferOpaqueCaptureAddressKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceMemoryOpaqueCaptureAddressKHR,
+    /* VK_KHR_deferred_host_operations spec_version 4 */
+    VKAD_DEVICE_FUNCTION_ID_CreateDeferredOperationKHR,
+    VKAD_DEVICE_FUNCTION_ID_DestroyDeferredOperationKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetDeferredOperationMaxConcurrencyKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetDeferredOperationResultKHR,
+    VKAD_DEVICE_FUNCTION_ID_DeferredOperationJoinKHR,
+    /* VK_KHR_pipeline_executable_properties spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetPipelineExecutablePropertiesKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetPipelineExecutableStatisticsKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetPipelineExecutableInternalRepresentationsKHR,
+    /* VK_KHR_map_memory2 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_MapMemory2KHR,
+    VKAD_DEVICE_FUNCTION_ID_UnmapMemory2KHR,
+    /* VK_KHR_video_encode_queue spec_version 12 */
+    VKAD_DEVICE_FUNCTION_ID_GetEncodedVideoSessionParametersKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdEncodeVideoKHR,
+    /* VK_KHR_synchronization2 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetEvent2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdResetEvent2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdWaitEvents2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdPipelineBarrier2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdWriteTimestamp2KHR,
+    VKAD_DEVICE_FUNCTION_ID_QueueSubmit2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdWriteBufferMarker2AMD,
+    VKAD_DEVICE_FUNCTION_ID_GetQueueCheckpointData2NV,
+    /* NOTE: vkCmdWriteBufferMarker2AMD and vkGetQueueCheckpointData2NV were moved out of VK_KHR_synchronization2, see the struct */
+    /* VK_KHR_copy_commands2 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyBuffer2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyImage2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyBufferToImage2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyImageToBuffer2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdBlitImage2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdResolveImage2KHR,
+    /* VK_KHR_ray_tracing_maintenance1 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdTraceRaysIndirect2KHR,
+    /* VK_KHR_maintenance4 spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceBufferMemoryRequirementsKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceImageMemoryRequirementsKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceImageSparseMemoryRequirementsKHR,
+    /* VK_KHR_maintenance5 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdBindIndexBuffer2KHR,
+    VKAD_DEVICE_FUNCTION_ID_GetRenderingAreaGranularityKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceImageSubresourceLayoutKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetImageSubresourceLayout2KHR,
+    /* VK_KHR_line_rasterization spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetLineStippleKHR,
+    /* VK_KHR_calibrated_timestamps spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetCalibratedTimestampsKHR,
+    /* VK_KHR_maintenance6 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdBindDescriptorSets2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdPushConstants2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSet2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSetWithTemplate2KHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDescriptorBufferOffsets2EXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindDescriptorBufferEmbeddedSamplers2EXT,
+    /* VK_EXT_debug_marker spec_version 4 */
+    VKAD_DEVICE_FUNCTION_ID_DebugMarkerSetObjectTagEXT,
+    VKAD_DEVICE_FUNCTION_ID_DebugMarkerSetObjectNameEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdDebugMarkerBeginEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdDebugMarkerEndEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdDebugMarkerInsertEXT,
+    /* VK_EXT_transform_feedback spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdBindTransformFeedbackBuffersEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdBeginTransformFeedbackEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdEndTransformFeedbackEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdBeginQueryIndexedEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdEndQueryIndexedEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndirectByteCountEXT,
+    /* VK_NVX_binary_import spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CreateCuModuleNVX,
+    VKAD_DEVICE_FUNCTION_ID_CreateCuFunctionNVX,
+    VKAD_DEVICE_FUNCTION_ID_DestroyCuModuleNVX,
+    VKAD_DEVICE_FUNCTION_ID_DestroyCuFunctionNVX,
+    VKAD_DEVICE_FUNCTION_ID_CmdCuLaunchKernelNVX,
+    /* VK_NVX_image_view_handle spec_version 3 */
+    VKAD_DEVICE_FUNCTION_ID_GetImageViewHandleNVX,
+    VKAD_DEVICE_FUNCTION_ID_GetImageViewAddressNVX,
+    /* VK_AMD_draw_indirect_count spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndirectCountAMD,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndexedIndirectCountAMD,
+    /* VK_AMD_shader_info spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetShaderInfoAMD,
+    /* VK_EXT_conditional_rendering spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CmdBeginConditionalRenderingEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdEndConditionalRenderingEXT,
+    /* VK_NV_clip_space_w_scaling spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetViewportWScalingNV,
+    /* VK_EXT_display_control spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_DisplayPowerControlEXT,
+    VKAD_DEVICE_FUNCTION_ID_RegisterDeviceEventEXT,
+    VKAD_DEVICE_FUNCTION_ID_RegisterDisplayEventEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetSwapchainCounterEXT,
+    /* VK_GOOGLE_display_timing spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetRefreshCycleDurationGOOGLE,
+    VKAD_DEVICE_FUNCTION_ID_GetPastPresentationTimingGOOGLE,
+    /* VK_EXT_discard_rectangles spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDiscardRectangleEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDiscardRectangleEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDiscardRectangleModeEXT,
+    /* VK_EXT_hdr_metadata spec_version 3 */
+    VKAD_DEVICE_FUNCTION_ID_SetHdrMetadataEXT,
+    /* VK_EXT_debug_utils spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_SetDebugUtilsObjectNameEXT,
+    VKAD_DEVICE_FUNCTION_ID_SetDebugUtilsObjectTagEXT,
+    VKAD_DEVICE_FUNCTION_ID_QueueBeginDebugUtilsLabelEXT,
+    VKAD_DEVICE_FUNCTION_ID_QueueEndDebugUtilsLabelEXT,
+    VKAD_DEVICE_FUNCTION_ID_QueueInsertDebugUtilsLabelEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdBeginDebugUtilsLabelEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdEndDebugUtilsLabelEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdInsertDebugUtilsLabelEXT,
+    /* VK_EXT_sample_locations spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetSampleLocationsEXT,
+    /* VK_EXT_image_drm_format_modifier spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_GetImageDrmFormatModifierPropertiesEXT,
+    /* VK_EXT_validation_cache spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CreateValidationCacheEXT,
+    VKAD_DEVICE_FUNCTION_ID_DestroyValidationCacheEXT,
+    VKAD_DEVICE_FUNCTION_ID_MergeValidationCachesEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetValidationCacheDataEXT,
+    /* VK_NV_shading_rate_image spec_version 3 */
+    VKAD_DEVICE_FUNCTION_ID_CmdBindShadingRateImageNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetViewportShadingRatePaletteNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetCoarseSampleOrderNV,
+    /* VK_NV_ray_tracing spec_version 3 */
+    VKAD_DEVICE_FUNCTION_ID_CreateAccelerationStructureNV,
+    VKAD_DEVICE_FUNCTION_ID_DestroyAccelerationStructureNV,
+    VKAD_DEVICE_FUNCTION_ID_GetAccelerationStructureMemoryRequirementsNV,
+    VKAD_DEVICE_FUNCTION_ID_BindAccelerationStructureMemoryNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdBuildAccelerationStructureNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyAccelerationStructureNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdTraceRaysNV,
+    VKAD_DEVICE_FUNCTION_ID_CreateRayTracingPipelinesNV,
+    VKAD_DEVICE_FUNCTION_ID_GetRayTracingShaderGroupHandlesKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetRayTracingShaderGroupHandlesNV,
+    VKAD_DEVICE_FUNCTION_ID_GetAccelerationStructureHandleNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdWriteAccelerationStructuresPropertiesNV,
+    VKAD_DEVICE_FUNCTION_ID_CompileDeferredNV,
+    /* VK_EXT_external_memory_host spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryHostPointerPropertiesEXT,
+    /* VK_AMD_buffer_marker spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdWriteBufferMarkerAMD,
+    /* VK_EXT_calibrated_timestamps spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_GetCalibratedTimestampsEXT,
+    /* VK_NV_mesh_shader spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawMeshTasksNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawMeshTasksIndirectNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawMeshTasksIndirectCountNV,
+    /* VK_NV_scissor_exclusive spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetExclusiveScissorEnableNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetExclusiveScissorNV,
+    /* VK_NV_device_diagnostic_checkpoints spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetCheckpointNV,
+    VKAD_DEVICE_FUNCTION_ID_GetQueueCheckpointDataNV,
+    /* VK_INTEL_performance_query spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_InitializePerformanceApiINTEL,
+    VKAD_DEVICE_FUNCTION_ID_UninitializePerformanceApiINTEL,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetPerformanceMarkerINTEL,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetPerformanceStreamMarkerINTEL,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetPerformanceOverrideINTEL,
+    VKAD_DEVICE_FUNCTION_ID_AcquirePerformanceConfigurationINTEL,
+    VKAD_DEVICE_FUNCTION_ID_ReleasePerformanceConfigurationINTEL,
+    VKAD_DEVICE_FUNCTION_ID_QueueSetPerformanceConfigurationINTEL,
+    VKAD_DEVICE_FUNCTION_ID_GetPerformanceParameterINTEL,
+    /* VK_AMD_display_native_hdr spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_SetLocalDimmingAMD,
+    /* VK_EXT_buffer_device_address spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_GetBufferDeviceAddressEXT,
+    /* VK_EXT_line_rasterization spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetLineStippleEXT,
+    /* VK_EXT_host_query_reset spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_ResetQueryPoolEXT,
+    /* VK_EXT_extended_dynamic_state spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetCullModeEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetFrontFaceEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetPrimitiveTopologyEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetViewportWithCountEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetScissorWithCountEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindVertexBuffers2EXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthTestEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthWriteEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthCompareOpEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthBoundsTestEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetStencilTestEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetStencilOpEXT,
+    /* VK_EXT_host_image_copy spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CopyMemoryToImageEXT,
+    VKAD_DEVICE_FUNCTION_ID_CopyImageToMemoryEXT,
+    VKAD_DEVICE_FUNCTION_ID_CopyImageToImageEXT,
+    VKAD_DEVICE_FUNCTION_ID_TransitionImageLayoutEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetImageSubresourceLayout2EXT,
+    /* VK_EXT_swapchain_maintenance1 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_ReleaseSwapchainImagesEXT,
+    /* VK_NV_device_generated_commands spec_version 3 */
+    VKAD_DEVICE_FUNCTION_ID_GetGeneratedCommandsMemoryRequirementsNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdPreprocessGeneratedCommandsNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdExecuteGeneratedCommandsNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindPipelineShaderGroupNV,
+    VKAD_DEVICE_FUNCTION_ID_CreateIndirectCommandsLayoutNV,
+    VKAD_DEVICE_FUNCTION_ID_DestroyIndirectCommandsLayoutNV,
+    /* VK_EXT_depth_bias_control spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthBias2EXT,
+    /* VK_EXT_private_data spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CreatePrivateDataSlotEXT,
+    VKAD_DEVICE_FUNCTION_ID_DestroyPrivateDataSlotEXT,
+    VKAD_DEVICE_FUNCTION_ID_SetPrivateDataEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetPrivateDataEXT,
+    /* VK_NV_cuda_kernel_launch spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CreateCudaModuleNV,
+    VKAD_DEVICE_FUNCTION_ID_GetCudaModuleCacheNV,
+    VKAD_DEVICE_FUNCTION_ID_CreateCudaFunctionNV,
+    VKAD_DEVICE_FUNCTION_ID_DestroyCudaModuleNV,
+    VKAD_DEVICE_FUNCTION_ID_DestroyCudaFunctionNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdCudaLaunchKernelNV,
+    /* VK_EXT_descriptor_buffer spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetDescriptorSetLayoutSizeEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetDescriptorSetLayoutBindingOffsetEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetDescriptorEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindDescriptorBuffersEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDescriptorBufferOffsetsEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindDescriptorBufferEmbeddedSamplersEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferOpaqueCaptureDescriptorDataEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetImageOpaqueCaptureDescriptorDataEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetImageViewOpaqueCaptureDescriptorDataEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetSamplerOpaqueCaptureDescriptorDataEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetAccelerationStructureOpaqueCaptureDescriptorDataEXT,
+    /* VK_NV_fragment_shading_rate_enums spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetFragmentShadingRateEnumNV,
+    /* VK_EXT_device_fault spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceFaultInfoEXT,
+    /* VK_EXT_vertex_input_dynamic_state spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetVertexInputEXT,
+    /* VK_HUAWEI_subpass_shading spec_version 3 */
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI,
+    VKAD_DEVICE_FUNCTION_ID_CmdSubpassShadingHUAWEI,
+    /* VK_HUAWEI_invocation_mask spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdBindInvocationMaskHUAWEI,
+    /* VK_NV_external_memory_rdma spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryRemoteAddressNV,
+    /* VK_EXT_pipeline_properties spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetPipelinePropertiesEXT,
+    /* VK_EXT_extended_dynamic_state2 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetPatchControlPointsEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetRasterizerDiscardEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthBiasEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetLogicOpEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetPrimitiveRestartEnableEXT,
+    /* VK_EXT_color_write_enable spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetColorWriteEnableEXT,
+    /* VK_EXT_multi_draw spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawMultiEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawMultiIndexedEXT,
+    /* VK_EXT_opacity_micromap spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CreateMicromapEXT,
+    VKAD_DEVICE_FUNCTION_ID_DestroyMicromapEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdBuildMicromapsEXT,
+    VKAD_DEVICE_FUNCTION_ID_BuildMicromapsEXT,
+    VKAD_DEVICE_FUNCTION_ID_CopyMicromapEXT,
+    VKAD_DEVICE_FUNCTION_ID_CopyMicromapToMemoryEXT,
+    VKAD_DEVICE_FUNCTION_ID_CopyMemoryToMicromapEXT,
+    VKAD_DEVICE_FUNCTION_ID_WriteMicromapsPropertiesEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyMicromapEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyMicromapToMemoryEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyMemoryToMicromapEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdWriteMicromapsPropertiesEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceMicromapCompatibilityEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetMicromapBuildSizesEXT,
+    /* VK_HUAWEI_cluster_culling_shader spec_version 3 */
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawClusterHUAWEI,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawClusterIndirectHUAWEI,
+    /* VK_EXT_pageable_device_local_memory spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_SetDeviceMemoryPriorityEXT,
+    /* VK_VALVE_descriptor_set_host_mapping spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetDescriptorSetLayoutHostMappingInfoVALVE,
+    VKAD_DEVICE_FUNCTION_ID_GetDescriptorSetHostMappingVALVE,
+    /* VK_NV_copy_memory_indirect spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyMemoryIndirectNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyMemoryToImageIndirectNV,
+    /* VK_NV_memory_decompression spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdDecompressMemoryNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdDecompressMemoryIndirectCountNV,
+    /* VK_NV_device_generated_commands_compute spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_GetPipelineIndirectMemoryRequirementsNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdUpdatePipelineIndirectBufferNV,
+    VKAD_DEVICE_FUNCTION_ID_GetPipelineIndirectDeviceAddressNV,
+    /* VK_EXT_extended_dynamic_state3 spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthClampEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetPolygonModeEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetRasterizationSamplesEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetSampleMaskEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetAlphaToCoverageEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetAlphaToOneEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetLogicOpEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetColorBlendEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetColorBlendEquationEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetColorWriteMaskEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetTessellationDomainOriginEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetRasterizationStreamEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetConservativeRasterizationModeEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetExtraPrimitiveOverestimationSizeEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthClipEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetSampleLocationsEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetColorBlendAdvancedEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetProvokingVertexModeEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetLineRasterizationModeEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetLineStippleEnableEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthClipNegativeOneToOneEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetViewportWScalingEnableNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetViewportSwizzleNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetCoverageToColorEnableNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetCoverageToColorLocationNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetCoverageModulationModeNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetCoverageModulationTableEnableNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetCoverageModulationTableNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetShadingRateImageEnableNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetRepresentativeFragmentTestEnableNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetCoverageReductionModeNV,
+    /* VK_EXT_shader_module_identifier spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetShaderModuleIdentifierEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetShaderModuleCreateInfoIdentifierEXT,
+    /* VK_NV_optical_flow spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CreateOpticalFlowSessionNV,
+    VKAD_DEVICE_FUNCTION_ID_DestroyOpticalFlowSessionNV,
+    VKAD_DEVICE_FUNCTION_ID_BindOpticalFlowSessionImageNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdOpticalFlowExecuteNV,
+    /* VK_EXT_shader_object spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CreateShadersEXT,
+    VKAD_DEVICE_FUNCTION_ID_DestroyShaderEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetShaderBinaryDataEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindShadersEXT,
+    /* VK_QCOM_tile_properties spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetFramebufferTilePropertiesQCOM,
+    VKAD_DEVICE_FUNCTION_ID_GetDynamicRenderingTilePropertiesQCOM,
+    /* VK_NV_low_latency2 spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_SetLatencySleepModeNV,
+    VKAD_DEVICE_FUNCTION_ID_LatencySleepNV,
+    VKAD_DEVICE_FUNCTION_ID_SetLatencyMarkerNV,
+    VKAD_DEVICE_FUNCTION_ID_GetLatencyTimingsNV,
+    VKAD_DEVICE_FUNCTION_ID_QueueNotifyOutOfBandNV,
+    /* VK_EXT_attachment_feedback_loop_dynamic_state spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetAttachmentFeedbackLoopEnableEXT,
+    /* VK_KHR_acceleration_structure spec_version 13 */
+    VKAD_DEVICE_FUNCTION_ID_CreateAccelerationStructureKHR,
+    VKAD_DEVICE_FUNCTION_ID_DestroyAccelerationStructureKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdBuildAccelerationStructuresKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdBuildAccelerationStructuresIndirectKHR,
+    VKAD_DEVICE_FUNCTION_ID_BuildAccelerationStructuresKHR,
+    VKAD_DEVICE_FUNCTION_ID_CopyAccelerationStructureKHR,
+    VKAD_DEVICE_FUNCTION_ID_CopyAccelerationStructureToMemoryKHR,
+    VKAD_DEVICE_FUNCTION_ID_CopyMemoryToAccelerationStructureKHR,
+    VKAD_DEVICE_FUNCTION_ID_WriteAccelerationStructuresPropertiesKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyAccelerationStructureKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyAccelerationStructureToMemoryKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdCopyMemoryToAccelerationStructureKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetAccelerationStructureDeviceAddressKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdWriteAccelerationStructuresPropertiesKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceAccelerationStructureCompatibilityKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetAccelerationStructureBuildSizesKHR,
+    /* VK_KHR_ray_tracing_pipeline spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdTraceRaysKHR,
+    VKAD_DEVICE_FUNCTION_ID_CreateRayTracingPipelinesKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetRayTracingCaptureReplayShaderGroupHandlesKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdTraceRaysIndirectKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetRayTracingShaderGroupStackSizeKHR,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetRayTracingPipelineStackSizeKHR,
+    /* VK_EXT_mesh_shader spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawMeshTasksEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawMeshTasksIndirectEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdDrawMeshTasksIndirectCountEXT,
+    /* VK_ANDROID_external_memory_android_hardware_buffer spec_version 5 */
+    VKAD_DEVICE_FUNCTION_ID_GetAndroidHardwareBufferPropertiesANDROID,
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryAndroidHardwareBufferANDROID,
+    /* VK_FUCHSIA_external_memory spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryZirconHandleFUCHSIA,
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryZirconHandlePropertiesFUCHSIA,
+    /* VK_FUCHSIA_external_semaphore spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_ImportSemaphoreZirconHandleFUCHSIA,
+    VKAD_DEVICE_FUNCTION_ID_GetSemaphoreZirconHandleFUCHSIA,
+    /* VK_FUCHSIA_buffer_collection spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CreateBufferCollectionFUCHSIA,
+    VKAD_DEVICE_FUNCTION_ID_SetBufferCollectionImageConstraintsFUCHSIA,
+    VKAD_DEVICE_FUNCTION_ID_SetBufferCollectionBufferConstraintsFUCHSIA,
+    VKAD_DEVICE_FUNCTION_ID_DestroyBufferCollectionFUCHSIA,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferCollectionPropertiesFUCHSIA,
+    /* VK_EXT_metal_objects spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_ExportMetalObjectsEXT,
+    /* VK_KHR_external_memory_win32 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryWin32HandleKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryWin32HandlePropertiesKHR,
+    /* VK_KHR_external_semaphore_win32 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_ImportSemaphoreWin32HandleKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetSemaphoreWin32HandleKHR,
+    /* VK_KHR_external_fence_win32 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_ImportFenceWin32HandleKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetFenceWin32HandleKHR,
+    /* VK_NV_external_memory_win32 spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryWin32HandleNV,
+    /* VK_EXT_full_screen_exclusive spec_version 4 */
+    VKAD_DEVICE_FUNCTION_ID_AcquireFullScreenExclusiveModeEXT,
+    VKAD_DEVICE_FUNCTION_ID_ReleaseFullScreenExclusiveModeEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceGroupSurfacePresentModes2EXT,
+    /* VK_QNX_external_memory_screen_buffer spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetScreenBufferPropertiesQNX,
+    /* VK_AMDX_shader_enqueue spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_CreateExecutionGraphPipelinesAMDX,
+    VKAD_DEVICE_FUNCTION_ID_GetExecutionGraphPipelineScratchSizeAMDX,
+    VKAD_DEVICE_FUNCTION_ID_GetExecutionGraphPipelineNodeIndexAMDX,
+    VKAD_DEVICE_FUNCTION_ID_CmdInitializeGraphScratchMemoryAMDX,
+    VKAD_DEVICE_FUNCTION_ID_CmdDispatchGraphAMDX,
+    VKAD_DEVICE_FUNCTION_ID_CmdDispatchGraphIndirectAMDX,
+    VKAD_DEVICE_FUNCTION_ID_CmdDispatchGraphIndirectCountAMDX,
+    /* Additions from 1.3.284 to 1.4.309: */
+    /* to VK_NVX_image_view_handle spec_version 3 */
+    VKAD_DEVICE_FUNCTION_ID_GetImageViewHandle64NVX,
+    /* to VK_EXT_shader_object spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthClampRangeEXT,
+    /* VK_VERSION_1_4 */
+    VKAD_DEVICE_FUNCTION_ID_CmdSetLineStipple,
+    VKAD_DEVICE_FUNCTION_ID_MapMemory2,
+    VKAD_DEVICE_FUNCTION_ID_UnmapMemory2,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindIndexBuffer2,
+    VKAD_DEVICE_FUNCTION_ID_GetRenderingAreaGranularity,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceImageSubresourceLayout,
+    VKAD_DEVICE_FUNCTION_ID_GetImageSubresourceLayout2,
+    VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSet,
+    VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSetWithTemplate,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetRenderingAttachmentLocations,
+    VKAD_DEVICE_FUNCTION_ID_CmdSetRenderingInputAttachmentIndices,
+    VKAD_DEVICE_FUNCTION_ID_CmdBindDescriptorSets2,
+    VKAD_DEVICE_FUNCTION_ID_CmdPushConstants2,
+    VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSet2,
+    VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSetWithTemplate2,
+    VKAD_DEVICE_FUNCTION_ID_CopyMemoryToImage,
+    VKAD_DEVICE_FUNCTION_ID_CopyImageToMemory,
+    VKAD_DEVICE_FUNCTION_ID_CopyImageToImage,
+    VKAD_DEVICE_FUNCTION_ID_TransitionImageLayout,
+    /* VK_KHR_pipeline_binary spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_CreatePipelineBinariesKHR,
+    VKAD_DEVICE_FUNCTION_ID_DestroyPipelineBinaryKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetPipelineKeyKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetPipelineBinaryDataKHR,
+    VKAD_DEVICE_FUNCTION_ID_ReleaseCapturedPipelineDataKHR,
+    /* VK_AMD_anti_lag spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_AntiLagUpdateAMD,
+    /* VK_NV_cooperative_vector spec_version 4 */
+    VKAD_DEVICE_FUNCTION_ID_ConvertCooperativeVectorMatrixNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdConvertCooperativeVectorMatrixNV,
+    /* VK_NV_cluster_acceleration_structure spec_version 2 */
+    VKAD_DEVICE_FUNCTION_ID_GetClusterAccelerationStructureBuildSizesNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdBuildClusterAccelerationStructureIndirectNV,
+    /* VK_NV_partitioned_acceleration_structure spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetPartitionedAccelerationStructuresBuildSizesNV,
+    VKAD_DEVICE_FUNCTION_ID_CmdBuildPartitionedAccelerationStructuresNV,
+    /* VK_EXT_device_generated_commands spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetGeneratedCommandsMemoryRequirementsEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdPreprocessGeneratedCommandsEXT,
+    VKAD_DEVICE_FUNCTION_ID_CmdExecuteGeneratedCommandsEXT,
+    VKAD_DEVICE_FUNCTION_ID_CreateIndirectCommandsLayoutEXT,
+    VKAD_DEVICE_FUNCTION_ID_DestroyIndirectCommandsLayoutEXT,
+    VKAD_DEVICE_FUNCTION_ID_CreateIndirectExecutionSetEXT,
+    VKAD_DEVICE_FUNCTION_ID_DestroyIndirectExecutionSetEXT,
+    VKAD_DEVICE_FUNCTION_ID_UpdateIndirectExecutionSetPipelineEXT,
+    VKAD_DEVICE_FUNCTION_ID_UpdateIndirectExecutionSetShaderEXT,
+    /* VK_EXT_external_memory_metal spec_version 1 */
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryMetalHandleEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetMemoryMetalHandlePropertiesEXT,
+    VKAD_DEVICE_FUNCTION_ID_COUNT
+} VkadDeviceFunctionId;
+/* extensions without function pointers:
+    VK_KHR_sampler_mirror_clamp_to_edge spec_version 3
+    VK_KHR_video_encode_h264 spec_version 14
+    VK_KHR_video_encode_h265 spec_version 14
+    VK_KHR_video_decode_h264 spec_version 9
+    VK_KHR_multiview spec_version 1
+    VK_KHR_shader_draw_parameters spec_version 1
+    VK_KHR_external_memory spec_version 1
+    VK_KHR_external_semaphore spec_version 1
+    VK_KHR_shader_float16_int8 spec_version 1
+    VK_KHR_16bit_storage spec_version 1
+    VK_KHR_incremental_present spec_version 2
+    VK_KHR_imageless_framebuffer spec_version 1
+    VK_KHR_external_fence spec_version 1
+    VK_KHR_maintenance2 spec_version 1
+    VK_KHR_variable_pointers spec_version 1
+    VK_KHR_dedicated_allocation spec_version 3
+    VK_KHR_storage_buffer_storage_class spec_version 1
+    VK_KHR_relaxed_block_layout spec_version 1
+    VK_KHR_image_format_list spec_version 1
+    VK_KHR_shader_subgroup_extended_types spec_version 1
+    VK_KHR_8bit_storage spec_version 1
+    VK_KHR_shader_atomic_int64 spec_version 1
+    VK_KHR_shader_clock spec_version 1
+    VK_KHR_video_decode_h265 spec_version 8
+    VK_KHR_global_priority spec_version 1
+    VK_KHR_driver_properties spec_version 1
+    VK_KHR_shader_float_controls spec_version 4
+    VK_KHR_depth_stencil_resolve spec_version 1
+    VK_KHR_swapchain_mutable_format spec_version 1
+    VK_KHR_vulkan_memory_model spec_version 3
+    VK_KHR_shader_terminate_invocation spec_version 1
+    VK_KHR_shader_quad_control spec_version 1
+    VK_KHR_spirv_1_4 spec_version 1
+    VK_KHR_surface_protected_capabilities spec_version 1
+    VK_KHR_separate_depth_stencil_layouts spec_version 1
+    VK_KHR_uniform_buffer_standard_layout spec_version 1
+    VK_KHR_shader_integer_dot_product spec_version 1
+    VK_KHR_pipeline_library spec_version 1
+    VK_KHR_shader_non_semantic_info spec_version 1
+    VK_KHR_present_id spec_version 1
+    VK_KHR_fragment_shader_barycentric spec_version 1
+    VK_KHR_shader_subgroup_uniform_control_flow spec_version 1
+    VK_KHR_zero_initialize_workgroup_memory spec_version 1
+    VK_KHR_workgroup_memory_explicit_layout spec_version 1
+    VK_KHR_format_feature_flags2 spec_version 2
+    VK_KHR_portability_enumeration spec_version 1
+    VK_KHR_shader_subgroup_rotate spec_version 2
+    VK_KHR_shader_maximal_reconvergence spec_version 1
+    VK_KHR_ray_tracing_position_fetch spec_version 1
+    VK_KHR_video_decode_av1 spec_version 1
+    VK_KHR_video_maintenance1 spec_version 1
+    VK_KHR_vertex_attribute_divisor spec_version 1
+    VK_KHR_load_store_op_none spec_version 1
+    VK_KHR_shader_float_controls2 spec_version 1
+    VK_KHR_index_type_uint8 spec_version 1
+    VK_KHR_shader_expect_assume spec_version 1
+    VK_NV_glsl_shader spec_version 1
+    VK_EXT_depth_range_unrestricted spec_version 1
+    VK_IMG_filter_cubic spec_version 1
+    VK_AMD_rasterization_order spec_version 1
+    VK_AMD_shader_trinary_minmax spec_version 1
+    VK_AMD_shader_explicit_vertex_parameter spec_version 1
+    VK_AMD_gcn_shader spec_version 1
+    VK_NV_dedicated_allocation spec_version 1
+    VK_AMD_negative_viewport_height spec_version 1
+    VK_AMD_gpu_shader_half_float spec_version 2
+    VK_AMD_shader_ballot spec_version 1
+    VK_AMD_texture_gather_bias_lod spec_version 1
+    VK_AMD_shader_image_load_store_lod spec_version 1
+    VK_NV_corner_sampled_image spec_version 2
+    VK_IMG_format_pvrtc spec_version 1
+    VK_NV_external_memory spec_version 1
+    VK_EXT_validation_flags spec_version 3
+    VK_EXT_shader_subgroup_ballot spec_version 1
+    VK_EXT_shader_subgroup_vote spec_version 1
+    VK_EXT_texture_compression_astc_hdr spec_version 1
+    VK_EXT_astc_decode_mode spec_version 1
+    VK_EXT_pipeline_robustness spec_version 1
+    VK_NV_sample_mask_override_coverage spec_version 1
+    VK_NV_geometry_shader_passthrough spec_version 1
+    VK_NV_viewport_array2 spec_version 1
+    VK_NVX_multiview_per_view_attributes spec_version 1
+    VK_NV_viewport_swizzle spec_version 1
+    VK_EXT_conservative_rasterization spec_version 1
+    VK_EXT_depth_clip_enable spec_version 1
+    VK_EXT_swapchain_colorspace spec_version 5
+    VK_IMG_relaxed_line_rasterization spec_version 1
+    VK_EXT_external_memory_dma_buf spec_version 1
+    VK_EXT_queue_family_foreign spec_version 1
+    VK_EXT_sampler_filter_minmax spec_version 2
+    VK_AMD_gpu_shader_int16 spec_version 2
+    VK_AMD_mixed_attachment_samples spec_version 1
+    VK_AMD_shader_fragment_mask spec_version 1
+    VK_EXT_inline_uniform_block spec_version 1
+    VK_EXT_shader_stencil_export spec_version 1
+    VK_EXT_blend_operation_advanced spec_version 2
+    VK_NV_fragment_coverage_to_color spec_version 1
+    VK_NV_framebuffer_mixed_samples spec_version 1
+    VK_NV_fill_rectangle spec_version 1
+    VK_NV_shader_sm_builtins spec_version 1
+    VK_EXT_post_depth_coverage spec_version 1
+    VK_EXT_descriptor_indexing spec_version 2
+    VK_EXT_shader_viewport_index_layer spec_version 1
+    VK_NV_representative_fragment_test spec_version 2
+    VK_EXT_filter_cubic spec_version 3
+    VK_QCOM_render_pass_shader_resolve spec_version 4
+    VK_EXT_global_priority spec_version 2
+    VK_AMD_pipeline_compiler_control spec_version 1
+    VK_AMD_shader_core_properties spec_version 2
+    VK_AMD_memory_overallocation_behavior spec_version 1
+    VK_EXT_vertex_attribute_divisor spec_version 3
+    VK_EXT_pipeline_creation_feedback spec_version 1
+    VK_NV_shader_subgroup_partitioned spec_version 1
+    VK_NV_compute_shader_derivatives spec_version 1
+    VK_NV_fragment_shader_barycentric spec_version 1
+    VK_NV_shader_image_footprint spec_version 2
+    VK_INTEL_shader_integer_functions2 spec_version 1
+    VK_EXT_pci_bus_info spec_version 2
+    VK_EXT_fragment_density_map spec_version 2
+    VK_EXT_scalar_block_layout spec_version 1
+    VK_GOOGLE_hlsl_functionality1 spec_version 1
+    VK_GOOGLE_decorate_string spec_version 1
+    VK_EXT_subgroup_size_control spec_version 2
+    VK_AMD_shader_core_properties2 spec_version 1
+    VK_AMD_device_coherent_memory spec_version 1
+    VK_EXT_shader_image_atomic_int64 spec_version 1
+    VK_EXT_memory_budget spec_version 1
+    VK_EXT_memory_priority spec_version 1
+    VK_NV_dedicated_allocation_image_aliasing spec_version 1
+    VK_EXT_separate_stencil_usage spec_version 1
+    VK_EXT_validation_features spec_version 6
+    VK_EXT_fragment_shader_interlock spec_version 1
+    VK_EXT_ycbcr_image_arrays spec_version 1
+    VK_EXT_provoking_vertex spec_version 1
+    VK_EXT_shader_atomic_float spec_version 1
+    VK_EXT_index_type_uint8 spec_version 1
+    VK_EXT_map_memory_placed spec_version 1
+    VK_EXT_shader_atomic_float2 spec_version 1
+    VK_EXT_surface_maintenance1 spec_version 1
+    VK_EXT_shader_demote_to_helper_invocation spec_version 1
+    VK_NV_inherited_viewport_scissor spec_version 1
+    VK_EXT_texel_buffer_alignment spec_version 1
+    VK_QCOM_render_pass_transform spec_version 4
+    VK_EXT_device_memory_report spec_version 2
+    VK_EXT_robustness2 spec_version 1
+    VK_EXT_custom_border_color spec_version 12
+    VK_GOOGLE_user_type spec_version 1
+    VK_NV_present_barrier spec_version 1
+    VK_EXT_pipeline_creation_cache_control spec_version 3
+    VK_NV_device_diagnostics_config spec_version 2
+    VK_QCOM_render_pass_store_ops spec_version 2
+    VK_NV_low_latency spec_version 1
+    VK_EXT_graphics_pipeline_library spec_version 1
+    VK_AMD_shader_early_and_late_fragment_tests spec_version 1
+    VK_NV_ray_tracing_motion_blur spec_version 1
+    VK_EXT_ycbcr_2plane_444_formats spec_version 1
+    VK_EXT_fragment_density_map2 spec_version 1
+    VK_QCOM_rotated_copy_commands spec_version 2
+    VK_EXT_image_robustness spec_version 1
+    VK_EXT_image_compression_control spec_version 1
+    VK_EXT_attachment_feedback_loop_layout spec_version 2
+    VK_EXT_4444_formats spec_version 1
+    VK_ARM_rasterization_order_attachment_access spec_version 1
+    VK_EXT_rgba10x6_formats spec_version 1
+    VK_VALVE_mutable_descriptor_type spec_version 1
+    VK_EXT_physical_device_drm spec_version 1
+    VK_EXT_device_address_binding_report spec_version 1
+    VK_EXT_depth_clip_control spec_version 1
+    VK_EXT_primitive_topology_list_restart spec_version 1
+    VK_EXT_frame_boundary spec_version 1
+    VK_EXT_multisampled_render_to_single_sampled spec_version 1
+    VK_EXT_primitives_generated_query spec_version 1
+    VK_EXT_global_priority_query spec_version 1
+    VK_EXT_image_view_min_lod spec_version 1
+    VK_EXT_image_2d_view_of_3d spec_version 1
+    VK_EXT_shader_tile_image spec_version 1
+    VK_EXT_load_store_op_none spec_version 1
+    VK_EXT_border_color_swizzle spec_version 1
+    VK_ARM_shader_core_properties spec_version 1
+    VK_ARM_scheduling_controls spec_version 1
+    VK_EXT_image_sliced_view_of_3d spec_version 1
+    VK_EXT_depth_clamp_zero_one spec_version 1
+    VK_EXT_non_seamless_cube_map spec_version 1
+    VK_ARM_render_pass_striped spec_version 1
+    VK_QCOM_fragment_density_map_offset spec_version 2
+    VK_NV_linear_color_attachment spec_version 1
+    VK_GOOGLE_surfaceless_query spec_version 2
+    VK_EXT_image_compression_control_swapchain spec_version 1
+    VK_QCOM_image_processing spec_version 1
+    VK_EXT_nested_command_buffer spec_version 1
+    VK_EXT_external_memory_acquire_unmodified spec_version 1
+    VK_EXT_subpass_merge_feedback spec_version 2
+    VK_LUNARG_direct_driver_loading spec_version 1
+    VK_EXT_rasterization_order_attachment_access spec_version 1
+    VK_EXT_legacy_dithering spec_version 2
+    VK_EXT_pipeline_protected_access spec_version 1
+    VK_SEC_amigo_profiling spec_version 1
+    VK_QCOM_multiview_per_view_viewports spec_version 1
+    VK_NV_ray_tracing_invocation_reorder spec_version 1
+    VK_NV_extended_sparse_address_space spec_version 1
+    VK_EXT_mutable_descriptor_type spec_version 1
+    VK_EXT_legacy_vertex_attributes spec_version 1
+    VK_EXT_layer_settings spec_version 2
+    VK_ARM_shader_core_builtins spec_version 2
+    VK_EXT_pipeline_library_group_handles spec_version 1
+    VK_EXT_dynamic_rendering_unused_attachments spec_version 1
+    VK_QCOM_multiview_per_view_render_areas spec_version 1
     VK_NV_per_stage_descriptor_set spec_version 1
     VK_QCOM_image_processing2 spec_version 1
     VK_QCOM_filter_cubic_weights spec_version 1
@@ -1311,922 +3465,5120 @@ typedef struct VkadDeviceFunctions {
     VK_NV_present_metering spec_version 1
 */
 
-static void vkadLoadGlobalFunctions  (PFN_vkGetInstanceProcAddr loader, VkadGlobalFunctions* functions) {
-    /* VK_VERSION_1_0 */
-    functions[0].EnumerateInstanceExtensionProperties                              = REINTERPRET_CAST(PFN_vkEnumerateInstanceExtensionProperties                              , loader(NULL, "vkEnumerateInstanceExtensionProperties"                            )) ;
-    functions[0].EnumerateInstanceLayerProperties                                  = REINTERPRET_CAST(PFN_vkEnumerateInstanceLayerProperties                                  , loader(NULL, "vkEnumerateInstanceLayerProperties"                                )) ;
-    functions[0].CreateInstance                                                    = REINTERPRET_CAST(PFN_vkCreateInstance                                                    , loader(NULL, "vkCreateInstance"                                                  )) ;
-    /* VK_VERSION_1_1 */                                                                                                     
-    functions[0].EnumerateInstanceVersion                                          = REINTERPRET_CAST(PFN_vkEnumerateInstanceVersion                                          , loader(NULL, "vkEnumerateInstanceVersion"                                        )) ;
+/* the number of entries in the tables, which stay the same with all profiles, since left out functions keep their entries */
+#define VKAD_GLOBAL_FUNCTION_COUNT         ((size_t) 4)
+#define VKAD_INSTANCE_FUNCTION_COUNT       ((size_t) VKAD_INSTANCE_FUNCTION_ID_COUNT)
+#define VKAD_DEVICE_FUNCTION_COUNT         ((size_t) VKAD_DEVICE_FUNCTION_ID_COUNT)
+#define VKAD_INSTANCE_FUNCTION_GROUP_COUNT ((size_t) 50)
+#define VKAD_DEVICE_FUNCTION_GROUP_COUNT   ((size_t) 129)
+
+#if VKAD_HAS_DEFINITIONS
+/* the tables for loading the functions: every entry holds the offset of the member in the struct and the offset of the function name, without the "vk" prefix, in vkadFunctionNames. */
+typedef struct VkadFunctionNames {
+    /* global functions */
+    char EnumerateInstanceExtensionProperties                            [sizeof("EnumerateInstanceExtensionProperties")];
+    char EnumerateInstanceLayerProperties                                [sizeof("EnumerateInstanceLayerProperties")];
+    char CreateInstance                                                  [sizeof("CreateInstance")];
+    char EnumerateInstanceVersion                                        [sizeof("EnumerateInstanceVersion")];
+    /* instance functions */
+    char DestroyInstance                                                 [sizeof("DestroyInstance")];
+    char EnumeratePhysicalDevices                                        [sizeof("EnumeratePhysicalDevices")];
+    char GetPhysicalDeviceFeatures                                       [sizeof("GetPhysicalDeviceFeatures")];
+    char GetPhysicalDeviceFormatProperties                               [sizeof("GetPhysicalDeviceFormatProperties")];
+    char GetPhysicalDeviceImageFormatProperties                          [sizeof("GetPhysicalDeviceImageFormatProperties")];
+    char GetPhysicalDeviceProperties                                     [sizeof("GetPhysicalDeviceProperties")];
+    char GetPhysicalDeviceQueueFamilyProperties                          [sizeof("GetPhysicalDeviceQueueFamilyProperties")];
+    char GetPhysicalDeviceMemoryProperties                               [sizeof("GetPhysicalDeviceMemoryProperties")];
+    char EnumerateDeviceExtensionProperties                              [sizeof("EnumerateDeviceExtensionProperties")];
+    char EnumerateDeviceLayerProperties                                  [sizeof("EnumerateDeviceLayerProperties")];
+    char GetPhysicalDeviceSparseImageFormatProperties                    [sizeof("GetPhysicalDeviceSparseImageFormatProperties")];
+    char CreateDevice                                                    [sizeof("CreateDevice")];
+    char GetDeviceProcAddr                                               [sizeof("GetDeviceProcAddr")];
+    char EnumeratePhysicalDeviceGroups                                   [sizeof("EnumeratePhysicalDeviceGroups")];
+    char GetPhysicalDeviceFeatures2                                      [sizeof("GetPhysicalDeviceFeatures2")];
+    char GetPhysicalDeviceProperties2                                    [sizeof("GetPhysicalDeviceProperties2")];
+    char GetPhysicalDeviceFormatProperties2                              [sizeof("GetPhysicalDeviceFormatProperties2")];
+    char GetPhysicalDeviceImageFormatProperties2                         [sizeof("GetPhysicalDeviceImageFormatProperties2")];
+    char GetPhysicalDeviceQueueFamilyProperties2                         [sizeof("GetPhysicalDeviceQueueFamilyProperties2")];
+    char GetPhysicalDeviceMemoryProperties2                              [sizeof("GetPhysicalDeviceMemoryProperties2")];
+    char GetPhysicalDeviceSparseImageFormatProperties2                   [sizeof("GetPhysicalDeviceSparseImageFormatProperties2")];
+    char GetPhysicalDeviceExternalBufferProperties                       [sizeof("GetPhysicalDeviceExternalBufferProperties")];
+    char GetPhysicalDeviceExternalFenceProperties                        [sizeof("GetPhysicalDeviceExternalFenceProperties")];
+    char GetPhysicalDeviceExternalSemaphoreProperties                    [sizeof("GetPhysicalDeviceExternalSemaphoreProperties")];
+    char GetPhysicalDeviceToolProperties                                 [sizeof("GetPhysicalDeviceToolProperties")];
+    char DestroySurfaceKHR                                               [sizeof("DestroySurfaceKHR")];
+    char GetPhysicalDeviceSurfaceSupportKHR                              [sizeof("GetPhysicalDeviceSurfaceSupportKHR")];
+    char GetPhysicalDeviceSurfaceCapabilitiesKHR                         [sizeof("GetPhysicalDeviceSurfaceCapabilitiesKHR")];
+    char GetPhysicalDeviceSurfaceFormatsKHR                              [sizeof("GetPhysicalDeviceSurfaceFormatsKHR")];
+    char GetPhysicalDeviceSurfacePresentModesKHR                         [sizeof("GetPhysicalDeviceSurfacePresentModesKHR")];
+    char GetPhysicalDevicePresentRectanglesKHR                           [sizeof("GetPhysicalDevicePresentRectanglesKHR")];
+    char GetPhysicalDeviceDisplayPropertiesKHR                           [sizeof("GetPhysicalDeviceDisplayPropertiesKHR")];
+    char GetPhysicalDeviceDisplayPlanePropertiesKHR                      [sizeof("GetPhysicalDeviceDisplayPlanePropertiesKHR")];
+    char GetDisplayPlaneSupportedDisplaysKHR                             [sizeof("GetDisplayPlaneSupportedDisplaysKHR")];
+    char GetDisplayModePropertiesKHR                                     [sizeof("GetDisplayModePropertiesKHR")];
+    char CreateDisplayModeKHR                                            [sizeof("CreateDisplayModeKHR")];
+    char GetDisplayPlaneCapabilitiesKHR                                  [sizeof("GetDisplayPlaneCapabilitiesKHR")];
+    char CreateDisplayPlaneSurfaceKHR                                    [sizeof("CreateDisplayPlaneSurfaceKHR")];
+    char GetPhysicalDeviceVideoCapabilitiesKHR                           [sizeof("GetPhysicalDeviceVideoCapabilitiesKHR")];
+    char GetPhysicalDeviceVideoFormatPropertiesKHR                       [sizeof("GetPhysicalDeviceVideoFormatPropertiesKHR")];
+    char GetPhysicalDeviceFeatures2KHR                                   [sizeof("GetPhysicalDeviceFeatures2KHR")];
+    char GetPhysicalDeviceProperties2KHR                                 [sizeof("GetPhysicalDeviceProperties2KHR")];
+    char GetPhysicalDeviceFormatProperties2KHR                           [sizeof("GetPhysicalDeviceFormatProperties2KHR")];
+    char GetPhysicalDeviceImageFormatProperties2KHR                      [sizeof("GetPhysicalDeviceImageFormatProperties2KHR")];
+    char GetPhysicalDeviceQueueFamilyProperties2KHR                      [sizeof("GetPhysicalDeviceQueueFamilyProperties2KHR")];
+    char GetPhysicalDeviceMemoryProperties2KHR                           [sizeof("GetPhysicalDeviceMemoryProperties2KHR")];
+    char GetPhysicalDeviceSparseImageFormatProperties2KHR                [sizeof("GetPhysicalDeviceSparseImageFormatProperties2KHR")];
+    char EnumeratePhysicalDeviceGroupsKHR                                [sizeof("EnumeratePhysicalDeviceGroupsKHR")];
+    char GetPhysicalDeviceExternalBufferPropertiesKHR                    [sizeof("GetPhysicalDeviceExternalBufferPropertiesKHR")];
+    char GetPhysicalDeviceExternalSemaphorePropertiesKHR                 [sizeof("GetPhysicalDeviceExternalSemaphorePropertiesKHR")];
+    char GetPhysicalDeviceExternalFencePropertiesKHR                     [sizeof("GetPhysicalDeviceExternalFencePropertiesKHR")];
+    char EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR   [sizeof("EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR")];
+    char GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR           [sizeof("GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR")];
+    char GetPhysicalDeviceSurfaceCapabilities2KHR                        [sizeof("GetPhysicalDeviceSurfaceCapabilities2KHR")];
+    char GetPhysicalDeviceSurfaceFormats2KHR                             [sizeof("GetPhysicalDeviceSurfaceFormats2KHR")];
+    char GetPhysicalDeviceDisplayProperties2KHR                          [sizeof("GetPhysicalDeviceDisplayProperties2KHR")];
+    char GetPhysicalDeviceDisplayPlaneProperties2KHR                     [sizeof("GetPhysicalDeviceDisplayPlaneProperties2KHR")];
+    char GetDisplayModeProperties2KHR                                    [sizeof("GetDisplayModeProperties2KHR")];
+    char GetDisplayPlaneCapabilities2KHR                                 [sizeof("GetDisplayPlaneCapabilities2KHR")];
+    char GetPhysicalDeviceFragmentShadingRatesKHR                        [sizeof("GetPhysicalDeviceFragmentShadingRatesKHR")];
+    char GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR           [sizeof("GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR")];
+    char GetPhysicalDeviceCooperativeMatrixPropertiesKHR                 [sizeof("GetPhysicalDeviceCooperativeMatrixPropertiesKHR")];
+    char GetPhysicalDeviceCalibrateableTimeDomainsKHR                    [sizeof("GetPhysicalDeviceCalibrateableTimeDomainsKHR")];
+    char CreateDebugReportCallbackEXT                                    [sizeof("CreateDebugReportCallbackEXT")];
+    char DestroyDebugReportCallbackEXT                                   [sizeof("DestroyDebugReportCallbackEXT")];
+    char DebugReportMessageEXT                                           [sizeof("DebugReportMessageEXT")];
+    char GetPhysicalDeviceExternalImageFormatPropertiesNV                [sizeof("GetPhysicalDeviceExternalImageFormatPropertiesNV")];
+    char ReleaseDisplayEXT                                               [sizeof("ReleaseDisplayEXT")];
+    char GetPhysicalDeviceSurfaceCapabilities2EXT                        [sizeof("GetPhysicalDeviceSurfaceCapabilities2EXT")];
+    char CreateDebugUtilsMessengerEXT                                    [sizeof("CreateDebugUtilsMessengerEXT")];
+    char DestroyDebugUtilsMessengerEXT                                   [sizeof("DestroyDebugUtilsMessengerEXT")];
+    char SubmitDebugUtilsMessageEXT                                      [sizeof("SubmitDebugUtilsMessageEXT")];
+    char GetPhysicalDeviceMultisamplePropertiesEXT                       [sizeof("GetPhysicalDeviceMultisamplePropertiesEXT")];
+    char GetPhysicalDeviceCalibrateableTimeDomainsEXT                    [sizeof("GetPhysicalDeviceCalibrateableTimeDomainsEXT")];
+    char GetPhysicalDeviceToolPropertiesEXT                              [sizeof("GetPhysicalDeviceToolPropertiesEXT")];
+    char GetPhysicalDeviceCooperativeMatrixPropertiesNV                  [sizeof("GetPhysicalDeviceCooperativeMatrixPropertiesNV")];
+    char GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV [sizeof("GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV")];
+    char CreateHeadlessSurfaceEXT                                        [sizeof("CreateHeadlessSurfaceEXT")];
+    char AcquireDrmDisplayEXT                                            [sizeof("AcquireDrmDisplayEXT")];
+    char GetDrmDisplayEXT                                                [sizeof("GetDrmDisplayEXT")];
+    char GetPhysicalDeviceOpticalFlowImageFormatsNV                      [sizeof("GetPhysicalDeviceOpticalFlowImageFormatsNV")];
+    char CreateAndroidSurfaceKHR                                         [sizeof("CreateAndroidSurfaceKHR")];
+    char CreateImagePipeSurfaceFUCHSIA                                   [sizeof("CreateImagePipeSurfaceFUCHSIA")];
+    char CreateIOSSurfaceMVK                                             [sizeof("CreateIOSSurfaceMVK")];
+    char CreateMacOSSurfaceMVK                                           [sizeof("CreateMacOSSurfaceMVK")];
+    char CreateMetalSurfaceEXT                                           [sizeof("CreateMetalSurfaceEXT")];
+    char CreateViSurfaceNN                                               [sizeof("CreateViSurfaceNN")];
+    char CreateWaylandSurfaceKHR                                         [sizeof("CreateWaylandSurfaceKHR")];
+    char GetPhysicalDeviceWaylandPresentationSupportKHR                  [sizeof("GetPhysicalDeviceWaylandPresentationSupportKHR")];
+    char CreateWin32SurfaceKHR                                           [sizeof("CreateWin32SurfaceKHR")];
+    char GetPhysicalDeviceWin32PresentationSupportKHR                    [sizeof("GetPhysicalDeviceWin32PresentationSupportKHR")];
+    char GetPhysicalDeviceSurfacePresentModes2EXT                        [sizeof("GetPhysicalDeviceSurfacePresentModes2EXT")];
+    char AcquireWinrtDisplayNV                                           [sizeof("AcquireWinrtDisplayNV")];
+    char GetWinrtDisplayNV                                               [sizeof("GetWinrtDisplayNV")];
+    char CreateXcbSurfaceKHR                                             [sizeof("CreateXcbSurfaceKHR")];
+    char GetPhysicalDeviceXcbPresentationSupportKHR                      [sizeof("GetPhysicalDeviceXcbPresentationSupportKHR")];
+    char CreateXlibSurfaceKHR                                            [sizeof("CreateXlibSurfaceKHR")];
+    char GetPhysicalDeviceXlibPresentationSupportKHR                     [sizeof("GetPhysicalDeviceXlibPresentationSupportKHR")];
+    char CreateDirectFBSurfaceEXT                                        [sizeof("CreateDirectFBSurfaceEXT")];
+    char GetPhysicalDeviceDirectFBPresentationSupportEXT                 [sizeof("GetPhysicalDeviceDirectFBPresentationSupportEXT")];
+    char AcquireXlibDisplayEXT                                           [sizeof("AcquireXlibDisplayEXT")];
+    char GetRandROutputDisplayEXT                                        [sizeof("GetRandROutputDisplayEXT")];
+    char CreateStreamDescriptorSurfaceGGP                                [sizeof("CreateStreamDescriptorSurfaceGGP")];
+    char CreateScreenSurfaceQNX                                          [sizeof("CreateScreenSurfaceQNX")];
+    char GetPhysicalDeviceScreenPresentationSupportQNX                   [sizeof("GetPhysicalDeviceScreenPresentationSupportQNX")];
+    char GetPhysicalDeviceCooperativeVectorPropertiesNV                  [sizeof("GetPhysicalDeviceCooperativeVectorPropertiesNV")];
+    char GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV[sizeof("GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV")];
+    /* device functions */
+    char DestroyDevice                                                   [sizeof("DestroyDevice")];
+    char GetDeviceQueue                                                  [sizeof("GetDeviceQueue")];
+    char QueueSubmit                                                     [sizeof("QueueSubmit")];
+    char QueueWaitIdle                                                   [sizeof("QueueWaitIdle")];
+    char DeviceWaitIdle                                                  [sizeof("DeviceWaitIdle")];
+    char AllocateMemory                                                  [sizeof("AllocateMemory")];
+    char FreeMemory                                                      [sizeof("FreeMemory")];
+    char MapMemory                                                       [sizeof("MapMemory")];
+    char UnmapMemory                                                     [sizeof("UnmapMemory")];
+    char FlushMappedMemoryRanges                                         [sizeof("FlushMappedMemoryRanges")];
+    char InvalidateMappedMemoryRanges                                    [sizeof("InvalidateMappedMemoryRanges")];
+    char GetDeviceMemoryCommitment                                       [sizeof("GetDeviceMemoryCommitment")];
+    char BindBufferMemory                                                [sizeof("BindBufferMemory")];
+    char BindImageMemory                                                 [sizeof("BindImageMemory")];
+    char GetBufferMemoryRequirements                                     [sizeof("GetBufferMemoryRequirements")];
+    char GetImageMemoryRequirements                                      [sizeof("GetImageMemoryRequirements")];
+    char GetImageSparseMemoryRequirements                                [sizeof("GetImageSparseMemoryRequirements")];
+    char QueueBindSparse                                                 [sizeof("QueueBindSparse")];
+    char CreateFence                                                     [sizeof("CreateFence")];
+    char DestroyFence                                                    [sizeof("DestroyFence")];
+    char ResetFences                                                     [sizeof("ResetFences")];
+    char GetFenceStatus                                                  [sizeof("GetFenceStatus")];
+    char WaitForFences                                                   [sizeof("WaitForFences")];
+    char CreateSemaphore                                                 [sizeof("CreateSemaphore")];
+    char DestroySemaphore                                                [sizeof("DestroySemaphore")];
+    char CreateEvent                                                     [sizeof("CreateEvent")];
+    char DestroyEvent                                                    [sizeof("DestroyEvent")];
+    char GetEventStatus                                                  [sizeof("GetEventStatus")];
+    char SetEvent                                                        [sizeof("SetEvent")];
+    char ResetEvent                                                      [sizeof("ResetEvent")];
+    char CreateQueryPool                                                 [sizeof("CreateQueryPool")];
+    char DestroyQueryPool                                                [sizeof("DestroyQueryPool")];
+    char GetQueryPoolResults                                             [sizeof("GetQueryPoolResults")];
+    char CreateBuffer                                                    [sizeof("CreateBuffer")];
+    char DestroyBuffer                                                   [sizeof("DestroyBuffer")];
+    char CreateBufferView                                                [sizeof("CreateBufferView")];
+    char DestroyBufferView                                               [sizeof("DestroyBufferView")];
+    char CreateImage                                                     [sizeof("CreateImage")];
+    char DestroyImage                                                    [sizeof("DestroyImage")];
+    char GetImageSubresourceLayout                                       [sizeof("GetImageSubresourceLayout")];
+    char CreateImageView                                                 [sizeof("CreateImageView")];
+    char DestroyImageView                                                [sizeof("DestroyImageView")];
+    char CreateShaderModule                                              [sizeof("CreateShaderModule")];
+    char DestroyShaderModule                                             [sizeof("DestroyShaderModule")];
+    char CreatePipelineCache                                             [sizeof("CreatePipelineCache")];
+    char DestroyPipelineCache                                            [sizeof("DestroyPipelineCache")];
+    char GetPipelineCacheData                                            [sizeof("GetPipelineCacheData")];
+    char MergePipelineCaches                                             [sizeof("MergePipelineCaches")];
+    char CreateGraphicsPipelines                                         [sizeof("CreateGraphicsPipelines")];
+    char CreateComputePipelines                                          [sizeof("CreateComputePipelines")];
+    char DestroyPipeline                                                 [sizeof("DestroyPipeline")];
+    char CreatePipelineLayout                                            [sizeof("CreatePipelineLayout")];
+    char DestroyPipelineLayout                                           [sizeof("DestroyPipelineLayout")];
+    char CreateSampler                                                   [sizeof("CreateSampler")];
+    char DestroySampler                                                  [sizeof("DestroySampler")];
+    char CreateDescriptorSetLayout                                       [sizeof("CreateDescriptorSetLayout")];
+    char DestroyDescriptorSetLayout                                      [sizeof("DestroyDescriptorSetLayout")];
+    char CreateDescriptorPool                                            [sizeof("CreateDescriptorPool")];
+    char DestroyDescriptorPool                                           [sizeof("DestroyDescriptorPool")];
+    char ResetDescriptorPool                                             [sizeof("ResetDescriptorPool")];
+    char AllocateDescriptorSets                                          [sizeof("AllocateDescriptorSets")];
+    char FreeDescriptorSets                                              [sizeof("FreeDescriptorSets")];
+    char UpdateDescriptorSets                                            [sizeof("UpdateDescriptorSets")];
+    char CreateFramebuffer                                               [sizeof("CreateFramebuffer")];
+    char DestroyFramebuffer                                              [sizeof("DestroyFramebuffer")];
+    char CreateRenderPass                                                [sizeof("CreateRenderPass")];
+    char DestroyRenderPass                                               [sizeof("DestroyRenderPass")];
+    char GetRenderAreaGranularity                                        [sizeof("GetRenderAreaGranularity")];
+    char CreateCommandPool                                               [sizeof("CreateCommandPool")];
+    char DestroyCommandPool                                              [sizeof("DestroyCommandPool")];
+    char ResetCommandPool                                                [sizeof("ResetCommandPool")];
+    char AllocateCommandBuffers                                          [sizeof("AllocateCommandBuffers")];
+    char FreeCommandBuffers                                              [sizeof("FreeCommandBuffers")];
+    char BeginCommandBuffer                                              [sizeof("BeginCommandBuffer")];
+    char EndCommandBuffer                                                [sizeof("EndCommandBuffer")];
+    char ResetCommandBuffer                                              [sizeof("ResetCommandBuffer")];
+    char CmdBindPipeline                                                 [sizeof("CmdBindPipeline")];
+    char CmdSetViewport                                                  [sizeof("CmdSetViewport")];
+    char CmdSetScissor                                                   [sizeof("CmdSetScissor")];
+    char CmdSetLineWidth                                                 [sizeof("CmdSetLineWidth")];
+    char CmdSetDepthBias                                                 [sizeof("CmdSetDepthBias")];
+    char CmdSetBlendConstants                                            [sizeof("CmdSetBlendConstants")];
+    char CmdSetDepthBounds                                               [sizeof("CmdSetDepthBounds")];
+    char CmdSetStencilCompareMask                                        [sizeof("CmdSetStencilCompareMask")];
+    char CmdSetStencilWriteMask                                          [sizeof("CmdSetStencilWriteMask")];
+    char CmdSetStencilReference                                          [sizeof("CmdSetStencilReference")];
+    char CmdBindDescriptorSets                                           [sizeof("CmdBindDescriptorSets")];
+    char CmdBindIndexBuffer                                              [sizeof("CmdBindIndexBuffer")];
+    char CmdBindVertexBuffers                                            [sizeof("CmdBindVertexBuffers")];
+    char CmdDraw                                                         [sizeof("CmdDraw")];
+    char CmdDrawIndexed                                                  [sizeof("CmdDrawIndexed")];
+    char CmdDrawIndirect                                                 [sizeof("CmdDrawIndirect")];
+    char CmdDrawIndexedIndirect                                          [sizeof("CmdDrawIndexedIndirect")];
+    char CmdDispatch                                                     [sizeof("CmdDispatch")];
+    char CmdDispatchIndirect                                             [sizeof("CmdDispatchIndirect")];
+    char CmdCopyBuffer                                                   [sizeof("CmdCopyBuffer")];
+    char CmdCopyImage                                                    [sizeof("CmdCopyImage")];
+    char CmdBlitImage                                                    [sizeof("CmdBlitImage")];
+    char CmdCopyBufferToImage                                            [sizeof("CmdCopyBufferToImage")];
+    char CmdCopyImageToBuffer                                            [sizeof("CmdCopyImageToBuffer")];
+    char CmdUpdateBuffer                                                 [sizeof("CmdUpdateBuffer")];
+    char CmdFillBuffer                                                   [sizeof("CmdFillBuffer")];
+    char CmdClearColorImage                                              [sizeof("CmdClearColorImage")];
+    char CmdClearDepthStencilImage                                       [sizeof("CmdClearDepthStencilImage")];
+    char CmdClearAttachments                                             [sizeof("CmdClearAttachments")];
+    char CmdResolveImage                                                 [sizeof("CmdResolveImage")];
+    char CmdSetEvent                                                     [sizeof("CmdSetEvent")];
+    char CmdResetEvent                                                   [sizeof("CmdResetEvent")];
+    char CmdWaitEvents                                                   [sizeof("CmdWaitEvents")];
+    char CmdPipelineBarrier                                              [sizeof("CmdPipelineBarrier")];
+    char CmdBeginQuery                                                   [sizeof("CmdBeginQuery")];
+    char CmdEndQuery                                                     [sizeof("CmdEndQuery")];
+    char CmdResetQueryPool                                               [sizeof("CmdResetQueryPool")];
+    char CmdWriteTimestamp                                               [sizeof("CmdWriteTimestamp")];
+    char CmdCopyQueryPoolResults                                         [sizeof("CmdCopyQueryPoolResults")];
+    char CmdPushConstants                                                [sizeof("CmdPushConstants")];
+    char CmdBeginRenderPass                                              [sizeof("CmdBeginRenderPass")];
+    char CmdNextSubpass                                                  [sizeof("CmdNextSubpass")];
+    char CmdEndRenderPass                                                [sizeof("CmdEndRenderPass")];
+    char CmdExecuteCommands                                              [sizeof("CmdExecuteCommands")];
+    char BindBufferMemory2                                               [sizeof("BindBufferMemory2")];
+    char BindImageMemory2                                                [sizeof("BindImageMemory2")];
+    char GetDeviceGroupPeerMemoryFeatures                                [sizeof("GetDeviceGroupPeerMemoryFeatures")];
+    char CmdSetDeviceMask                                                [sizeof("CmdSetDeviceMask")];
+    char CmdDispatchBase                                                 [sizeof("CmdDispatchBase")];
+    char GetImageMemoryRequirements2                                     [sizeof("GetImageMemoryRequirements2")];
+    char GetBufferMemoryRequirements2                                    [sizeof("GetBufferMemoryRequirements2")];
+    char GetImageSparseMemoryRequirements2                               [sizeof("GetImageSparseMemoryRequirements2")];
+    char TrimCommandPool                                                 [sizeof("TrimCommandPool")];
+    char GetDeviceQueue2                                                 [sizeof("GetDeviceQueue2")];
+    char CreateSamplerYcbcrConversion                                    [sizeof("CreateSamplerYcbcrConversion")];
+    char DestroySamplerYcbcrConversion                                   [sizeof("DestroySamplerYcbcrConversion")];
+    char CreateDescriptorUpdateTemplate                                  [sizeof("CreateDescriptorUpdateTemplate")];
+    char DestroyDescriptorUpdateTemplate                                 [sizeof("DestroyDescriptorUpdateTemplate")];
+    char UpdateDescriptorSetWithTemplate                                 [sizeof("UpdateDescriptorSetWithTemplate")];
+    char GetDescriptorSetLayoutSupport                                   [sizeof("GetDescriptorSetLayoutSupport")];
+    char CmdDrawIndirectCount                                            [sizeof("CmdDrawIndirectCount")];
+    char CmdDrawIndexedIndirectCount                                     [sizeof("CmdDrawIndexedIndirectCount")];
+    char CreateRenderPass2                                               [sizeof("CreateRenderPass2")];
+    char CmdBeginRenderPass2                                             [sizeof("CmdBeginRenderPass2")];
+    char CmdNextSubpass2                                                 [sizeof("CmdNextSubpass2")];
+    char CmdEndRenderPass2                                               [sizeof("CmdEndRenderPass2")];
+    char ResetQueryPool                                                  [sizeof("ResetQueryPool")];
+    char GetSemaphoreCounterValue                                        [sizeof("GetSemaphoreCounterValue")];
+    char WaitSemaphores                                                  [sizeof("WaitSemaphores")];
+    char SignalSemaphore                                                 [sizeof("SignalSemaphore")];
+    char GetBufferDeviceAddress                                          [sizeof("GetBufferDeviceAddress")];
+    char GetBufferOpaqueCaptureAddress                                   [sizeof("GetBufferOpaqueCaptureAddress")];
+    char GetDeviceMemoryOpaqueCaptureAddress                             [sizeof("GetDeviceMemoryOpaqueCaptureAddress")];
+    char CreatePrivateDataSlot                                           [sizeof("CreatePrivateDataSlot")];
+    char DestroyPrivateDataSlot                                          [sizeof("DestroyPrivateDataSlot")];
+    char SetPrivateData                                                  [sizeof("SetPrivateData")];
+    char GetPrivateData                                                  [sizeof("GetPrivateData")];
+    char CmdSetEvent2                                                    [sizeof("CmdSetEvent2")];
+    char CmdResetEvent2                                                  [sizeof("CmdResetEvent2")];
+    char CmdWaitEvents2                                                  [sizeof("CmdWaitEvents2")];
+    char CmdPipelineBarrier2                                             [sizeof("CmdPipelineBarrier2")];
+    char CmdWriteTimestamp2                                              [sizeof("CmdWriteTimestamp2")];
+    char QueueSubmit2                                                    [sizeof("QueueSubmit2")];
+    char CmdCopyBuffer2                                                  [sizeof("CmdCopyBuffer2")];
+    char CmdCopyImage2                                                   [sizeof("CmdCopyImage2")];
+    char CmdCopyBufferToImage2                                           [sizeof("CmdCopyBufferToImage2")];
+    char CmdCopyImageToBuffer2                                           [sizeof("CmdCopyImageToBuffer2")];
+    char CmdBlitImage2                                                   [sizeof("CmdBlitImage2")];
+    char CmdResolveImage2                                                [sizeof("CmdResolveImage2")];
+    char CmdBeginRendering                                               [sizeof("CmdBeginRendering")];
+    char CmdEndRendering                                                 [sizeof("CmdEndRendering")];
+    char CmdSetCullMode                                                  [sizeof("CmdSetCullMode")];
+    char CmdSetFrontFace                                                 [sizeof("CmdSetFrontFace")];
+    char CmdSetPrimitiveTopology                                         [sizeof("CmdSetPrimitiveTopology")];
+    char CmdSetViewportWithCount                                         [sizeof("CmdSetViewportWithCount")];
+    char CmdSetScissorWithCount                                          [sizeof("CmdSetScissorWithCount")];
+    char CmdBindVertexBuffers2                                           [sizeof("CmdBindVertexBuffers2")];
+    char CmdSetDepthTestEnable                                           [sizeof("CmdSetDepthTestEnable")];
+    char CmdSetDepthWriteEnable                                          [sizeof("CmdSetDepthWriteEnable")];
+    char CmdSetDepthCompareOp                                            [sizeof("CmdSetDepthCompareOp")];
+    char CmdSetDepthBoundsTestEnable                                     [sizeof("CmdSetDepthBoundsTestEnable")];
+    char CmdSetStencilTestEnable                                         [sizeof("CmdSetStencilTestEnable")];
+    char CmdSetStencilOp                                                 [sizeof("CmdSetStencilOp")];
+    char CmdSetRasterizerDiscardEnable                                   [sizeof("CmdSetRasterizerDiscardEnable")];
+    char CmdSetDepthBiasEnable                                           [sizeof("CmdSetDepthBiasEnable")];
+    char CmdSetPrimitiveRestartEnable                                    [sizeof("CmdSetPrimitiveRestartEnable")];
+    char GetDeviceBufferMemoryRequirements                               [sizeof("GetDeviceBufferMemoryRequirements")];
+    char GetDeviceImageMemoryRequirements                                [sizeof("GetDeviceImageMemoryRequirements")];
+    char GetDeviceImageSparseMemoryRequirements                          [sizeof("GetDeviceImageSparseMemoryRequirements")];
+    char CreateSwapchainKHR                                              [sizeof("CreateSwapchainKHR")];
+    char DestroySwapchainKHR                                             [sizeof("DestroySwapchainKHR")];
+    char GetSwapchainImagesKHR                                           [sizeof("GetSwapchainImagesKHR")];
+    char AcquireNextImageKHR                                             [sizeof("AcquireNextImageKHR")];
+    char QueuePresentKHR                                                 [sizeof("QueuePresentKHR")];
+    char GetDeviceGroupPresentCapabilitiesKHR                            [sizeof("GetDeviceGroupPresentCapabilitiesKHR")];
+    char GetDeviceGroupSurfacePresentModesKHR                            [sizeof("GetDeviceGroupSurfacePresentModesKHR")];
+    char AcquireNextImage2KHR                                            [sizeof("AcquireNextImage2KHR")];
+    char CreateSharedSwapchainsKHR                                       [sizeof("CreateSharedSwapchainsKHR")];
+    char CreateVideoSessionKHR                                           [sizeof("CreateVideoSessionKHR")];
+    char DestroyVideoSessionKHR                                          [sizeof("DestroyVideoSessionKHR")];
+    char GetVideoSessionMemoryRequirementsKHR                            [sizeof("GetVideoSessionMemoryRequirementsKHR")];
+    char BindVideoSessionMemoryKHR                                       [sizeof("BindVideoSessionMemoryKHR")];
+    char CreateVideoSessionParametersKHR                                 [sizeof("CreateVideoSessionParametersKHR")];
+    char UpdateVideoSessionParametersKHR                                 [sizeof("UpdateVideoSessionParametersKHR")];
+    char DestroyVideoSessionParametersKHR                                [sizeof("DestroyVideoSessionParametersKHR")];
+    char CmdBeginVideoCodingKHR                                          [sizeof("CmdBeginVideoCodingKHR")];
+    char CmdEndVideoCodingKHR                                            [sizeof("CmdEndVideoCodingKHR")];
+    char CmdControlVideoCodingKHR                                        [sizeof("CmdControlVideoCodingKHR")];
+    char CmdDecodeVideoKHR                                               [sizeof("CmdDecodeVideoKHR")];
+    char CmdBeginRenderingKHR                                            [sizeof("CmdBeginRenderingKHR")];
+    char CmdEndRenderingKHR                                              [sizeof("CmdEndRenderingKHR")];
+    char GetDeviceGroupPeerMemoryFeaturesKHR                             [sizeof("GetDeviceGroupPeerMemoryFeaturesKHR")];
+    char CmdSetDeviceMaskKHR                                             [sizeof("CmdSetDeviceMaskKHR")];
+    char CmdDispatchBaseKHR                                              [sizeof("CmdDispatchBaseKHR")];
+    char TrimCommandPoolKHR                                              [sizeof("TrimCommandPoolKHR")];
+    char GetMemoryFdKHR                                                  [sizeof("GetMemoryFdKHR")];
+    char GetMemoryFdPropertiesKHR                                        [sizeof("GetMemoryFdPropertiesKHR")];
+    char ImportSemaphoreFdKHR                                            [sizeof("ImportSemaphoreFdKHR")];
+    char GetSemaphoreFdKHR                                               [sizeof("GetSemaphoreFdKHR")];
+    char CmdPushDescriptorSetKHR                                         [sizeof("CmdPushDescriptorSetKHR")];
+    char CmdPushDescriptorSetWithTemplateKHR                             [sizeof("CmdPushDescriptorSetWithTemplateKHR")];
+    char CreateDescriptorUpdateTemplateKHR                               [sizeof("CreateDescriptorUpdateTemplateKHR")];
+    char DestroyDescriptorUpdateTemplateKHR                              [sizeof("DestroyDescriptorUpdateTemplateKHR")];
+    char UpdateDescriptorSetWithTemplateKHR                              [sizeof("UpdateDescriptorSetWithTemplateKHR")];
+    char CreateRenderPass2KHR                                            [sizeof("CreateRenderPass2KHR")];
+    char CmdBeginRenderPass2KHR                                          [sizeof("CmdBeginRenderPass2KHR")];
+    char CmdNextSubpass2KHR                                              [sizeof("CmdNextSubpass2KHR")];
+    char CmdEndRenderPass2KHR                                            [sizeof("CmdEndRenderPass2KHR")];
+    char GetSwapchainStatusKHR                                           [sizeof("GetSwapchainStatusKHR")];
+    char ImportFenceFdKHR                                                [sizeof("ImportFenceFdKHR")];
+    char GetFenceFdKHR                                                   [sizeof("GetFenceFdKHR")];
+    char AcquireProfilingLockKHR                                         [sizeof("AcquireProfilingLockKHR")];
+    char ReleaseProfilingLockKHR                                         [sizeof("ReleaseProfilingLockKHR")];
+    char GetImageMemoryRequirements2KHR                                  [sizeof("GetImageMemoryRequirements2KHR")];
+    char GetBufferMemoryRequirements2KHR                                 [sizeof("GetBufferMemoryRequirements2KHR")];
+    char GetImageSparseMemoryRequirements2KHR                            [sizeof("GetImageSparseMemoryRequirements2KHR")];
+    char CreateSamplerYcbcrConversionKHR                                 [sizeof("CreateSamplerYcbcrConversionKHR")];
+    char DestroySamplerYcbcrConversionKHR                                [sizeof("DestroySamplerYcbcrConversionKHR")];
+    char BindBufferMemory2KHR                                            [sizeof("BindBufferMemory2KHR")];
+    char BindImageMemory2KHR                                             [sizeof("BindImageMemory2KHR")];
+    char GetDescriptorSetLayoutSupportKHR                                [sizeof("GetDescriptorSetLayoutSupportKHR")];
+    char CmdDrawIndirectCountKHR                                         [sizeof("CmdDrawIndirectCountKHR")];
+    char CmdDrawIndexedIndirectCountKHR                                  [sizeof("CmdDrawIndexedIndirectCountKHR")];
+    char GetSemaphoreCounterValueKHR                                     [sizeof("GetSemaphoreCounterValueKHR")];
+    char WaitSemaphoresKHR                                               [sizeof("WaitSemaphoresKHR")];
+    char SignalSemaphoreKHR                                              [sizeof("SignalSemaphoreKHR")];
+    char CmdSetFragmentShadingRateKHR                                    [sizeof("CmdSetFragmentShadingRateKHR")];
+    char CmdSetRenderingAttachmentLocationsKHR                           [sizeof("CmdSetRenderingAttachmentLocationsKHR")];
+    char CmdSetRenderingInputAttachmentIndicesKHR                        [sizeof("CmdSetRenderingInputAttachmentIndicesKHR")];
+    char WaitForPresentKHR                                               [sizeof("WaitForPresentKHR")];
+    char GetBufferDeviceAddressKHR                                       [sizeof("GetBufferDeviceAddressKHR")];
+    char GetBufferOpaqueCaptureAddressKHR                                [sizeof("GetBufferOpaqueCaptureAddressKHR")];
+    char GetDeviceMemoryOpaqueCaptureAddressKHR                          [sizeof("GetDeviceMemoryOpaqueCaptureAddressKHR")];
+    char CreateDeferredOperationKHR                                      [sizeof("CreateDeferredOperationKHR")];
+    char DestroyDeferredOperationKHR                                     [sizeof("DestroyDeferredOperationKHR")];
+    char GetDeferredOperationMaxConcurrencyKHR                           [sizeof("GetDeferredOperationMaxConcurrencyKHR")];
+    char GetDeferredOperationResultKHR                                   [sizeof("GetDeferredOperationResultKHR")];
+    char DeferredOperationJoinKHR                                        [sizeof("DeferredOperationJoinKHR")];
+    char GetPipelineExecutablePropertiesKHR                              [sizeof("GetPipelineExecutablePropertiesKHR")];
+    char GetPipelineExecutableStatisticsKHR                              [sizeof("GetPipelineExecutableStatisticsKHR")];
+    char GetPipelineExecutableInternalRepresentationsKHR                 [sizeof("GetPipelineExecutableInternalRepresentationsKHR")];
+    char MapMemory2KHR                                                   [sizeof("MapMemory2KHR")];
+    char UnmapMemory2KHR                                                 [sizeof("UnmapMemory2KHR")];
+    char GetEncodedVideoSessionParametersKHR                             [sizeof("GetEncodedVideoSessionParametersKHR")];
+    char CmdEncodeVideoKHR                                               [sizeof("CmdEncodeVideoKHR")];
+    char CmdSetEvent2KHR                                                 [sizeof("CmdSetEvent2KHR")];
+    char CmdResetEvent2KHR                                               [sizeof("CmdResetEvent2KHR")];
+    char CmdWaitEvents2KHR                                               [sizeof("CmdWaitEvents2KHR")];
+    char CmdPipelineBarrier2KHR                                          [sizeof("CmdPipelineBarrier2KHR")];
+    char CmdWriteTimestamp2KHR                                           [sizeof("CmdWriteTimestamp2KHR")];
+    char QueueSubmit2KHR                                                 [sizeof("QueueSubmit2KHR")];
+    char CmdWriteBufferMarker2AMD                                        [sizeof("CmdWriteBufferMarker2AMD")];
+    char GetQueueCheckpointData2NV                                       [sizeof("GetQueueCheckpointData2NV")];
+    char CmdCopyBuffer2KHR                                               [sizeof("CmdCopyBuffer2KHR")];
+    char CmdCopyImage2KHR                                                [sizeof("CmdCopyImage2KHR")];
+    char CmdCopyBufferToImage2KHR                                        [sizeof("CmdCopyBufferToImage2KHR")];
+    char CmdCopyImageToBuffer2KHR                                        [sizeof("CmdCopyImageToBuffer2KHR")];
+    char CmdBlitImage2KHR                                                [sizeof("CmdBlitImage2KHR")];
+    char CmdResolveImage2KHR                                             [sizeof("CmdResolveImage2KHR")];
+    char CmdTraceRaysIndirect2KHR                                        [sizeof("CmdTraceRaysIndirect2KHR")];
+    char GetDeviceBufferMemoryRequirementsKHR                            [sizeof("GetDeviceBufferMemoryRequirementsKHR")];
+    char GetDeviceImageMemoryRequirementsKHR                             [sizeof("GetDeviceImageMemoryRequirementsKHR")];
+    char GetDeviceImageSparseMemoryRequirementsKHR                       [sizeof("GetDeviceImageSparseMemoryRequirementsKHR")];
+    char CmdBindIndexBuffer2KHR                                          [sizeof("CmdBindIndexBuffer2KHR")];
+    char GetRenderingAreaGranularityKHR                                  [sizeof("GetRenderingAreaGranularityKHR")];
+    char GetDeviceImageSubresourceLayoutKHR                              [sizeof("GetDeviceImageSubresourceLayoutKHR")];
+    char GetImageSubresourceLayout2KHR                                   [sizeof("GetImageSubresourceLayout2KHR")];
+    char CmdSetLineStippleKHR                                            [sizeof("CmdSetLineStippleKHR")];
+    char GetCalibratedTimestampsKHR                                      [sizeof("GetCalibratedTimestampsKHR")];
+    char CmdBindDescriptorSets2KHR                                       [sizeof("CmdBindDescriptorSets2KHR")];
+    char CmdPushConstants2KHR                                            [sizeof("CmdPushConstants2KHR")];
+    char CmdPushDescriptorSet2KHR                                        [sizeof("CmdPushDescriptorSet2KHR")];
+    char CmdPushDescriptorSetWithTemplate2KHR                            [sizeof("CmdPushDescriptorSetWithTemplate2KHR")];
+    char CmdSetDescriptorBufferOffsets2EXT                               [sizeof("CmdSetDescriptorBufferOffsets2EXT")];
+    char CmdBindDescriptorBufferEmbeddedSamplers2EXT                     [sizeof("CmdBindDescriptorBufferEmbeddedSamplers2EXT")];
+    char DebugMarkerSetObjectTagEXT                                      [sizeof("DebugMarkerSetObjectTagEXT")];
+    char DebugMarkerSetObjectNameEXT                                     [sizeof("DebugMarkerSetObjectNameEXT")];
+    char CmdDebugMarkerBeginEXT                                          [sizeof("CmdDebugMarkerBeginEXT")];
+    char CmdDebugMarkerEndEXT                                            [sizeof("CmdDebugMarkerEndEXT")];
+    char CmdDebugMarkerInsertEXT                                         [sizeof("CmdDebugMarkerInsertEXT")];
+    char CmdBindTransformFeedbackBuffersEXT                              [sizeof("CmdBindTransformFeedbackBuffersEXT")];
+    char CmdBeginTransformFeedbackEXT                                    [sizeof("CmdBeginTransformFeedbackEXT")];
+    char CmdEndTransformFeedbackEXT                                      [sizeof("CmdEndTransformFeedbackEXT")];
+    char CmdBeginQueryIndexedEXT                                         [sizeof("CmdBeginQueryIndexedEXT")];
+    char CmdEndQueryIndexedEXT                                           [sizeof("CmdEndQueryIndexedEXT")];
+    char CmdDrawIndirectByteCountEXT                                     [sizeof("CmdDrawIndirectByteCountEXT")];
+    char CreateCuModuleNVX                                               [sizeof("CreateCuModuleNVX")];
+    char CreateCuFunctionNVX                                             [sizeof("CreateCuFunctionNVX")];
+    char DestroyCuModuleNVX                                              [sizeof("DestroyCuModuleNVX")];
+    char DestroyCuFunctionNVX                                            [sizeof("DestroyCuFunctionNVX")];
+    char CmdCuLaunchKernelNVX                                            [sizeof("CmdCuLaunchKernelNVX")];
+    char GetImageViewHandleNVX                                           [sizeof("GetImageViewHandleNVX")];
+    char GetImageViewAddressNVX                                          [sizeof("GetImageViewAddressNVX")];
+    char CmdDrawIndirectCountAMD                                         [sizeof("CmdDrawIndirectCountAMD")];
+    char CmdDrawIndexedIndirectCountAMD                                  [sizeof("CmdDrawIndexedIndirectCountAMD")];
+    char GetShaderInfoAMD                                                [sizeof("GetShaderInfoAMD")];
+    char CmdBeginConditionalRenderingEXT                                 [sizeof("CmdBeginConditionalRenderingEXT")];
+    char CmdEndConditionalRenderingEXT                                   [sizeof("CmdEndConditionalRenderingEXT")];
+    char CmdSetViewportWScalingNV                                        [sizeof("CmdSetViewportWScalingNV")];
+    char DisplayPowerControlEXT                                          [sizeof("DisplayPowerControlEXT")];
+    char RegisterDeviceEventEXT                                          [sizeof("RegisterDeviceEventEXT")];
+    char RegisterDisplayEventEXT                                         [sizeof("RegisterDisplayEventEXT")];
+    char GetSwapchainCounterEXT                                          [sizeof("GetSwapchainCounterEXT")];
+    char GetRefreshCycleDurationGOOGLE                                   [sizeof("GetRefreshCycleDurationGOOGLE")];
+    char GetPastPresentationTimingGOOGLE                                 [sizeof("GetPastPresentationTimingGOOGLE")];
+    char CmdSetDiscardRectangleEXT                                       [sizeof("CmdSetDiscardRectangleEXT")];
+    char CmdSetDiscardRectangleEnableEXT                                 [sizeof("CmdSetDiscardRectangleEnableEXT")];
+    char CmdSetDiscardRectangleModeEXT                                   [sizeof("CmdSetDiscardRectangleModeEXT")];
+    char SetHdrMetadataEXT                                               [sizeof("SetHdrMetadataEXT")];
+    char SetDebugUtilsObjectNameEXT                                      [sizeof("SetDebugUtilsObjectNameEXT")];
+    char SetDebugUtilsObjectTagEXT                                       [sizeof("SetDebugUtilsObjectTagEXT")];
+    char QueueBeginDebugUtilsLabelEXT                                    [sizeof("QueueBeginDebugUtilsLabelEXT")];
+    char QueueEndDebugUtilsLabelEXT                                      [sizeof("QueueEndDebugUtilsLabelEXT")];
+    char QueueInsertDebugUtilsLabelEXT                                   [sizeof("QueueInsertDebugUtilsLabelEXT")];
+    char CmdBeginDebugUtilsLabelEXT                                      [sizeof("CmdBeginDebugUtilsLabelEXT")];
+    char CmdEndDebugUtilsLabelEXT                                        [sizeof("CmdEndDebugUtilsLabelEXT")];
+    char CmdInsertDebugUtilsLabelEXT                                     [sizeof("CmdInsertDebugUtilsLabelEXT")];
+    char CmdSetSampleLocationsEXT                                        [sizeof("CmdSetSampleLocationsEXT")];
+    char GetImageDrmFormatModifierPropertiesEXT                          [sizeof("GetImageDrmFormatModifierPropertiesEXT")];
+    char CreateValidationCacheEXT                                        [sizeof("CreateValidationCacheEXT")];
+    char DestroyValidationCacheEXT                                       [sizeof("DestroyValidationCacheEXT")];
+    char MergeValidationCachesEXT                                        [sizeof("MergeValidationCachesEXT")];
+    char GetValidationCacheDataEXT                                       [sizeof("GetValidationCacheDataEXT")];
+    char CmdBindShadingRateImageNV                                       [sizeof("CmdBindShadingRateImageNV")];
+    char CmdSetViewportShadingRatePaletteNV                              [sizeof("CmdSetViewportShadingRatePaletteNV")];
+    char CmdSetCoarseSampleOrderNV                                       [sizeof("CmdSetCoarseSampleOrderNV")];
+    char CreateAccelerationStructureNV                                   [sizeof("CreateAccelerationStructureNV")];
+    char DestroyAccelerationStructureNV                                  [sizeof("DestroyAccelerationStructureNV")];
+    char GetAccelerationStructureMemoryRequirementsNV                    [sizeof("GetAccelerationStructureMemoryRequirementsNV")];
+    char BindAccelerationStructureMemoryNV                               [sizeof("BindAccelerationStructureMemoryNV")];
+    char CmdBuildAccelerationStructureNV                                 [sizeof("CmdBuildAccelerationStructureNV")];
+    char CmdCopyAccelerationStructureNV                                  [sizeof("CmdCopyAccelerationStructureNV")];
+    char CmdTraceRaysNV                                                  [sizeof("CmdTraceRaysNV")];
+    char CreateRayTracingPipelinesNV                                     [sizeof("CreateRayTracingPipelinesNV")];
+    char GetRayTracingShaderGroupHandlesKHR                              [sizeof("GetRayTracingShaderGroupHandlesKHR")];
+    char GetRayTracingShaderGroupHandlesNV                               [sizeof("GetRayTracingShaderGroupHandlesNV")];
+    char GetAccelerationStructureHandleNV                                [sizeof("GetAccelerationStructureHandleNV")];
+    char CmdWriteAccelerationStructuresPropertiesNV                      [sizeof("CmdWriteAccelerationStructuresPropertiesNV")];
+    char CompileDeferredNV                                               [sizeof("CompileDeferredNV")];
+    char GetMemoryHostPointerPropertiesEXT                               [sizeof("GetMemoryHostPointerPropertiesEXT")];
+    char CmdWriteBufferMarkerAMD                                         [sizeof("CmdWriteBufferMarkerAMD")];
+    char GetCalibratedTimestampsEXT                                      [sizeof("GetCalibratedTimestampsEXT")];
+    char CmdDrawMeshTasksNV                                              [sizeof("CmdDrawMeshTasksNV")];
+    char CmdDrawMeshTasksIndirectNV                                      [sizeof("CmdDrawMeshTasksIndirectNV")];
+    char CmdDrawMeshTasksIndirectCountNV                                 [sizeof("CmdDrawMeshTasksIndirectCountNV")];
+    char CmdSetExclusiveScissorEnableNV                                  [sizeof("CmdSetExclusiveScissorEnableNV")];
+    char CmdSetExclusiveScissorNV                                        [sizeof("CmdSetExclusiveScissorNV")];
+    char CmdSetCheckpointNV                                              [sizeof("CmdSetCheckpointNV")];
+    char GetQueueCheckpointDataNV                                        [sizeof("GetQueueCheckpointDataNV")];
+    char InitializePerformanceApiINTEL                                   [sizeof("InitializePerformanceApiINTEL")];
+    char UninitializePerformanceApiINTEL                                 [sizeof("UninitializePerformanceApiINTEL")];
+    char CmdSetPerformanceMarkerINTEL                                    [sizeof("CmdSetPerformanceMarkerINTEL")];
+    char CmdSetPerformanceStreamMarkerINTEL                              [sizeof("CmdSetPerformanceStreamMarkerINTEL")];
+    char CmdSetPerformanceOverrideINTEL                                  [sizeof("CmdSetPerformanceOverrideINTEL")];
+    char AcquirePerformanceConfigurationINTEL                            [sizeof("AcquirePerformanceConfigurationINTEL")];
+    char ReleasePerformanceConfigurationINTEL                            [sizeof("ReleasePerformanceConfigurationINTEL")];
+    char QueueSetPerformanceConfigurationINTEL                           [sizeof("QueueSetPerformanceConfigurationINTEL")];
+    char GetPerformanceParameterINTEL                                    [sizeof("GetPerformanceParameterINTEL")];
+    char SetLocalDimmingAMD                                              [sizeof("SetLocalDimmingAMD")];
+    char GetBufferDeviceAddressEXT                                       [sizeof("GetBufferDeviceAddressEXT")];
+    char CmdSetLineStippleEXT                                            [sizeof("CmdSetLineStippleEXT")];
+    char ResetQueryPoolEXT                                               [sizeof("ResetQueryPoolEXT")];
+    char CmdSetCullModeEXT                                               [sizeof("CmdSetCullModeEXT")];
+    char CmdSetFrontFaceEXT                                              [sizeof("CmdSetFrontFaceEXT")];
+    char CmdSetPrimitiveTopologyEXT                                      [sizeof("CmdSetPrimitiveTopologyEXT")];
+    char CmdSetViewportWithCountEXT                                      [sizeof("CmdSetViewportWithCountEXT")];
+    char CmdSetScissorWithCountEXT                                       [sizeof("CmdSetScissorWithCountEXT")];
+    char CmdBindVertexBuffers2EXT                                        [sizeof("CmdBindVertexBuffers2EXT")];
+    char CmdSetDepthTestEnableEXT                                        [sizeof("CmdSetDepthTestEnableEXT")];
+    char CmdSetDepthWriteEnableEXT                                       [sizeof("CmdSetDepthWriteEnableEXT")];
+    char CmdSetDepthCompareOpEXT                                         [sizeof("CmdSetDepthCompareOpEXT")];
+    char CmdSetDepthBoundsTestEnableEXT                                  [sizeof("CmdSetDepthBoundsTestEnableEXT")];
+    char CmdSetStencilTestEnableEXT                                      [sizeof("CmdSetStencilTestEnableEXT")];
+    char CmdSetStencilOpEXT                                              [sizeof("CmdSetStencilOpEXT")];
+    char CopyMemoryToImageEXT                                            [sizeof("CopyMemoryToImageEXT")];
+    char CopyImageToMemoryEXT                                            [sizeof("CopyImageToMemoryEXT")];
+    char CopyImageToImageEXT                                             [sizeof("CopyImageToImageEXT")];
+    char TransitionImageLayoutEXT                                        [sizeof("TransitionImageLayoutEXT")];
+    char GetImageSubresourceLayout2EXT                                   [sizeof("GetImageSubresourceLayout2EXT")];
+    char ReleaseSwapchainImagesEXT                                       [sizeof("ReleaseSwapchainImagesEXT")];
+    char GetGeneratedCommandsMemoryRequirementsNV                        [sizeof("GetGeneratedCommandsMemoryRequirementsNV")];
+    char CmdPreprocessGeneratedCommandsNV                                [sizeof("CmdPreprocessGeneratedCommandsNV")];
+    char CmdExecuteGeneratedCommandsNV                                   [sizeof("CmdExecuteGeneratedCommandsNV")];
+    char CmdBindPipelineShaderGroupNV                                    [sizeof("CmdBindPipelineShaderGroupNV")];
+    char CreateIndirectCommandsLayoutNV                                  [sizeof("CreateIndirectCommandsLayoutNV")];
+    char DestroyIndirectCommandsLayoutNV                                 [sizeof("DestroyIndirectCommandsLayoutNV")];
+    char CmdSetDepthBias2EXT                                             [sizeof("CmdSetDepthBias2EXT")];
+    char CreatePrivateDataSlotEXT                                        [sizeof("CreatePrivateDataSlotEXT")];
+    char DestroyPrivateDataSlotEXT                                       [sizeof("DestroyPrivateDataSlotEXT")];
+    char SetPrivateDataEXT                                               [sizeof("SetPrivateDataEXT")];
+    char GetPrivateDataEXT                                               [sizeof("GetPrivateDataEXT")];
+    char CreateCudaModuleNV                                              [sizeof("CreateCudaModuleNV")];
+    char GetCudaModuleCacheNV                                            [sizeof("GetCudaModuleCacheNV")];
+    char CreateCudaFunctionNV                                            [sizeof("CreateCudaFunctionNV")];
+    char DestroyCudaModuleNV                                             [sizeof("DestroyCudaModuleNV")];
+    char DestroyCudaFunctionNV                                           [sizeof("DestroyCudaFunctionNV")];
+    char CmdCudaLaunchKernelNV                                           [sizeof("CmdCudaLaunchKernelNV")];
+    char GetDescriptorSetLayoutSizeEXT                                   [sizeof("GetDescriptorSetLayoutSizeEXT")];
+    char GetDescriptorSetLayoutBindingOffsetEXT                          [sizeof("GetDescriptorSetLayoutBindingOffsetEXT")];
+    char GetDescriptorEXT                                                [sizeof("GetDescriptorEXT")];
+    char CmdBindDescriptorBuffersEXT                                     [sizeof("CmdBindDescriptorBuffersEXT")];
+    char CmdSetDescriptorBufferOffsetsEXT                                [sizeof("CmdSetDescriptorBufferOffsetsEXT")];
+    char CmdBindDescriptorBufferEmbeddedSamplersEXT                      [sizeof("CmdBindDescriptorBufferEmbeddedSamplersEXT")];
+    char GetBufferOpaqueCaptureDescriptorDataEXT                         [sizeof("GetBufferOpaqueCaptureDescriptorDataEXT")];
+    char GetImageOpaqueCaptureDescriptorDataEXT                          [sizeof("GetImageOpaqueCaptureDescriptorDataEXT")];
+    char GetImageViewOpaqueCaptureDescriptorDataEXT                      [sizeof("GetImageViewOpaqueCaptureDescriptorDataEXT")];
+    char GetSamplerOpaqueCaptureDescriptorDataEXT                        [sizeof("GetSamplerOpaqueCaptureDescriptorDataEXT")];
+    char GetAccelerationStructureOpaqueCaptureDescriptorDataEXT          [sizeof("GetAccelerationStructureOpaqueCaptureDescriptorDataEXT")];
+    char CmdSetFragmentShadingRateEnumNV                                 [sizeof("CmdSetFragmentShadingRateEnumNV")];
+    char GetDeviceFaultInfoEXT                                           [sizeof("GetDeviceFaultInfoEXT")];
+    char CmdSetVertexInputEXT                                            [sizeof("CmdSetVertexInputEXT")];
+    char GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI                   [sizeof("GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI")];
+    char CmdSubpassShadingHUAWEI                                         [sizeof("CmdSubpassShadingHUAWEI")];
+    char CmdBindInvocationMaskHUAWEI                                     [sizeof("CmdBindInvocationMaskHUAWEI")];
+    char GetMemoryRemoteAddressNV                                        [sizeof("GetMemoryRemoteAddressNV")];
+    char GetPipelinePropertiesEXT                                        [sizeof("GetPipelinePropertiesEXT")];
+    char CmdSetPatchControlPointsEXT                                     [sizeof("CmdSetPatchControlPointsEXT")];
+    char CmdSetRasterizerDiscardEnableEXT                                [sizeof("CmdSetRasterizerDiscardEnableEXT")];
+    char CmdSetDepthBiasEnableEXT                                        [sizeof("CmdSetDepthBiasEnableEXT")];
+    char CmdSetLogicOpEXT                                                [sizeof("CmdSetLogicOpEXT")];
+    char CmdSetPrimitiveRestartEnableEXT                                 [sizeof("CmdSetPrimitiveRestartEnableEXT")];
+    char CmdSetColorWriteEnableEXT                                       [sizeof("CmdSetColorWriteEnableEXT")];
+    char CmdDrawMultiEXT                                                 [sizeof("CmdDrawMultiEXT")];
+    char CmdDrawMultiIndexedEXT                                          [sizeof("CmdDrawMultiIndexedEXT")];
+    char CreateMicromapEXT                                               [sizeof("CreateMicromapEXT")];
+    char DestroyMicromapEXT                                              [sizeof("DestroyMicromapEXT")];
+    char CmdBuildMicromapsEXT                                            [sizeof("CmdBuildMicromapsEXT")];
+    char BuildMicromapsEXT                                               [sizeof("BuildMicromapsEXT")];
+    char CopyMicromapEXT                                                 [sizeof("CopyMicromapEXT")];
+    char CopyMicromapToMemoryEXT                                         [sizeof("CopyMicromapToMemoryEXT")];
+    char CopyMemoryToMicromapEXT                                         [sizeof("CopyMemoryToMicromapEXT")];
+    char WriteMicromapsPropertiesEXT                                     [sizeof("WriteMicromapsPropertiesEXT")];
+    char CmdCopyMicromapEXT                                              [sizeof("CmdCopyMicromapEXT")];
+    char CmdCopyMicromapToMemoryEXT                                      [sizeof("CmdCopyMicromapToMemoryEXT")];
+    char CmdCopyMemoryToMicromapEXT                                      [sizeof("CmdCopyMemoryToMicromapEXT")];
+    char CmdWriteMicromapsPropertiesEXT                                  [sizeof("CmdWriteMicromapsPropertiesEXT")];
+    char GetDeviceMicromapCompatibilityEXT                               [sizeof("GetDeviceMicromapCompatibilityEXT")];
+    char GetMicromapBuildSizesEXT                                        [sizeof("GetMicromapBuildSizesEXT")];
+    char CmdDrawClusterHUAWEI                                            [sizeof("CmdDrawClusterHUAWEI")];
+    char CmdDrawClusterIndirectHUAWEI                                    [sizeof("CmdDrawClusterIndirectHUAWEI")];
+    char SetDeviceMemoryPriorityEXT                                      [sizeof("SetDeviceMemoryPriorityEXT")];
+    char GetDescriptorSetLayoutHostMappingInfoVALVE                      [sizeof("GetDescriptorSetLayoutHostMappingInfoVALVE")];
+    char GetDescriptorSetHostMappingVALVE                                [sizeof("GetDescriptorSetHostMappingVALVE")];
+    char CmdCopyMemoryIndirectNV                                         [sizeof("CmdCopyMemoryIndirectNV")];
+    char CmdCopyMemoryToImageIndirectNV                                  [sizeof("CmdCopyMemoryToImageIndirectNV")];
+    char CmdDecompressMemoryNV                                           [sizeof("CmdDecompressMemoryNV")];
+    char CmdDecompressMemoryIndirectCountNV                              [sizeof("CmdDecompressMemoryIndirectCountNV")];
+    char GetPipelineIndirectMemoryRequirementsNV                         [sizeof("GetPipelineIndirectMemoryRequirementsNV")];
+    char CmdUpdatePipelineIndirectBufferNV                               [sizeof("CmdUpdatePipelineIndirectBufferNV")];
+    char GetPipelineIndirectDeviceAddressNV                              [sizeof("GetPipelineIndirectDeviceAddressNV")];
+    char CmdSetDepthClampEnableEXT                                       [sizeof("CmdSetDepthClampEnableEXT")];
+    char CmdSetPolygonModeEXT                                            [sizeof("CmdSetPolygonModeEXT")];
+    char CmdSetRasterizationSamplesEXT                                   [sizeof("CmdSetRasterizationSamplesEXT")];
+    char CmdSetSampleMaskEXT                                             [sizeof("CmdSetSampleMaskEXT")];
+    char CmdSetAlphaToCoverageEnableEXT                                  [sizeof("CmdSetAlphaToCoverageEnableEXT")];
+    char CmdSetAlphaToOneEnableEXT                                       [sizeof("CmdSetAlphaToOneEnableEXT")];
+    char CmdSetLogicOpEnableEXT                                          [sizeof("CmdSetLogicOpEnableEXT")];
+    char CmdSetColorBlendEnableEXT                                       [sizeof("CmdSetColorBlendEnableEXT")];
+    char CmdSetColorBlendEquationEXT                                     [sizeof("CmdSetColorBlendEquationEXT")];
+    char CmdSetColorWriteMaskEXT                                         [sizeof("CmdSetColorWriteMaskEXT")];
+    char CmdSetTessellationDomainOriginEXT                               [sizeof("CmdSetTessellationDomainOriginEXT")];
+    char CmdSetRasterizationStreamEXT                                    [sizeof("CmdSetRasterizationStreamEXT")];
+    char CmdSetConservativeRasterizationModeEXT                          [sizeof("CmdSetConservativeRasterizationModeEXT")];
+    char CmdSetExtraPrimitiveOverestimationSizeEXT                       [sizeof("CmdSetExtraPrimitiveOverestimationSizeEXT")];
+    char CmdSetDepthClipEnableEXT                                        [sizeof("CmdSetDepthClipEnableEXT")];
+    char CmdSetSampleLocationsEnableEXT                                  [sizeof("CmdSetSampleLocationsEnableEXT")];
+    char CmdSetColorBlendAdvancedEXT                                     [sizeof("CmdSetColorBlendAdvancedEXT")];
+    char CmdSetProvokingVertexModeEXT                                    [sizeof("CmdSetProvokingVertexModeEXT")];
+    char CmdSetLineRasterizationModeEXT                                  [sizeof("CmdSetLineRasterizationModeEXT")];
+    char CmdSetLineStippleEnableEXT                                      [sizeof("CmdSetLineStippleEnableEXT")];
+    char CmdSetDepthClipNegativeOneToOneEXT                              [sizeof("CmdSetDepthClipNegativeOneToOneEXT")];
+    char CmdSetViewportWScalingEnableNV                                  [sizeof("CmdSetViewportWScalingEnableNV")];
+    char CmdSetViewportSwizzleNV                                         [sizeof("CmdSetViewportSwizzleNV")];
+    char CmdSetCoverageToColorEnableNV                                   [sizeof("CmdSetCoverageToColorEnableNV")];
+    char CmdSetCoverageToColorLocationNV                                 [sizeof("CmdSetCoverageToColorLocationNV")];
+    char CmdSetCoverageModulationModeNV                                  [sizeof("CmdSetCoverageModulationModeNV")];
+    char CmdSetCoverageModulationTableEnableNV                           [sizeof("CmdSetCoverageModulationTableEnableNV")];
+    char CmdSetCoverageModulationTableNV                                 [sizeof("CmdSetCoverageModulationTableNV")];
+    char CmdSetShadingRateImageEnableNV                                  [sizeof("CmdSetShadingRateImageEnableNV")];
+    char CmdSetRepresentativeFragmentTestEnableNV                        [sizeof("CmdSetRepresentativeFragmentTestEnableNV")];
+    char CmdSetCoverageReductionModeNV                                   [sizeof("CmdSetCoverageReductionModeNV")];
+    char GetShaderModuleIdentifierEXT                                    [sizeof("GetShaderModuleIdentifierEXT")];
+    char GetShaderModuleCreateInfoIdentifierEXT                          [sizeof("GetShaderModuleCreateInfoIdentifierEXT")];
+    char CreateOpticalFlowSessionNV                                      [sizeof("CreateOpticalFlowSessionNV")];
+    char DestroyOpticalFlowSessionNV                                     [sizeof("DestroyOpticalFlowSessionNV")];
+    char BindOpticalFlowSessionImageNV                                   [sizeof("BindOpticalFlowSessionImageNV")];
+    char CmdOpticalFlowExecuteNV                                         [sizeof("CmdOpticalFlowExecuteNV")];
+    char CreateShadersEXT                                                [sizeof("CreateShadersEXT")];
+    char DestroyShaderEXT                                                [sizeof("DestroyShaderEXT")];
+    char GetShaderBinaryDataEXT                                          [sizeof("GetShaderBinaryDataEXT")];
+    char CmdBindShadersEXT                                               [sizeof("CmdBindShadersEXT")];
+    char GetFramebufferTilePropertiesQCOM                                [sizeof("GetFramebufferTilePropertiesQCOM")];
+    char GetDynamicRenderingTilePropertiesQCOM                           [sizeof("GetDynamicRenderingTilePropertiesQCOM")];
+    char SetLatencySleepModeNV                                           [sizeof("SetLatencySleepModeNV")];
+    char LatencySleepNV                                                  [sizeof("LatencySleepNV")];
+    char SetLatencyMarkerNV                                              [sizeof("SetLatencyMarkerNV")];
+    char GetLatencyTimingsNV                                             [sizeof("GetLatencyTimingsNV")];
+    char QueueNotifyOutOfBandNV                                          [sizeof("QueueNotifyOutOfBandNV")];
+    char CmdSetAttachmentFeedbackLoopEnableEXT                           [sizeof("CmdSetAttachmentFeedbackLoopEnableEXT")];
+    char CreateAccelerationStructureKHR                                  [sizeof("CreateAccelerationStructureKHR")];
+    char DestroyAccelerationStructureKHR                                 [sizeof("DestroyAccelerationStructureKHR")];
+    char CmdBuildAccelerationStructuresKHR                               [sizeof("CmdBuildAccelerationStructuresKHR")];
+    char CmdBuildAccelerationStructuresIndirectKHR                       [sizeof("CmdBuildAccelerationStructuresIndirectKHR")];
+    char BuildAccelerationStructuresKHR                                  [sizeof("BuildAccelerationStructuresKHR")];
+    char CopyAccelerationStructureKHR                                    [sizeof("CopyAccelerationStructureKHR")];
+    char CopyAccelerationStructureToMemoryKHR                            [sizeof("CopyAccelerationStructureToMemoryKHR")];
+    char CopyMemoryToAccelerationStructureKHR                            [sizeof("CopyMemoryToAccelerationStructureKHR")];
+    char WriteAccelerationStructuresPropertiesKHR                        [sizeof("WriteAccelerationStructuresPropertiesKHR")];
+    char CmdCopyAccelerationStructureKHR                                 [sizeof("CmdCopyAccelerationStructureKHR")];
+    char CmdCopyAccelerationStructureToMemoryKHR                         [sizeof("CmdCopyAccelerationStructureToMemoryKHR")];
+    char CmdCopyMemoryToAccelerationStructureKHR                         [sizeof("CmdCopyMemoryToAccelerationStructureKHR")];
+    char GetAccelerationStructureDeviceAddressKHR                        [sizeof("GetAccelerationStructureDeviceAddressKHR")];
+    char CmdWriteAccelerationStructuresPropertiesKHR                     [sizeof("CmdWriteAccelerationStructuresPropertiesKHR")];
+    char GetDeviceAccelerationStructureCompatibilityKHR                  [sizeof("GetDeviceAccelerationStructureCompatibilityKHR")];
+    char GetAccelerationStructureBuildSizesKHR                           [sizeof("GetAccelerationStructureBuildSizesKHR")];
+    char CmdTraceRaysKHR                                                 [sizeof("CmdTraceRaysKHR")];
+    char CreateRayTracingPipelinesKHR                                    [sizeof("CreateRayTracingPipelinesKHR")];
+    char GetRayTracingCaptureReplayShaderGroupHandlesKHR                 [sizeof("GetRayTracingCaptureReplayShaderGroupHandlesKHR")];
+    char CmdTraceRaysIndirectKHR                                         [sizeof("CmdTraceRaysIndirectKHR")];
+    char GetRayTracingShaderGroupStackSizeKHR                            [sizeof("GetRayTracingShaderGroupStackSizeKHR")];
+    char CmdSetRayTracingPipelineStackSizeKHR                            [sizeof("CmdSetRayTracingPipelineStackSizeKHR")];
+    char CmdDrawMeshTasksEXT                                             [sizeof("CmdDrawMeshTasksEXT")];
+    char CmdDrawMeshTasksIndirectEXT                                     [sizeof("CmdDrawMeshTasksIndirectEXT")];
+    char CmdDrawMeshTasksIndirectCountEXT                                [sizeof("CmdDrawMeshTasksIndirectCountEXT")];
+    char GetAndroidHardwareBufferPropertiesANDROID                       [sizeof("GetAndroidHardwareBufferPropertiesANDROID")];
+    char GetMemoryAndroidHardwareBufferANDROID                           [sizeof("GetMemoryAndroidHardwareBufferANDROID")];
+    char GetMemoryZirconHandleFUCHSIA                                    [sizeof("GetMemoryZirconHandleFUCHSIA")];
+    char GetMemoryZirconHandlePropertiesFUCHSIA                          [sizeof("GetMemoryZirconHandlePropertiesFUCHSIA")];
+    char ImportSemaphoreZirconHandleFUCHSIA                              [sizeof("ImportSemaphoreZirconHandleFUCHSIA")];
+    char GetSemaphoreZirconHandleFUCHSIA                                 [sizeof("GetSemaphoreZirconHandleFUCHSIA")];
+    char CreateBufferCollectionFUCHSIA                                   [sizeof("CreateBufferCollectionFUCHSIA")];
+    char SetBufferCollectionImageConstraintsFUCHSIA                      [sizeof("SetBufferCollectionImageConstraintsFUCHSIA")];
+    char SetBufferCollectionBufferConstraintsFUCHSIA                     [sizeof("SetBufferCollectionBufferConstraintsFUCHSIA")];
+    char DestroyBufferCollectionFUCHSIA                                  [sizeof("DestroyBufferCollectionFUCHSIA")];
+    char GetBufferCollectionPropertiesFUCHSIA                            [sizeof("GetBufferCollectionPropertiesFUCHSIA")];
+    char ExportMetalObjectsEXT                                           [sizeof("ExportMetalObjectsEXT")];
+    char GetMemoryWin32HandleKHR                                         [sizeof("GetMemoryWin32HandleKHR")];
+    char GetMemoryWin32HandlePropertiesKHR                               [sizeof("GetMemoryWin32HandlePropertiesKHR")];
+    char ImportSemaphoreWin32HandleKHR                                   [sizeof("ImportSemaphoreWin32HandleKHR")];
+    char GetSemaphoreWin32HandleKHR                                      [sizeof("GetSemaphoreWin32HandleKHR")];
+    char ImportFenceWin32HandleKHR                                       [sizeof("ImportFenceWin32HandleKHR")];
+    char GetFenceWin32HandleKHR                                          [sizeof("GetFenceWin32HandleKHR")];
+    char GetMemoryWin32HandleNV                                          [sizeof("GetMemoryWin32HandleNV")];
+    char AcquireFullScreenExclusiveModeEXT                               [sizeof("AcquireFullScreenExclusiveModeEXT")];
+    char ReleaseFullScreenExclusiveModeEXT                               [sizeof("ReleaseFullScreenExclusiveModeEXT")];
+    char GetDeviceGroupSurfacePresentModes2EXT                           [sizeof("GetDeviceGroupSurfacePresentModes2EXT")];
+    char GetScreenBufferPropertiesQNX                                    [sizeof("GetScreenBufferPropertiesQNX")];
+    char CreateExecutionGraphPipelinesAMDX                               [sizeof("CreateExecutionGraphPipelinesAMDX")];
+    char GetExecutionGraphPipelineScratchSizeAMDX                        [sizeof("GetExecutionGraphPipelineScratchSizeAMDX")];
+    char GetExecutionGraphPipelineNodeIndexAMDX                          [sizeof("GetExecutionGraphPipelineNodeIndexAMDX")];
+    char CmdInitializeGraphScratchMemoryAMDX                             [sizeof("CmdInitializeGraphScratchMemoryAMDX")];
+    char CmdDispatchGraphAMDX                                            [sizeof("CmdDispatchGraphAMDX")];
+    char CmdDispatchGraphIndirectAMDX                                    [sizeof("CmdDispatchGraphIndirectAMDX")];
+    char CmdDispatchGraphIndirectCountAMDX                               [sizeof("CmdDispatchGraphIndirectCountAMDX")];
+    char GetImageViewHandle64NVX                                         [sizeof("GetImageViewHandle64NVX")];
+    char CmdSetDepthClampRangeEXT                                        [sizeof("CmdSetDepthClampRangeEXT")];
+    char CmdSetLineStipple                                               [sizeof("CmdSetLineStipple")];
+    char MapMemory2                                                      [sizeof("MapMemory2")];
+    char UnmapMemory2                                                    [sizeof("UnmapMemory2")];
+    char CmdBindIndexBuffer2                                             [sizeof("CmdBindIndexBuffer2")];
+    char GetRenderingAreaGranularity                                     [sizeof("GetRenderingAreaGranularity")];
+    char GetDeviceImageSubresourceLayout                                 [sizeof("GetDeviceImageSubresourceLayout")];
+    char GetImageSubresourceLayout2                                      [sizeof("GetImageSubresourceLayout2")];
+    char CmdPushDescriptorSet                                            [sizeof("CmdPushDescriptorSet")];
+    char CmdPushDescriptorSetWithTemplate                                [sizeof("CmdPushDescriptorSetWithTemplate")];
+    char CmdSetRenderingAttachmentLocations                              [sizeof("CmdSetRenderingAttachmentLocations")];
+    char CmdSetRenderingInputAttachmentIndices                           [sizeof("CmdSetRenderingInputAttachmentIndices")];
+    char CmdBindDescriptorSets2                                          [sizeof("CmdBindDescriptorSets2")];
+    char CmdPushConstants2                                               [sizeof("CmdPushConstants2")];
+    char CmdPushDescriptorSet2                                           [sizeof("CmdPushDescriptorSet2")];
+    char CmdPushDescriptorSetWithTemplate2                               [sizeof("CmdPushDescriptorSetWithTemplate2")];
+    char CopyMemoryToImage                                               [sizeof("CopyMemoryToImage")];
+    char CopyImageToMemory                                               [sizeof("CopyImageToMemory")];
+    char CopyImageToImage                                                [sizeof("CopyImageToImage")];
+    char TransitionImageLayout                                           [sizeof("TransitionImageLayout")];
+    char CreatePipelineBinariesKHR                                       [sizeof("CreatePipelineBinariesKHR")];
+    char DestroyPipelineBinaryKHR                                        [sizeof("DestroyPipelineBinaryKHR")];
+    char GetPipelineKeyKHR                                               [sizeof("GetPipelineKeyKHR")];
+    char GetPipelineBinaryDataKHR                                        [sizeof("GetPipelineBinaryDataKHR")];
+    char ReleaseCapturedPipelineDataKHR                                  [sizeof("ReleaseCapturedPipelineDataKHR")];
+    char AntiLagUpdateAMD                                                [sizeof("AntiLagUpdateAMD")];
+    char ConvertCooperativeVectorMatrixNV                                [sizeof("ConvertCooperativeVectorMatrixNV")];
+    char CmdConvertCooperativeVectorMatrixNV                             [sizeof("CmdConvertCooperativeVectorMatrixNV")];
+    char GetClusterAccelerationStructureBuildSizesNV                     [sizeof("GetClusterAccelerationStructureBuildSizesNV")];
+    char CmdBuildClusterAccelerationStructureIndirectNV                  [sizeof("CmdBuildClusterAccelerationStructureIndirectNV")];
+    char GetPartitionedAccelerationStructuresBuildSizesNV                [sizeof("GetPartitionedAccelerationStructuresBuildSizesNV")];
+    char CmdBuildPartitionedAccelerationStructuresNV                     [sizeof("CmdBuildPartitionedAccelerationStructuresNV")];
+    char GetGeneratedCommandsMemoryRequirementsEXT                       [sizeof("GetGeneratedCommandsMemoryRequirementsEXT")];
+    char CmdPreprocessGeneratedCommandsEXT                               [sizeof("CmdPreprocessGeneratedCommandsEXT")];
+    char CmdExecuteGeneratedCommandsEXT                                  [sizeof("CmdExecuteGeneratedCommandsEXT")];
+    char CreateIndirectCommandsLayoutEXT                                 [sizeof("CreateIndirectCommandsLayoutEXT")];
+    char DestroyIndirectCommandsLayoutEXT                                [sizeof("DestroyIndirectCommandsLayoutEXT")];
+    char CreateIndirectExecutionSetEXT                                   [sizeof("CreateIndirectExecutionSetEXT")];
+    char DestroyIndirectExecutionSetEXT                                  [sizeof("DestroyIndirectExecutionSetEXT")];
+    char UpdateIndirectExecutionSetPipelineEXT                           [sizeof("UpdateIndirectExecutionSetPipelineEXT")];
+    char UpdateIndirectExecutionSetShaderEXT                             [sizeof("UpdateIndirectExecutionSetShaderEXT")];
+    char GetMemoryMetalHandleEXT                                         [sizeof("GetMemoryMetalHandleEXT")];
+    char GetMemoryMetalHandlePropertiesEXT                               [sizeof("GetMemoryMetalHandlePropertiesEXT")];
+} VkadFunctionNames;
+typedef struct VkadExtensionNames {
+    char KHR_swapchain                                  [sizeof("VK_KHR_swapchain")];
+    char KHR_display_swapchain                          [sizeof("VK_KHR_display_swapchain")];
+    char KHR_video_queue                                [sizeof("VK_KHR_video_queue")];
+    char KHR_video_decode_queue                         [sizeof("VK_KHR_video_decode_queue")];
+    char KHR_dynamic_rendering                          [sizeof("VK_KHR_dynamic_rendering")];
+    char KHR_device_group                               [sizeof("VK_KHR_device_group")];
+    char KHR_maintenance1                               [sizeof("VK_KHR_maintenance1")];
+    char KHR_external_memory_fd                         [sizeof("VK_KHR_external_memory_fd")];
+    char KHR_external_semaphore_fd                      [sizeof("VK_KHR_external_semaphore_fd")];
+    char KHR_push_descriptor                            [sizeof("VK_KHR_push_descriptor")];
+    char KHR_descriptor_update_template                 [sizeof("VK_KHR_descriptor_update_template")];
+    char KHR_create_renderpass2                         [sizeof("VK_KHR_create_renderpass2")];
+    char KHR_shared_presentable_image                   [sizeof("VK_KHR_shared_presentable_image")];
+    char KHR_external_fence_fd                          [sizeof("VK_KHR_external_fence_fd")];
+    char KHR_performance_query                          [sizeof("VK_KHR_performance_query")];
+    char KHR_get_memory_requirements2                   [sizeof("VK_KHR_get_memory_requirements2")];
+    char KHR_sampler_ycbcr_conversion                   [sizeof("VK_KHR_sampler_ycbcr_conversion")];
+    char KHR_bind_memory2                               [sizeof("VK_KHR_bind_memory2")];
+    char KHR_maintenance3                               [sizeof("VK_KHR_maintenance3")];
+    char KHR_draw_indirect_count                        [sizeof("VK_KHR_draw_indirect_count")];
+    char KHR_timeline_semaphore                         [sizeof("VK_KHR_timeline_semaphore")];
+    char KHR_fragment_shading_rate                      [sizeof("VK_KHR_fragment_shading_rate")];
+    char KHR_dynamic_rendering_local_read               [sizeof("VK_KHR_dynamic_rendering_local_read")];
+    char KHR_present_wait                               [sizeof("VK_KHR_present_wait")];
+    char KHR_buffer_device_address                      [sizeof("VK_KHR_buffer_device_address")];
+    char KHR_deferred_host_operations                   [sizeof("VK_KHR_deferred_host_operations")];
+    char KHR_pipeline_executable_properties             [sizeof("VK_KHR_pipeline_executable_properties")];
+    char KHR_map_memory2                                [sizeof("VK_KHR_map_memory2")];
+    char KHR_video_encode_queue                         [sizeof("VK_KHR_video_encode_queue")];
+    char KHR_synchronization2                           [sizeof("VK_KHR_synchronization2")];
+    char AMD_buffer_marker                              [sizeof("VK_AMD_buffer_marker")];
+    char NV_device_diagnostic_checkpoints               [sizeof("VK_NV_device_diagnostic_checkpoints")];
+    char KHR_copy_commands2                             [sizeof("VK_KHR_copy_commands2")];
+    char KHR_ray_tracing_maintenance1                   [sizeof("VK_KHR_ray_tracing_maintenance1")];
+    char KHR_maintenance4                               [sizeof("VK_KHR_maintenance4")];
+    char KHR_maintenance5                               [sizeof("VK_KHR_maintenance5")];
+    char KHR_line_rasterization                         [sizeof("VK_KHR_line_rasterization")];
+    char KHR_calibrated_timestamps                      [sizeof("VK_KHR_calibrated_timestamps")];
+    char KHR_maintenance6                               [sizeof("VK_KHR_maintenance6")];
+    char EXT_debug_marker                               [sizeof("VK_EXT_debug_marker")];
+    char EXT_transform_feedback                         [sizeof("VK_EXT_transform_feedback")];
+    char NVX_binary_import                              [sizeof("VK_NVX_binary_import")];
+    char NVX_image_view_handle                          [sizeof("VK_NVX_image_view_handle")];
+    char AMD_draw_indirect_count                        [sizeof("VK_AMD_draw_indirect_count")];
+    char AMD_shader_info                                [sizeof("VK_AMD_shader_info")];
+    char EXT_conditional_rendering                      [sizeof("VK_EXT_conditional_rendering")];
+    char NV_clip_space_w_scaling                        [sizeof("VK_NV_clip_space_w_scaling")];
+    char EXT_display_control                            [sizeof("VK_EXT_display_control")];
+    char GOOGLE_display_timing                          [sizeof("VK_GOOGLE_display_timing")];
+    char EXT_discard_rectangles                         [sizeof("VK_EXT_discard_rectangles")];
+    char EXT_hdr_metadata                               [sizeof("VK_EXT_hdr_metadata")];
+    char EXT_debug_utils                                [sizeof("VK_EXT_debug_utils")];
+    char EXT_sample_locations                           [sizeof("VK_EXT_sample_locations")];
+    char EXT_image_drm_format_modifier                  [sizeof("VK_EXT_image_drm_format_modifier")];
+    char EXT_validation_cache                           [sizeof("VK_EXT_validation_cache")];
+    char NV_shading_rate_image                          [sizeof("VK_NV_shading_rate_image")];
+    char NV_ray_tracing                                 [sizeof("VK_NV_ray_tracing")];
+    char EXT_external_memory_host                       [sizeof("VK_EXT_external_memory_host")];
+    char EXT_calibrated_timestamps                      [sizeof("VK_EXT_calibrated_timestamps")];
+    char NV_mesh_shader                                 [sizeof("VK_NV_mesh_shader")];
+    char NV_scissor_exclusive                           [sizeof("VK_NV_scissor_exclusive")];
+    char INTEL_performance_query                        [sizeof("VK_INTEL_performance_query")];
+    char AMD_display_native_hdr                         [sizeof("VK_AMD_display_native_hdr")];
+    char EXT_buffer_device_address                      [sizeof("VK_EXT_buffer_device_address")];
+    char EXT_line_rasterization                         [sizeof("VK_EXT_line_rasterization")];
+    char EXT_host_query_reset                           [sizeof("VK_EXT_host_query_reset")];
+    char EXT_extended_dynamic_state                     [sizeof("VK_EXT_extended_dynamic_state")];
+    char EXT_shader_object                              [sizeof("VK_EXT_shader_object")];
+    char EXT_host_image_copy                            [sizeof("VK_EXT_host_image_copy")];
+    char EXT_image_compression_control                  [sizeof("VK_EXT_image_compression_control")];
+    char EXT_swapchain_maintenance1                     [sizeof("VK_EXT_swapchain_maintenance1")];
+    char NV_device_generated_commands                   [sizeof("VK_NV_device_generated_commands")];
+    char EXT_depth_bias_control                         [sizeof("VK_EXT_depth_bias_control")];
+    char EXT_private_data                               [sizeof("VK_EXT_private_data")];
+    char NV_cuda_kernel_launch                          [sizeof("VK_NV_cuda_kernel_launch")];
+    char EXT_descriptor_buffer                          [sizeof("VK_EXT_descriptor_buffer")];
+    char NV_fragment_shading_rate_enums                 [sizeof("VK_NV_fragment_shading_rate_enums")];
+    char EXT_device_fault                               [sizeof("VK_EXT_device_fault")];
+    char EXT_vertex_input_dynamic_state                 [sizeof("VK_EXT_vertex_input_dynamic_state")];
+    char HUAWEI_subpass_shading                         [sizeof("VK_HUAWEI_subpass_shading")];
+    char HUAWEI_invocation_mask                         [sizeof("VK_HUAWEI_invocation_mask")];
+    char NV_external_memory_rdma                        [sizeof("VK_NV_external_memory_rdma")];
+    char EXT_pipeline_properties                        [sizeof("VK_EXT_pipeline_properties")];
+    char EXT_extended_dynamic_state2                    [sizeof("VK_EXT_extended_dynamic_state2")];
+    char EXT_color_write_enable                         [sizeof("VK_EXT_color_write_enable")];
+    char EXT_multi_draw                                 [sizeof("VK_EXT_multi_draw")];
+    char EXT_opacity_micromap                           [sizeof("VK_EXT_opacity_micromap")];
+    char HUAWEI_cluster_culling_shader                  [sizeof("VK_HUAWEI_cluster_culling_shader")];
+    char EXT_pageable_device_local_memory               [sizeof("VK_EXT_pageable_device_local_memory")];
+    char VALVE_descriptor_set_host_mapping              [sizeof("VK_VALVE_descriptor_set_host_mapping")];
+    char NV_copy_memory_indirect                        [sizeof("VK_NV_copy_memory_indirect")];
+    char NV_memory_decompression                        [sizeof("VK_NV_memory_decompression")];
+    char NV_device_generated_commands_compute           [sizeof("VK_NV_device_generated_commands_compute")];
+    char EXT_extended_dynamic_state3                    [sizeof("VK_EXT_extended_dynamic_state3")];
+    char EXT_shader_module_identifier                   [sizeof("VK_EXT_shader_module_identifier")];
+    char NV_optical_flow                                [sizeof("VK_NV_optical_flow")];
+    char QCOM_tile_properties                           [sizeof("VK_QCOM_tile_properties")];
+    char NV_low_latency2                                [sizeof("VK_NV_low_latency2")];
+    char EXT_attachment_feedback_loop_dynamic_state     [sizeof("VK_EXT_attachment_feedback_loop_dynamic_state")];
+    char KHR_acceleration_structure                     [sizeof("VK_KHR_acceleration_structure")];
+    char KHR_ray_tracing_pipeline                       [sizeof("VK_KHR_ray_tracing_pipeline")];
+    char EXT_mesh_shader                                [sizeof("VK_EXT_mesh_shader")];
+    char ANDROID_external_memory_android_hardware_buffer[sizeof("VK_ANDROID_external_memory_android_hardware_buffer")];
+    char FUCHSIA_external_memory                        [sizeof("VK_FUCHSIA_external_memory")];
+    char FUCHSIA_external_semaphore                     [sizeof("VK_FUCHSIA_external_semaphore")];
+    char FUCHSIA_buffer_collection                      [sizeof("VK_FUCHSIA_buffer_collection")];
+    char EXT_metal_objects                              [sizeof("VK_EXT_metal_objects")];
+    char KHR_external_memory_win32                      [sizeof("VK_KHR_external_memory_win32")];
+    char KHR_external_semaphore_win32                   [sizeof("VK_KHR_external_semaphore_win32")];
+    char KHR_external_fence_win32                       [sizeof("VK_KHR_external_fence_win32")];
+    char NV_external_memory_win32                       [sizeof("VK_NV_external_memory_win32")];
+    char EXT_full_screen_exclusive                      [sizeof("VK_EXT_full_screen_exclusive")];
+    char QNX_external_memory_screen_buffer              [sizeof("VK_QNX_external_memory_screen_buffer")];
+    char AMDX_shader_enqueue                            [sizeof("VK_AMDX_shader_enqueue")];
+    char EXT_depth_clamp_control                        [sizeof("VK_EXT_depth_clamp_control")];
+    char KHR_pipeline_binary                            [sizeof("VK_KHR_pipeline_binary")];
+    char AMD_anti_lag                                   [sizeof("VK_AMD_anti_lag")];
+    char NV_cooperative_vector                          [sizeof("VK_NV_cooperative_vector")];
+    char NV_cluster_acceleration_structure              [sizeof("VK_NV_cluster_acceleration_structure")];
+    char NV_partitioned_acceleration_structure          [sizeof("VK_NV_partitioned_acceleration_structure")];
+    char EXT_device_generated_commands                  [sizeof("VK_EXT_device_generated_commands")];
+    char EXT_external_memory_metal                      [sizeof("VK_EXT_external_memory_metal")];
+    char KHR_surface                                    [sizeof("VK_KHR_surface")];
+    char KHR_display                                    [sizeof("VK_KHR_display")];
+    char KHR_get_physical_device_properties2            [sizeof("VK_KHR_get_physical_device_properties2")];
+    char KHR_device_group_creation                      [sizeof("VK_KHR_device_group_creation")];
+    char KHR_external_memory_capabilities               [sizeof("VK_KHR_external_memory_capabilities")];
+    char KHR_external_semaphore_capabilities            [sizeof("VK_KHR_external_semaphore_capabilities")];
+    char KHR_external_fence_capabilities                [sizeof("VK_KHR_external_fence_capabilities")];
+    char KHR_get_surface_capabilities2                  [sizeof("VK_KHR_get_surface_capabilities2")];
+    char KHR_get_display_properties2                    [sizeof("VK_KHR_get_display_properties2")];
+    char KHR_cooperative_matrix                         [sizeof("VK_KHR_cooperative_matrix")];
+    char EXT_debug_report                               [sizeof("VK_EXT_debug_report")];
+    char NV_external_memory_capabilities                [sizeof("VK_NV_external_memory_capabilities")];
+    char EXT_direct_mode_display                        [sizeof("VK_EXT_direct_mode_display")];
+    char EXT_display_surface_counter                    [sizeof("VK_EXT_display_surface_counter")];
+    char EXT_tooling_info                               [sizeof("VK_EXT_tooling_info")];
+    char NV_cooperative_matrix                          [sizeof("VK_NV_cooperative_matrix")];
+    char NV_coverage_reduction_mode                     [sizeof("VK_NV_coverage_reduction_mode")];
+    char EXT_headless_surface                           [sizeof("VK_EXT_headless_surface")];
+    char EXT_acquire_drm_display                        [sizeof("VK_EXT_acquire_drm_display")];
+    char KHR_android_surface                            [sizeof("VK_KHR_android_surface")];
+    char FUCHSIA_imagepipe_surface                      [sizeof("VK_FUCHSIA_imagepipe_surface")];
+    char MVK_ios_surface                                [sizeof("VK_MVK_ios_surface")];
+    char MVK_macos_surface                              [sizeof("VK_MVK_macos_surface")];
+    char EXT_metal_surface                              [sizeof("VK_EXT_metal_surface")];
+    char NN_vi_surface                                  [sizeof("VK_NN_vi_surface")];
+    char KHR_wayland_surface                            [sizeof("VK_KHR_wayland_surface")];
+    char KHR_win32_surface                              [sizeof("VK_KHR_win32_surface")];
+    char NV_acquire_winrt_display                       [sizeof("VK_NV_acquire_winrt_display")];
+    char KHR_xcb_surface                                [sizeof("VK_KHR_xcb_surface")];
+    char KHR_xlib_surface                               [sizeof("VK_KHR_xlib_surface")];
+    char EXT_directfb_surface                           [sizeof("VK_EXT_directfb_surface")];
+    char EXT_acquire_xlib_display                       [sizeof("VK_EXT_acquire_xlib_display")];
+    char GGP_stream_descriptor_surface                  [sizeof("VK_GGP_stream_descriptor_surface")];
+    char QNX_screen_surface                             [sizeof("VK_QNX_screen_surface")];
+    char NV_cooperative_matrix2                         [sizeof("VK_NV_cooperative_matrix2")];
+} VkadExtensionNames;
+typedef struct VkadFunctionEntry {
+    uint16_t memberOffset;
+    uint16_t nameOffset;
+} VkadFunctionEntry;
+/* a group is a core version or an extension, and covers a range of consecutive entries of the table */
+typedef struct VkadFunctionGroup {
+    uint16_t firstEntry;
+    uint16_t entryCount;
+    uint16_t extension;   /* offset of the extension name in vkadExtensionNames, or VKAD_NO_EXTENSION for core versions */
+    uint16_t alternative; /* another extension which exposes the same functions */
+    uint16_t dependency;  /* extension that is needed additionally, unless the version is at least apiVersion */
+    uint16_t flags;
+    uint32_t apiVersion;  /* core version of the group, or the version that makes the dependency unnecessary */
+} VkadFunctionGroup;
+#define VKAD_NO_EXTENSION 0xFFFF
+/* the extension is enabled on the instance, so it cannot be found in the VkDeviceCreateInfo */
+#define VKAD_GROUP_INSTANCE_EXTENSION_BIT 0x0001
+/* the extension is a device extension with physical device commands, so it cannot be found in the VkInstanceCreateInfo */
+#define VKAD_GROUP_DEVICE_EXTENSION_BIT   0x0002
+/* "vk" + the longest function name + terminator */
+#define VKAD_MAX_FUNCTION_NAME_SIZE 67
+#define VKAD_FUNCTION_ENTRY(FUNCTIONS, NAME) { (uint16_t) offsetof(FUNCTIONS, NAME), (uint16_t) offsetof(VkadFunctionNames, NAME) }
+#define VKAD_EXTENSION(NAME) ((uint16_t) offsetof(VkadExtensionNames, NAME))
+/* the entries of functions left out by a VKAD_NO_*_EXTENSIONS macro keep their place and name, so the IDs stay the same, but have no member */
+#define VKAD_NO_MEMBER 0xFFFF
+#define VKAD_NO_MEMBER_ENTRY(FUNCTIONS, NAME) { VKAD_NO_MEMBER, (uint16_t) offsetof(VkadFunctionNames, NAME) }
+#ifdef VKAD_NO_WSI_EXTENSIONS
+#define VKAD_WSI_ENTRY VKAD_NO_MEMBER_ENTRY
+#else
+#define VKAD_WSI_ENTRY VKAD_FUNCTION_ENTRY
+#endif
+#ifdef VKAD_NO_VIDEO_EXTENSIONS
+#define VKAD_VIDEO_ENTRY VKAD_NO_MEMBER_ENTRY
+#else
+#define VKAD_VIDEO_ENTRY VKAD_FUNCTION_ENTRY
+#endif
+#ifdef VKAD_NO_RAY_TRACING_EXTENSIONS
+#define VKAD_RAY_TRACING_ENTRY VKAD_NO_MEMBER_ENTRY
+#else
+#define VKAD_RAY_TRACING_ENTRY VKAD_FUNCTION_ENTRY
+#endif
+#ifdef VKAD_NO_VENDOR_EXTENSIONS
+#define VKAD_VENDOR_ENTRY VKAD_NO_MEMBER_ENTRY
+#else
+#define VKAD_VENDOR_ENTRY VKAD_FUNCTION_ENTRY
+#endif
+#ifdef VKAD_NO_GRAPHICS_EXTENSIONS
+#define VKAD_GRAPHICS_ENTRY VKAD_NO_MEMBER_ENTRY
+#else
+#define VKAD_GRAPHICS_ENTRY VKAD_FUNCTION_ENTRY
+#endif
+
+static const VkadFunctionNames vkadFunctionNames = {
+    /* global functions */
+    "EnumerateInstanceExtensionProperties",
+    "EnumerateInstanceLayerProperties",
+    "CreateInstance",
+    "EnumerateInstanceVersion",
+    /* instance functions */
+    "DestroyInstance",
+    "EnumeratePhysicalDevices",
+    "GetPhysicalDeviceFeatures",
+    "GetPhysicalDeviceFormatProperties",
+    "GetPhysicalDeviceImageFormatProperties",
+    "GetPhysicalDeviceProperties",
+    "GetPhysicalDeviceQueueFamilyProperties",
+    "GetPhysicalDeviceMemoryProperties",
+    "EnumerateDeviceExtensionProperties",
+    "EnumerateDeviceLayerProperties",
+    "GetPhysicalDeviceSparseImageFormatProperties",
+    "CreateDevice",
+    "GetDeviceProcAddr",
+    "EnumeratePhysicalDeviceGroups",
+    "GetPhysicalDeviceFeatures2",
+    "GetPhysicalDeviceProperties2",
+    "GetPhysicalDeviceFormatProperties2",
+    "GetPhysicalDeviceImageFormatProperties2",
+    "GetPhysicalDeviceQueueFamilyProperties2",
+    "GetPhysicalDeviceMemoryProperties2",
+    "GetPhysicalDeviceSparseImageFormatProperties2",
+    "GetPhysicalDeviceExternalBufferProperties",
+    "GetPhysicalDeviceExternalFenceProperties",
+    "GetPhysicalDeviceExternalSemaphoreProperties",
+    "GetPhysicalDeviceToolProperties",
+    "DestroySurfaceKHR",
+    "GetPhysicalDeviceSurfaceSupportKHR",
+    "GetPhysicalDeviceSurfaceCapabilitiesKHR",
+    "GetPhysicalDeviceSurfaceFormatsKHR",
+    "GetPhysicalDeviceSurfacePresentModesKHR",
+    "GetPhysicalDevicePresentRectanglesKHR",
+    "GetPhysicalDeviceDisplayPropertiesKHR",
+    "GetPhysicalDeviceDisplayPlanePropertiesKHR",
+    "GetDisplayPlaneSupportedDisplaysKHR",
+    "GetDisplayModePropertiesKHR",
+    "CreateDisplayModeKHR",
+    "GetDisplayPlaneCapabilitiesKHR",
+    "CreateDisplayPlaneSurfaceKHR",
+    "GetPhysicalDeviceVideoCapabilitiesKHR",
+    "GetPhysicalDeviceVideoFormatPropertiesKHR",
+    "GetPhysicalDeviceFeatures2KHR",
+    "GetPhysicalDeviceProperties2KHR",
+    "GetPhysicalDeviceFormatProperties2KHR",
+    "GetPhysicalDeviceImageFormatProperties2KHR",
+    "GetPhysicalDeviceQueueFamilyProperties2KHR",
+    "GetPhysicalDeviceMemoryProperties2KHR",
+    "GetPhysicalDeviceSparseImageFormatProperties2KHR",
+    "EnumeratePhysicalDeviceGroupsKHR",
+    "GetPhysicalDeviceExternalBufferPropertiesKHR",
+    "GetPhysicalDeviceExternalSemaphorePropertiesKHR",
+    "GetPhysicalDeviceExternalFencePropertiesKHR",
+    "EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",
+    "GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR",
+    "GetPhysicalDeviceSurfaceCapabilities2KHR",
+    "GetPhysicalDeviceSurfaceFormats2KHR",
+    "GetPhysicalDeviceDisplayProperties2KHR",
+    "GetPhysicalDeviceDisplayPlaneProperties2KHR",
+    "GetDisplayModeProperties2KHR",
+    "GetDisplayPlaneCapabilities2KHR",
+    "GetPhysicalDeviceFragmentShadingRatesKHR",
+    "GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR",
+    "GetPhysicalDeviceCooperativeMatrixPropertiesKHR",
+    "GetPhysicalDeviceCalibrateableTimeDomainsKHR",
+    "CreateDebugReportCallbackEXT",
+    "DestroyDebugReportCallbackEXT",
+    "DebugReportMessageEXT",
+    "GetPhysicalDeviceExternalImageFormatPropertiesNV",
+    "ReleaseDisplayEXT",
+    "GetPhysicalDeviceSurfaceCapabilities2EXT",
+    "CreateDebugUtilsMessengerEXT",
+    "DestroyDebugUtilsMessengerEXT",
+    "SubmitDebugUtilsMessageEXT",
+    "GetPhysicalDeviceMultisamplePropertiesEXT",
+    "GetPhysicalDeviceCalibrateableTimeDomainsEXT",
+    "GetPhysicalDeviceToolPropertiesEXT",
+    "GetPhysicalDeviceCooperativeMatrixPropertiesNV",
+    "GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV",
+    "CreateHeadlessSurfaceEXT",
+    "AcquireDrmDisplayEXT",
+    "GetDrmDisplayEXT",
+    "GetPhysicalDeviceOpticalFlowImageFormatsNV",
+    "CreateAndroidSurfaceKHR",
+    "CreateImagePipeSurfaceFUCHSIA",
+    "CreateIOSSurfaceMVK",
+    "CreateMacOSSurfaceMVK",
+    "CreateMetalSurfaceEXT",
+    "CreateViSurfaceNN",
+    "CreateWaylandSurfaceKHR",
+    "GetPhysicalDeviceWaylandPresentationSupportKHR",
+    "CreateWin32SurfaceKHR",
+    "GetPhysicalDeviceWin32PresentationSupportKHR",
+    "GetPhysicalDeviceSurfacePresentModes2EXT",
+    "AcquireWinrtDisplayNV",
+    "GetWinrtDisplayNV",
+    "CreateXcbSurfaceKHR",
+    "GetPhysicalDeviceXcbPresentationSupportKHR",
+    "CreateXlibSurfaceKHR",
+    "GetPhysicalDeviceXlibPresentationSupportKHR",
+    "CreateDirectFBSurfaceEXT",
+    "GetPhysicalDeviceDirectFBPresentationSupportEXT",
+    "AcquireXlibDisplayEXT",
+    "GetRandROutputDisplayEXT",
+    "CreateStreamDescriptorSurfaceGGP",
+    "CreateScreenSurfaceQNX",
+    "GetPhysicalDeviceScreenPresentationSupportQNX",
+    "GetPhysicalDeviceCooperativeVectorPropertiesNV",
+    "GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV",
+    /* device functions */
+    "DestroyDevice",
+    "GetDeviceQueue",
+    "QueueSubmit",
+    "QueueWaitIdle",
+    "DeviceWaitIdle",
+    "AllocateMemory",
+    "FreeMemory",
+    "MapMemory",
+    "UnmapMemory",
+    "FlushMappedMemoryRanges",
+    "InvalidateMappedMemoryRanges",
+    "GetDeviceMemoryCommitment",
+    "BindBufferMemory",
+    "BindImageMemory",
+    "GetBufferMemoryRequirements",
+    "GetImageMemoryRequirements",
+    "GetImageSparseMemoryRequirements",
+    "QueueBindSparse",
+    "CreateFence",
+    "DestroyFence",
+    "ResetFences",
+    "GetFenceStatus",
+    "WaitForFences",
+    "CreateSemaphore",
+    "DestroySemaphore",
+    "CreateEvent",
+    "DestroyEvent",
+    "GetEventStatus",
+    "SetEvent",
+    "ResetEvent",
+    "CreateQueryPool",
+    "DestroyQueryPool",
+    "GetQueryPoolResults",
+    "CreateBuffer",
+    "DestroyBuffer",
+    "CreateBufferView",
+    "DestroyBufferView",
+    "CreateImage",
+    "DestroyImage",
+    "GetImageSubresourceLayout",
+    "CreateImageView",
+    "DestroyImageView",
+    "CreateShaderModule",
+    "DestroyShaderModule",
+    "CreatePipelineCache",
+    "DestroyPipelineCache",
+    "GetPipelineCacheData",
+    "MergePipelineCaches",
+    "CreateGraphicsPipelines",
+    "CreateComputePipelines",
+    "DestroyPipeline",
+    "CreatePipelineLayout",
+    "DestroyPipelineLayout",
+    "CreateSampler",
+    "DestroySampler",
+    "CreateDescriptorSetLayout",
+    "DestroyDescriptorSetLayout",
+    "CreateDescriptorPool",
+    "DestroyDescriptorPool",
+    "ResetDescriptorPool",
+    "AllocateDescriptorSets",
+    "FreeDescriptorSets",
+    "UpdateDescriptorSets",
+    "CreateFramebuffer",
+    "DestroyFramebuffer",
+    "CreateRenderPass",
+    "DestroyRenderPass",
+    "GetRenderAreaGranularity",
+    "CreateCommandPool",
+    "DestroyCommandPool",
+    "ResetCommandPool",
+    "AllocateCommandBuffers",
+    "FreeCommandBuffers",
+    "BeginCommandBuffer",
+    "EndCommandBuffer",
+    "ResetCommandBuffer",
+    "CmdBindPipeline",
+    "CmdSetViewport",
+    "CmdSetScissor",
+    "CmdSetLineWidth",
+    "CmdSetDepthBias",
+    "CmdSetBlendConstants",
+    "CmdSetDepthBounds",
+    "CmdSetStencilCompareMask",
+    "CmdSetStencilWriteMask",
+    "CmdSetStencilReference",
+    "CmdBindDescriptorSets",
+    "CmdBindIndexBuffer",
+    "CmdBindVertexBuffers",
+    "CmdDraw",
+    "CmdDrawIndexed",
+    "CmdDrawIndirect",
+    "CmdDrawIndexedIndirect",
+    "CmdDispatch",
+    "CmdDispatchIndirect",
+    "CmdCopyBuffer",
+    "CmdCopyImage",
+    "CmdBlitImage",
+    "CmdCopyBufferToImage",
+    "CmdCopyImageToBuffer",
+    "CmdUpdateBuffer",
+    "CmdFillBuffer",
+    "CmdClearColorImage",
+    "CmdClearDepthStencilImage",
+    "CmdClearAttachments",
+    "CmdResolveImage",
+    "CmdSetEvent",
+    "CmdResetEvent",
+    "CmdWaitEvents",
+    "CmdPipelineBarrier",
+    "CmdBeginQuery",
+    "CmdEndQuery",
+    "CmdResetQueryPool",
+    "CmdWriteTimestamp",
+    "CmdCopyQueryPoolResults",
+    "CmdPushConstants",
+    "CmdBeginRenderPass",
+    "CmdNextSubpass",
+    "CmdEndRenderPass",
+    "CmdExecuteCommands",
+    "BindBufferMemory2",
+    "BindImageMemory2",
+    "GetDeviceGroupPeerMemoryFeatures",
+    "CmdSetDeviceMask",
+    "CmdDispatchBase",
+    "GetImageMemoryRequirements2",
+    "GetBufferMemoryRequirements2",
+    "GetImageSparseMemoryRequirements2",
+    "TrimCommandPool",
+    "GetDeviceQueue2",
+    "CreateSamplerYcbcrConversion",
+    "DestroySamplerYcbcrConversion",
+    "CreateDescriptorUpdateTemplate",
+    "DestroyDescriptorUpdateTemplate",
+    "UpdateDescriptorSetWithTemplate",
+    "GetDescriptorSetLayoutSupport",
+    "CmdDrawIndirectCount",
+    "CmdDrawIndexedIndirectCount",
+    "CreateRenderPass2",
+    "CmdBeginRenderPass2",
+    "CmdNextSubpass2",
+    "CmdEndRenderPass2",
+    "ResetQueryPool",
+    "GetSemaphoreCounterValue",
+    "WaitSemaphores",
+    "SignalSemaphore",
+    "GetBufferDeviceAddress",
+    "GetBufferOpaqueCaptureAddress",
+    "GetDeviceMemoryOpaqueCaptureAddress",
+    "CreatePrivateDataSlot",
+    "DestroyPrivateDataSlot",
+    "SetPrivateData",
+    "GetPrivateData",
+    "CmdSetEvent2",
+    "CmdResetEvent2",
+    "CmdWaitEvents2",
+    "CmdPipelineBarrier2",
+    "CmdWriteTimestamp2",
+    "QueueSubmit2",
+    "CmdCopyBuffer2",
+    "CmdCopyImage2",
+    "CmdCopyBufferToImage2",
+    "CmdCopyImageToBuffer2",
+    "CmdBlitImage2",
+    "CmdResolveImage2",
+    "CmdBeginRendering",
+    "CmdEndRendering",
+    "CmdSetCullMode",
+    "CmdSetFrontFace",
+    "CmdSetPrimitiveTopology",
+    "CmdSetViewportWithCount",
+    "CmdSetScissorWithCount",
+    "CmdBindVertexBuffers2",
+    "CmdSetDepthTestEnable",
+    "CmdSetDepthWriteEnable",
+    "CmdSetDepthCompareOp",
+    "CmdSetDepthBoundsTestEnable",
+    "CmdSetStencilTestEnable",
+    "CmdSetStencilOp",
+    "CmdSetRasterizerDiscardEnable",
+    "CmdSetDepthBiasEnable",
+    "CmdSetPrimitiveRestartEnable",
+    "GetDeviceBufferMemoryRequirements",
+    "GetDeviceImageMemoryRequirements",
+    "GetDeviceImageSparseMemoryRequirements",
+    "CreateSwapchainKHR",
+    "DestroySwapchainKHR",
+    "GetSwapchainImagesKHR",
+    "AcquireNextImageKHR",
+    "QueuePresentKHR",
+    "GetDeviceGroupPresentCapabilitiesKHR",
+    "GetDeviceGroupSurfacePresentModesKHR",
+    "AcquireNextImage2KHR",
+    "CreateSharedSwapchainsKHR",
+    "CreateVideoSessionKHR",
+    "DestroyVideoSessionKHR",
+    "GetVideoSessionMemoryRequirementsKHR",
+    "BindVideoSessionMemoryKHR",
+    "CreateVideoSessionParametersKHR",
+    "UpdateVideoSessionParametersKHR",
+    "DestroyVideoSessionParametersKHR",
+    "CmdBeginVideoCodingKHR",
+    "CmdEndVideoCodingKHR",
+    "CmdControlVideoCodingKHR",
+    "CmdDecodeVideoKHR",
+    "CmdBeginRenderingKHR",
+    "CmdEndRenderingKHR",
+    "GetDeviceGroupPeerMemoryFeaturesKHR",
+    "CmdSetDeviceMaskKHR",
+    "CmdDispatchBaseKHR",
+    "TrimCommandPoolKHR",
+    "GetMemoryFdKHR",
+    "GetMemoryFdPropertiesKHR",
+    "ImportSemaphoreFdKHR",
+    "GetSemaphoreFdKHR",
+    "CmdPushDescriptorSetKHR",
+    "CmdPushDescriptorSetWithTemplateKHR",
+    "CreateDescriptorUpdateTemplateKHR",
+    "DestroyDescriptorUpdateTemplateKHR",
+    "UpdateDescriptorSetWithTemplateKHR",
+    "CreateRenderPass2KHR",
+    "CmdBeginRenderPass2KHR",
+    "CmdNextSubpass2KHR",
+    "CmdEndRenderPass2KHR",
+    "GetSwapchainStatusKHR",
+    "ImportFenceFdKHR",
+    "GetFenceFdKHR",
+    "AcquireProfilingLockKHR",
+    "ReleaseProfilingLockKHR",
+    "GetImageMemoryRequirements2KHR",
+    "GetBufferMemoryRequirements2KHR",
+    "GetImageSparseMemoryRequirements2KHR",
+    "CreateSamplerYcbcrConversionKHR",
+    "DestroySamplerYcbcrConversionKHR",
+    "BindBufferMemory2KHR",
+    "BindImageMemory2KHR",
+    "GetDescriptorSetLayoutSupportKHR",
+    "CmdDrawIndirectCountKHR",
+    "CmdDrawIndexedIndirectCountKHR",
+    "GetSemaphoreCounterValueKHR",
+    "WaitSemaphoresKHR",
+    "SignalSemaphoreKHR",
+    "CmdSetFragmentShadingRateKHR",
+    "CmdSetRenderingAttachmentLocationsKHR",
+    "CmdSetRenderingInputAttachmentIndicesKHR",
+    "WaitForPresentKHR",
+    "GetBufferDeviceAddressKHR",
+    "GetBufferOpaqueCaptureAddressKHR",
+    "GetDeviceMemoryOpaqueCaptureAddressKHR",
+    "CreateDeferredOperationKHR",
+    "DestroyDeferredOperationKHR",
+    "GetDeferredOperationMaxConcurrencyKHR",
+    "GetDeferredOperationResultKHR",
+    "DeferredOperationJoinKHR",
+    "GetPipelineExecutablePropertiesKHR",
+    "GetPipelineExecutableStatisticsKHR",
+    "GetPipelineExecutableInternalRepresentationsKHR",
+    "MapMemory2KHR",
+    "UnmapMemory2KHR",
+    "GetEncodedVideoSessionParametersKHR",
+    "CmdEncodeVideoKHR",
+    "CmdSetEvent2KHR",
+    "CmdResetEvent2KHR",
+    "CmdWaitEvents2KHR",
+    "CmdPipelineBarrier2KHR",
+    "CmdWriteTimestamp2KHR",
+    "QueueSubmit2KHR",
+    "CmdWriteBufferMarker2AMD",
+    "GetQueueCheckpointData2NV",
+    "CmdCopyBuffer2KHR",
+    "CmdCopyImage2KHR",
+    "CmdCopyBufferToImage2KHR",
+    "CmdCopyImageToBuffer2KHR",
+    "CmdBlitImage2KHR",
+    "CmdResolveImage2KHR",
+    "CmdTraceRaysIndirect2KHR",
+    "GetDeviceBufferMemoryRequirementsKHR",
+    "GetDeviceImageMemoryRequirementsKHR",
+    "GetDeviceImageSparseMemoryRequirementsKHR",
+    "CmdBindIndexBuffer2KHR",
+    "GetRenderingAreaGranularityKHR",
+    "GetDeviceImageSubresourceLayoutKHR",
+    "GetImageSubresourceLayout2KHR",
+    "CmdSetLineStippleKHR",
+    "GetCalibratedTimestampsKHR",
+    "CmdBindDescriptorSets2KHR",
+    "CmdPushConstants2KHR",
+    "CmdPushDescriptorSet2KHR",
+    "CmdPushDescriptorSetWithTemplate2KHR",
+    "CmdSetDescriptorBufferOffsets2EXT",
+    "CmdBindDescriptorBufferEmbeddedSamplers2EXT",
+    "DebugMarkerSetObjectTagEXT",
+    "DebugMarkerSetObjectNameEXT",
+    "CmdDebugMarkerBeginEXT",
+    "CmdDebugMarkerEndEXT",
+    "CmdDebugMarkerInsertEXT",
+    "CmdBindTransformFeedbackBuffersEXT",
+    "CmdBeginTransformFeedbackEXT",
+    "CmdEndTransformFeedbackEXT",
+    "CmdBeginQueryIndexedEXT",
+    "CmdEndQueryIndexedEXT",
+    "CmdDrawIndirectByteCountEXT",
+    "CreateCuModuleNVX",
+    "CreateCuFunctionNVX",
+    "DestroyCuModuleNVX",
+    "DestroyCuFunctionNVX",
+    "CmdCuLaunchKernelNVX",
+    "GetImageViewHandleNVX",
+    "GetImageViewAddressNVX",
+    "CmdDrawIndirectCountAMD",
+    "CmdDrawIndexedIndirectCountAMD",
+    "GetShaderInfoAMD",
+    "CmdBeginConditionalRenderingEXT",
+    "CmdEndConditionalRenderingEXT",
+    "CmdSetViewportWScalingNV",
+    "DisplayPowerControlEXT",
+    "RegisterDeviceEventEXT",
+    "RegisterDisplayEventEXT",
+    "GetSwapchainCounterEXT",
+    "GetRefreshCycleDurationGOOGLE",
+    "GetPastPresentationTimingGOOGLE",
+    "CmdSetDiscardRectangleEXT",
+    "CmdSetDiscardRectangleEnableEXT",
+    "CmdSetDiscardRectangleModeEXT",
+    "SetHdrMetadataEXT",
+    "SetDebugUtilsObjectNameEXT",
+    "SetDebugUtilsObjectTagEXT",
+    "QueueBeginDebugUtilsLabelEXT",
+    "QueueEndDebugUtilsLabelEXT",
+    "QueueInsertDebugUtilsLabelEXT",
+    "CmdBeginDebugUtilsLabelEXT",
+    "CmdEndDebugUtilsLabelEXT",
+    "CmdInsertDebugUtilsLabelEXT",
+    "CmdSetSampleLocationsEXT",
+    "GetImageDrmFormatModifierPropertiesEXT",
+    "CreateValidationCacheEXT",
+    "DestroyValidationCacheEXT",
+    "MergeValidationCachesEXT",
+    "GetValidationCacheDataEXT",
+    "CmdBindShadingRateImageNV",
+    "CmdSetViewportShadingRatePaletteNV",
+    "CmdSetCoarseSampleOrderNV",
+    "CreateAccelerationStructureNV",
+    "DestroyAccelerationStructureNV",
+    "GetAccelerationStructureMemoryRequirementsNV",
+    "BindAccelerationStructureMemoryNV",
+    "CmdBuildAccelerationStructureNV",
+    "CmdCopyAccelerationStructureNV",
+    "CmdTraceRaysNV",
+    "CreateRayTracingPipelinesNV",
+    "GetRayTracingShaderGroupHandlesKHR",
+    "GetRayTracingShaderGroupHandlesNV",
+    "GetAccelerationStructureHandleNV",
+    "CmdWriteAccelerationStructuresPropertiesNV",
+    "CompileDeferredNV",
+    "GetMemoryHostPointerPropertiesEXT",
+    "CmdWriteBufferMarkerAMD",
+    "GetCalibratedTimestampsEXT",
+    "CmdDrawMeshTasksNV",
+    "CmdDrawMeshTasksIndirectNV",
+    "CmdDrawMeshTasksIndirectCountNV",
+    "CmdSetExclusiveScissorEnableNV",
+    "CmdSetExclusiveScissorNV",
+    "CmdSetCheckpointNV",
+    "GetQueueCheckpointDataNV",
+    "InitializePerformanceApiINTEL",
+    "UninitializePerformanceApiINTEL",
+    "CmdSetPerformanceMarkerINTEL",
+    "CmdSetPerformanceStreamMarkerINTEL",
+    "CmdSetPerformanceOverrideINTEL",
+    "AcquirePerformanceConfigurationINTEL",
+    "ReleasePerformanceConfigurationINTEL",
+    "QueueSetPerformanceConfigurationINTEL",
+    "GetPerformanceParameterINTEL",
+    "SetLocalDimmingAMD",
+    "GetBufferDeviceAddressEXT",
+    "CmdSetLineStippleEXT",
+    "ResetQueryPoolEXT",
+    "CmdSetCullModeEXT",
+    "CmdSetFrontFaceEXT",
+    "CmdSetPrimitiveTopologyEXT",
+    "CmdSetViewportWithCountEXT",
+    "CmdSetScissorWithCountEXT",
+    "CmdBindVertexBuffers2EXT",
+    "CmdSetDepthTestEnableEXT",
+    "CmdSetDepthWriteEnableEXT",
+    "CmdSetDepthCompareOpEXT",
+    "CmdSetDepthBoundsTestEnableEXT",
+    "CmdSetStencilTestEnableEXT",
+    "CmdSetStencilOpEXT",
+    "CopyMemoryToImageEXT",
+    "CopyImageToMemoryEXT",
+    "CopyImageToImageEXT",
+    "TransitionImageLayoutEXT",
+    "GetImageSubresourceLayout2EXT",
+    "ReleaseSwapchainImagesEXT",
+    "GetGeneratedCommandsMemoryRequirementsNV",
+    "CmdPreprocessGeneratedCommandsNV",
+    "CmdExecuteGeneratedCommandsNV",
+    "CmdBindPipelineShaderGroupNV",
+    "CreateIndirectCommandsLayoutNV",
+    "DestroyIndirectCommandsLayoutNV",
+    "CmdSetDepthBias2EXT",
+    "CreatePrivateDataSlotEXT",
+    "DestroyPrivateDataSlotEXT",
+    "SetPrivateDataEXT",
+    "GetPrivateDataEXT",
+    "CreateCudaModuleNV",
+    "GetCudaModuleCacheNV",
+    "CreateCudaFunctionNV",
+    "DestroyCudaModuleNV",
+    "DestroyCudaFunctionNV",
+    "CmdCudaLaunchKernelNV",
+    "GetDescriptorSetLayoutSizeEXT",
+    "GetDescriptorSetLayoutBindingOffsetEXT",
+    "GetDescriptorEXT",
+    "CmdBindDescriptorBuffersEXT",
+    "CmdSetDescriptorBufferOffsetsEXT",
+    "CmdBindDescriptorBufferEmbeddedSamplersEXT",
+    "GetBufferOpaqueCaptureDescriptorDataEXT",
+    "GetImageOpaqueCaptureDescriptorDataEXT",
+    "GetImageViewOpaqueCaptureDescriptorDataEXT",
+    "GetSamplerOpaqueCaptureDescriptorDataEXT",
+    "GetAccelerationStructureOpaqueCaptureDescriptorDataEXT",
+    "CmdSetFragmentShadingRateEnumNV",
+    "GetDeviceFaultInfoEXT",
+    "CmdSetVertexInputEXT",
+    "GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI",
+    "CmdSubpassShadingHUAWEI",
+    "CmdBindInvocationMaskHUAWEI",
+    "GetMemoryRemoteAddressNV",
+    "GetPipelinePropertiesEXT",
+    "CmdSetPatchControlPointsEXT",
+    "CmdSetRasterizerDiscardEnableEXT",
+    "CmdSetDepthBiasEnableEXT",
+    "CmdSetLogicOpEXT",
+    "CmdSetPrimitiveRestartEnableEXT",
+    "CmdSetColorWriteEnableEXT",
+    "CmdDrawMultiEXT",
+    "CmdDrawMultiIndexedEXT",
+    "CreateMicromapEXT",
+    "DestroyMicromapEXT",
+    "CmdBuildMicromapsEXT",
+    "BuildMicromapsEXT",
+    "CopyMicromapEXT",
+    "CopyMicromapToMemoryEXT",
+    "CopyMemoryToMicromapEXT",
+    "WriteMicromapsPropertiesEXT",
+    "CmdCopyMicromapEXT",
+    "CmdCopyMicromapToMemoryEXT",
+    "CmdCopyMemoryToMicromapEXT",
+    "CmdWriteMicromapsPropertiesEXT",
+    "GetDeviceMicromapCompatibilityEXT",
+    "GetMicromapBuildSizesEXT",
+    "CmdDrawClusterHUAWEI",
+    "CmdDrawClusterIndirectHUAWEI",
+    "SetDeviceMemoryPriorityEXT",
+    "GetDescriptorSetLayoutHostMappingInfoVALVE",
+    "GetDescriptorSetHostMappingVALVE",
+    "CmdCopyMemoryIndirectNV",
+    "CmdCopyMemoryToImageIndirectNV",
+    "CmdDecompressMemoryNV",
+    "CmdDecompressMemoryIndirectCountNV",
+    "GetPipelineIndirectMemoryRequirementsNV",
+    "CmdUpdatePipelineIndirectBufferNV",
+    "GetPipelineIndirectDeviceAddressNV",
+    "CmdSetDepthClampEnableEXT",
+    "CmdSetPolygonModeEXT",
+    "CmdSetRasterizationSamplesEXT",
+    "CmdSetSampleMaskEXT",
+    "CmdSetAlphaToCoverageEnableEXT",
+    "CmdSetAlphaToOneEnableEXT",
+    "CmdSetLogicOpEnableEXT",
+    "CmdSetColorBlendEnableEXT",
+    "CmdSetColorBlendEquationEXT",
+    "CmdSetColorWriteMaskEXT",
+    "CmdSetTessellationDomainOriginEXT",
+    "CmdSetRasterizationStreamEXT",
+    "CmdSetConservativeRasterizationModeEXT",
+    "CmdSetExtraPrimitiveOverestimationSizeEXT",
+    "CmdSetDepthClipEnableEXT",
+    "CmdSetSampleLocationsEnableEXT",
+    "CmdSetColorBlendAdvancedEXT",
+    "CmdSetProvokingVertexModeEXT",
+    "CmdSetLineRasterizationModeEXT",
+    "CmdSetLineStippleEnableEXT",
+    "CmdSetDepthClipNegativeOneToOneEXT",
+    "CmdSetViewportWScalingEnableNV",
+    "CmdSetViewportSwizzleNV",
+    "CmdSetCoverageToColorEnableNV",
+    "CmdSetCoverageToColorLocationNV",
+    "CmdSetCoverageModulationModeNV",
+    "CmdSetCoverageModulationTableEnableNV",
+    "CmdSetCoverageModulationTableNV",
+    "CmdSetShadingRateImageEnableNV",
+    "CmdSetRepresentativeFragmentTestEnableNV",
+    "CmdSetCoverageReductionModeNV",
+    "GetShaderModuleIdentifierEXT",
+    "GetShaderModuleCreateInfoIdentifierEXT",
+    "CreateOpticalFlowSessionNV",
+    "DestroyOpticalFlowSessionNV",
+    "BindOpticalFlowSessionImageNV",
+    "CmdOpticalFlowExecuteNV",
+    "CreateShadersEXT",
+    "DestroyShaderEXT",
+    "GetShaderBinaryDataEXT",
+    "CmdBindShadersEXT",
+    "GetFramebufferTilePropertiesQCOM",
+    "GetDynamicRenderingTilePropertiesQCOM",
+    "SetLatencySleepModeNV",
+    "LatencySleepNV",
+    "SetLatencyMarkerNV",
+    "GetLatencyTimingsNV",
+    "QueueNotifyOutOfBandNV",
+    "CmdSetAttachmentFeedbackLoopEnableEXT",
+    "CreateAccelerationStructureKHR",
+    "DestroyAccelerationStructureKHR",
+    "CmdBuildAccelerationStructuresKHR",
+    "CmdBuildAccelerationStructuresIndirectKHR",
+    "BuildAccelerationStructuresKHR",
+    "CopyAccelerationStructureKHR",
+    "CopyAccelerationStructureToMemoryKHR",
+    "CopyMemoryToAccelerationStructureKHR",
+    "WriteAccelerationStructuresPropertiesKHR",
+    "CmdCopyAccelerationStructureKHR",
+    "CmdCopyAccelerationStructureToMemoryKHR",
+    "CmdCopyMemoryToAccelerationStructureKHR",
+    "GetAccelerationStructureDeviceAddressKHR",
+    "CmdWriteAccelerationStructuresPropertiesKHR",
+    "GetDeviceAccelerationStructureCompatibilityKHR",
+    "GetAccelerationStructureBuildSizesKHR",
+    "CmdTraceRaysKHR",
+    "CreateRayTracingPipelinesKHR",
+    "GetRayTracingCaptureReplayShaderGroupHandlesKHR",
+    "CmdTraceRaysIndirectKHR",
+    "GetRayTracingShaderGroupStackSizeKHR",
+    "CmdSetRayTracingPipelineStackSizeKHR",
+    "CmdDrawMeshTasksEXT",
+    "CmdDrawMeshTasksIndirectEXT",
+    "CmdDrawMeshTasksIndirectCountEXT",
+    "GetAndroidHardwareBufferPropertiesANDROID",
+    "GetMemoryAndroidHardwareBufferANDROID",
+    "GetMemoryZirconHandleFUCHSIA",
+    "GetMemoryZirconHandlePropertiesFUCHSIA",
+    "ImportSemaphoreZirconHandleFUCHSIA",
+    "GetSemaphoreZirconHandleFUCHSIA",
+    "CreateBufferCollectionFUCHSIA",
+    "SetBufferCollectionImageConstraintsFUCHSIA",
+    "SetBufferCollectionBufferConstraintsFUCHSIA",
+    "DestroyBufferCollectionFUCHSIA",
+    "GetBufferCollectionPropertiesFUCHSIA",
+    "ExportMetalObjectsEXT",
+    "GetMemoryWin32HandleKHR",
+    "GetMemoryWin32HandlePropertiesKHR",
+    "ImportSemaphoreWin32HandleKHR",
+    "GetSemaphoreWin32HandleKHR",
+    "ImportFenceWin32HandleKHR",
+    "GetFenceWin32HandleKHR",
+    "GetMemoryWin32HandleNV",
+    "AcquireFullScreenExclusiveModeEXT",
+    "ReleaseFullScreenExclusiveModeEXT",
+    "GetDeviceGroupSurfacePresentModes2EXT",
+    "GetScreenBufferPropertiesQNX",
+    "CreateExecutionGraphPipelinesAMDX",
+    "GetExecutionGraphPipelineScratchSizeAMDX",
+    "GetExecutionGraphPipelineNodeIndexAMDX",
+    "CmdInitializeGraphScratchMemoryAMDX",
+    "CmdDispatchGraphAMDX",
+    "CmdDispatchGraphIndirectAMDX",
+    "CmdDispatchGraphIndirectCountAMDX",
+    "GetImageViewHandle64NVX",
+    "CmdSetDepthClampRangeEXT",
+    "CmdSetLineStipple",
+    "MapMemory2",
+    "UnmapMemory2",
+    "CmdBindIndexBuffer2",
+    "GetRenderingAreaGranularity",
+    "GetDeviceImageSubresourceLayout",
+    "GetImageSubresourceLayout2",
+    "CmdPushDescriptorSet",
+    "CmdPushDescriptorSetWithTemplate",
+    "CmdSetRenderingAttachmentLocations",
+    "CmdSetRenderingInputAttachmentIndices",
+    "CmdBindDescriptorSets2",
+    "CmdPushConstants2",
+    "CmdPushDescriptorSet2",
+    "CmdPushDescriptorSetWithTemplate2",
+    "CopyMemoryToImage",
+    "CopyImageToMemory",
+    "CopyImageToImage",
+    "TransitionImageLayout",
+    "CreatePipelineBinariesKHR",
+    "DestroyPipelineBinaryKHR",
+    "GetPipelineKeyKHR",
+    "GetPipelineBinaryDataKHR",
+    "ReleaseCapturedPipelineDataKHR",
+    "AntiLagUpdateAMD",
+    "ConvertCooperativeVectorMatrixNV",
+    "CmdConvertCooperativeVectorMatrixNV",
+    "GetClusterAccelerationStructureBuildSizesNV",
+    "CmdBuildClusterAccelerationStructureIndirectNV",
+    "GetPartitionedAccelerationStructuresBuildSizesNV",
+    "CmdBuildPartitionedAccelerationStructuresNV",
+    "GetGeneratedCommandsMemoryRequirementsEXT",
+    "CmdPreprocessGeneratedCommandsEXT",
+    "CmdExecuteGeneratedCommandsEXT",
+    "CreateIndirectCommandsLayoutEXT",
+    "DestroyIndirectCommandsLayoutEXT",
+    "CreateIndirectExecutionSetEXT",
+    "DestroyIndirectExecutionSetEXT",
+    "UpdateIndirectExecutionSetPipelineEXT",
+    "UpdateIndirectExecutionSetShaderEXT",
+    "GetMemoryMetalHandleEXT",
+    "GetMemoryMetalHandlePropertiesEXT",
+};
+static const VkadExtensionNames vkadExtensionNames = {
+    "VK_KHR_swapchain",
+    "VK_KHR_display_swapchain",
+    "VK_KHR_video_queue",
+    "VK_KHR_video_decode_queue",
+    "VK_KHR_dynamic_rendering",
+    "VK_KHR_device_group",
+    "VK_KHR_maintenance1",
+    "VK_KHR_external_memory_fd",
+    "VK_KHR_external_semaphore_fd",
+    "VK_KHR_push_descriptor",
+    "VK_KHR_descriptor_update_template",
+    "VK_KHR_create_renderpass2",
+    "VK_KHR_shared_presentable_image",
+    "VK_KHR_external_fence_fd",
+    "VK_KHR_performance_query",
+    "VK_KHR_get_memory_requirements2",
+    "VK_KHR_sampler_ycbcr_conversion",
+    "VK_KHR_bind_memory2",
+    "VK_KHR_maintenance3",
+    "VK_KHR_draw_indirect_count",
+    "VK_KHR_timeline_semaphore",
+    "VK_KHR_fragment_shading_rate",
+    "VK_KHR_dynamic_rendering_local_read",
+    "VK_KHR_present_wait",
+    "VK_KHR_buffer_device_address",
+    "VK_KHR_deferred_host_operations",
+    "VK_KHR_pipeline_executable_properties",
+    "VK_KHR_map_memory2",
+    "VK_KHR_video_encode_queue",
+    "VK_KHR_synchronization2",
+    "VK_AMD_buffer_marker",
+    "VK_NV_device_diagnostic_checkpoints",
+    "VK_KHR_copy_commands2",
+    "VK_KHR_ray_tracing_maintenance1",
+    "VK_KHR_maintenance4",
+    "VK_KHR_maintenance5",
+    "VK_KHR_line_rasterization",
+    "VK_KHR_calibrated_timestamps",
+    "VK_KHR_maintenance6",
+    "VK_EXT_debug_marker",
+    "VK_EXT_transform_feedback",
+    "VK_NVX_binary_import",
+    "VK_NVX_image_view_handle",
+    "VK_AMD_draw_indirect_count",
+    "VK_AMD_shader_info",
+    "VK_EXT_conditional_rendering",
+    "VK_NV_clip_space_w_scaling",
+    "VK_EXT_display_control",
+    "VK_GOOGLE_display_timing",
+    "VK_EXT_discard_rectangles",
+    "VK_EXT_hdr_metadata",
+    "VK_EXT_debug_utils",
+    "VK_EXT_sample_locations",
+    "VK_EXT_image_drm_format_modifier",
+    "VK_EXT_validation_cache",
+    "VK_NV_shading_rate_image",
+    "VK_NV_ray_tracing",
+    "VK_EXT_external_memory_host",
+    "VK_EXT_calibrated_timestamps",
+    "VK_NV_mesh_shader",
+    "VK_NV_scissor_exclusive",
+    "VK_INTEL_performance_query",
+    "VK_AMD_display_native_hdr",
+    "VK_EXT_buffer_device_address",
+    "VK_EXT_line_rasterization",
+    "VK_EXT_host_query_reset",
+    "VK_EXT_extended_dynamic_state",
+    "VK_EXT_shader_object",
+    "VK_EXT_host_image_copy",
+    "VK_EXT_image_compression_control",
+    "VK_EXT_swapchain_maintenance1",
+    "VK_NV_device_generated_commands",
+    "VK_EXT_depth_bias_control",
+    "VK_EXT_private_data",
+    "VK_NV_cuda_kernel_launch",
+    "VK_EXT_descriptor_buffer",
+    "VK_NV_fragment_shading_rate_enums",
+    "VK_EXT_device_fault",
+    "VK_EXT_vertex_input_dynamic_state",
+    "VK_HUAWEI_subpass_shading",
+    "VK_HUAWEI_invocation_mask",
+    "VK_NV_external_memory_rdma",
+    "VK_EXT_pipeline_properties",
+    "VK_EXT_extended_dynamic_state2",
+    "VK_EXT_color_write_enable",
+    "VK_EXT_multi_draw",
+    "VK_EXT_opacity_micromap",
+    "VK_HUAWEI_cluster_culling_shader",
+    "VK_EXT_pageable_device_local_memory",
+    "VK_VALVE_descriptor_set_host_mapping",
+    "VK_NV_copy_memory_indirect",
+    "VK_NV_memory_decompression",
+    "VK_NV_device_generated_commands_compute",
+    "VK_EXT_extended_dynamic_state3",
+    "VK_EXT_shader_module_identifier",
+    "VK_NV_optical_flow",
+    "VK_QCOM_tile_properties",
+    "VK_NV_low_latency2",
+    "VK_EXT_attachment_feedback_loop_dynamic_state",
+    "VK_KHR_acceleration_structure",
+    "VK_KHR_ray_tracing_pipeline",
+    "VK_EXT_mesh_shader",
+    "VK_ANDROID_external_memory_android_hardware_buffer",
+    "VK_FUCHSIA_external_memory",
+    "VK_FUCHSIA_external_semaphore",
+    "VK_FUCHSIA_buffer_collection",
+    "VK_EXT_metal_objects",
+    "VK_KHR_external_memory_win32",
+    "VK_KHR_external_semaphore_win32",
+    "VK_KHR_external_fence_win32",
+    "VK_NV_external_memory_win32",
+    "VK_EXT_full_screen_exclusive",
+    "VK_QNX_external_memory_screen_buffer",
+    "VK_AMDX_shader_enqueue",
+    "VK_EXT_depth_clamp_control",
+    "VK_KHR_pipeline_binary",
+    "VK_AMD_anti_lag",
+    "VK_NV_cooperative_vector",
+    "VK_NV_cluster_acceleration_structure",
+    "VK_NV_partitioned_acceleration_structure",
+    "VK_EXT_device_generated_commands",
+    "VK_EXT_external_memory_metal",
+    "VK_KHR_surface",
+    "VK_KHR_display",
+    "VK_KHR_get_physical_device_properties2",
+    "VK_KHR_device_group_creation",
+    "VK_KHR_external_memory_capabilities",
+    "VK_KHR_external_semaphore_capabilities",
+    "VK_KHR_external_fence_capabilities",
+    "VK_KHR_get_surface_capabilities2",
+    "VK_KHR_get_display_properties2",
+    "VK_KHR_cooperative_matrix",
+    "VK_EXT_debug_report",
+    "VK_NV_external_memory_capabilities",
+    "VK_EXT_direct_mode_display",
+    "VK_EXT_display_surface_counter",
+    "VK_EXT_tooling_info",
+    "VK_NV_cooperative_matrix",
+    "VK_NV_coverage_reduction_mode",
+    "VK_EXT_headless_surface",
+    "VK_EXT_acquire_drm_display",
+    "VK_KHR_android_surface",
+    "VK_FUCHSIA_imagepipe_surface",
+    "VK_MVK_ios_surface",
+    "VK_MVK_macos_surface",
+    "VK_EXT_metal_surface",
+    "VK_NN_vi_surface",
+    "VK_KHR_wayland_surface",
+    "VK_KHR_win32_surface",
+    "VK_NV_acquire_winrt_display",
+    "VK_KHR_xcb_surface",
+    "VK_KHR_xlib_surface",
+    "VK_EXT_directfb_surface",
+    "VK_EXT_acquire_xlib_display",
+    "VK_GGP_stream_descriptor_surface",
+    "VK_QNX_screen_surface",
+    "VK_NV_cooperative_matrix2",
+};
+static const VkadFunctionEntry vkadGlobalFunctionEntries[] = {
+    /* VK_VERSION_1_0 */
+    VKAD_FUNCTION_ENTRY   (VkadGlobalFunctions, EnumerateInstanceExtensionProperties                            ),
+    VKAD_FUNCTION_ENTRY   (VkadGlobalFunctions, EnumerateInstanceLayerProperties                                ),
+    VKAD_FUNCTION_ENTRY   (VkadGlobalFunctions, CreateInstance                                                  ),
+    /* VK_VERSION_1_1 */
+    VKAD_FUNCTION_ENTRY   (VkadGlobalFunctions, EnumerateInstanceVersion                                        ),
+};
+static const VkadFunctionEntry vkadInstanceFunctionEntries[] = {
+    /* VK_VERSION_1_0 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, DestroyInstance                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, EnumeratePhysicalDevices                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceFeatures                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceFormatProperties                               ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceImageFormatProperties                          ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceProperties                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceQueueFamilyProperties                          ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceMemoryProperties                               ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, EnumerateDeviceExtensionProperties                              ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, EnumerateDeviceLayerProperties                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceSparseImageFormatProperties                    ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, CreateDevice                                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetDeviceProcAddr                                               ),
+    /* VK_VERSION_1_1 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, EnumeratePhysicalDeviceGroups                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceFeatures2                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceProperties2                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceFormatProperties2                              ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceImageFormatProperties2                         ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceQueueFamilyProperties2                         ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceMemoryProperties2                              ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceSparseImageFormatProperties2                   ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceExternalBufferProperties                       ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceExternalFenceProperties                        ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceExternalSemaphoreProperties                    ),
+    /* VK_VERSION_1_3 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceToolProperties                                 ),
+    /* VK_KHR_surface spec_version 25  */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, DestroySurfaceKHR                                               ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceSurfaceSupportKHR                              ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceSurfaceCapabilitiesKHR                         ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceSurfaceFormatsKHR                              ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceSurfacePresentModesKHR                         ),
+    /* VK_KHR_swapchain spec_version 70  */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDevicePresentRectanglesKHR                           ),
+    /* VK_KHR_display spec_version 23  */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceDisplayPropertiesKHR                           ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceDisplayPlanePropertiesKHR                      ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetDisplayPlaneSupportedDisplaysKHR                             ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetDisplayModePropertiesKHR                                     ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateDisplayModeKHR                                            ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetDisplayPlaneCapabilitiesKHR                                  ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateDisplayPlaneSurfaceKHR                                    ),
+    /* VK_KHR_video_queue spec_version 8 */
+    VKAD_VIDEO_ENTRY      (VkadInstanceFunctions, GetPhysicalDeviceVideoCapabilitiesKHR                           ),
+    VKAD_VIDEO_ENTRY      (VkadInstanceFunctions, GetPhysicalDeviceVideoFormatPropertiesKHR                       ),
+    /* VK_KHR_get_physical_device_properties2 spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceFeatures2KHR                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceProperties2KHR                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceFormatProperties2KHR                           ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceImageFormatProperties2KHR                      ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceQueueFamilyProperties2KHR                      ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceMemoryProperties2KHR                           ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceSparseImageFormatProperties2KHR                ),
+    /* VK_KHR_device_group_creation spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, EnumeratePhysicalDeviceGroupsKHR                                ),
+    /* VK_KHR_external_memory_capabilities spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceExternalBufferPropertiesKHR                    ),
+    /* VK_KHR_external_semaphore_capabilities spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceExternalSemaphorePropertiesKHR                 ),
+    /* VK_KHR_external_fence_capabilities spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceExternalFencePropertiesKHR                     ),
+    /* VK_KHR_performance_query spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR   ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR           ),
+    /* VK_KHR_get_surface_capabilities2 spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceSurfaceCapabilities2KHR                        ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceSurfaceFormats2KHR                             ),
+    /* VK_KHR_get_display_properties2 spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceDisplayProperties2KHR                          ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceDisplayPlaneProperties2KHR                     ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetDisplayModeProperties2KHR                                    ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetDisplayPlaneCapabilities2KHR                                 ),
+    /* VK_KHR_fragment_shading_rate spec_version 2 */
+    VKAD_GRAPHICS_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceFragmentShadingRatesKHR                        ),
+    /* VK_KHR_video_encode_queue spec_version 12 */
+    VKAD_VIDEO_ENTRY      (VkadInstanceFunctions, GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR           ),
+    /* VK_KHR_cooperative_matrix spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceCooperativeMatrixPropertiesKHR                 ),
+    /* VK_KHR_calibrated_timestamps spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceCalibrateableTimeDomainsKHR                    ),
+    /* VK_EXT_debug_report spec_version 10 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, CreateDebugReportCallbackEXT                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, DestroyDebugReportCallbackEXT                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, DebugReportMessageEXT                                           ),
+    /* VK_NV_external_memory_capabilities spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadInstanceFunctions, GetPhysicalDeviceExternalImageFormatPropertiesNV                ),
+    /* VK_EXT_direct_mode_display spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, ReleaseDisplayEXT                                               ),
+    /* VK_EXT_display_surface_counter spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceSurfaceCapabilities2EXT                        ),
+    /* VK_EXT_debug_utils spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, CreateDebugUtilsMessengerEXT                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, DestroyDebugUtilsMessengerEXT                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, SubmitDebugUtilsMessageEXT                                      ),
+    /* VK_EXT_sample_locations spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceMultisamplePropertiesEXT                       ),
+    /* VK_EXT_calibrated_timestamps spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceCalibrateableTimeDomainsEXT                    ),
+    /* VK_EXT_tooling_info spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadInstanceFunctions, GetPhysicalDeviceToolPropertiesEXT                              ),
+    /* VK_NV_cooperative_matrix spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadInstanceFunctions, GetPhysicalDeviceCooperativeMatrixPropertiesNV                  ),
+    /* VK_NV_coverage_reduction_mode spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadInstanceFunctions, GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV ),
+    /* VK_EXT_headless_surface spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateHeadlessSurfaceEXT                                        ),
+    /* VK_EXT_acquire_drm_display spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, AcquireDrmDisplayEXT                                            ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetDrmDisplayEXT                                                ),
+    /* VK_NV_optical_flow spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadInstanceFunctions, GetPhysicalDeviceOpticalFlowImageFormatsNV                      ),
+    /* VK_KHR_android_surface spec_version 6 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateAndroidSurfaceKHR                                         ),
+    /* VK_FUCHSIA_imagepipe_surface spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateImagePipeSurfaceFUCHSIA                                   ),
+    /* VK_MVK_ios_surface spec_version 3 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateIOSSurfaceMVK                                             ),
+    /* VK_MVK_macos_surface spec_version 3 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateMacOSSurfaceMVK                                           ),
+    /* VK_EXT_metal_surface spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateMetalSurfaceEXT                                           ),
+    /* VK_NN_vi_surface spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateViSurfaceNN                                               ),
+    /* VK_KHR_wayland_surface spec_version 6 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateWaylandSurfaceKHR                                         ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceWaylandPresentationSupportKHR                  ),
+    /* VK_KHR_win32_surface spec_version 6 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateWin32SurfaceKHR                                           ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceWin32PresentationSupportKHR                    ),
+    /* VK_EXT_full_screen_exclusive spec_version 4 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceSurfacePresentModes2EXT                        ),
+    /* VK_NV_acquire_winrt_display spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, AcquireWinrtDisplayNV                                           ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetWinrtDisplayNV                                               ),
+    /* VK_KHR_xcb_surface spec_version 6 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateXcbSurfaceKHR                                             ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceXcbPresentationSupportKHR                      ),
+    /* VK_KHR_xlib_surface spec_version 6 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateXlibSurfaceKHR                                            ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceXlibPresentationSupportKHR                     ),
+    /* VK_EXT_directfb_surface spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateDirectFBSurfaceEXT                                        ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceDirectFBPresentationSupportEXT                 ),
+    /* VK_EXT_acquire_xlib_display spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, AcquireXlibDisplayEXT                                           ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetRandROutputDisplayEXT                                        ),
+    /* VK_GGP_stream_descriptor_surface spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateStreamDescriptorSurfaceGGP                                ),
+    /* VK_QNX_screen_surface spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, CreateScreenSurfaceQNX                                          ),
+    VKAD_WSI_ENTRY        (VkadInstanceFunctions, GetPhysicalDeviceScreenPresentationSupportQNX                   ),
+    /* VK_NV_cooperative_vector spec_version 4 */
+    VKAD_VENDOR_ENTRY     (VkadInstanceFunctions, GetPhysicalDeviceCooperativeVectorPropertiesNV                  ),
+    /* VK_NV_cooperative_matrix2 spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadInstanceFunctions, GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV),
+};
+static const VkadFunctionEntry vkadDeviceFunctionEntries[] = {
+    /* VK_VERSION_1_0 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyDevice                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceQueue                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, QueueSubmit                                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, QueueWaitIdle                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DeviceWaitIdle                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, AllocateMemory                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, FreeMemory                                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, MapMemory                                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, UnmapMemory                                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, FlushMappedMemoryRanges                                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, InvalidateMappedMemoryRanges                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceMemoryCommitment                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, BindBufferMemory                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, BindImageMemory                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetBufferMemoryRequirements                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageMemoryRequirements                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageSparseMemoryRequirements                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, QueueBindSparse                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateFence                                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyFence                                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ResetFences                                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetFenceStatus                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, WaitForFences                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateSemaphore                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroySemaphore                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateEvent                                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyEvent                                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetEventStatus                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, SetEvent                                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ResetEvent                                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateQueryPool                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyQueryPool                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetQueryPoolResults                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateBuffer                                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyBuffer                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateBufferView                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyBufferView                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateImage                                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyImage                                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageSubresourceLayout                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateImageView                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyImageView                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateShaderModule                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyShaderModule                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreatePipelineCache                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyPipelineCache                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetPipelineCacheData                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, MergePipelineCaches                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateGraphicsPipelines                                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateComputePipelines                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyPipeline                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreatePipelineLayout                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyPipelineLayout                                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateSampler                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroySampler                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateDescriptorSetLayout                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyDescriptorSetLayout                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateDescriptorPool                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyDescriptorPool                                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ResetDescriptorPool                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, AllocateDescriptorSets                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, FreeDescriptorSets                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, UpdateDescriptorSets                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateFramebuffer                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyFramebuffer                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateRenderPass                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyRenderPass                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetRenderAreaGranularity                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateCommandPool                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyCommandPool                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ResetCommandPool                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, AllocateCommandBuffers                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, FreeCommandBuffers                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, BeginCommandBuffer                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, EndCommandBuffer                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ResetCommandBuffer                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindPipeline                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetViewport                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetScissor                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetLineWidth                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetDepthBias                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetBlendConstants                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetDepthBounds                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetStencilCompareMask                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetStencilWriteMask                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetStencilReference                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindDescriptorSets                                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindIndexBuffer                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindVertexBuffers                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDraw                                                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDrawIndexed                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDrawIndirect                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDrawIndexedIndirect                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDispatch                                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDispatchIndirect                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyBuffer                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyImage                                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBlitImage                                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyBufferToImage                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyImageToBuffer                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdUpdateBuffer                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdFillBuffer                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdClearColorImage                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdClearDepthStencilImage                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdClearAttachments                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdResolveImage                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetEvent                                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdResetEvent                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdWaitEvents                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPipelineBarrier                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBeginQuery                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdEndQuery                                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdResetQueryPool                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdWriteTimestamp                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyQueryPoolResults                                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPushConstants                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBeginRenderPass                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdNextSubpass                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdEndRenderPass                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdExecuteCommands                                              ),
+    /* VK_VERSION_1_1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, BindBufferMemory2                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, BindImageMemory2                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceGroupPeerMemoryFeatures                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetDeviceMask                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDispatchBase                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageMemoryRequirements2                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetBufferMemoryRequirements2                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageSparseMemoryRequirements2                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, TrimCommandPool                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceQueue2                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateSamplerYcbcrConversion                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroySamplerYcbcrConversion                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateDescriptorUpdateTemplate                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyDescriptorUpdateTemplate                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, UpdateDescriptorSetWithTemplate                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDescriptorSetLayoutSupport                                   ),
+    /* VK_VERSION_1_2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDrawIndirectCount                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDrawIndexedIndirectCount                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateRenderPass2                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBeginRenderPass2                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdNextSubpass2                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdEndRenderPass2                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ResetQueryPool                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetSemaphoreCounterValue                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, WaitSemaphores                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, SignalSemaphore                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetBufferDeviceAddress                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetBufferOpaqueCaptureAddress                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceMemoryOpaqueCaptureAddress                             ),
+    /* VK_VERSION_1_3 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreatePrivateDataSlot                                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyPrivateDataSlot                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, SetPrivateData                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetPrivateData                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetEvent2                                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdResetEvent2                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdWaitEvents2                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPipelineBarrier2                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdWriteTimestamp2                                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, QueueSubmit2                                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyBuffer2                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyImage2                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyBufferToImage2                                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyImageToBuffer2                                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBlitImage2                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdResolveImage2                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBeginRendering                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdEndRendering                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetCullMode                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetFrontFace                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetPrimitiveTopology                                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetViewportWithCount                                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetScissorWithCount                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindVertexBuffers2                                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetDepthTestEnable                                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetDepthWriteEnable                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetDepthCompareOp                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetDepthBoundsTestEnable                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetStencilTestEnable                                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetStencilOp                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetRasterizerDiscardEnable                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetDepthBiasEnable                                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetPrimitiveRestartEnable                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceBufferMemoryRequirements                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceImageMemoryRequirements                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceImageSparseMemoryRequirements                          ),
+    /* VK_KHR_swapchain spec_version 70  */
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, CreateSwapchainKHR                                              ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, DestroySwapchainKHR                                             ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, GetSwapchainImagesKHR                                           ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, AcquireNextImageKHR                                             ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, QueuePresentKHR                                                 ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, GetDeviceGroupPresentCapabilitiesKHR                            ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, GetDeviceGroupSurfacePresentModesKHR                            ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, AcquireNextImage2KHR                                            ),
+    /* VK_KHR_display_swapchain spec_version 10  */
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, CreateSharedSwapchainsKHR                                       ),
+    /* VK_KHR_video_queue spec_version 8 */
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, CreateVideoSessionKHR                                           ),
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, DestroyVideoSessionKHR                                          ),
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, GetVideoSessionMemoryRequirementsKHR                            ),
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, BindVideoSessionMemoryKHR                                       ),
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, CreateVideoSessionParametersKHR                                 ),
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, UpdateVideoSessionParametersKHR                                 ),
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, DestroyVideoSessionParametersKHR                                ),
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, CmdBeginVideoCodingKHR                                          ),
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, CmdEndVideoCodingKHR                                            ),
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, CmdControlVideoCodingKHR                                        ),
+    /* VK_KHR_video_decode_queue spec_version 8 */
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, CmdDecodeVideoKHR                                               ),
+    /* VK_KHR_dynamic_rendering spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdBeginRenderingKHR                                            ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdEndRenderingKHR                                              ),
+    /* VK_KHR_device_group spec_version 4 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceGroupPeerMemoryFeaturesKHR                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetDeviceMaskKHR                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDispatchBaseKHR                                              ),
+    /* VK_KHR_maintenance1 spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, TrimCommandPoolKHR                                              ),
+    /* VK_KHR_external_memory_fd spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetMemoryFdKHR                                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetMemoryFdPropertiesKHR                                        ),
+    /* VK_KHR_external_semaphore_fd spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ImportSemaphoreFdKHR                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetSemaphoreFdKHR                                               ),
+    /* VK_KHR_push_descriptor spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPushDescriptorSetKHR                                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPushDescriptorSetWithTemplateKHR                             ),
+    /* VK_KHR_descriptor_update_template spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateDescriptorUpdateTemplateKHR                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyDescriptorUpdateTemplateKHR                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, UpdateDescriptorSetWithTemplateKHR                              ),
+    /* VK_KHR_create_renderpass2 spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CreateRenderPass2KHR                                            ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdBeginRenderPass2KHR                                          ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdNextSubpass2KHR                                              ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdEndRenderPass2KHR                                            ),
+    /* VK_KHR_shared_presentable_image spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, GetSwapchainStatusKHR                                           ),
+    /* VK_KHR_external_fence_fd spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ImportFenceFdKHR                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetFenceFdKHR                                                   ),
+    /* VK_KHR_performance_query spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, AcquireProfilingLockKHR                                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ReleaseProfilingLockKHR                                         ),
+    /* VK_KHR_get_memory_requirements2 spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageMemoryRequirements2KHR                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetBufferMemoryRequirements2KHR                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageSparseMemoryRequirements2KHR                            ),
+    /* VK_KHR_sampler_ycbcr_conversion spec_version 14 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateSamplerYcbcrConversionKHR                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroySamplerYcbcrConversionKHR                                ),
+    /* VK_KHR_bind_memory2 spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, BindBufferMemory2KHR                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, BindImageMemory2KHR                                             ),
+    /* VK_KHR_maintenance3 spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDescriptorSetLayoutSupportKHR                                ),
+    /* VK_KHR_draw_indirect_count spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdDrawIndirectCountKHR                                         ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdDrawIndexedIndirectCountKHR                                  ),
+    /* VK_KHR_timeline_semaphore spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetSemaphoreCounterValueKHR                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, WaitSemaphoresKHR                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, SignalSemaphoreKHR                                              ),
+    /* VK_KHR_fragment_shading_rate spec_version 2 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetFragmentShadingRateKHR                                    ),
+    /* VK_KHR_dynamic_rendering_local_read spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetRenderingAttachmentLocationsKHR                           ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetRenderingInputAttachmentIndicesKHR                        ),
+    /* VK_KHR_present_wait spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, WaitForPresentKHR                                               ),
+    /* VK_KHR_buffer_device_address spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetBufferDeviceAddressKHR                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetBufferOpaqueCaptureAddressKHR                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceMemoryOpaqueCaptureAddressKHR                          ),
+    /* VK_KHR_deferred_host_operations spec_version 4 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateDeferredOperationKHR                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyDeferredOperationKHR                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeferredOperationMaxConcurrencyKHR                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeferredOperationResultKHR                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DeferredOperationJoinKHR                                        ),
+    /* VK_KHR_pipeline_executable_properties spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetPipelineExecutablePropertiesKHR                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetPipelineExecutableStatisticsKHR                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetPipelineExecutableInternalRepresentationsKHR                 ),
+    /* VK_KHR_map_memory2 spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, MapMemory2KHR                                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, UnmapMemory2KHR                                                 ),
+    /* VK_KHR_video_encode_queue spec_version 12 */
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, GetEncodedVideoSessionParametersKHR                             ),
+    VKAD_VIDEO_ENTRY      (VkadDeviceFunctions, CmdEncodeVideoKHR                                               ),
+    /* VK_KHR_synchronization2 spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetEvent2KHR                                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdResetEvent2KHR                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdWaitEvents2KHR                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPipelineBarrier2KHR                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdWriteTimestamp2KHR                                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, QueueSubmit2KHR                                                 ),
+    /* VK_AMD_buffer_marker, kept in the VK_KHR_synchronization2 block for the memory layout */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdWriteBufferMarker2AMD                                        ),
+    /* VK_NV_device_diagnostic_checkpoints, kept in the VK_KHR_synchronization2 block for the memory layout */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetQueueCheckpointData2NV                                       ),
+    /* VK_KHR_copy_commands2 spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyBuffer2KHR                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyImage2KHR                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyBufferToImage2KHR                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdCopyImageToBuffer2KHR                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBlitImage2KHR                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdResolveImage2KHR                                             ),
+    /* VK_KHR_ray_tracing_maintenance1 spec_version 1 */
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdTraceRaysIndirect2KHR                                        ),
+    /* VK_KHR_maintenance4 spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceBufferMemoryRequirementsKHR                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceImageMemoryRequirementsKHR                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceImageSparseMemoryRequirementsKHR                       ),
+    /* VK_KHR_maintenance5 spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindIndexBuffer2KHR                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetRenderingAreaGranularityKHR                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceImageSubresourceLayoutKHR                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageSubresourceLayout2KHR                                   ),
+    /* VK_KHR_line_rasterization spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetLineStippleKHR                                            ),
+    /* VK_KHR_calibrated_timestamps spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetCalibratedTimestampsKHR                                      ),
+    /* VK_KHR_maintenance6 spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindDescriptorSets2KHR                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPushConstants2KHR                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPushDescriptorSet2KHR                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPushDescriptorSetWithTemplate2KHR                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetDescriptorBufferOffsets2EXT                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindDescriptorBufferEmbeddedSamplers2EXT                     ),
+    /* VK_EXT_debug_marker spec_version 4 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DebugMarkerSetObjectTagEXT                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DebugMarkerSetObjectNameEXT                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDebugMarkerBeginEXT                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDebugMarkerEndEXT                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdDebugMarkerInsertEXT                                         ),
+    /* VK_EXT_transform_feedback spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdBindTransformFeedbackBuffersEXT                              ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdBeginTransformFeedbackEXT                                    ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdEndTransformFeedbackEXT                                      ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdBeginQueryIndexedEXT                                         ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdEndQueryIndexedEXT                                           ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdDrawIndirectByteCountEXT                                     ),
+    /* VK_NVX_binary_import spec_version 2 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CreateCuModuleNVX                                               ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CreateCuFunctionNVX                                             ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, DestroyCuModuleNVX                                              ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, DestroyCuFunctionNVX                                            ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdCuLaunchKernelNVX                                            ),
+    /* VK_NVX_image_view_handle spec_version 3 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetImageViewHandleNVX                                           ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetImageViewAddressNVX                                          ),
+    /* VK_AMD_draw_indirect_count spec_version 2 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDrawIndirectCountAMD                                         ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDrawIndexedIndirectCountAMD                                  ),
+    /* VK_AMD_shader_info spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetShaderInfoAMD                                                ),
+    /* VK_EXT_conditional_rendering spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBeginConditionalRenderingEXT                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdEndConditionalRenderingEXT                                   ),
+    /* VK_NV_clip_space_w_scaling spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdSetViewportWScalingNV                                        ),
+    /* VK_EXT_display_control spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, DisplayPowerControlEXT                                          ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, RegisterDeviceEventEXT                                          ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, RegisterDisplayEventEXT                                         ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, GetSwapchainCounterEXT                                          ),
+    /* VK_GOOGLE_display_timing spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, GetRefreshCycleDurationGOOGLE                                   ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, GetPastPresentationTimingGOOGLE                                 ),
+    /* VK_EXT_discard_rectangles spec_version 2 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDiscardRectangleEXT                                       ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDiscardRectangleEnableEXT                                 ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDiscardRectangleModeEXT                                   ),
+    /* VK_EXT_hdr_metadata spec_version 3 */
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, SetHdrMetadataEXT                                               ),
+    /* VK_EXT_debug_utils spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, SetDebugUtilsObjectNameEXT                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, SetDebugUtilsObjectTagEXT                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, QueueBeginDebugUtilsLabelEXT                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, QueueEndDebugUtilsLabelEXT                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, QueueInsertDebugUtilsLabelEXT                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBeginDebugUtilsLabelEXT                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdEndDebugUtilsLabelEXT                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdInsertDebugUtilsLabelEXT                                     ),
+    /* VK_EXT_sample_locations spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetSampleLocationsEXT                                        ),
+    /* VK_EXT_image_drm_format_modifier spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageDrmFormatModifierPropertiesEXT                          ),
+    /* VK_EXT_validation_cache spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateValidationCacheEXT                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyValidationCacheEXT                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, MergeValidationCachesEXT                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetValidationCacheDataEXT                                       ),
+    /* VK_NV_shading_rate_image spec_version 3 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdBindShadingRateImageNV                                       ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdSetViewportShadingRatePaletteNV                              ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdSetCoarseSampleOrderNV                                       ),
+    /* VK_NV_ray_tracing spec_version 3 */
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CreateAccelerationStructureNV                                   ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, DestroyAccelerationStructureNV                                  ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetAccelerationStructureMemoryRequirementsNV                    ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, BindAccelerationStructureMemoryNV                               ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdBuildAccelerationStructureNV                                 ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdCopyAccelerationStructureNV                                  ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdTraceRaysNV                                                  ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CreateRayTracingPipelinesNV                                     ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetRayTracingShaderGroupHandlesKHR                              ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetRayTracingShaderGroupHandlesNV                               ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetAccelerationStructureHandleNV                                ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdWriteAccelerationStructuresPropertiesNV                      ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CompileDeferredNV                                               ),
+    /* VK_EXT_external_memory_host spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetMemoryHostPointerPropertiesEXT                               ),
+    /* VK_AMD_buffer_marker spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdWriteBufferMarkerAMD                                         ),
+    /* VK_EXT_calibrated_timestamps spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetCalibratedTimestampsEXT                                      ),
+    /* VK_NV_mesh_shader spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDrawMeshTasksNV                                              ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDrawMeshTasksIndirectNV                                      ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDrawMeshTasksIndirectCountNV                                 ),
+    /* VK_NV_scissor_exclusive spec_version 2 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdSetExclusiveScissorEnableNV                                  ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdSetExclusiveScissorNV                                        ),
+    /* VK_NV_device_diagnostic_checkpoints spec_version 2 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdSetCheckpointNV                                              ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetQueueCheckpointDataNV                                        ),
+    /* VK_INTEL_performance_query spec_version 2 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, InitializePerformanceApiINTEL                                   ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, UninitializePerformanceApiINTEL                                 ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdSetPerformanceMarkerINTEL                                    ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdSetPerformanceStreamMarkerINTEL                              ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdSetPerformanceOverrideINTEL                                  ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, AcquirePerformanceConfigurationINTEL                            ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, ReleasePerformanceConfigurationINTEL                            ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, QueueSetPerformanceConfigurationINTEL                           ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetPerformanceParameterINTEL                                    ),
+    /* VK_AMD_display_native_hdr spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, SetLocalDimmingAMD                                              ),
+    /* VK_EXT_buffer_device_address spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetBufferDeviceAddressEXT                                       ),
+    /* VK_EXT_line_rasterization spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetLineStippleEXT                                            ),
+    /* VK_EXT_host_query_reset spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ResetQueryPoolEXT                                               ),
+    /* VK_EXT_extended_dynamic_state spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetCullModeEXT                                               ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetFrontFaceEXT                                              ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetPrimitiveTopologyEXT                                      ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetViewportWithCountEXT                                      ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetScissorWithCountEXT                                       ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdBindVertexBuffers2EXT                                        ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDepthTestEnableEXT                                        ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDepthWriteEnableEXT                                       ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDepthCompareOpEXT                                         ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDepthBoundsTestEnableEXT                                  ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetStencilTestEnableEXT                                      ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetStencilOpEXT                                              ),
+    /* VK_EXT_host_image_copy spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CopyMemoryToImageEXT                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CopyImageToMemoryEXT                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CopyImageToImageEXT                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, TransitionImageLayoutEXT                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageSubresourceLayout2EXT                                   ),
+    /* VK_EXT_swapchain_maintenance1 spec_version 1 */
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, ReleaseSwapchainImagesEXT                                       ),
+    /* VK_NV_device_generated_commands spec_version 3 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetGeneratedCommandsMemoryRequirementsNV                        ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdPreprocessGeneratedCommandsNV                                ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdExecuteGeneratedCommandsNV                                   ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdBindPipelineShaderGroupNV                                    ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CreateIndirectCommandsLayoutNV                                  ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, DestroyIndirectCommandsLayoutNV                                 ),
+    /* VK_EXT_depth_bias_control spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDepthBias2EXT                                             ),
+    /* VK_EXT_private_data spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreatePrivateDataSlotEXT                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyPrivateDataSlotEXT                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, SetPrivateDataEXT                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetPrivateDataEXT                                               ),
+    /* VK_NV_cuda_kernel_launch spec_version 2 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CreateCudaModuleNV                                              ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetCudaModuleCacheNV                                            ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CreateCudaFunctionNV                                            ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, DestroyCudaModuleNV                                             ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, DestroyCudaFunctionNV                                           ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdCudaLaunchKernelNV                                           ),
+    /* VK_EXT_descriptor_buffer spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDescriptorSetLayoutSizeEXT                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDescriptorSetLayoutBindingOffsetEXT                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDescriptorEXT                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindDescriptorBuffersEXT                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetDescriptorBufferOffsetsEXT                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindDescriptorBufferEmbeddedSamplersEXT                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetBufferOpaqueCaptureDescriptorDataEXT                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageOpaqueCaptureDescriptorDataEXT                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageViewOpaqueCaptureDescriptorDataEXT                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetSamplerOpaqueCaptureDescriptorDataEXT                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetAccelerationStructureOpaqueCaptureDescriptorDataEXT          ),
+    /* VK_NV_fragment_shading_rate_enums spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdSetFragmentShadingRateEnumNV                                 ),
+    /* VK_EXT_device_fault spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceFaultInfoEXT                                           ),
+    /* VK_EXT_vertex_input_dynamic_state spec_version 2 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetVertexInputEXT                                            ),
+    /* VK_HUAWEI_subpass_shading spec_version 3 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI                   ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdSubpassShadingHUAWEI                                         ),
+    /* VK_HUAWEI_invocation_mask spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdBindInvocationMaskHUAWEI                                     ),
+    /* VK_NV_external_memory_rdma spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetMemoryRemoteAddressNV                                        ),
+    /* VK_EXT_pipeline_properties spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetPipelinePropertiesEXT                                        ),
+    /* VK_EXT_extended_dynamic_state2 spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetPatchControlPointsEXT                                     ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetRasterizerDiscardEnableEXT                                ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDepthBiasEnableEXT                                        ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetLogicOpEXT                                                ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetPrimitiveRestartEnableEXT                                 ),
+    /* VK_EXT_color_write_enable spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetColorWriteEnableEXT                                       ),
+    /* VK_EXT_multi_draw spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdDrawMultiEXT                                                 ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdDrawMultiIndexedEXT                                          ),
+    /* VK_EXT_opacity_micromap spec_version 2 */
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CreateMicromapEXT                                               ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, DestroyMicromapEXT                                              ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdBuildMicromapsEXT                                            ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, BuildMicromapsEXT                                               ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CopyMicromapEXT                                                 ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CopyMicromapToMemoryEXT                                         ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CopyMemoryToMicromapEXT                                         ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, WriteMicromapsPropertiesEXT                                     ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdCopyMicromapEXT                                              ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdCopyMicromapToMemoryEXT                                      ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdCopyMemoryToMicromapEXT                                      ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdWriteMicromapsPropertiesEXT                                  ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetDeviceMicromapCompatibilityEXT                               ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetMicromapBuildSizesEXT                                        ),
+    /* VK_HUAWEI_cluster_culling_shader spec_version 3 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDrawClusterHUAWEI                                            ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDrawClusterIndirectHUAWEI                                    ),
+    /* VK_EXT_pageable_device_local_memory spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, SetDeviceMemoryPriorityEXT                                      ),
+    /* VK_VALVE_descriptor_set_host_mapping spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetDescriptorSetLayoutHostMappingInfoVALVE                      ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetDescriptorSetHostMappingVALVE                                ),
+    /* VK_NV_copy_memory_indirect spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdCopyMemoryIndirectNV                                         ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdCopyMemoryToImageIndirectNV                                  ),
+    /* VK_NV_memory_decompression spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDecompressMemoryNV                                           ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDecompressMemoryIndirectCountNV                              ),
+    /* VK_NV_device_generated_commands_compute spec_version 2 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetPipelineIndirectMemoryRequirementsNV                         ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdUpdatePipelineIndirectBufferNV                               ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetPipelineIndirectDeviceAddressNV                              ),
+    /* VK_EXT_extended_dynamic_state3 spec_version 2 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDepthClampEnableEXT                                       ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetPolygonModeEXT                                            ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetRasterizationSamplesEXT                                   ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetSampleMaskEXT                                             ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetAlphaToCoverageEnableEXT                                  ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetAlphaToOneEnableEXT                                       ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetLogicOpEnableEXT                                          ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetColorBlendEnableEXT                                       ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetColorBlendEquationEXT                                     ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetColorWriteMaskEXT                                         ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetTessellationDomainOriginEXT                               ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetRasterizationStreamEXT                                    ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetConservativeRasterizationModeEXT                          ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetExtraPrimitiveOverestimationSizeEXT                       ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDepthClipEnableEXT                                        ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetSampleLocationsEnableEXT                                  ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetColorBlendAdvancedEXT                                     ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetProvokingVertexModeEXT                                    ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetLineRasterizationModeEXT                                  ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetLineStippleEnableEXT                                      ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDepthClipNegativeOneToOneEXT                              ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetViewportWScalingEnableNV                                  ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetViewportSwizzleNV                                         ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetCoverageToColorEnableNV                                   ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetCoverageToColorLocationNV                                 ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetCoverageModulationModeNV                                  ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetCoverageModulationTableEnableNV                           ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetCoverageModulationTableNV                                 ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetShadingRateImageEnableNV                                  ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetRepresentativeFragmentTestEnableNV                        ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetCoverageReductionModeNV                                   ),
+    /* VK_EXT_shader_module_identifier spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetShaderModuleIdentifierEXT                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetShaderModuleCreateInfoIdentifierEXT                          ),
+    /* VK_NV_optical_flow spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CreateOpticalFlowSessionNV                                      ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, DestroyOpticalFlowSessionNV                                     ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, BindOpticalFlowSessionImageNV                                   ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdOpticalFlowExecuteNV                                         ),
+    /* VK_EXT_shader_object spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateShadersEXT                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyShaderEXT                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetShaderBinaryDataEXT                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindShadersEXT                                               ),
+    /* VK_QCOM_tile_properties spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetFramebufferTilePropertiesQCOM                                ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetDynamicRenderingTilePropertiesQCOM                           ),
+    /* VK_NV_low_latency2 spec_version 2 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, SetLatencySleepModeNV                                           ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, LatencySleepNV                                                  ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, SetLatencyMarkerNV                                              ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetLatencyTimingsNV                                             ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, QueueNotifyOutOfBandNV                                          ),
+    /* VK_EXT_attachment_feedback_loop_dynamic_state spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetAttachmentFeedbackLoopEnableEXT                           ),
+    /* VK_KHR_acceleration_structure spec_version 13 */
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CreateAccelerationStructureKHR                                  ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, DestroyAccelerationStructureKHR                                 ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdBuildAccelerationStructuresKHR                               ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdBuildAccelerationStructuresIndirectKHR                       ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, BuildAccelerationStructuresKHR                                  ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CopyAccelerationStructureKHR                                    ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CopyAccelerationStructureToMemoryKHR                            ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CopyMemoryToAccelerationStructureKHR                            ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, WriteAccelerationStructuresPropertiesKHR                        ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdCopyAccelerationStructureKHR                                 ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdCopyAccelerationStructureToMemoryKHR                         ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdCopyMemoryToAccelerationStructureKHR                         ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetAccelerationStructureDeviceAddressKHR                        ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdWriteAccelerationStructuresPropertiesKHR                     ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetDeviceAccelerationStructureCompatibilityKHR                  ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetAccelerationStructureBuildSizesKHR                           ),
+    /* VK_KHR_ray_tracing_pipeline spec_version 1 */
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdTraceRaysKHR                                                 ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CreateRayTracingPipelinesKHR                                    ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetRayTracingCaptureReplayShaderGroupHandlesKHR                 ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdTraceRaysIndirectKHR                                         ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetRayTracingShaderGroupStackSizeKHR                            ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdSetRayTracingPipelineStackSizeKHR                            ),
+    /* VK_EXT_mesh_shader spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdDrawMeshTasksEXT                                             ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdDrawMeshTasksIndirectEXT                                     ),
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdDrawMeshTasksIndirectCountEXT                                ),
+    /* VK_ANDROID_external_memory_android_hardware_buffer spec_version 5 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetAndroidHardwareBufferPropertiesANDROID                       ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetMemoryAndroidHardwareBufferANDROID                           ),
+    /* VK_FUCHSIA_external_memory spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetMemoryZirconHandleFUCHSIA                                    ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetMemoryZirconHandlePropertiesFUCHSIA                          ),
+    /* VK_FUCHSIA_external_semaphore spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, ImportSemaphoreZirconHandleFUCHSIA                              ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetSemaphoreZirconHandleFUCHSIA                                 ),
+    /* VK_FUCHSIA_buffer_collection spec_version 2 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CreateBufferCollectionFUCHSIA                                   ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, SetBufferCollectionImageConstraintsFUCHSIA                      ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, SetBufferCollectionBufferConstraintsFUCHSIA                     ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, DestroyBufferCollectionFUCHSIA                                  ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetBufferCollectionPropertiesFUCHSIA                            ),
+    /* VK_EXT_metal_objects spec_version 2 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ExportMetalObjectsEXT                                           ),
+    /* VK_KHR_external_memory_win32 spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetMemoryWin32HandleKHR                                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetMemoryWin32HandlePropertiesKHR                               ),
+    /* VK_KHR_external_semaphore_win32 spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ImportSemaphoreWin32HandleKHR                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetSemaphoreWin32HandleKHR                                      ),
+    /* VK_KHR_external_fence_win32 spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ImportFenceWin32HandleKHR                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetFenceWin32HandleKHR                                          ),
+    /* VK_NV_external_memory_win32 spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetMemoryWin32HandleNV                                          ),
+    /* VK_EXT_full_screen_exclusive spec_version 4 */
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, AcquireFullScreenExclusiveModeEXT                               ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, ReleaseFullScreenExclusiveModeEXT                               ),
+    VKAD_WSI_ENTRY        (VkadDeviceFunctions, GetDeviceGroupSurfacePresentModes2EXT                           ),
+    /* VK_QNX_external_memory_screen_buffer spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetScreenBufferPropertiesQNX                                    ),
+    /* VK_AMDX_shader_enqueue spec_version 2 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CreateExecutionGraphPipelinesAMDX                               ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetExecutionGraphPipelineScratchSizeAMDX                        ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetExecutionGraphPipelineNodeIndexAMDX                          ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdInitializeGraphScratchMemoryAMDX                             ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDispatchGraphAMDX                                            ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDispatchGraphIndirectAMDX                                    ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdDispatchGraphIndirectCountAMDX                               ),
+    /* to VK_NVX_image_view_handle spec_version 3 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, GetImageViewHandle64NVX                                         ),
+    /* to VK_EXT_shader_object spec_version 1 */
+    VKAD_GRAPHICS_ENTRY   (VkadDeviceFunctions, CmdSetDepthClampRangeEXT                                        ),
+    /* VK_VERSION_1_4 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetLineStipple                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, MapMemory2                                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, UnmapMemory2                                                    ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindIndexBuffer2                                             ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetRenderingAreaGranularity                                     ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetDeviceImageSubresourceLayout                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetImageSubresourceLayout2                                      ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPushDescriptorSet                                            ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPushDescriptorSetWithTemplate                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetRenderingAttachmentLocations                              ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdSetRenderingInputAttachmentIndices                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdBindDescriptorSets2                                          ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPushConstants2                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPushDescriptorSet2                                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPushDescriptorSetWithTemplate2                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CopyMemoryToImage                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CopyImageToMemory                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CopyImageToImage                                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, TransitionImageLayout                                           ),
+    /* VK_KHR_pipeline_binary spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreatePipelineBinariesKHR                                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyPipelineBinaryKHR                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetPipelineKeyKHR                                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetPipelineBinaryDataKHR                                        ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, ReleaseCapturedPipelineDataKHR                                  ),
+    /* VK_AMD_anti_lag spec_version 1 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, AntiLagUpdateAMD                                                ),
+    /* VK_NV_cooperative_vector spec_version 4 */
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, ConvertCooperativeVectorMatrixNV                                ),
+    VKAD_VENDOR_ENTRY     (VkadDeviceFunctions, CmdConvertCooperativeVectorMatrixNV                             ),
+    /* VK_NV_cluster_acceleration_structure spec_version 2 */
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetClusterAccelerationStructureBuildSizesNV                     ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdBuildClusterAccelerationStructureIndirectNV                  ),
+    /* VK_NV_partitioned_acceleration_structure spec_version 1 */
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, GetPartitionedAccelerationStructuresBuildSizesNV                ),
+    VKAD_RAY_TRACING_ENTRY(VkadDeviceFunctions, CmdBuildPartitionedAccelerationStructuresNV                     ),
+    /* VK_EXT_device_generated_commands spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetGeneratedCommandsMemoryRequirementsEXT                       ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdPreprocessGeneratedCommandsEXT                               ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CmdExecuteGeneratedCommandsEXT                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateIndirectCommandsLayoutEXT                                 ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyIndirectCommandsLayoutEXT                                ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, CreateIndirectExecutionSetEXT                                   ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, DestroyIndirectExecutionSetEXT                                  ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, UpdateIndirectExecutionSetPipelineEXT                           ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, UpdateIndirectExecutionSetShaderEXT                             ),
+    /* VK_EXT_external_memory_metal spec_version 1 */
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetMemoryMetalHandleEXT                                         ),
+    VKAD_FUNCTION_ENTRY   (VkadDeviceFunctions, GetMemoryMetalHandlePropertiesEXT                               ),
+};
+static const VkadFunctionGroup vkadDeviceFunctionGroups[] = {
+    {   0, 120, VKAD_NO_EXTENSION,                                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_VERSION_1_0 */
+    { 120,  16, VKAD_NO_EXTENSION,                                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 VK_API_VERSION_1_1 },  /* VK_VERSION_1_1 */
+    { 136,  13, VKAD_NO_EXTENSION,                                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 VK_API_VERSION_1_2 },  /* VK_VERSION_1_2 */
+    { 149,  36, VKAD_NO_EXTENSION,                                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 VK_API_VERSION_1_3 },  /* VK_VERSION_1_3 */
+    { 185,   8, VKAD_EXTENSION(KHR_swapchain),                                   VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_swapchain spec_version 70  */
+    { 193,   1, VKAD_EXTENSION(KHR_display_swapchain),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_display_swapchain spec_version 10  */
+    { 194,  10, VKAD_EXTENSION(KHR_video_queue),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_video_queue spec_version 8 */
+    { 204,   1, VKAD_EXTENSION(KHR_video_decode_queue),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_video_decode_queue spec_version 8 */
+    { 205,   2, VKAD_EXTENSION(KHR_dynamic_rendering),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_dynamic_rendering spec_version 1 */
+    { 207,   3, VKAD_EXTENSION(KHR_device_group),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_device_group spec_version 4 */
+    { 210,   1, VKAD_EXTENSION(KHR_maintenance1),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_maintenance1 spec_version 2 */
+    { 211,   2, VKAD_EXTENSION(KHR_external_memory_fd),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_external_memory_fd spec_version 1 */
+    { 213,   2, VKAD_EXTENSION(KHR_external_semaphore_fd),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_external_semaphore_fd spec_version 1 */
+    { 215,   2, VKAD_EXTENSION(KHR_push_descriptor),                             VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_push_descriptor spec_version 2 */
+    { 217,   3, VKAD_EXTENSION(KHR_descriptor_update_template),                  VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_descriptor_update_template spec_version 1 */
+    { 220,   4, VKAD_EXTENSION(KHR_create_renderpass2),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_create_renderpass2 spec_version 1 */
+    { 224,   1, VKAD_EXTENSION(KHR_shared_presentable_image),                    VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_shared_presentable_image spec_version 1 */
+    { 225,   2, VKAD_EXTENSION(KHR_external_fence_fd),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_external_fence_fd spec_version 1 */
+    { 227,   2, VKAD_EXTENSION(KHR_performance_query),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_performance_query spec_version 1 */
+    { 229,   3, VKAD_EXTENSION(KHR_get_memory_requirements2),                    VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_get_memory_requirements2 spec_version 1 */
+    { 232,   2, VKAD_EXTENSION(KHR_sampler_ycbcr_conversion),                    VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_sampler_ycbcr_conversion spec_version 14 */
+    { 234,   2, VKAD_EXTENSION(KHR_bind_memory2),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_bind_memory2 spec_version 1 */
+    { 236,   1, VKAD_EXTENSION(KHR_maintenance3),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_maintenance3 spec_version 1 */
+    { 237,   2, VKAD_EXTENSION(KHR_draw_indirect_count),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_draw_indirect_count spec_version 1 */
+    { 239,   3, VKAD_EXTENSION(KHR_timeline_semaphore),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_timeline_semaphore spec_version 2 */
+    { 242,   1, VKAD_EXTENSION(KHR_fragment_shading_rate),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_fragment_shading_rate spec_version 2 */
+    { 243,   2, VKAD_EXTENSION(KHR_dynamic_rendering_local_read),                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_dynamic_rendering_local_read spec_version 1 */
+    { 245,   1, VKAD_EXTENSION(KHR_present_wait),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_present_wait spec_version 1 */
+    { 246,   3, VKAD_EXTENSION(KHR_buffer_device_address),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_buffer_device_address spec_version 1 */
+    { 249,   5, VKAD_EXTENSION(KHR_deferred_host_operations),                    VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_deferred_host_operations spec_version 4 */
+    { 254,   3, VKAD_EXTENSION(KHR_pipeline_executable_properties),              VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_pipeline_executable_properties spec_version 1 */
+    { 257,   2, VKAD_EXTENSION(KHR_map_memory2),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_map_memory2 spec_version 1 */
+    { 259,   2, VKAD_EXTENSION(KHR_video_encode_queue),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_video_encode_queue spec_version 12 */
+    { 261,   6, VKAD_EXTENSION(KHR_synchronization2),                            VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_synchronization2 spec_version 1 */
+    { 267,   1, VKAD_EXTENSION(AMD_buffer_marker),                               VKAD_NO_EXTENSION,                             VKAD_EXTENSION(KHR_synchronization2), 0,                                 VK_API_VERSION_1_3 },  /* VK_AMD_buffer_marker, kept in the VK_KHR_synchronization2 block for the memory layout */
+    { 268,   1, VKAD_EXTENSION(NV_device_diagnostic_checkpoints),                VKAD_NO_EXTENSION,                             VKAD_EXTENSION(KHR_synchronization2), 0,                                 VK_API_VERSION_1_3 },  /* VK_NV_device_diagnostic_checkpoints, kept in the VK_KHR_synchronization2 block for the memory layout */
+    { 269,   6, VKAD_EXTENSION(KHR_copy_commands2),                              VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_copy_commands2 spec_version 1 */
+    { 275,   1, VKAD_EXTENSION(KHR_ray_tracing_maintenance1),                    VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_ray_tracing_maintenance1 spec_version 1 */
+    { 276,   3, VKAD_EXTENSION(KHR_maintenance4),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_maintenance4 spec_version 2 */
+    { 279,   4, VKAD_EXTENSION(KHR_maintenance5),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_maintenance5 spec_version 1 */
+    { 283,   1, VKAD_EXTENSION(KHR_line_rasterization),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_line_rasterization spec_version 1 */
+    { 284,   1, VKAD_EXTENSION(KHR_calibrated_timestamps),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_calibrated_timestamps spec_version 1 */
+    { 285,   6, VKAD_EXTENSION(KHR_maintenance6),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_maintenance6 spec_version 1 */
+    { 291,   5, VKAD_EXTENSION(EXT_debug_marker),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_debug_marker spec_version 4 */
+    { 296,   6, VKAD_EXTENSION(EXT_transform_feedback),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_transform_feedback spec_version 1 */
+    { 302,   5, VKAD_EXTENSION(NVX_binary_import),                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NVX_binary_import spec_version 2 */
+    { 307,   2, VKAD_EXTENSION(NVX_image_view_handle),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NVX_image_view_handle spec_version 3 */
+    { 309,   2, VKAD_EXTENSION(AMD_draw_indirect_count),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_AMD_draw_indirect_count spec_version 2 */
+    { 311,   1, VKAD_EXTENSION(AMD_shader_info),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_AMD_shader_info spec_version 1 */
+    { 312,   2, VKAD_EXTENSION(EXT_conditional_rendering),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_conditional_rendering spec_version 2 */
+    { 314,   1, VKAD_EXTENSION(NV_clip_space_w_scaling),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_clip_space_w_scaling spec_version 1 */
+    { 315,   4, VKAD_EXTENSION(EXT_display_control),                             VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_display_control spec_version 1 */
+    { 319,   2, VKAD_EXTENSION(GOOGLE_display_timing),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_GOOGLE_display_timing spec_version 1 */
+    { 321,   3, VKAD_EXTENSION(EXT_discard_rectangles),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_discard_rectangles spec_version 2 */
+    { 324,   1, VKAD_EXTENSION(EXT_hdr_metadata),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_hdr_metadata spec_version 3 */
+    { 325,   8, VKAD_EXTENSION(EXT_debug_utils),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_INSTANCE_EXTENSION_BIT, 0                  },  /* VK_EXT_debug_utils spec_version 2 */
+    { 333,   1, VKAD_EXTENSION(EXT_sample_locations),                            VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_sample_locations spec_version 1 */
+    { 334,   1, VKAD_EXTENSION(EXT_image_drm_format_modifier),                   VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_image_drm_format_modifier spec_version 2 */
+    { 335,   4, VKAD_EXTENSION(EXT_validation_cache),                            VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_validation_cache spec_version 1 */
+    { 339,   3, VKAD_EXTENSION(NV_shading_rate_image),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_shading_rate_image spec_version 3 */
+    { 342,  13, VKAD_EXTENSION(NV_ray_tracing),                                  VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_ray_tracing spec_version 3 */
+    { 355,   1, VKAD_EXTENSION(EXT_external_memory_host),                        VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_external_memory_host spec_version 1 */
+    { 356,   1, VKAD_EXTENSION(AMD_buffer_marker),                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_AMD_buffer_marker spec_version 1 */
+    { 357,   1, VKAD_EXTENSION(EXT_calibrated_timestamps),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_calibrated_timestamps spec_version 2 */
+    { 358,   3, VKAD_EXTENSION(NV_mesh_shader),                                  VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_mesh_shader spec_version 1 */
+    { 361,   2, VKAD_EXTENSION(NV_scissor_exclusive),                            VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_scissor_exclusive spec_version 2 */
+    { 363,   2, VKAD_EXTENSION(NV_device_diagnostic_checkpoints),                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_device_diagnostic_checkpoints spec_version 2 */
+    { 365,   9, VKAD_EXTENSION(INTEL_performance_query),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_INTEL_performance_query spec_version 2 */
+    { 374,   1, VKAD_EXTENSION(AMD_display_native_hdr),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_AMD_display_native_hdr spec_version 1 */
+    { 375,   1, VKAD_EXTENSION(EXT_buffer_device_address),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_buffer_device_address spec_version 2 */
+    { 376,   1, VKAD_EXTENSION(EXT_line_rasterization),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_line_rasterization spec_version 1 */
+    { 377,   1, VKAD_EXTENSION(EXT_host_query_reset),                            VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_host_query_reset spec_version 1 */
+    { 378,  12, VKAD_EXTENSION(EXT_extended_dynamic_state),                      VKAD_EXTENSION(EXT_shader_object),             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_extended_dynamic_state spec_version 1 */
+    { 390,   5, VKAD_EXTENSION(EXT_host_image_copy),                             VKAD_EXTENSION(EXT_image_compression_control), VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_host_image_copy spec_version 1 */
+    { 395,   1, VKAD_EXTENSION(EXT_swapchain_maintenance1),                      VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_swapchain_maintenance1 spec_version 1 */
+    { 396,   6, VKAD_EXTENSION(NV_device_generated_commands),                    VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_device_generated_commands spec_version 3 */
+    { 402,   1, VKAD_EXTENSION(EXT_depth_bias_control),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_depth_bias_control spec_version 1 */
+    { 403,   4, VKAD_EXTENSION(EXT_private_data),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_private_data spec_version 1 */
+    { 407,   6, VKAD_EXTENSION(NV_cuda_kernel_launch),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_cuda_kernel_launch spec_version 2 */
+    { 413,  11, VKAD_EXTENSION(EXT_descriptor_buffer),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_descriptor_buffer spec_version 1 */
+    { 424,   1, VKAD_EXTENSION(NV_fragment_shading_rate_enums),                  VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_fragment_shading_rate_enums spec_version 1 */
+    { 425,   1, VKAD_EXTENSION(EXT_device_fault),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_device_fault spec_version 2 */
+    { 426,   1, VKAD_EXTENSION(EXT_vertex_input_dynamic_state),                  VKAD_EXTENSION(EXT_shader_object),             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_vertex_input_dynamic_state spec_version 2 */
+    { 427,   2, VKAD_EXTENSION(HUAWEI_subpass_shading),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_HUAWEI_subpass_shading spec_version 3 */
+    { 429,   1, VKAD_EXTENSION(HUAWEI_invocation_mask),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_HUAWEI_invocation_mask spec_version 1 */
+    { 430,   1, VKAD_EXTENSION(NV_external_memory_rdma),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_external_memory_rdma spec_version 1 */
+    { 431,   1, VKAD_EXTENSION(EXT_pipeline_properties),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_pipeline_properties spec_version 1 */
+    { 432,   5, VKAD_EXTENSION(EXT_extended_dynamic_state2),                     VKAD_EXTENSION(EXT_shader_object),             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_extended_dynamic_state2 spec_version 1 */
+    { 437,   1, VKAD_EXTENSION(EXT_color_write_enable),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_color_write_enable spec_version 1 */
+    { 438,   2, VKAD_EXTENSION(EXT_multi_draw),                                  VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_multi_draw spec_version 1 */
+    { 440,  14, VKAD_EXTENSION(EXT_opacity_micromap),                            VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_opacity_micromap spec_version 2 */
+    { 454,   2, VKAD_EXTENSION(HUAWEI_cluster_culling_shader),                   VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_HUAWEI_cluster_culling_shader spec_version 3 */
+    { 456,   1, VKAD_EXTENSION(EXT_pageable_device_local_memory),                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_pageable_device_local_memory spec_version 1 */
+    { 457,   2, VKAD_EXTENSION(VALVE_descriptor_set_host_mapping),               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_VALVE_descriptor_set_host_mapping spec_version 1 */
+    { 459,   2, VKAD_EXTENSION(NV_copy_memory_indirect),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_copy_memory_indirect spec_version 1 */
+    { 461,   2, VKAD_EXTENSION(NV_memory_decompression),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_memory_decompression spec_version 1 */
+    { 463,   3, VKAD_EXTENSION(NV_device_generated_commands_compute),            VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_device_generated_commands_compute spec_version 2 */
+    { 466,  31, VKAD_EXTENSION(EXT_extended_dynamic_state3),                     VKAD_EXTENSION(EXT_shader_object),             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_extended_dynamic_state3 spec_version 2 */
+    { 497,   2, VKAD_EXTENSION(EXT_shader_module_identifier),                    VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_shader_module_identifier spec_version 1 */
+    { 499,   4, VKAD_EXTENSION(NV_optical_flow),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_optical_flow spec_version 1 */
+    { 503,   4, VKAD_EXTENSION(EXT_shader_object),                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_shader_object spec_version 1 */
+    { 507,   2, VKAD_EXTENSION(QCOM_tile_properties),                            VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_QCOM_tile_properties spec_version 1 */
+    { 509,   5, VKAD_EXTENSION(NV_low_latency2),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_low_latency2 spec_version 2 */
+    { 514,   1, VKAD_EXTENSION(EXT_attachment_feedback_loop_dynamic_state),      VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_attachment_feedback_loop_dynamic_state spec_version 1 */
+    { 515,  16, VKAD_EXTENSION(KHR_acceleration_structure),                      VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_acceleration_structure spec_version 13 */
+    { 531,   6, VKAD_EXTENSION(KHR_ray_tracing_pipeline),                        VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_ray_tracing_pipeline spec_version 1 */
+    { 537,   3, VKAD_EXTENSION(EXT_mesh_shader),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_mesh_shader spec_version 1 */
+    { 540,   2, VKAD_EXTENSION(ANDROID_external_memory_android_hardware_buffer), VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_ANDROID_external_memory_android_hardware_buffer spec_version 5 */
+    { 542,   2, VKAD_EXTENSION(FUCHSIA_external_memory),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_FUCHSIA_external_memory spec_version 1 */
+    { 544,   2, VKAD_EXTENSION(FUCHSIA_external_semaphore),                      VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_FUCHSIA_external_semaphore spec_version 1 */
+    { 546,   5, VKAD_EXTENSION(FUCHSIA_buffer_collection),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_FUCHSIA_buffer_collection spec_version 2 */
+    { 551,   1, VKAD_EXTENSION(EXT_metal_objects),                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_metal_objects spec_version 2 */
+    { 552,   2, VKAD_EXTENSION(KHR_external_memory_win32),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_external_memory_win32 spec_version 1 */
+    { 554,   2, VKAD_EXTENSION(KHR_external_semaphore_win32),                    VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_external_semaphore_win32 spec_version 1 */
+    { 556,   2, VKAD_EXTENSION(KHR_external_fence_win32),                        VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_external_fence_win32 spec_version 1 */
+    { 558,   1, VKAD_EXTENSION(NV_external_memory_win32),                        VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_external_memory_win32 spec_version 1 */
+    { 559,   3, VKAD_EXTENSION(EXT_full_screen_exclusive),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_full_screen_exclusive spec_version 4 */
+    { 562,   1, VKAD_EXTENSION(QNX_external_memory_screen_buffer),               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_QNX_external_memory_screen_buffer spec_version 1 */
+    { 563,   7, VKAD_EXTENSION(AMDX_shader_enqueue),                             VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_AMDX_shader_enqueue spec_version 2 */
+    { 570,   1, VKAD_EXTENSION(NVX_image_view_handle),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* to VK_NVX_image_view_handle spec_version 3 */
+    /* provided by VK_EXT_depth_clamp_control, which VK_EXT_shader_object depends on for it: */
+    { 571,   1, VKAD_EXTENSION(EXT_depth_clamp_control),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* to VK_EXT_shader_object spec_version 1 */
+    { 572,  19, VKAD_NO_EXTENSION,                                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 VK_API_VERSION_1_4 },  /* VK_VERSION_1_4 */
+    { 591,   5, VKAD_EXTENSION(KHR_pipeline_binary),                             VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_pipeline_binary spec_version 1 */
+    { 596,   1, VKAD_EXTENSION(AMD_anti_lag),                                    VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_AMD_anti_lag spec_version 1 */
+    { 597,   2, VKAD_EXTENSION(NV_cooperative_vector),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_cooperative_vector spec_version 4 */
+    { 599,   2, VKAD_EXTENSION(NV_cluster_acceleration_structure),               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_cluster_acceleration_structure spec_version 2 */
+    { 601,   2, VKAD_EXTENSION(NV_partitioned_acceleration_structure),           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_partitioned_acceleration_structure spec_version 1 */
+    { 603,   9, VKAD_EXTENSION(EXT_device_generated_commands),                   VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_device_generated_commands spec_version 1 */
+    { 612,   2, VKAD_EXTENSION(EXT_external_memory_metal),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_external_memory_metal spec_version 1 */
+};
+/* the groups of the instance entries, for vkadLoadInstanceFunctionsFiltered */
+static const VkadFunctionGroup vkadInstanceFunctionGroups[] = {
+    {   0,  13, VKAD_NO_EXTENSION,                                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_VERSION_1_0 */
+    {  13,  11, VKAD_NO_EXTENSION,                                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 VK_API_VERSION_1_1 },  /* VK_VERSION_1_1 */
+    {  24,   1, VKAD_NO_EXTENSION,                                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 VK_API_VERSION_1_3 },  /* VK_VERSION_1_3 */
+    {  25,   5, VKAD_EXTENSION(KHR_surface),                                     VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_surface spec_version 25  */
+    {  30,   1, VKAD_EXTENSION(KHR_swapchain),                                   VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_KHR_swapchain spec_version 70  */
+    {  31,   7, VKAD_EXTENSION(KHR_display),                                     VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_display spec_version 23  */
+    {  38,   2, VKAD_EXTENSION(KHR_video_queue),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_KHR_video_queue spec_version 8 */
+    {  40,   7, VKAD_EXTENSION(KHR_get_physical_device_properties2),             VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_get_physical_device_properties2 spec_version 2 */
+    {  47,   1, VKAD_EXTENSION(KHR_device_group_creation),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_device_group_creation spec_version 1 */
+    {  48,   1, VKAD_EXTENSION(KHR_external_memory_capabilities),                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_external_memory_capabilities spec_version 1 */
+    {  49,   1, VKAD_EXTENSION(KHR_external_semaphore_capabilities),             VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_external_semaphore_capabilities spec_version 1 */
+    {  50,   1, VKAD_EXTENSION(KHR_external_fence_capabilities),                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_external_fence_capabilities spec_version 1 */
+    {  51,   2, VKAD_EXTENSION(KHR_performance_query),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_KHR_performance_query spec_version 1 */
+    {  53,   2, VKAD_EXTENSION(KHR_get_surface_capabilities2),                   VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_get_surface_capabilities2 spec_version 1 */
+    {  55,   4, VKAD_EXTENSION(KHR_get_display_properties2),                     VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_get_display_properties2 spec_version 1 */
+    {  59,   1, VKAD_EXTENSION(KHR_fragment_shading_rate),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_KHR_fragment_shading_rate spec_version 2 */
+    {  60,   1, VKAD_EXTENSION(KHR_video_encode_queue),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_KHR_video_encode_queue spec_version 12 */
+    {  61,   1, VKAD_EXTENSION(KHR_cooperative_matrix),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_KHR_cooperative_matrix spec_version 2 */
+    {  62,   1, VKAD_EXTENSION(KHR_calibrated_timestamps),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_KHR_calibrated_timestamps spec_version 1 */
+    {  63,   3, VKAD_EXTENSION(EXT_debug_report),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_debug_report spec_version 10 */
+    {  66,   1, VKAD_EXTENSION(NV_external_memory_capabilities),                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NV_external_memory_capabilities spec_version 1 */
+    {  67,   1, VKAD_EXTENSION(EXT_direct_mode_display),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_direct_mode_display spec_version 1 */
+    {  68,   1, VKAD_EXTENSION(EXT_display_surface_counter),                     VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_display_surface_counter spec_version 1 */
+    {  69,   3, VKAD_EXTENSION(EXT_debug_utils),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_debug_utils spec_version 2 */
+    {  72,   1, VKAD_EXTENSION(EXT_sample_locations),                            VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_EXT_sample_locations spec_version 1 */
+    {  73,   1, VKAD_EXTENSION(EXT_calibrated_timestamps),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_EXT_calibrated_timestamps spec_version 2 */
+    {  74,   1, VKAD_EXTENSION(EXT_tooling_info),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_EXT_tooling_info spec_version 1 */
+    {  75,   1, VKAD_EXTENSION(NV_cooperative_matrix),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_NV_cooperative_matrix spec_version 1 */
+    {  76,   1, VKAD_EXTENSION(NV_coverage_reduction_mode),                      VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_NV_coverage_reduction_mode spec_version 1 */
+    {  77,   1, VKAD_EXTENSION(EXT_headless_surface),                            VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_headless_surface spec_version 1 */
+    {  78,   2, VKAD_EXTENSION(EXT_acquire_drm_display),                         VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_acquire_drm_display spec_version 1 */
+    {  80,   1, VKAD_EXTENSION(NV_optical_flow),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_NV_optical_flow spec_version 1 */
+    {  81,   1, VKAD_EXTENSION(KHR_android_surface),                             VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_android_surface spec_version 6 */
+    {  82,   1, VKAD_EXTENSION(FUCHSIA_imagepipe_surface),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_FUCHSIA_imagepipe_surface spec_version 1 */
+    {  83,   1, VKAD_EXTENSION(MVK_ios_surface),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_MVK_ios_surface spec_version 3 */
+    {  84,   1, VKAD_EXTENSION(MVK_macos_surface),                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_MVK_macos_surface spec_version 3 */
+    {  85,   1, VKAD_EXTENSION(EXT_metal_surface),                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_metal_surface spec_version 1 */
+    {  86,   1, VKAD_EXTENSION(NN_vi_surface),                                   VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_NN_vi_surface spec_version 1 */
+    {  87,   2, VKAD_EXTENSION(KHR_wayland_surface),                             VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_wayland_surface spec_version 6 */
+    {  89,   2, VKAD_EXTENSION(KHR_win32_surface),                               VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_win32_surface spec_version 6 */
+    {  91,   1, VKAD_EXTENSION(EXT_full_screen_exclusive),                       VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_EXT_full_screen_exclusive spec_version 4 */
+    {  92,   2, VKAD_EXTENSION(NV_acquire_winrt_display),                        VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_NV_acquire_winrt_display spec_version 1 */
+    {  94,   2, VKAD_EXTENSION(KHR_xcb_surface),                                 VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_xcb_surface spec_version 6 */
+    {  96,   2, VKAD_EXTENSION(KHR_xlib_surface),                                VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_KHR_xlib_surface spec_version 6 */
+    {  98,   2, VKAD_EXTENSION(EXT_directfb_surface),                            VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_directfb_surface spec_version 1 */
+    { 100,   2, VKAD_EXTENSION(EXT_acquire_xlib_display),                        VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_EXT_acquire_xlib_display spec_version 1 */
+    { 102,   1, VKAD_EXTENSION(GGP_stream_descriptor_surface),                   VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_GGP_stream_descriptor_surface spec_version 1 */
+    { 103,   2, VKAD_EXTENSION(QNX_screen_surface),                              VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    0,                                 0                  },  /* VK_QNX_screen_surface spec_version 1 */
+    { 105,   1, VKAD_EXTENSION(NV_cooperative_vector),                           VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_NV_cooperative_vector spec_version 4 */
+    { 106,   1, VKAD_EXTENSION(NV_cooperative_matrix2),                          VKAD_NO_EXTENSION,                             VKAD_NO_EXTENSION,                    VKAD_GROUP_DEVICE_EXTENSION_BIT,   0                  },  /* VK_NV_cooperative_matrix2 spec_version 1 */
+};
+typedef char VkadGlobalFunctionCountCheck       [(sizeof(vkadGlobalFunctionEntries)   / sizeof(VkadFunctionEntry) == VKAD_GLOBAL_FUNCTION_COUNT)         ? 1 : -1];
+typedef char VkadInstanceFunctionIdCheck        [(sizeof(vkadInstanceFunctionEntries) / sizeof(VkadFunctionEntry) == VKAD_INSTANCE_FUNCTION_COUNT)       ? 1 : -1];
+typedef char VkadDeviceFunctionIdCheck          [(sizeof(vkadDeviceFunctionEntries)   / sizeof(VkadFunctionEntry) == VKAD_DEVICE_FUNCTION_COUNT)         ? 1 : -1];
+typedef char VkadInstanceFunctionGroupCountCheck[(sizeof(vkadInstanceFunctionGroups)  / sizeof(VkadFunctionGroup) == VKAD_INSTANCE_FUNCTION_GROUP_COUNT) ? 1 : -1];
+typedef char VkadDeviceFunctionGroupCountCheck  [(sizeof(vkadDeviceFunctionGroups)    / sizeof(VkadFunctionGroup) == VKAD_DEVICE_FUNCTION_GROUP_COUNT)   ? 1 : -1];
+
+/* writes "vk" and the name of the entry to name, which has to hold VKAD_MAX_FUNCTION_NAME_SIZE characters */
+static const char* vkadFunctionEntryName(const VkadFunctionEntry* entry, char* name) {
+    name[0] = 'v';
+    name[1] = 'k';
+    strcpy(name + 2, REINTERPRET_CAST(const char*, &vkadFunctionNames) + entry->nameOffset);
+    return name;
+}
+static void vkadStoreFunction(void* functions, const VkadFunctionEntry* entry, PFN_vkVoidFunction function) {
+    if (entry->memberOffset == VKAD_NO_MEMBER) return;
+    memcpy(REINTERPRET_CAST(char*, functions) + entry->memberOffset, &function, sizeof(PFN_vkVoidFunction));
+}
+/* a timestamp for the statistics: monotonic where POSIX declares it, otherwise from clock(), which measures processor time on some platforms */
+static uint64_t vkadNanoseconds(void) {
+#ifdef CLOCK_MONOTONIC
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t) time.tv_sec * UINT64_C(1000000000) + (uint64_t) time.tv_nsec;
+#else
+    return (uint64_t) clock() * (UINT64_C(1000000000) / CLOCKS_PER_SEC);
+#endif
+}
+static int vkadExtensionNameEnabled(uint32_t enabledExtensionCount, const char* const* ppEnabledExtensionNames, uint16_t extension) {
+    const char* extensionName = REINTERPRET_CAST(const char*, &vkadExtensionNames) + extension;
+    uint32_t i;
+    if (extension == VKAD_NO_EXTENSION) return 0;
+    for (i = 0; i < enabledExtensionCount; ++i) {
+        if (strcmp(ppEnabledExtensionNames[i], extensionName) == 0) return 1;
+    }
+    return 0;
+}
+/* the version is the one requested in pApplicationInfo, which is 1.0 if it is missing or zero; device extensions are decided by vkadCheckPhysicalDeviceFunctions */
+static int vkadInstanceFunctionGroupEnabled(const VkadFunctionGroup* group, const VkInstanceCreateInfo* createInfo) {
+    uint32_t apiVersion = VK_API_VERSION_1_0;
+    if (createInfo->pApplicationInfo != NULL && createInfo->pApplicationInfo->apiVersion != 0) apiVersion = createInfo->pApplicationInfo->apiVersion;
+    if (group->extension == VKAD_NO_EXTENSION) return apiVersion >= group->apiVersion;
+    if (group->flags & VKAD_GROUP_DEVICE_EXTENSION_BIT) return 1;
+    return vkadExtensionNameEnabled(createInfo->enabledExtensionCount, createInfo->ppEnabledExtensionNames, group->extension);
+}
+static int vkadDeviceFunctionGroupEnabled(const VkadFunctionGroup* group, const VkDeviceCreateInfo* createInfo, uint32_t apiVersion) {
+    uint32_t count = createInfo->enabledExtensionCount;
+    const char* const* names = createInfo->ppEnabledExtensionNames;
+    if (group->extension == VKAD_NO_EXTENSION) return apiVersion >= group->apiVersion;
+    if (group->flags & VKAD_GROUP_INSTANCE_EXTENSION_BIT) return 1;
+    if (!vkadExtensionNameEnabled(count, names, group->extension) && !vkadExtensionNameEnabled(count, names, group->alternative)) return 0;
+    if (group->dependency != VKAD_NO_EXTENSION) return vkadExtensionNameEnabled(count, names, group->dependency) || apiVersion >= group->apiVersion;
+    return 1;
+}
+
+#endif /* VKAD_HAS_DEFINITIONS */
+
+/* stubs for functions that could not be loaded: commands returning VkResult report VK_ERROR_EXTENSION_NOT_PRESENT, the others (the void commands and the handful in the value lists below) return zero.
+   A stub is called through the function pointer type of the member it is stored in; its parameters are ignored, which only works with calling conventions where the caller cleans up the stack,
+   so they are not available on 32-bit Windows, where VKAPI_CALL is __stdcall. */
+#if defined(_WIN32) && !defined(_WIN64)
+#define VKAD_HAS_UNSUPPORTED_STUBS 0
+#else
+#define VKAD_HAS_UNSUPPORTED_STUBS 1
+#endif
+#if VKAD_HAS_DEFINITIONS
+#if VKAD_HAS_UNSUPPORTED_STUBS
+static VKAPI_ATTR VkResult VKAPI_CALL vkadUnsupportedFunction(void) {
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+static VKAPI_ATTR uint64_t VKAPI_CALL vkadUnsupportedValueFunction(void) {
+    return 0;
+}
+#endif
+/* the functions which neither return VkResult nor void, by ID, since the members of left out extensions do not exist */
+static const uint16_t vkadInstanceValueFunctions[] = {
+    VKAD_INSTANCE_FUNCTION_ID_GetDeviceProcAddr,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceWaylandPresentationSupportKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceWin32PresentationSupportKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceXcbPresentationSupportKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceXlibPresentationSupportKHR,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceDirectFBPresentationSupportEXT,
+    VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceScreenPresentationSupportQNX,
+};
+static const uint16_t vkadDeviceValueFunctions[] = {
+    VKAD_DEVICE_FUNCTION_ID_GetBufferDeviceAddress,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferOpaqueCaptureAddress,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceMemoryOpaqueCaptureAddress,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferDeviceAddressKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferOpaqueCaptureAddressKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetDeviceMemoryOpaqueCaptureAddressKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetDeferredOperationMaxConcurrencyKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetImageViewHandleNVX,
+    VKAD_DEVICE_FUNCTION_ID_GetBufferDeviceAddressEXT,
+    VKAD_DEVICE_FUNCTION_ID_GetPipelineIndirectDeviceAddressNV,
+    VKAD_DEVICE_FUNCTION_ID_GetAccelerationStructureDeviceAddressKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetRayTracingShaderGroupStackSizeKHR,
+    VKAD_DEVICE_FUNCTION_ID_GetImageViewHandle64NVX,
+};
+/* returns the stub fitting the entry, or NULL where there are no stubs */
+static PFN_vkVoidFunction vkadUnsupportedStub(uint32_t id, const uint16_t* valueFunctions, size_t valueFunctionCount) {
+#if VKAD_HAS_UNSUPPORTED_STUBS
+    size_t i;
+    for (i = 0; i < valueFunctionCount; ++i) {
+        if (valueFunctions[i] == id) return REINTERPRET_CAST(PFN_vkVoidFunction, vkadUnsupportedValueFunction);
+    }
+    return REINTERPRET_CAST(PFN_vkVoidFunction, vkadUnsupportedFunction);
+#else
+    (void) id;
+    (void) valueFunctions;
+    (void) valueFunctionCount;
+    return NULL;
+#endif
+}
+#endif /* VKAD_HAS_DEFINITIONS */
+
+/* options of the extended load functions */
+#define VKAD_LOAD_UNSUPPORTED_STUBS_BIT 0x00000001
+#define VKAD_LOAD_FOLD_ALIASES_BIT      0x00000002
+
+/* which members were really loaded, one bit per function ID */
+typedef struct VkadInstanceFunctionSet {
+    uint32_t bits[(VKAD_INSTANCE_FUNCTION_ID_COUNT + 31) / 32];
+} VkadInstanceFunctionSet;
+typedef struct VkadDeviceFunctionSet {
+    uint32_t bits[(VKAD_DEVICE_FUNCTION_ID_COUNT + 31) / 32];
+} VkadDeviceFunctionSet;
+
+/* what a load function did and where its time went; filled by the load functions with a load info, not by vkadLoadGlobalFunctions or the lazy loaders */
+#define VKAD_SLOWEST_LOOKUP_COUNT 8
+typedef struct VkadSlowLookup {
+    uint32_t                    id;                 /* VkadInstanceFunctionId or VkadDeviceFunctionId */
+    uint64_t                    nanoseconds;
+} VkadSlowLookup;
+typedef struct VkadLoadStats {
+    uint32_t                    lookupCount;        /* calls of the loader */
+    uint32_t                    resolvedCount;      /* lookups that returned a function */
+    uint32_t                    nullCount;          /* lookups that returned NULL */
+    uint32_t                    skippedCount;       /* members that were not looked up, since they were filtered out or left out by the profile */
+    uint64_t                    nanoseconds;        /* the whole load function */
+    uint64_t                    loaderNanoseconds;  /* the calls of the loader */
+    uint64_t                    groupNanoseconds[VKAD_DEVICE_FUNCTION_GROUP_COUNT]; /* the calls of the loader by group, only for device functions */
+    VkadSlowLookup              slowest[VKAD_SLOWEST_LOOKUP_COUNT];                 /* the slowest lookups, slowest first; unused ones have 0 nanoseconds */
+} VkadLoadStats;
+
+typedef struct VkadInstanceLoadInfo {
+    uint32_t                    flags;              /* VKAD_LOAD_*_BIT */
+    VkadInstanceFunctionSet*    pAvailable;         /* optional */
+    const VkadInstanceFunctionSet* pSelection;      /* optional, only these functions are loaded */
+    VkadLoadStats*              pStats;             /* optional */
+    const VkInstanceCreateInfo* pCreateInfo;        /* optional, only the functions of the enabled version and extensions are loaded */
+} VkadInstanceLoadInfo;
+typedef struct VkadDeviceLoadInfo {
+    const VkDeviceCreateInfo*   pCreateInfo;        /* NULL loads all functions */
+    uint32_t                    apiVersion;         /* ignored without pCreateInfo */
+    uint32_t                    flags;              /* VKAD_LOAD_*_BIT */
+    VkadDeviceFunctionSet*      pAvailable;         /* optional */
+    const VkadDeviceFunctionSet* pSelection;        /* optional, only these functions are loaded */
+    VkadLoadStats*              pStats;             /* optional */
+} VkadDeviceLoadInfo;
+
+/* the functions are defined below, or with VKAD_SPLIT_IMPLEMENTATION in the file that defines VKAD_IMPLEMENTATION */
+VKAD_API int                vkadInstanceFunctionAvailable    (const VkadInstanceFunctionSet* available, VkadInstanceFunctionId id);
+VKAD_API int                vkadDeviceFunctionAvailable      (const VkadDeviceFunctionSet* available, VkadDeviceFunctionId id);
+VKAD_API PFN_vkVoidFunction vkadGetInstanceFunction          (const VkadInstanceFunctions* functions, VkadInstanceFunctionId id);
+VKAD_API PFN_vkVoidFunction vkadGetDeviceFunction            (const VkadDeviceFunctions* functions, VkadDeviceFunctionId id);
+VKAD_API int                vkadFindInstanceFunctionId       (const char* name, VkadInstanceFunctionId* id);
+VKAD_API int                vkadFindDeviceFunctionId         (const char* name, VkadDeviceFunctionId* id);
+VKAD_API int                vkadFindInstanceFunctionIdByOffset(size_t offset, VkadInstanceFunctionId* id);
+VKAD_API int                vkadFindDeviceFunctionIdByOffset (size_t offset, VkadDeviceFunctionId* id);
+VKAD_API PFN_vkVoidFunction vkadFindInstanceFunction         (const VkadInstanceFunctions* functions, const char* name);
+VKAD_API PFN_vkVoidFunction vkadFindDeviceFunction           (const VkadDeviceFunctions* functions, const char* name);
+VKAD_API const char*        vkadInstanceFunctionName         (VkadInstanceFunctionId id);
+VKAD_API const char*        vkadDeviceFunctionName           (VkadDeviceFunctionId id);
+VKAD_API void               vkadLoadGlobalFunctions          (PFN_vkGetInstanceProcAddr loader, VkadGlobalFunctions* functions);
+VKAD_API void               vkadLoadInstanceFunctionsEx      (PFN_vkGetInstanceProcAddr loader, VkInstance instance, const VkadInstanceLoadInfo* loadInfo, VkadInstanceFunctions* functions);
+VKAD_API void               vkadLoadInstanceFunctionsFiltered(PFN_vkGetInstanceProcAddr loader, VkInstance instance, const VkInstanceCreateInfo* createInfo, VkadInstanceFunctions* functions);
+VKAD_API void               vkadLoadInstanceFunctions        (PFN_vkGetInstanceProcAddr loader, VkInstance instance, VkadInstanceFunctions* functions);
+VKAD_API void               vkadCheckPhysicalDeviceFunctions (const VkExtensionProperties* pProperties, uint32_t propertyCount, VkadInstanceFunctionSet* available);
+VKAD_API void               vkadLoadDeviceFunctionsEx        (PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkadDeviceLoadInfo* loadInfo, VkadDeviceFunctions* functions);
+VKAD_API const char*        vkadDeviceFunctionGroupName      (uint32_t group);
+VKAD_API void               vkadLoadDeviceFunctionsFiltered  (PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkDeviceCreateInfo* createInfo, uint32_t apiVersion, VkadDeviceFunctions* functions);
+VKAD_API void               vkadLoadDeviceFunctions          (PFN_vkGetDeviceProcAddr loader, VkDevice device, VkadDeviceFunctions* functions);
+
+#if VKAD_HAS_DEFINITIONS
+
+static void vkadAddToFunctionSet(uint32_t* bits, uint32_t entry) {
+    bits[entry / 32] |= UINT32_C(1) << (entry % 32);
+}
+VKAD_API int vkadInstanceFunctionAvailable(const VkadInstanceFunctionSet* available, VkadInstanceFunctionId id) {
+    return (available->bits[id / 32] >> (id % 32)) & 1;
+}
+VKAD_API int vkadDeviceFunctionAvailable(const VkadDeviceFunctionSet* available, VkadDeviceFunctionId id) {
+    return (available->bits[id / 32] >> (id % 32)) & 1;
+}
+/* the member with the given ID, for code that does not know the member names */
+VKAD_API PFN_vkVoidFunction vkadGetInstanceFunction(const VkadInstanceFunctions* functions, VkadInstanceFunctionId id) {
+    PFN_vkVoidFunction function;
+    if (vkadInstanceFunctionEntries[id].memberOffset == VKAD_NO_MEMBER) return NULL;
+    memcpy(&function, REINTERPRET_CAST(const char*, functions) + vkadInstanceFunctionEntries[id].memberOffset, sizeof(PFN_vkVoidFunction));
+    return function;
+}
+VKAD_API PFN_vkVoidFunction vkadGetDeviceFunction(const VkadDeviceFunctions* functions, VkadDeviceFunctionId id) {
+    PFN_vkVoidFunction function;
+    if (vkadDeviceFunctionEntries[id].memberOffset == VKAD_NO_MEMBER) return NULL;
+    memcpy(&function, REINTERPRET_CAST(const char*, functions) + vkadDeviceFunctionEntries[id].memberOffset, sizeof(PFN_vkVoidFunction));
+    return function;
+}
+
+/* perfect hash over the names of all entries, generated together with the tables: the hash of the name selects a bucket, and the seed of the bucket moves its names into distinct slots.
+   The slots hold the index over the global, instance and device entries in this order. */
+#define VKAD_FUNCTION_HASH_BUCKET_BITS 8
+#define VKAD_FUNCTION_HASH_SLOT_BITS   10
+#define VKAD_NO_FUNCTION 0xFFFF
+static const uint8_t vkadFunctionHashSeeds[1 << VKAD_FUNCTION_HASH_BUCKET_BITS] = {
+      5,   4,   2,   4,   1,   1,   6,   8,   6,   1,   3,   2,   1,   4,   2,   2,
+      1,   4,   2,   1,   1,   8,   1,  14,  17,   1,   1,   2,   5,   1,   9,   0,
+      0,   3,   1,   1,   2,   2,   1,  15,   1,   5,   1,   1,   0,   2,   9,   2,
+      2,   5,  34,   1,  33,   2,   3,   2,   1,   6,   2,   3,   2,  12,   2,   6,
+      7,   3,   3,   1,  25,   1,   2,  10,  11,   1,   1,   0,   4,   0,   7,   3,
+     10,   0,   2,   1,   1,   1,   3,   1,   2,   3,   5,  13,   5,   0,   2,   2,
+      4,   1,   1,   5,   6,   5,   2,   1,  13,   6,   1,  15,   3,   3,   6,   1,
+      4,   4,   1,   4,   4,   4,   2,   1,   1,   1,  12,   7,   1,  12,   3,   1,
+      5,   3,   5,   1,   2,   3,   1,   1,   3,   1,   6,   8,   0,   0,   5,   3,
+      3,   0,   8,   7,   4,   5,   1,   2,   2,   3,   0,  16,   2,   3,  19,   2,
+      8,   3,   1,   1,   3,   3,   2,   1,   1,   8,   1,   8,   5,   5,   2,   8,
+      4,   2,   2,   1,   9,   3,   5,   3,   5,   0,   3,   8,   5,   3,   4,   2,
+      1,  10,   6,   6,   1,   1,   6,  11,   8,   5,   8,   3,  38,   2,   3,  18,
+      2,   6,   6,   4,   2,  18,   1,   5,  12,   3,  12,   8,   1,   2,   1,   0,
+     19,  17,   4,   6,  19,   2,  10,   0,   2,   2,  71,   0,   4,  27,  10,   1,
+      2,   4,   2,  12,   2,   2,   1,  23,   2,   6,  19,   2,   5,   4,   7,   4,
+};
+static const uint16_t vkadFunctionHashSlots[1 << VKAD_FUNCTION_HASH_SLOT_BITS] = {
+    0x0031, 0xFFFF, 0xFFFF, 0xFFFF, 0x0263, 0x0060, 0x0140, 0x013D, 0x00B8, 0x00E0, 0xFFFF, 0x0223, 0x01CB, 0x0151, 0x01A6, 0x0116,
+    0xFFFF, 0x0057, 0x0174, 0x0209, 0x022C, 0x009E, 0x0121, 0x0112, 0x0126, 0x022A, 0xFFFF, 0x0270, 0xFFFF, 0xFFFF, 0xFFFF, 0x0061,
+    0x0133, 0xFFFF, 0xFFFF, 0x0291, 0xFFFF, 0xFFFF, 0x000A, 0x02C8, 0x02D0, 0x02B6, 0x0252, 0x00B0, 0x01FD, 0x01AD, 0x021C, 0x0271,
+    0x028E, 0x011A, 0x01DE, 0x0160, 0x0030, 0x0073, 0x00F0, 0x0222, 0x019F, 0x019E, 0x00FE, 0xFFFF, 0x0039, 0x0294, 0x0098, 0x022B,
+    0xFFFF, 0xFFFF, 0x02A2, 0xFFFF, 0x015B, 0x022D, 0xFFFF, 0x0172, 0x00A0, 0x016E, 0x0251, 0x0273, 0x01F1, 0x021D, 0xFFFF, 0x02AF,
+    0x0118, 0x00F4, 0xFFFF, 0xFFFF, 0x0012, 0x0231, 0xFFFF, 0x0026, 0x003C, 0x00C6, 0x02D2, 0x0171, 0x0111, 0x0186, 0xFFFF, 0x02C4,
+    0x0088, 0x00BA, 0x024F, 0x0289, 0x003F, 0x018C, 0xFFFF, 0x0064, 0x0085, 0x0032, 0x01D3, 0x01A8, 0x020D, 0x011F, 0x02BD, 0xFFFF,
+    0x00FF, 0xFFFF, 0x0290, 0x0023, 0x02D4, 0x003E, 0x0033, 0xFFFF, 0xFFFF, 0x025B, 0x0241, 0x0169, 0x0157, 0xFFFF, 0x0128, 0x01C1,
+    0xFFFF, 0xFFFF, 0x01E5, 0x0191, 0x01AA, 0x00AC, 0x0110, 0xFFFF, 0x00AF, 0x015A, 0x0149, 0x01E4, 0x0202, 0xFFFF, 0x0053, 0x014F,
+    0x0180, 0x01B1, 0xFFFF, 0x0260, 0xFFFF, 0x00A5, 0xFFFF, 0x014B, 0xFFFF, 0x01A1, 0x0035, 0xFFFF, 0x0107, 0x0095, 0x01D7, 0xFFFF,
+    0x01E9, 0x02AA, 0x00A8, 0x0179, 0x01DC, 0x007F, 0x0019, 0x0109, 0xFFFF, 0x016A, 0xFFFF, 0xFFFF, 0x0040, 0xFFFF, 0x0211, 0x0117,
+    0x0292, 0xFFFF, 0x0092, 0x012F, 0x00CF, 0x014E, 0xFFFF, 0xFFFF, 0xFFFF, 0x01E8, 0x01D2, 0x0114, 0x00BF, 0x0135, 0x02BC, 0x01B2,
+    0xFFFF, 0x018E, 0x02B1, 0x0148, 0x01B9, 0xFFFF, 0x01E1, 0xFFFF, 0x0278, 0x002B, 0x0134, 0x01C5, 0xFFFF, 0xFFFF, 0xFFFF, 0x0250,
+    0x00D6, 0x023F, 0x0295, 0x00D3, 0x023E, 0x00C2, 0x00CB, 0x01BA, 0x027E, 0x016D, 0xFFFF, 0x0008, 0xFFFF, 0x00A9, 0x008D, 0x0189,
+    0xFFFF, 0x02C0, 0x02AD, 0xFFFF, 0xFFFF, 0x00A2, 0x01CD, 0xFFFF, 0x0226, 0x0079, 0xFFFF, 0x00D2, 0xFFFF, 0x021E, 0x018D, 0x0049,
+    0x00D4, 0x0018, 0x0264, 0x02A1, 0x01B4, 0xFFFF, 0x023D, 0x01FA, 0x00D0, 0x027A, 0x0102, 0x01C0, 0x00B1, 0x02CC, 0x0021, 0xFFFF,
+    0xFFFF, 0x0078, 0x018B, 0x0276, 0x015E, 0xFFFF, 0x00EB, 0xFFFF, 0xFFFF, 0xFFFF, 0x02AE, 0x006B, 0xFFFF, 0x00CA, 0x008B, 0x02A0,
+    0x027B, 0x00D9, 0x0101, 0x001B, 0x006A, 0xFFFF, 0xFFFF, 0x0004, 0x02CD, 0x007B, 0x00A4, 0x01FB, 0x013C, 0xFFFF, 0x012E, 0x0069,
+    0x0181, 0x025D, 0xFFFF, 0x0203, 0x01A0, 0x009C, 0x00F9, 0x0067, 0xFFFF, 0xFFFF, 0x02B5, 0x01D0, 0xFFFF, 0x0100, 0x02A8, 0x0065,
+    0x001D, 0x0106, 0x028B, 0x007A, 0x017A, 0x00DA, 0x015C, 0x0165, 0x0005, 0xFFFF, 0x01B7, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F8, 0xFFFF,
+    0x009B, 0x001F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01C4, 0x016C, 0x01A9, 0x007D, 0x02B4, 0x0280, 0x0084, 0xFFFF, 0x0156, 0x0027,
+    0x0298, 0x01BD, 0x0129, 0x0147, 0x015D, 0x0255, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D, 0x01DF, 0x00FB, 0x02CB, 0x01F7, 0x000F, 0x022F,
+    0x00AB, 0xFFFF, 0x0192, 0x0136, 0xFFFF, 0xFFFF, 0x0206, 0x0003, 0x01CC, 0x0265, 0x0051, 0xFFFF, 0x018A, 0xFFFF, 0x01D6, 0xFFFF,
+    0x007C, 0x0063, 0xFFFF, 0x0238, 0x00B5, 0xFFFF, 0x02BF, 0x01E2, 0x026A, 0x00C8, 0x003D, 0xFFFF, 0x0272, 0x00B6, 0x0167, 0x01D1,
+    0x0281, 0x024E, 0xFFFF, 0x0047, 0x00FD, 0x0090, 0x00CC, 0x0237, 0x0077, 0xFFFF, 0x01B8, 0x01EA, 0x00AA, 0x0161, 0x001C, 0x0155,
+    0xFFFF, 0x02AB, 0xFFFF, 0x0166, 0x01D5, 0xFFFF, 0x00E7, 0x023A, 0xFFFF, 0x020C, 0x00E4, 0xFFFF, 0x028F, 0x0210, 0x000D, 0xFFFF,
+    0x029B, 0xFFFF, 0xFFFF, 0x022E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0036, 0xFFFF, 0xFFFF, 0x024C, 0x0184, 0xFFFF, 0xFFFF, 0xFFFF, 0x00EE,
+    0x0193, 0x0225, 0x0196, 0xFFFF, 0x00B3, 0x00C5, 0x02CE, 0xFFFF, 0xFFFF, 0x0055, 0xFFFF, 0x01EC, 0x0267, 0xFFFF, 0xFFFF, 0x023B,
+    0x0020, 0x02B7, 0xFFFF, 0x0144, 0xFFFF, 0xFFFF, 0x0113, 0xFFFF, 0x024B, 0x0083, 0x01C2, 0x018F, 0xFFFF, 0x0201, 0x0257, 0x0096,
+    0x0056, 0xFFFF, 0x00F2, 0x026B, 0xFFFF, 0x0266, 0x025C, 0xFFFF, 0xFFFF, 0x01A3, 0x01F8, 0x005A, 0x02C9, 0x02C1, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x0080, 0xFFFF, 0x0176, 0x00AD, 0x00F1, 0x01AC, 0x0122, 0x0059, 0x0002, 0x0001, 0x0218, 0xFFFF, 0xFFFF, 0x01EE, 0xFFFF,
+    0x0124, 0x00E3, 0x0007, 0xFFFF, 0x0197, 0x005E, 0xFFFF, 0x00A7, 0x01C7, 0xFFFF, 0x01BE, 0x0158, 0x01AB, 0x0286, 0xFFFF, 0xFFFF,
+    0x00BE, 0x02BE, 0x0153, 0xFFFF, 0xFFFF, 0x017C, 0x0142, 0xFFFF, 0x000B, 0x014C, 0x0014, 0x027D, 0xFFFF, 0x01E7, 0x0199, 0xFFFF,
+    0x0015, 0x01F9, 0xFFFF, 0x013E, 0x02CF, 0x00B4, 0x023C, 0x02BB, 0x0213, 0x00D8, 0xFFFF, 0x01B6, 0x01ED, 0x0099, 0xFFFF, 0x0243,
+    0x01EB, 0x00C0, 0x0282, 0x0227, 0x0068, 0x0182, 0xFFFF, 0x002A, 0x01CF, 0x004B, 0x01B0, 0x00C7, 0x027C, 0x0244, 0x01A5, 0x01BF,
+    0xFFFF, 0x02CA, 0xFFFF, 0xFFFF, 0xFFFF, 0x0275, 0x0029, 0xFFFF, 0x002E, 0x017B, 0x0025, 0x0022, 0x01F0, 0x00A1, 0x0119, 0xFFFF,
+    0xFFFF, 0x01C6, 0x0123, 0x01D8, 0xFFFF, 0xFFFF, 0x00FC, 0xFFFF, 0x01CA, 0x00FA, 0x0137, 0x00F6, 0x0046, 0xFFFF, 0x00F5, 0x0120,
+    0x025A, 0x029E, 0x0075, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0177, 0x00C9, 0x021F, 0xFFFF, 0x026D, 0x0164, 0xFFFF, 0xFFFF, 0x0200,
+    0x02B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0173, 0x01EF, 0x008A, 0x00F7, 0x01E3, 0x0285, 0x00D1, 0x0168, 0x01BB,
+    0x02B3, 0xFFFF, 0x0283, 0x00F3, 0x028A, 0xFFFF, 0x02A3, 0x004D, 0x0188, 0x020F, 0x020E, 0x020A, 0x026E, 0x005F, 0x0268, 0x0245,
+    0xFFFF, 0x0034, 0xFFFF, 0x003A, 0x00BC, 0x00C3, 0x00DE, 0xFFFF, 0x01AF, 0xFFFF, 0xFFFF, 0x00EF, 0x010A, 0x017D, 0xFFFF, 0xFFFF,
+    0x0152, 0xFFFF, 0x0146, 0xFFFF, 0xFFFF, 0x008E, 0x014A, 0xFFFF, 0x0130, 0xFFFF, 0x002C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x01A2, 0x0175, 0x0228, 0x01CE, 0xFFFF, 0x009A, 0x010F, 0x0011, 0x017F, 0xFFFF, 0xFFFF, 0xFFFF, 0x013F, 0x0274, 0x002D, 0xFFFF,
+    0x012C, 0x01A7, 0x02B8, 0xFFFF, 0x0258, 0xFFFF, 0xFFFF, 0x01B5, 0x00B2, 0x002F, 0x021A, 0x01F6, 0xFFFF, 0x016B, 0x0009, 0xFFFF,
+    0x0159, 0x0208, 0xFFFF, 0xFFFF, 0x01E0, 0x025F, 0x0259, 0xFFFF, 0x00A6, 0x0115, 0x0215, 0x01A4, 0x0296, 0x0287, 0x011C, 0xFFFF,
+    0x00CD, 0x00C4, 0x0284, 0x00CE, 0x00E2, 0x0299, 0xFFFF, 0x0207, 0x010E, 0xFFFF, 0x004C, 0x01FE, 0x0131, 0x0187, 0xFFFF, 0xFFFF,
+    0x0205, 0x01E6, 0xFFFF, 0x026F, 0x0253, 0x015F, 0xFFFF, 0xFFFF, 0x00BD, 0xFFFF, 0xFFFF, 0xFFFF, 0x0234, 0xFFFF, 0x02C6, 0x0183,
+    0xFFFF, 0x0071, 0x02A4, 0xFFFF, 0x006F, 0x020B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0006, 0x0091, 0x0236, 0x01BC, 0x0024, 0x00DD, 0x0089,
+    0x001A, 0x0150, 0x02D1, 0xFFFF, 0xFFFF, 0x0045, 0xFFFF, 0x00E1, 0x0217, 0x003B, 0x02C5, 0x00AE, 0x01F4, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x02A6, 0x02B0, 0x0143, 0xFFFF, 0xFFFF, 0xFFFF, 0x00A3, 0x0062, 0x00DF, 0xFFFF, 0x0076, 0x028C, 0x0235,
+    0x0239, 0xFFFF, 0xFFFF, 0x0219, 0xFFFF, 0x01C8, 0x0054, 0x00C1, 0x01D4, 0x019A, 0x0097, 0xFFFF, 0x02C7, 0x0048, 0xFFFF, 0x0220,
+    0xFFFF, 0xFFFF, 0x0093, 0x0232, 0xFFFF, 0x010B, 0x01F5, 0x02A9, 0x0185, 0xFFFF, 0x02BA, 0xFFFF, 0x02C3, 0xFFFF, 0x008F, 0xFFFF,
+    0xFFFF, 0x00E5, 0x013B, 0x01D9, 0x0297, 0x0050, 0x02A5, 0xFFFF, 0x0132, 0x00D7, 0x0082, 0x0044, 0xFFFF, 0x024D, 0xFFFF, 0x0138,
+    0xFFFF, 0x0017, 0x027F, 0x0000, 0x0249, 0x01C9, 0xFFFF, 0xFFFF, 0x0288, 0x0277, 0x019D, 0xFFFF, 0xFFFF, 0xFFFF, 0x019B, 0x0016,
+    0x0125, 0xFFFF, 0xFFFF, 0x026C, 0x0154, 0x0204, 0x0293, 0x0240, 0x014D, 0x01AE, 0x004A, 0x00E6, 0x0163, 0xFFFF, 0x007E, 0x013A,
+    0x0254, 0x01DB, 0x0247, 0x00EC, 0x00BB, 0x02AC, 0x005D, 0x0216, 0xFFFF, 0x0108, 0x00B9, 0xFFFF, 0x0195, 0x0139, 0xFFFF, 0xFFFF,
+    0x025E, 0x0127, 0x01DA, 0x0141, 0x0194, 0xFFFF, 0xFFFF, 0x0214, 0x00B7, 0x0198, 0x0052, 0x012B, 0x01F2, 0x0279, 0xFFFF, 0xFFFF,
+    0x004F, 0x000E, 0x0190, 0x019C, 0x0246, 0x008C, 0xFFFF, 0x0212, 0x0248, 0x02C2, 0xFFFF, 0xFFFF, 0xFFFF, 0x01FF, 0x006D, 0x01FC,
+    0x00E8, 0x0104, 0x0178, 0x0105, 0x02A7, 0xFFFF, 0x0037, 0x00ED, 0x001E, 0x0224, 0x010D, 0x012D, 0xFFFF, 0xFFFF, 0x011B, 0x0145,
+    0x0058, 0x00EA, 0xFFFF, 0x010C, 0xFFFF, 0xFFFF, 0xFFFF, 0x004E, 0x0229, 0x029D, 0x0013, 0x0162, 0x006E, 0xFFFF, 0x0262, 0x011D,
+    0x01B3, 0x02D3, 0xFFFF, 0x0103, 0x009D, 0xFFFF, 0x029F, 0x0230, 0x011E, 0x012A, 0x0072, 0x0070, 0xFFFF, 0x021B, 0x0086, 0xFFFF,
+    0x0041, 0x0269, 0x0038, 0x0042, 0x02B9, 0x0028, 0x0256, 0x0010, 0xFFFF, 0x029C, 0xFFFF, 0x00DC, 0x024A, 0xFFFF, 0xFFFF, 0x00DB,
+    0x0066, 0x000C, 0x029A, 0xFFFF, 0x009F, 0x0233, 0x0170, 0xFFFF, 0x01DD, 0x01C3, 0xFFFF, 0x005B, 0x00E9, 0x005C, 0x0221, 0x0087,
+    0x006C, 0xFFFF, 0x00D5, 0x0074, 0x0242, 0xFFFF, 0x0081, 0x01F3, 0xFFFF, 0x016F, 0x0094, 0x0043, 0x017E, 0x0261, 0xFFFF, 0xFFFF,
+};
+/* reads up to eight characters as a little endian word on every platform, so the tables stay valid; compilers turn the full case into a single load */
+static uint64_t vkadLoadLittleEndian(const char* bytes, size_t count) {
+    const unsigned char* b = REINTERPRET_CAST(const unsigned char*, bytes);
+    uint64_t word = 0;
+    size_t i = 0;
+    if (count >= 8) {
+        return (uint64_t) b[0]       | (uint64_t) b[1] << 8  | (uint64_t) b[2] << 16 | (uint64_t) b[3] << 24
+             | (uint64_t) b[4] << 32 | (uint64_t) b[5] << 40 | (uint64_t) b[6] << 48 | (uint64_t) b[7] << 56;
+    }
+    if (count & 4) { word  = (uint64_t) b[0] | (uint64_t) b[1] << 8 | (uint64_t) b[2] << 16 | (uint64_t) b[3] << 24; i = 4; }
+    if (count & 2) { word |= ((uint64_t) b[i] | (uint64_t) b[i + 1] << 8) << (8 * i); i += 2; }
+    if (count & 1) { word |= (uint64_t) b[i] << (8 * i); }
+    return word;
+}
+static uint32_t vkadFunctionNameHash(const char* name) {
+    size_t length = strlen(name);
+    uint64_t hash = (uint64_t) length * UINT64_C(0x9E3779B97F4A7C15);
+    size_t i;
+    for (i = 0; i < length; i += 8) {
+        hash ^= vkadLoadLittleEndian(name + i, length - i);
+        hash *= UINT64_C(0xFF51AFD7ED558CCD);
+        hash ^= hash >> 32;
+    }
+    return (uint32_t) hash;
+}
+/* returns the index of the entry named name (with the "vk" prefix) over all entries, or VKAD_NO_FUNCTION */
+static uint32_t vkadFindFunctionIndex(const char* name) {
+    uint32_t hash = vkadFunctionNameHash(name);
+    uint32_t seed = vkadFunctionHashSeeds[hash & ((1 << VKAD_FUNCTION_HASH_BUCKET_BITS) - 1)];
+    uint32_t index = vkadFunctionHashSlots[(uint32_t) ((hash ^ seed) * UINT32_C(0x9E3779B1)) >> (32 - VKAD_FUNCTION_HASH_SLOT_BITS)];
+    const VkadFunctionEntry* entry;
+    if (index == VKAD_NO_FUNCTION) return VKAD_NO_FUNCTION;
+    if (index < VKAD_GLOBAL_FUNCTION_COUNT) {
+        entry = &vkadGlobalFunctionEntries[index];
+    } else if (index < VKAD_GLOBAL_FUNCTION_COUNT + VKAD_INSTANCE_FUNCTION_COUNT) {
+        entry = &vkadInstanceFunctionEntries[index - VKAD_GLOBAL_FUNCTION_COUNT];
+    } else {
+        entry = &vkadDeviceFunctionEntries[index - VKAD_GLOBAL_FUNCTION_COUNT - VKAD_INSTANCE_FUNCTION_COUNT];
+    }
+    if (name[0] != 'v' || name[1] != 'k' || strcmp(name + 2, REINTERPRET_CAST(const char*, &vkadFunctionNames) + entry->nameOffset) != 0) return VKAD_NO_FUNCTION;
+    return index;
+}
+VKAD_API int vkadFindInstanceFunctionId(const char* name, VkadInstanceFunctionId* id) {
+    uint32_t index = vkadFindFunctionIndex(name);
+    if (index == VKAD_NO_FUNCTION || index < VKAD_GLOBAL_FUNCTION_COUNT || index >= VKAD_GLOBAL_FUNCTION_COUNT + VKAD_INSTANCE_FUNCTION_COUNT) return 0;
+    *id = (VkadInstanceFunctionId) (index - VKAD_GLOBAL_FUNCTION_COUNT);
+    return 1;
+}
+VKAD_API int vkadFindDeviceFunctionId(const char* name, VkadDeviceFunctionId* id) {
+    uint32_t index = vkadFindFunctionIndex(name);
+    if (index == VKAD_NO_FUNCTION || index < VKAD_GLOBAL_FUNCTION_COUNT + VKAD_INSTANCE_FUNCTION_COUNT) return 0;
+    *id = (VkadDeviceFunctionId) (index - VKAD_GLOBAL_FUNCTION_COUNT - VKAD_INSTANCE_FUNCTION_COUNT);
+    return 1;
+}
+/* the ID of the member at the byte offset in the struct, for code that only has the member itself */
+VKAD_API int vkadFindInstanceFunctionIdByOffset(size_t offset, VkadInstanceFunctionId* id) {
+    uint32_t i;
+    for (i = 0; i < VKAD_INSTANCE_FUNCTION_COUNT; ++i) {
+        if (vkadInstanceFunctionEntries[i].memberOffset == offset) {
+            *id = (VkadInstanceFunctionId) i;
+            return 1;
+        }
+    }
+    return 0;
+}
+VKAD_API int vkadFindDeviceFunctionIdByOffset(size_t offset, VkadDeviceFunctionId* id) {
+    uint32_t i;
+    for (i = 0; i < VKAD_DEVICE_FUNCTION_COUNT; ++i) {
+        if (vkadDeviceFunctionEntries[i].memberOffset == offset) {
+            *id = (VkadDeviceFunctionId) i;
+            return 1;
+        }
+    }
+    return 0;
+}
+/* the member of the named function, or NULL if it is not a function of this level */
+VKAD_API PFN_vkVoidFunction vkadFindInstanceFunction(const VkadInstanceFunctions* functions, const char* name) {
+    VkadInstanceFunctionId id;
+    return vkadFindInstanceFunctionId(name, &id) ? vkadGetInstanceFunction(functions, id) : NULL;
+}
+VKAD_API PFN_vkVoidFunction vkadFindDeviceFunction(const VkadDeviceFunctions* functions, const char* name) {
+    VkadDeviceFunctionId id;
+    return vkadFindDeviceFunctionId(name, &id) ? vkadGetDeviceFunction(functions, id) : NULL;
+}
+/* the member name of the function, which is its name without the "vk" prefix */
+VKAD_API const char* vkadInstanceFunctionName(VkadInstanceFunctionId id) {
+    return REINTERPRET_CAST(const char*, &vkadFunctionNames) + vkadInstanceFunctionEntries[id].nameOffset;
+}
+VKAD_API const char* vkadDeviceFunctionName(VkadDeviceFunctionId id) {
+    return REINTERPRET_CAST(const char*, &vkadFunctionNames) + vkadDeviceFunctionEntries[id].nameOffset;
+}
+
+VKAD_API void vkadLoadGlobalFunctions  (PFN_vkGetInstanceProcAddr loader, VkadGlobalFunctions* functions) {
+    char name[VKAD_MAX_FUNCTION_NAME_SIZE];
+    uint32_t i;
+    for (i = 0; i < VKAD_GLOBAL_FUNCTION_COUNT; ++i) {
+        vkadStoreFunction(functions, &vkadGlobalFunctionEntries[i], loader(NULL, vkadFunctionEntryName(&vkadGlobalFunctionEntries[i], name)));
+    }
+}
+/* adds a lookup that started at start to the statistics; returns its time */
+static uint64_t vkadRecordLookup(VkadLoadStats* stats, uint32_t id, PFN_vkVoidFunction function, uint64_t start) {
+    uint64_t nanoseconds = vkadNanoseconds() - start;
+    uint32_t i;
+    ++stats->lookupCount;
+    if (function != NULL) ++stats->resolvedCount;
+    else ++stats->nullCount;
+    stats->loaderNanoseconds += nanoseconds;
+    /* insertion into the sorted list, which drops the fastest one */
+    for (i = VKAD_SLOWEST_LOOKUP_COUNT; i > 0 && stats->slowest[i - 1].nanoseconds < nanoseconds; --i) {
+        if (i < VKAD_SLOWEST_LOOKUP_COUNT) stats->slowest[i] = stats->slowest[i - 1];
+    }
+    if (i < VKAD_SLOWEST_LOOKUP_COUNT) {
+        stats->slowest[i].id          = id;
+        stats->slowest[i].nanoseconds = nanoseconds;
+    }
+    return nanoseconds;
+}
+/* the commands that were promoted to core, with the extension commands they came from: the core command first, then its aliases in the order they are tried
+   (KHR, EXT, vendor), VKAD_NO_FUNCTION after the last. With VKAD_LOAD_FOLD_ALIASES_BIT, a family is looked up once and the winner is stored in all of its members. */
+#define VKAD_MAX_FUNCTION_FAMILY_SIZE 3
+static const uint16_t vkadInstanceFunctionFamilies[][VKAD_MAX_FUNCTION_FAMILY_SIZE] = {
+    { VKAD_INSTANCE_FUNCTION_ID_EnumeratePhysicalDeviceGroups,                  VKAD_INSTANCE_FUNCTION_ID_EnumeratePhysicalDeviceGroupsKHR,                  VKAD_NO_FUNCTION },
+    { VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFeatures2,                     VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFeatures2KHR,                     VKAD_NO_FUNCTION },
+    { VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceProperties2,                   VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceProperties2KHR,                   VKAD_NO_FUNCTION },
+    { VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFormatProperties2,             VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceFormatProperties2KHR,             VKAD_NO_FUNCTION },
+    { VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceImageFormatProperties2,        VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceImageFormatProperties2KHR,        VKAD_NO_FUNCTION },
+    { VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceQueueFamilyProperties2,        VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceQueueFamilyProperties2KHR,        VKAD_NO_FUNCTION },
+    { VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceMemoryProperties2,             VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceMemoryProperties2KHR,             VKAD_NO_FUNCTION },
+    { VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSparseImageFormatProperties2,  VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceSparseImageFormatProperties2KHR,  VKAD_NO_FUNCTION },
+    { VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalBufferProperties,      VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalBufferPropertiesKHR,      VKAD_NO_FUNCTION },
+    { VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalFenceProperties,       VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalFencePropertiesKHR,       VKAD_NO_FUNCTION },
+    { VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalSemaphoreProperties,   VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceExternalSemaphorePropertiesKHR,   VKAD_NO_FUNCTION },
+    { VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceToolProperties,                VKAD_INSTANCE_FUNCTION_ID_GetPhysicalDeviceToolPropertiesEXT,                VKAD_NO_FUNCTION },
+};
+static const uint16_t vkadDeviceFunctionFamilies[][VKAD_MAX_FUNCTION_FAMILY_SIZE] = {
+    { VKAD_DEVICE_FUNCTION_ID_BindBufferMemory2,                       VKAD_DEVICE_FUNCTION_ID_BindBufferMemory2KHR,                       VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_BindImageMemory2,                        VKAD_DEVICE_FUNCTION_ID_BindImageMemory2KHR,                        VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetDeviceGroupPeerMemoryFeatures,        VKAD_DEVICE_FUNCTION_ID_GetDeviceGroupPeerMemoryFeaturesKHR,        VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetDeviceMask,                        VKAD_DEVICE_FUNCTION_ID_CmdSetDeviceMaskKHR,                        VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdDispatchBase,                         VKAD_DEVICE_FUNCTION_ID_CmdDispatchBaseKHR,                         VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetImageMemoryRequirements2,             VKAD_DEVICE_FUNCTION_ID_GetImageMemoryRequirements2KHR,             VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetBufferMemoryRequirements2,            VKAD_DEVICE_FUNCTION_ID_GetBufferMemoryRequirements2KHR,            VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetImageSparseMemoryRequirements2,       VKAD_DEVICE_FUNCTION_ID_GetImageSparseMemoryRequirements2KHR,       VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_TrimCommandPool,                         VKAD_DEVICE_FUNCTION_ID_TrimCommandPoolKHR,                         VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CreateSamplerYcbcrConversion,            VKAD_DEVICE_FUNCTION_ID_CreateSamplerYcbcrConversionKHR,            VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_DestroySamplerYcbcrConversion,           VKAD_DEVICE_FUNCTION_ID_DestroySamplerYcbcrConversionKHR,           VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CreateDescriptorUpdateTemplate,          VKAD_DEVICE_FUNCTION_ID_CreateDescriptorUpdateTemplateKHR,          VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_DestroyDescriptorUpdateTemplate,         VKAD_DEVICE_FUNCTION_ID_DestroyDescriptorUpdateTemplateKHR,         VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_UpdateDescriptorSetWithTemplate,         VKAD_DEVICE_FUNCTION_ID_UpdateDescriptorSetWithTemplateKHR,         VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetDescriptorSetLayoutSupport,           VKAD_DEVICE_FUNCTION_ID_GetDescriptorSetLayoutSupportKHR,           VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdDrawIndirectCount,                    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndirectCountKHR,                    VKAD_DEVICE_FUNCTION_ID_CmdDrawIndirectCountAMD },
+    { VKAD_DEVICE_FUNCTION_ID_CmdDrawIndexedIndirectCount,             VKAD_DEVICE_FUNCTION_ID_CmdDrawIndexedIndirectCountKHR,             VKAD_DEVICE_FUNCTION_ID_CmdDrawIndexedIndirectCountAMD },
+    { VKAD_DEVICE_FUNCTION_ID_CreateRenderPass2,                       VKAD_DEVICE_FUNCTION_ID_CreateRenderPass2KHR,                       VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdBeginRenderPass2,                     VKAD_DEVICE_FUNCTION_ID_CmdBeginRenderPass2KHR,                     VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdNextSubpass2,                         VKAD_DEVICE_FUNCTION_ID_CmdNextSubpass2KHR,                         VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdEndRenderPass2,                       VKAD_DEVICE_FUNCTION_ID_CmdEndRenderPass2KHR,                       VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_ResetQueryPool,                          VKAD_DEVICE_FUNCTION_ID_ResetQueryPoolEXT,                          VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetSemaphoreCounterValue,                VKAD_DEVICE_FUNCTION_ID_GetSemaphoreCounterValueKHR,                VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_WaitSemaphores,                          VKAD_DEVICE_FUNCTION_ID_WaitSemaphoresKHR,                          VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_SignalSemaphore,                         VKAD_DEVICE_FUNCTION_ID_SignalSemaphoreKHR,                         VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetBufferDeviceAddress,                  VKAD_DEVICE_FUNCTION_ID_GetBufferDeviceAddressKHR,                  VKAD_DEVICE_FUNCTION_ID_GetBufferDeviceAddressEXT },
+    { VKAD_DEVICE_FUNCTION_ID_GetBufferOpaqueCaptureAddress,           VKAD_DEVICE_FUNCTION_ID_GetBufferOpaqueCaptureAddressKHR,           VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetDeviceMemoryOpaqueCaptureAddress,     VKAD_DEVICE_FUNCTION_ID_GetDeviceMemoryOpaqueCaptureAddressKHR,     VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CreatePrivateDataSlot,                   VKAD_DEVICE_FUNCTION_ID_CreatePrivateDataSlotEXT,                   VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_DestroyPrivateDataSlot,                  VKAD_DEVICE_FUNCTION_ID_DestroyPrivateDataSlotEXT,                  VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_SetPrivateData,                          VKAD_DEVICE_FUNCTION_ID_SetPrivateDataEXT,                          VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetPrivateData,                          VKAD_DEVICE_FUNCTION_ID_GetPrivateDataEXT,                          VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetEvent2,                            VKAD_DEVICE_FUNCTION_ID_CmdSetEvent2KHR,                            VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdResetEvent2,                          VKAD_DEVICE_FUNCTION_ID_CmdResetEvent2KHR,                          VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdWaitEvents2,                          VKAD_DEVICE_FUNCTION_ID_CmdWaitEvents2KHR,                          VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdPipelineBarrier2,                     VKAD_DEVICE_FUNCTION_ID_CmdPipelineBarrier2KHR,                     VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdWriteTimestamp2,                      VKAD_DEVICE_FUNCTION_ID_CmdWriteTimestamp2KHR,                      VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_QueueSubmit2,                            VKAD_DEVICE_FUNCTION_ID_QueueSubmit2KHR,                            VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdCopyBuffer2,                          VKAD_DEVICE_FUNCTION_ID_CmdCopyBuffer2KHR,                          VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdCopyImage2,                           VKAD_DEVICE_FUNCTION_ID_CmdCopyImage2KHR,                           VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdCopyBufferToImage2,                   VKAD_DEVICE_FUNCTION_ID_CmdCopyBufferToImage2KHR,                   VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdCopyImageToBuffer2,                   VKAD_DEVICE_FUNCTION_ID_CmdCopyImageToBuffer2KHR,                   VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdBlitImage2,                           VKAD_DEVICE_FUNCTION_ID_CmdBlitImage2KHR,                           VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdResolveImage2,                        VKAD_DEVICE_FUNCTION_ID_CmdResolveImage2KHR,                        VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdBeginRendering,                       VKAD_DEVICE_FUNCTION_ID_CmdBeginRenderingKHR,                       VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdEndRendering,                         VKAD_DEVICE_FUNCTION_ID_CmdEndRenderingKHR,                         VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetCullMode,                          VKAD_DEVICE_FUNCTION_ID_CmdSetCullModeEXT,                          VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetFrontFace,                         VKAD_DEVICE_FUNCTION_ID_CmdSetFrontFaceEXT,                         VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetPrimitiveTopology,                 VKAD_DEVICE_FUNCTION_ID_CmdSetPrimitiveTopologyEXT,                 VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetViewportWithCount,                 VKAD_DEVICE_FUNCTION_ID_CmdSetViewportWithCountEXT,                 VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetScissorWithCount,                  VKAD_DEVICE_FUNCTION_ID_CmdSetScissorWithCountEXT,                  VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdBindVertexBuffers2,                   VKAD_DEVICE_FUNCTION_ID_CmdBindVertexBuffers2EXT,                   VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetDepthTestEnable,                   VKAD_DEVICE_FUNCTION_ID_CmdSetDepthTestEnableEXT,                   VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetDepthWriteEnable,                  VKAD_DEVICE_FUNCTION_ID_CmdSetDepthWriteEnableEXT,                  VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetDepthCompareOp,                    VKAD_DEVICE_FUNCTION_ID_CmdSetDepthCompareOpEXT,                    VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetDepthBoundsTestEnable,             VKAD_DEVICE_FUNCTION_ID_CmdSetDepthBoundsTestEnableEXT,             VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetStencilTestEnable,                 VKAD_DEVICE_FUNCTION_ID_CmdSetStencilTestEnableEXT,                 VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetStencilOp,                         VKAD_DEVICE_FUNCTION_ID_CmdSetStencilOpEXT,                         VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetRasterizerDiscardEnable,           VKAD_DEVICE_FUNCTION_ID_CmdSetRasterizerDiscardEnableEXT,           VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetDepthBiasEnable,                   VKAD_DEVICE_FUNCTION_ID_CmdSetDepthBiasEnableEXT,                   VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetPrimitiveRestartEnable,            VKAD_DEVICE_FUNCTION_ID_CmdSetPrimitiveRestartEnableEXT,            VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetDeviceBufferMemoryRequirements,       VKAD_DEVICE_FUNCTION_ID_GetDeviceBufferMemoryRequirementsKHR,       VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetDeviceImageMemoryRequirements,        VKAD_DEVICE_FUNCTION_ID_GetDeviceImageMemoryRequirementsKHR,        VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetDeviceImageSparseMemoryRequirements,  VKAD_DEVICE_FUNCTION_ID_GetDeviceImageSparseMemoryRequirementsKHR,  VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetLineStipple,                       VKAD_DEVICE_FUNCTION_ID_CmdSetLineStippleKHR,                       VKAD_DEVICE_FUNCTION_ID_CmdSetLineStippleEXT },
+    { VKAD_DEVICE_FUNCTION_ID_MapMemory2,                              VKAD_DEVICE_FUNCTION_ID_MapMemory2KHR,                              VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_UnmapMemory2,                            VKAD_DEVICE_FUNCTION_ID_UnmapMemory2KHR,                            VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdBindIndexBuffer2,                     VKAD_DEVICE_FUNCTION_ID_CmdBindIndexBuffer2KHR,                     VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetRenderingAreaGranularity,             VKAD_DEVICE_FUNCTION_ID_GetRenderingAreaGranularityKHR,             VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetDeviceImageSubresourceLayout,         VKAD_DEVICE_FUNCTION_ID_GetDeviceImageSubresourceLayoutKHR,         VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_GetImageSubresourceLayout2,              VKAD_DEVICE_FUNCTION_ID_GetImageSubresourceLayout2KHR,              VKAD_DEVICE_FUNCTION_ID_GetImageSubresourceLayout2EXT },
+    { VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSet,                    VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSetKHR,                    VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSetWithTemplate,        VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSetWithTemplateKHR,        VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetRenderingAttachmentLocations,      VKAD_DEVICE_FUNCTION_ID_CmdSetRenderingAttachmentLocationsKHR,      VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdSetRenderingInputAttachmentIndices,   VKAD_DEVICE_FUNCTION_ID_CmdSetRenderingInputAttachmentIndicesKHR,   VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdBindDescriptorSets2,                  VKAD_DEVICE_FUNCTION_ID_CmdBindDescriptorSets2KHR,                  VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdPushConstants2,                       VKAD_DEVICE_FUNCTION_ID_CmdPushConstants2KHR,                       VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSet2,                   VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSet2KHR,                   VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSetWithTemplate2,       VKAD_DEVICE_FUNCTION_ID_CmdPushDescriptorSetWithTemplate2KHR,       VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CopyMemoryToImage,                       VKAD_DEVICE_FUNCTION_ID_CopyMemoryToImageEXT,                       VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CopyImageToMemory,                       VKAD_DEVICE_FUNCTION_ID_CopyImageToMemoryEXT,                       VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_CopyImageToImage,                        VKAD_DEVICE_FUNCTION_ID_CopyImageToImageEXT,                        VKAD_NO_FUNCTION },
+    { VKAD_DEVICE_FUNCTION_ID_TransitionImageLayout,                   VKAD_DEVICE_FUNCTION_ID_TransitionImageLayoutEXT,                   VKAD_NO_FUNCTION },
+};
+/* adds the members of all families to the set, which the loops over the entries skip when the aliases are folded */
+static void vkadAddFunctionFamilies(const uint16_t (*families)[VKAD_MAX_FUNCTION_FAMILY_SIZE], uint32_t familyCount, uint32_t* members) {
+    uint32_t i, j;
+    for (i = 0; i < familyCount; ++i) {
+        for (j = 0; j < VKAD_MAX_FUNCTION_FAMILY_SIZE && families[i][j] != VKAD_NO_FUNCTION; ++j) vkadAddToFunctionSet(members, families[i][j]);
+    }
+}
+/* whether any member of the family that is in the table is also in the selection (or there is no selection) */
+static int vkadFunctionFamilyWanted(const uint16_t* family, const VkadFunctionEntry* entries, const uint32_t* selection) {
+    uint32_t j;
+    for (j = 0; j < VKAD_MAX_FUNCTION_FAMILY_SIZE && family[j] != VKAD_NO_FUNCTION; ++j) {
+        if (entries[family[j]].memberOffset != VKAD_NO_MEMBER && (selection == NULL || ((selection[family[j] / 32] >> (family[j] % 32)) & 1))) return 1;
+    }
+    return 0;
+}
+/* the group of a function, which is the group whose range of entries holds its ID */
+static uint32_t vkadFunctionGroupOf(const VkadFunctionGroup* groups, uint32_t id) {
+    uint32_t i = 0;
+    while (id >= (uint32_t) groups[i].firstEntry + groups[i].entryCount) ++i;
+    return i;
+}
+/* the groups loaded for the load info, as a set over vkadInstanceFunctionGroups */
+static void vkadGetEnabledInstanceFunctionGroups(const VkadInstanceLoadInfo* loadInfo, uint32_t* groups) {
+    uint32_t i;
+    memset(groups, 0, sizeof(uint32_t) * ((VKAD_INSTANCE_FUNCTION_GROUP_COUNT + 31) / 32));
+    for (i = 0; i < VKAD_INSTANCE_FUNCTION_GROUP_COUNT; ++i) {
+        if (loadInfo->pCreateInfo == NULL || vkadInstanceFunctionGroupEnabled(&vkadInstanceFunctionGroups[i], loadInfo->pCreateInfo)) vkadAddToFunctionSet(groups, i);
+    }
+}
+static void vkadLoadInstanceFunctionFamilies(PFN_vkGetInstanceProcAddr loader, VkInstance instance, const uint32_t* groups, const VkadInstanceLoadInfo* loadInfo, VkadInstanceFunctions* functions) {
+    char name[VKAD_MAX_FUNCTION_NAME_SIZE];
+    VkadLoadStats* stats = loadInfo->pStats;
+    uint32_t i, j;
+    for (i = 0; i < sizeof(vkadInstanceFunctionFamilies) / sizeof(vkadInstanceFunctionFamilies[0]); ++i) {
+        const uint16_t* family = vkadInstanceFunctionFamilies[i];
+        PFN_vkVoidFunction function = NULL;
+        uint32_t lookedUp = 0;
+        if (vkadFunctionFamilyWanted(family, vkadInstanceFunctionEntries, loadInfo->pSelection != NULL ? loadInfo->pSelection->bits : NULL)) {
+            for (j = 0; function == NULL && j < VKAD_MAX_FUNCTION_FAMILY_SIZE && family[j] != VKAD_NO_FUNCTION; ++j) {
+                const VkadFunctionEntry* entry = &vkadInstanceFunctionEntries[family[j]];
+                uint32_t group = vkadFunctionGroupOf(vkadInstanceFunctionGroups, family[j]);
+                if (entry->memberOffset == VKAD_NO_MEMBER || !((groups[group / 32] >> (group % 32)) & 1)) continue;
+                lookedUp |= UINT32_C(1) << j;
+                if (stats != NULL) {
+                    uint64_t lookupStart = vkadNanoseconds();
+                    function = loader(instance, vkadFunctionEntryName(entry, name));
+                    vkadRecordLookup(stats, family[j], function, lookupStart);
+                } else {
+                    function = loader(instance, vkadFunctionEntryName(entry, name));
+                }
+            }
+        }
+        for (j = 0; j < VKAD_MAX_FUNCTION_FAMILY_SIZE && family[j] != VKAD_NO_FUNCTION; ++j) {
+            const VkadFunctionEntry* entry = &vkadInstanceFunctionEntries[family[j]];
+            PFN_vkVoidFunction member = function;
+            if (stats != NULL && !((lookedUp >> j) & 1)) ++stats->skippedCount;
+            if (entry->memberOffset == VKAD_NO_MEMBER) continue;
+            if (member != NULL) {
+                if (loadInfo->pAvailable != NULL) vkadAddToFunctionSet(loadInfo->pAvailable->bits, family[j]);
+            } else if (loadInfo->flags & VKAD_LOAD_UNSUPPORTED_STUBS_BIT) {
+                member = vkadUnsupportedStub(family[j], vkadInstanceValueFunctions, sizeof(vkadInstanceValueFunctions) / sizeof(uint16_t));
+            }
+            vkadStoreFunction(functions, entry, member);
+        }
+    }
+}
+VKAD_API void vkadLoadInstanceFunctionsEx(PFN_vkGetInstanceProcAddr loader, VkInstance instance, const VkadInstanceLoadInfo* loadInfo, VkadInstanceFunctions* functions) {
+    char name[VKAD_MAX_FUNCTION_NAME_SIZE];
+    VkadLoadStats* stats = loadInfo->pStats;
+    VkadInstanceFunctionSet folded;
+    uint32_t groups[(VKAD_INSTANCE_FUNCTION_GROUP_COUNT + 31) / 32];
+    uint64_t start = 0;
+    uint32_t i, j;
+    if (loadInfo->pAvailable != NULL) memset(loadInfo->pAvailable, 0, sizeof(VkadInstanceFunctionSet));
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(VkadLoadStats));
+        start = vkadNanoseconds();
+    }
+    memset(&folded, 0, sizeof(folded));
+    if (loadInfo->flags & VKAD_LOAD_FOLD_ALIASES_BIT) {
+        vkadAddFunctionFamilies(vkadInstanceFunctionFamilies, sizeof(vkadInstanceFunctionFamilies) / sizeof(vkadInstanceFunctionFamilies[0]), folded.bits);
+    }
+    vkadGetEnabledInstanceFunctionGroups(loadInfo, groups);
+    for (i = 0; i < VKAD_INSTANCE_FUNCTION_GROUP_COUNT; ++i) {
+        const VkadFunctionGroup* group = &vkadInstanceFunctionGroups[i];
+        int enabled = (groups[i / 32] >> (i % 32)) & 1;
+        for (j = group->firstEntry; j < group->firstEntry + group->entryCount; ++j) {
+            const VkadFunctionEntry* entry = &vkadInstanceFunctionEntries[j];
+            PFN_vkVoidFunction function;
+            if (vkadInstanceFunctionAvailable(&folded, (VkadInstanceFunctionId) j)) continue;
+            if (entry->memberOffset == VKAD_NO_MEMBER) {
+                if (stats != NULL) ++stats->skippedCount;
+                continue;
+            }
+            if (enabled && (loadInfo->pSelection == NULL || vkadInstanceFunctionAvailable(loadInfo->pSelection, (VkadInstanceFunctionId) j))) {
+                if (stats != NULL) {
+                    uint64_t lookupStart = vkadNanoseconds();
+                    function = loader(instance, vkadFunctionEntryName(entry, name));
+                    vkadRecordLookup(stats, j, function, lookupStart);
+                } else {
+                    function = loader(instance, vkadFunctionEntryName(entry, name));
+                }
+            } else {
+                function = NULL;
+                if (stats != NULL) ++stats->skippedCount;
+            }
+            if (function != NULL) {
+                if (loadInfo->pAvailable != NULL) vkadAddToFunctionSet(loadInfo->pAvailable->bits, j);
+            } else if (loadInfo->flags & VKAD_LOAD_UNSUPPORTED_STUBS_BIT) {
+                function = vkadUnsupportedStub(j, vkadInstanceValueFunctions, sizeof(vkadInstanceValueFunctions) / sizeof(uint16_t));
+            }
+            vkadStoreFunction(functions, entry, function);
+        }
+    }
+    if (loadInfo->flags & VKAD_LOAD_FOLD_ALIASES_BIT) vkadLoadInstanceFunctionFamilies(loader, instance, groups, loadInfo, functions);
+    if (stats != NULL) stats->nanoseconds = vkadNanoseconds() - start;
+}
+VKAD_API void vkadLoadInstanceFunctionsFiltered(PFN_vkGetInstanceProcAddr loader, VkInstance instance, const VkInstanceCreateInfo* createInfo, VkadInstanceFunctions* functions) {
+    VkadInstanceLoadInfo loadInfo = { 0, NULL, NULL, NULL, NULL };
+    loadInfo.pCreateInfo = createInfo;
+    vkadLoadInstanceFunctionsEx(loader, instance, &loadInfo, functions);
+}
+VKAD_API void vkadLoadInstanceFunctions(PFN_vkGetInstanceProcAddr loader, VkInstance instance, VkadInstanceFunctions* functions) {
+    VkadInstanceLoadInfo loadInfo = { 0, NULL, NULL, NULL, NULL };
+    vkadLoadInstanceFunctionsEx(loader, instance, &loadInfo, functions);
+}
+/* the commands of device extensions in the instance table are physical device commands, which the loader returns as soon as one driver has them, so they only work with
+   the physical devices that have the extension; this clears their bits in available for a physical device whose extension properties do not list it */
+VKAD_API void vkadCheckPhysicalDeviceFunctions(const VkExtensionProperties* pProperties, uint32_t propertyCount, VkadInstanceFunctionSet* available) {
+    uint32_t i, j, k;
+    for (i = 0; i < VKAD_INSTANCE_FUNCTION_GROUP_COUNT; ++i) {
+        const VkadFunctionGroup* group = &vkadInstanceFunctionGroups[i];
+        const char* extensionName = REINTERPRET_CAST(const char*, &vkadExtensionNames) + group->extension;
+        int supported = 0;
+        if (!(group->flags & VKAD_GROUP_DEVICE_EXTENSION_BIT)) continue;
+        for (k = 0; k < propertyCount; ++k) {
+            if (strcmp(pProperties[k].extensionName, extensionName) == 0) supported = 1;
+        }
+        if (supported) continue;
+        for (j = group->firstEntry; j < group->firstEntry + group->entryCount; ++j) available->bits[j / 32] &= ~(UINT32_C(1) << (j % 32));
+    }
+}
+/* the groups loaded for the load info, as a set over vkadDeviceFunctionGroups */
+static void vkadGetEnabledDeviceFunctionGroups(const VkadDeviceLoadInfo* loadInfo, uint32_t* groups) {
+    uint32_t i;
+    memset(groups, 0, sizeof(uint32_t) * ((VKAD_DEVICE_FUNCTION_GROUP_COUNT + 31) / 32));
+    for (i = 0; i < VKAD_DEVICE_FUNCTION_GROUP_COUNT; ++i) {
+        if (loadInfo->pCreateInfo == NULL || vkadDeviceFunctionGroupEnabled(&vkadDeviceFunctionGroups[i], loadInfo->pCreateInfo, loadInfo->apiVersion)) vkadAddToFunctionSet(groups, i);
+    }
+}
+/* the families for vkadLoadDeviceFunctionsPart: a candidate is only looked up if its group is enabled, and only the members in the part are stored */
+static void vkadLoadDeviceFunctionFamilies(PFN_vkGetDeviceProcAddr loader, VkDevice device, const uint32_t* groups, const VkadDeviceLoadInfo* loadInfo,
+                                           const VkadDeviceFunctionSet* part, int inPart, VkadDeviceFunctions* functions) {
+    char name[VKAD_MAX_FUNCTION_NAME_SIZE];
+    VkadLoadStats* stats = loadInfo->pStats;
+    uint32_t i, j;
+    for (i = 0; i < sizeof(vkadDeviceFunctionFamilies) / sizeof(vkadDeviceFunctionFamilies[0]); ++i) {
+        const uint16_t* family = vkadDeviceFunctionFamilies[i];
+        PFN_vkVoidFunction function = NULL;
+        uint32_t lookedUp = 0, inThisPart = 0;
+        for (j = 0; j < VKAD_MAX_FUNCTION_FAMILY_SIZE && family[j] != VKAD_NO_FUNCTION; ++j) {
+            if (part == NULL || vkadDeviceFunctionAvailable(part, (VkadDeviceFunctionId) family[j]) == inPart) inThisPart |= UINT32_C(1) << j;
+        }
+        if (inThisPart == 0) continue;
+        if (vkadFunctionFamilyWanted(family, vkadDeviceFunctionEntries, loadInfo->pSelection != NULL ? loadInfo->pSelection->bits : NULL)) {
+            for (j = 0; function == NULL && j < VKAD_MAX_FUNCTION_FAMILY_SIZE && family[j] != VKAD_NO_FUNCTION; ++j) {
+                const VkadFunctionEntry* entry = &vkadDeviceFunctionEntries[family[j]];
+                uint32_t group = vkadFunctionGroupOf(vkadDeviceFunctionGroups, family[j]);
+                if (entry->memberOffset == VKAD_NO_MEMBER || !((groups[group / 32] >> (group % 32)) & 1)) continue;
+                lookedUp |= UINT32_C(1) << j;
+                if (stats != NULL) {
+                    uint64_t lookupStart = vkadNanoseconds();
+                    function = loader(device, vkadFunctionEntryName(entry, name));
+                    stats->groupNanoseconds[group] += vkadRecordLookup(stats, family[j], function, lookupStart);
+                } else {
+                    function = loader(device, vkadFunctionEntryName(entry, name));
+                }
+            }
+        }
+        for (j = 0; j < VKAD_MAX_FUNCTION_FAMILY_SIZE && family[j] != VKAD_NO_FUNCTION; ++j) {
+            const VkadFunctionEntry* entry = &vkadDeviceFunctionEntries[family[j]];
+            PFN_vkVoidFunction member = function;
+            if (!((inThisPart >> j) & 1)) continue;
+            if (stats != NULL && !((lookedUp >> j) & 1)) ++stats->skippedCount;
+            if (entry->memberOffset == VKAD_NO_MEMBER) continue;
+            if (member != NULL) {
+                if (loadInfo->pAvailable != NULL) vkadAddToFunctionSet(loadInfo->pAvailable->bits, family[j]);
+            } else if (loadInfo->flags & VKAD_LOAD_UNSUPPORTED_STUBS_BIT) {
+                member = vkadUnsupportedStub(family[j], vkadDeviceValueFunctions, sizeof(vkadDeviceValueFunctions) / sizeof(uint16_t));
+            }
+            vkadStoreFunction(functions, entry, member);
+        }
+    }
+}
+/* loads the members whose bit in part is inPart (all members if part is NULL) from the groups in the set groups, and leaves the other members,
+   the availability bits and the statistics of the other members untouched, so the two parts of a table can be loaded at the same time */
+static void vkadLoadDeviceFunctionsPart(PFN_vkGetDeviceProcAddr loader, VkDevice device, const uint32_t* groups, const VkadDeviceLoadInfo* loadInfo,
+                                        const VkadDeviceFunctionSet* part, int inPart, VkadDeviceFunctions* functions) {
+    char name[VKAD_MAX_FUNCTION_NAME_SIZE];
+    VkadLoadStats* stats = loadInfo->pStats;
+    VkadDeviceFunctionSet folded;
+    uint32_t i, j;
+    memset(&folded, 0, sizeof(folded));
+    if (loadInfo->flags & VKAD_LOAD_FOLD_ALIASES_BIT) {
+        vkadAddFunctionFamilies(vkadDeviceFunctionFamilies, sizeof(vkadDeviceFunctionFamilies) / sizeof(vkadDeviceFunctionFamilies[0]), folded.bits);
+    }
+    for (i = 0; i < VKAD_DEVICE_FUNCTION_GROUP_COUNT; ++i) {
+        const VkadFunctionGroup* group = &vkadDeviceFunctionGroups[i];
+        int enabled = (groups[i / 32] >> (i % 32)) & 1;
+        for (j = group->firstEntry; j < group->firstEntry + group->entryCount; ++j) {
+            const VkadFunctionEntry* entry = &vkadDeviceFunctionEntries[j];
+            PFN_vkVoidFunction function;
+            if (part != NULL && vkadDeviceFunctionAvailable(part, (VkadDeviceFunctionId) j) != inPart) continue;
+            if (vkadDeviceFunctionAvailable(&folded, (VkadDeviceFunctionId) j)) continue;
+            if (entry->memberOffset == VKAD_NO_MEMBER) {
+                if (stats != NULL) ++stats->skippedCount;
+                continue;
+            }
+            if (enabled && (loadInfo->pSelection == NULL || vkadDeviceFunctionAvailable(loadInfo->pSelection, (VkadDeviceFunctionId) j))) {
+                if (stats != NULL) {
+                    uint64_t lookupStart = vkadNanoseconds();
+                    function = loader(device, vkadFunctionEntryName(entry, name));
+                    stats->groupNanoseconds[i] += vkadRecordLookup(stats, j, function, lookupStart);
+                } else {
+                    function = loader(device, vkadFunctionEntryName(entry, name));
+                }
+            } else {
+                function = NULL;
+                if (stats != NULL) ++stats->skippedCount;
+            }
+            if (function != NULL) {
+                if (loadInfo->pAvailable != NULL) vkadAddToFunctionSet(loadInfo->pAvailable->bits, j);
+            } else if (loadInfo->flags & VKAD_LOAD_UNSUPPORTED_STUBS_BIT) {
+                function = vkadUnsupportedStub(j, vkadDeviceValueFunctions, sizeof(vkadDeviceValueFunctions) / sizeof(uint16_t));
+            }
+            vkadStoreFunction(functions, entry, function);
+        }
+    }
+    if (loadInfo->flags & VKAD_LOAD_FOLD_ALIASES_BIT) vkadLoadDeviceFunctionFamilies(loader, device, groups, loadInfo, part, inPart, functions);
+}
+VKAD_API void vkadLoadDeviceFunctionsEx(PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkadDeviceLoadInfo* loadInfo, VkadDeviceFunctions* functions) {
+    uint32_t groups[(VKAD_DEVICE_FUNCTION_GROUP_COUNT + 31) / 32];
+    uint64_t start = 0;
+    if (loadInfo->pAvailable != NULL) memset(loadInfo->pAvailable, 0, sizeof(VkadDeviceFunctionSet));
+    if (loadInfo->pStats != NULL) {
+        memset(loadInfo->pStats, 0, sizeof(VkadLoadStats));
+        start = vkadNanoseconds();
+    }
+    vkadGetEnabledDeviceFunctionGroups(loadInfo, groups);
+    vkadLoadDeviceFunctionsPart(loader, device, groups, loadInfo, NULL, 0, functions);
+    if (loadInfo->pStats != NULL) loadInfo->pStats->nanoseconds = vkadNanoseconds() - start;
+}
+/* the name of a group of device functions in VkadLoadStats::groupNanoseconds: the extension, or the core version like "VK_VERSION_1_1" */
+VKAD_API const char* vkadDeviceFunctionGroupName(uint32_t group) {
+    static const char* const coreVersionNames[] = { "VK_VERSION_1_0", "VK_VERSION_1_1", "VK_VERSION_1_2", "VK_VERSION_1_3", "VK_VERSION_1_4" };
+    uint32_t minorVersion = VK_API_VERSION_MINOR(vkadDeviceFunctionGroups[group].apiVersion);
+    if (vkadDeviceFunctionGroups[group].extension != VKAD_NO_EXTENSION) return REINTERPRET_CAST(const char*, &vkadExtensionNames) + vkadDeviceFunctionGroups[group].extension;
+    return minorVersion < sizeof(coreVersionNames) / sizeof(coreVersionNames[0]) ? coreVersionNames[minorVersion] : "VK_VERSION_1_X";
+}
+VKAD_API void vkadLoadDeviceFunctionsFiltered(PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkDeviceCreateInfo* createInfo, uint32_t apiVersion, VkadDeviceFunctions* functions) {
+    VkadDeviceLoadInfo loadInfo = { NULL, 0, 0, NULL, NULL, NULL };
+    loadInfo.pCreateInfo = createInfo;
+    loadInfo.apiVersion  = apiVersion;
+    vkadLoadDeviceFunctionsEx(loader, device, &loadInfo, functions);
+}
+VKAD_API void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice device, VkadDeviceFunctions* functions) {
+    vkadLoadDeviceFunctionsFiltered(loader, device, NULL, 0, functions);
+}
+#endif /* VKAD_HAS_DEFINITIONS */
+
+#if (defined(VKAD_LAZY_LOADING) || defined(VKAD_INSTRUMENTATION)) && VKAD_HAS_DEFINITIONS
+/* thunks: small functions every member of a table can point to, which find the table through the first argument of the call, do their work and jump to the real function.
+   They are written in assembly, since they have to forward the arguments of any signature, so they are only available for x86-64 and AArch64 outside of Windows with GCC and Clang. */
+#if (defined(__x86_64__) || defined(__aarch64__)) && !defined(_WIN32) && (defined(__GNUC__) || defined(__clang__))
+#define VKAD_HAS_THUNKS 1
+#else
+#define VKAD_HAS_THUNKS 0
+#endif
+
+#if VKAD_HAS_THUNKS
+/* every thunk is padded to 16 bytes, so the thunk of an entry can be found by its index */
+#define VKAD_THUNK_SIZE 16
+
+#define VKAD_STRINGIFY(X) #X
+#define VKAD_EXPAND_STRINGIFY(X) VKAD_STRINGIFY(X)
+#define VKAD_ASM_SYMBOL(NAME) VKAD_EXPAND_STRINGIFY(__USER_LABEL_PREFIX__) #NAME
+/* the thunks are weak hidden symbols like the other shared state, in a section group on ELF, so only one copy stays in the linked binary */
+#ifdef __APPLE__
+#define VKAD_ASM_SECTION_BEGIN(NAME) "    .text\n"
+#define VKAD_ASM_SECTION_END         ""
+#define VKAD_ASM_WEAK(NAME)          "    .globl " VKAD_ASM_SYMBOL(NAME) "\n    .weak_definition " VKAD_ASM_SYMBOL(NAME) "\n    .private_extern " VKAD_ASM_SYMBOL(NAME) "\n"
+#else
+#define VKAD_ASM_SECTION_BEGIN(NAME) "    .pushsection .text." #NAME ",\"axG\",%progbits," #NAME ",comdat\n"
+#define VKAD_ASM_SECTION_END         "    .popsection\n"
+#define VKAD_ASM_WEAK(NAME)          "    .weak " #NAME "\n    .hidden " #NAME "\n"
+#endif
+
+/* the states of the registrations through which the thunks find their tables */
+#define VKAD_REGISTRATION_FREE    0
+#define VKAD_REGISTRATION_CLAIMED 1
+#define VKAD_REGISTRATION_READY   2
+
+/* the loader's dispatch table pointer at the start of every dispatchable handle, which is the same for a device and the queues and command buffers created from it */
+static void* vkadDispatchKey(const void* handle) {
+    return *REINTERPRET_CAST(void* const*, handle);
 }
-static void vkadLoadInstanceFunctions(PFN_vkGetInstanceProcAddr loader, VkInstance instance, VkadInstanceFunctions* functions) {
-    /* VK_VERSION_1_0 */                                                                                                                    
-    functions[0].DestroyInstance                                                   = REINTERPRET_CAST(PFN_vkDestroyInstance                                                   , loader(instance, "vkDestroyInstance"                                                 )) ;
-    functions[0].EnumeratePhysicalDevices                                          = REINTERPRET_CAST(PFN_vkEnumeratePhysicalDevices                                          , loader(instance, "vkEnumeratePhysicalDevices"                                        )) ;
-    functions[0].GetPhysicalDeviceFeatures                                         = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceFeatures                                         , loader(instance, "vkGetPhysicalDeviceFeatures"                                       )) ;
-    functions[0].GetPhysicalDeviceFormatProperties                                 = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceFormatProperties                                 , loader(instance, "vkGetPhysicalDeviceFormatProperties"                               )) ;
-    functions[0].GetPhysicalDeviceImageFormatProperties                            = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceImageFormatProperties                            , loader(instance, "vkGetPhysicalDeviceImageFormatProperties"                          )) ;
-    functions[0].GetPhysicalDeviceProperties                                       = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceProperties                                       , loader(instance, "vkGetPhysicalDeviceProperties"                                     )) ;
-    functions[0].GetPhysicalDeviceQueueFamilyProperties                            = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceQueueFamilyProperties                            , loader(instance, "vkGetPhysicalDeviceQueueFamilyProperties"                          )) ;
-    functions[0].GetPhysicalDeviceMemoryProperties                                 = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceMemoryProperties                                 , loader(instance, "vkGetPhysicalDeviceMemoryProperties"                               )) ;
-    functions[0].EnumerateDeviceExtensionProperties                                = REINTERPRET_CAST(PFN_vkEnumerateDeviceExtensionProperties                                , loader(instance, "vkEnumerateDeviceExtensionProperties"                              )) ;
-    functions[0].EnumerateDeviceLayerProperties                                    = REINTERPRET_CAST(PFN_vkEnumerateDeviceLayerProperties                                    , loader(instance, "vkEnumerateDeviceLayerProperties"                                  )) ;
-    functions[0].GetPhysicalDeviceSparseImageFormatProperties                      = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSparseImageFormatProperties                      , loader(instance, "vkGetPhysicalDeviceSparseImageFormatProperties"                    )) ;
-    functions[0].CreateDevice                                                      = REINTERPRET_CAST(PFN_vkCreateDevice                                                      , loader(instance, "vkCreateDevice"                                                    )) ;
-    functions[0].GetDeviceProcAddr                                                 = REINTERPRET_CAST(PFN_vkGetDeviceProcAddr                                                 , loader(instance, "vkGetDeviceProcAddr"                                               )) ;
-    /* VK_VERSION_1_1 */                                                             
-    functions[0].EnumeratePhysicalDeviceGroups                                     = REINTERPRET_CAST(PFN_vkEnumeratePhysicalDeviceGroups                                     , loader(instance, "vkEnumeratePhysicalDeviceGroups"                                   )) ;
-    functions[0].GetPhysicalDeviceFeatures2                                        = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceFeatures2                                        , loader(instance, "vkGetPhysicalDeviceFeatures2"                                      )) ;
-    functions[0].GetPhysicalDeviceProperties2                                      = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceProperties2                                      , loader(instance, "vkGetPhysicalDeviceProperties2"                                    )) ;
-    functions[0].GetPhysicalDeviceFormatProperties2                                = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceFormatProperties2                                , loader(instance, "vkGetPhysicalDeviceFormatProperties2"                              )) ;
-    functions[0].GetPhysicalDeviceImageFormatProperties2                           = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceImageFormatProperties2                           , loader(instance, "vkGetPhysicalDeviceImageFormatProperties2"                         )) ;
-    functions[0].GetPhysicalDeviceQueueFamilyProperties2                           = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceQueueFamilyProperties2                           , loader(instance, "vkGetPhysicalDeviceQueueFamilyProperties2"                         )) ;
-    functions[0].GetPhysicalDeviceMemoryProperties2                                = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceMemoryProperties2                                , loader(instance, "vkGetPhysicalDeviceMemoryProperties2"                              )) ;
-    functions[0].GetPhysicalDeviceSparseImageFormatProperties2                     = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSparseImageFormatProperties2                     , loader(instance, "vkGetPhysicalDeviceSparseImageFormatProperties2"                   )) ;
-    functions[0].GetPhysicalDeviceExternalBufferProperties                         = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceExternalBufferProperties                         , loader(instance, "vkGetPhysicalDeviceExternalBufferProperties"                       )) ;
-    functions[0].GetPhysicalDeviceExternalFenceProperties                          = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceExternalFenceProperties                          , loader(instance, "vkGetPhysicalDeviceExternalFenceProperties"                        )) ;
-    functions[0].GetPhysicalDeviceExternalSemaphoreProperties                      = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceExternalSemaphoreProperties                      , loader(instance, "vkGetPhysicalDeviceExternalSemaphoreProperties"                    )) ;
-    /* VK_VERSION_1_3 */                                                             
-    functions[0].GetPhysicalDeviceToolProperties                                   = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceToolProperties                                   , loader(instance, "vkGetPhysicalDeviceToolProperties"                                 )) ;
-    /* VK_KHR_surface spec_version 25  */                                            
-    functions[0].DestroySurfaceKHR                                                 = REINTERPRET_CAST(PFN_vkDestroySurfaceKHR                                                 , loader(instance, "vkDestroySurfaceKHR"                                               )) ;
-    functions[0].GetPhysicalDeviceSurfaceSupportKHR                                = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSurfaceSupportKHR                                , loader(instance, "vkGetPhysicalDeviceSurfaceSupportKHR"                              )) ;
-    functions[0].GetPhysicalDeviceSurfaceCapabilitiesKHR                           = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR                           , loader(instance, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR"                         )) ;
-    functions[0].GetPhysicalDeviceSurfaceFormatsKHR                                = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSurfaceFormatsKHR                                , loader(instance, "vkGetPhysicalDeviceSurfaceFormatsKHR"                              )) ;
-    functions[0].GetPhysicalDeviceSurfacePresentModesKHR                           = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSurfacePresentModesKHR                           , loader(instance, "vkGetPhysicalDeviceSurfacePresentModesKHR"                         )) ;
-    /* VK_KHR_swapchain spec_version 70  */                                          
-    functions[0].GetPhysicalDevicePresentRectanglesKHR                             = REINTERPRET_CAST(PFN_vkGetPhysicalDevicePresentRectanglesKHR                             , loader(instance, "vkGetPhysicalDevicePresentRectanglesKHR"                           )) ;
-    /* VK_KHR_display spec_version 23  */                                            
-    functions[0].GetPhysicalDeviceDisplayPropertiesKHR                             = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceDisplayPropertiesKHR                             , loader(instance, "vkGetPhysicalDeviceDisplayPropertiesKHR"                           )) ;
-    functions[0].GetPhysicalDeviceDisplayPlanePropertiesKHR                        = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR                        , loader(instance, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR"                      )) ;
-    functions[0].GetDisplayPlaneSupportedDisplaysKHR                               = REINTERPRET_CAST(PFN_vkGetDisplayPlaneSupportedDisplaysKHR                               , loader(instance, "vkGetDisplayPlaneSupportedDisplaysKHR"                             )) ;
-    functions[0].GetDisplayModePropertiesKHR                                       = REINTERPRET_CAST(PFN_vkGetDisplayModePropertiesKHR                                       , loader(instance, "vkGetDisplayModePropertiesKHR"                                     )) ;
-    functions[0].CreateDisplayModeKHR                                              = REINTERPRET_CAST(PFN_vkCreateDisplayModeKHR                                              , loader(instance, "vkCreateDisplayModeKHR"                                            )) ;
-    functions[0].GetDisplayPlaneCapabilitiesKHR                                    = REINTERPRET_CAST(PFN_vkGetDisplayPlaneCapabilitiesKHR                                    , loader(instance, "vkGetDisplayPlaneCapabilitiesKHR"                                  )) ;
-    functions[0].CreateDisplayPlaneSurfaceKHR                                      = REINTERPRET_CAST(PFN_vkCreateDisplayPlaneSurfaceKHR                                      , loader(instance, "vkCreateDisplayPlaneSurfaceKHR"                                    )) ;
-    /* VK_KHR_video_queue spec_version 8 */                                          
-    functions[0].GetPhysicalDeviceVideoCapabilitiesKHR                             = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceVideoCapabilitiesKHR                             , loader(instance, "vkGetPhysicalDeviceVideoCapabilitiesKHR"                           )) ;
-    functions[0].GetPhysicalDeviceVideoFormatPropertiesKHR                         = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceVideoFormatPropertiesKHR                         , loader(instance, "vkGetPhysicalDeviceVideoFormatPropertiesKHR"                       )) ;
-    /* VK_KHR_get_physical_device_properties2 spec_version 2 */                      
-    functions[0].GetPhysicalDeviceFeatures2KHR                                     = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceFeatures2KHR                                     , loader(instance, "vkGetPhysicalDeviceFeatures2KHR"                                   )) ;
-    functions[0].GetPhysicalDeviceProperties2KHR                                   = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceProperties2KHR                                   , loader(instance, "vkGetPhysicalDeviceProperties2KHR"                                 )) ;
-    functions[0].GetPhysicalDeviceFormatProperties2KHR                             = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceFormatProperties2KHR                             , loader(instance, "vkGetPhysicalDeviceFormatProperties2KHR"                           )) ;
-    functions[0].GetPhysicalDeviceImageFormatProperties2KHR                        = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceImageFormatProperties2KHR                        , loader(instance, "vkGetPhysicalDeviceImageFormatProperties2KHR"                      )) ;
-    functions[0].GetPhysicalDeviceQueueFamilyProperties2KHR                        = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceQueueFamilyProperties2KHR                        , loader(instance, "vkGetPhysicalDeviceQueueFamilyProperties2KHR"                      )) ;
-    functions[0].GetPhysicalDeviceMemoryProperties2KHR                             = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceMemoryProperties2KHR                             , loader(instance, "vkGetPhysicalDeviceMemoryProperties2KHR"                           )) ;
-    functions[0].GetPhysicalDeviceSparseImageFormatProperties2KHR                  = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSparseImageFormatProperties2KHR                  , loader(instance, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR"                )) ;
-    /* VK_KHR_device_group_creation spec_version 1 */                                
-    functions[0].EnumeratePhysicalDeviceGroupsKHR                                  = REINTERPRET_CAST(PFN_vkEnumeratePhysicalDeviceGroupsKHR                                  , loader(instance, "vkEnumeratePhysicalDeviceGroupsKHR"                                )) ;
-    /* VK_KHR_external_memory_capabilities spec_version 1 */                         
-    functions[0].GetPhysicalDeviceExternalBufferPropertiesKHR                      = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceExternalBufferPropertiesKHR                      , loader(instance, "vkGetPhysicalDeviceExternalBufferPropertiesKHR"                    )) ;
-    /* VK_KHR_external_semaphore_capabilities spec_version 1 */                      
-    functions[0].GetPhysicalDeviceExternalSemaphorePropertiesKHR                   = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR                   , loader(instance, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR"                 )) ;
-    /* VK_KHR_external_fence_capabilities spec_version 1 */                          
-    functions[0].GetPhysicalDeviceExternalFencePropertiesKHR                       = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR                       , loader(instance, "vkGetPhysicalDeviceExternalFencePropertiesKHR"                     )) ;
-    /* VK_KHR_performance_query spec_version 1 */                                    
-    functions[0].EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR     = REINTERPRET_CAST(PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR     , loader(instance, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR"   )) ;
-    functions[0].GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR             = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR             , loader(instance, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR"           )) ;
-    /* VK_KHR_get_surface_capabilities2 spec_version 1 */                            
-    functions[0].GetPhysicalDeviceSurfaceCapabilities2KHR                          = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR                          , loader(instance, "vkGetPhysicalDeviceSurfaceCapabilities2KHR"                        )) ;
-    functions[0].GetPhysicalDeviceSurfaceFormats2KHR                               = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSurfaceFormats2KHR                               , loader(instance, "vkGetPhysicalDeviceSurfaceFormats2KHR"                             )) ;
-    /* VK_KHR_get_display_properties2 spec_version 1 */                              
-    functions[0].GetPhysicalDeviceDisplayProperties2KHR                            = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceDisplayProperties2KHR                            , loader(instance, "vkGetPhysicalDeviceDisplayProperties2KHR"                          )) ;
-    functions[0].GetPhysicalDeviceDisplayPlaneProperties2KHR                       = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceDisplayPlaneProperties2KHR                       , loader(instance, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR"                     )) ;  
-    functions[0].GetDisplayModeProperties2KHR                                      = REINTERPRET_CAST(PFN_vkGetDisplayModeProperties2KHR                                      , loader(instance, "vkGetDisplayModeProperties2KHR"                                    )) ;
-    functions[0].GetDisplayPlaneCapabilities2KHR                                   = REINTERPRET_CAST(PFN_vkGetDisplayPlaneCapabilities2KHR                                   , loader(instance, "vkGetDisplayPlaneCapabilities2KHR"                                 )) ;
-    /* VK_KHR_fragment_shading_rate spec_version 2 */                                
-    functions[0].GetPhysicalDeviceFragmentShadingRatesKHR                          = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceFragmentShadingRatesKHR                          , loader(instance, "vkGetPhysicalDeviceFragmentShadingRatesKHR"                        )) ;
-    /* VK_KHR_video_encode_queue spec_version 12 */                                  
-    functions[0].GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR             = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR             , loader(instance, "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR"           )) ;
-    /* VK_KHR_cooperative_matrix spec_version 2 */                                   
-    functions[0].GetPhysicalDeviceCooperativeMatrixPropertiesKHR                   = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR                   , loader(instance, "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR"                 )) ;
-    /* VK_KHR_calibrated_timestamps spec_version 1 */                                
-    functions[0].GetPhysicalDeviceCalibrateableTimeDomainsKHR                      = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsKHR                      , loader(instance, "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR"                    )) ;
-    /* VK_EXT_debug_report spec_version 10 */                                        
-    functions[0].CreateDebugReportCallbackEXT                                      = REINTERPRET_CAST(PFN_vkCreateDebugReportCallbackEXT                                      , loader(instance, "vkCreateDebugReportCallbackEXT"                                    )) ;
-    functions[0].DestroyDebugReportCallbackEXT                                     = REINTERPRET_CAST(PFN_vkDestroyDebugReportCallbackEXT                                     , loader(instance, "vkDestroyDebugReportCallbackEXT"                                   )) ;
-    functions[0].DebugReportMessageEXT                                             = REINTERPRET_CAST(PFN_vkDebugReportMessageEXT                                             , loader(instance, "vkDebugReportMessageEXT"                                           )) ;
-    /* VK_NV_external_memory_capabilities spec_version 1 */                          
-    functions[0].GetPhysicalDeviceExternalImageFormatPropertiesNV                  = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV                  , loader(instance, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV"                )) ;
-    /* VK_EXT_direct_mode_display spec_version 1 */                                  
-    functions[0].ReleaseDisplayEXT                                                 = REINTERPRET_CAST(PFN_vkReleaseDisplayEXT                                                 , loader(instance, "vkReleaseDisplayEXT"                                               )) ;
-    /* VK_EXT_display_surface_counter spec_version 1 */                              
-    functions[0].GetPhysicalDeviceSurfaceCapabilities2EXT                          = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT                          , loader(instance, "vkGetPhysicalDeviceSurfaceCapabilities2EXT"                        )) ;
-    /* VK_EXT_debug_utils spec_version 2 */                                          
-    functions[0].CreateDebugUtilsMessengerEXT                                      = REINTERPRET_CAST(PFN_vkCreateDebugUtilsMessengerEXT                                      , loader(instance, "vkCreateDebugUtilsMessengerEXT"                                    )) ;
-    functions[0].DestroyDebugUtilsMessengerEXT                                     = REINTERPRET_CAST(PFN_vkDestroyDebugUtilsMessengerEXT                                     , loader(instance, "vkDestroyDebugUtilsMessengerEXT"                                   )) ;
-    functions[0].SubmitDebugUtilsMessageEXT                                        = REINTERPRET_CAST(PFN_vkSubmitDebugUtilsMessageEXT                                        , loader(instance, "vkSubmitDebugUtilsMessageEXT"                                      )) ;
-    /* VK_EXT_sample_locations spec_version 1 */                                     
-    functions[0].GetPhysicalDeviceMultisamplePropertiesEXT                         = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT                         , loader(instance, "vkGetPhysicalDeviceMultisamplePropertiesEXT"                       )) ;
-    /* VK_EXT_calibrated_timestamps spec_version 2 */                                
-    functions[0].GetPhysicalDeviceCalibrateableTimeDomainsEXT                      = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT                      , loader(instance, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT"                    )) ;
-    /* VK_EXT_tooling_info spec_version 1 */                                         
-    functions[0].GetPhysicalDeviceToolPropertiesEXT                                = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceToolPropertiesEXT                                , loader(instance, "vkGetPhysicalDeviceToolPropertiesEXT"                              )) ;
-    /* VK_NV_cooperative_matrix spec_version 1 */                                    
-    functions[0].GetPhysicalDeviceCooperativeMatrixPropertiesNV                    = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV                    , loader(instance, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV"                  )) ;
-    /* VK_NV_coverage_reduction_mode spec_version 1 */                               
-    functions[0].GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV   = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV   , loader(instance, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV" )) ;
-    /* VK_EXT_headless_surface spec_version 1 */                                     
-    functions[0].CreateHeadlessSurfaceEXT                                          = REINTERPRET_CAST(PFN_vkCreateHeadlessSurfaceEXT                                          , loader(instance, "vkCreateHeadlessSurfaceEXT"                                        )) ;
-    /* VK_EXT_acquire_drm_display spec_version 1 */                                  
-    functions[0].AcquireDrmDisplayEXT                                              = REINTERPRET_CAST(PFN_vkAcquireDrmDisplayEXT                                              , loader(instance, "vkAcquireDrmDisplayEXT"                                            )) ;
-    functions[0].GetDrmDisplayEXT                                                  = REINTERPRET_CAST(PFN_vkGetDrmDisplayEXT                                                  , loader(instance, "vkGetDrmDisplayEXT"                                                )) ;
-    /* VK_NV_optical_flow spec_version 1 */                                          
-    functions[0].GetPhysicalDeviceOpticalFlowImageFormatsNV                        = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceOpticalFlowImageFormatsNV                        , loader(instance, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV"                      )) ;
-    /* VK_KHR_android_surface spec_version 6 */                                      
-    functions[0].CreateAndroidSurfaceKHR                                           = REINTERPRET_CAST(PFN_vkCreateAndroidSurfaceKHR                                           , loader(instance, "vkCreateAndroidSurfaceKHR"                                         )) ;
-    /* VK_FUCHSIA_imagepipe_surface spec_version 1 */                                
-    functions[0].CreateImagePipeSurfaceFUCHSIA                                     = REINTERPRET_CAST(PFN_vkCreateImagePipeSurfaceFUCHSIA                                     , loader(instance, "vkCreateImagePipeSurfaceFUCHSIA"                                   )) ;
-    /* VK_MVK_ios_surface spec_version 3 */                                          
-    functions[0].CreateIOSSurfaceMVK                                               = REINTERPRET_CAST(PFN_vkCreateIOSSurfaceMVK                                               , loader(instance, "vkCreateIOSSurfaceMVK"                                             )) ;
-    /* VK_MVK_macos_surface spec_version 3 */                                        
-    functions[0].CreateMacOSSurfaceMVK                                             = REINTERPRET_CAST(PFN_vkCreateMacOSSurfaceMVK                                             , loader(instance, "vkCreateMacOSSurfaceMVK"                                           )) ;
-    /* VK_EXT_metal_surface spec_version 1 */                                        
-    functions[0].CreateMetalSurfaceEXT                                             = REINTERPRET_CAST(PFN_vkCreateMetalSurfaceEXT                                             , loader(instance, "vkCreateMetalSurfaceEXT"                                           )) ;
-    /* VK_NN_vi_surface spec_version 1 */                                            
-    functions[0].CreateViSurfaceNN                                                 = REINTERPRET_CAST(PFN_vkCreateViSurfaceNN                                                 , loader(instance, "vkCreateViSurfaceNN"                                               )) ;
-    /* VK_KHR_wayland_surface spec_version 6 */                                      
-    functions[0].CreateWaylandSurfaceKHR                                           = REINTERPRET_CAST(PFN_vkCreateWaylandSurfaceKHR                                           , loader(instance, "vkCreateWaylandSurfaceKHR"                                         )) ;
-    functions[0].GetPhysicalDeviceWaylandPresentationSupportKHR                    = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR                    , loader(instance, "vkGetPhysicalDeviceWaylandPresentationSupportKHR"                  )) ;
-    /* VK_KHR_win32_surface spec_version 6 */                                        
-    functions[0].CreateWin32SurfaceKHR                                             = REINTERPRET_CAST(PFN_vkCreateWin32SurfaceKHR                                             , loader(instance, "vkCreateWin32SurfaceKHR"                                           )) ;
-    functions[0].GetPhysicalDeviceWin32PresentationSupportKHR                      = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR                      , loader(instance, "vkGetPhysicalDeviceWin32PresentationSupportKHR"                    )) ;
-    /* VK_EXT_full_screen_exclusive spec_version 4 */                                
-    functions[0].GetPhysicalDeviceSurfacePresentModes2EXT                          = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceSurfacePresentModes2EXT                          , loader(instance, "vkGetPhysicalDeviceSurfacePresentModes2EXT"                        )) ;
-    /* VK_NV_acquire_winrt_display spec_version 1 */                                 
-    functions[0].AcquireWinrtDisplayNV                                             = REINTERPRET_CAST(PFN_vkAcquireWinrtDisplayNV                                             , loader(instance, "vkAcquireWinrtDisplayNV"                                           )) ;
-    functions[0].GetWinrtDisplayNV                                                 = REINTERPRET_CAST(PFN_vkGetWinrtDisplayNV                                                 , loader(instance, "vkGetWinrtDisplayNV"                                               )) ;
-    /* VK_KHR_xcb_surface spec_version 6 */                                          
-    functions[0].CreateXcbSurfaceKHR                                               = REINTERPRET_CAST(PFN_vkCreateXcbSurfaceKHR                                               , loader(instance, "vkCreateXcbSurfaceKHR"                                             )) ;
-    functions[0].GetPhysicalDeviceXcbPresentationSupportKHR                        = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR                        , loader(instance, "vkGetPhysicalDeviceXcbPresentationSupportKHR"                      )) ;
-    /* VK_KHR_xlib_surface spec_version 6 */                                         
-    functions[0].CreateXlibSurfaceKHR                                              = REINTERPRET_CAST(PFN_vkCreateXlibSurfaceKHR                                              , loader(instance, "vkCreateXlibSurfaceKHR"                                            )) ;
-    functions[0].GetPhysicalDeviceXlibPresentationSupportKHR                       = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR                       , loader(instance, "vkGetPhysicalDeviceXlibPresentationSupportKHR"                     )) ;
-    /* VK_EXT_directfb_surface spec_version 1 */                                     
-    functions[0].CreateDirectFBSurfaceEXT                                          = REINTERPRET_CAST(PFN_vkCreateDirectFBSurfaceEXT                                          , loader(instance, "vkCreateDirectFBSurfaceEXT"                                        )) ;
-    functions[0].GetPhysicalDeviceDirectFBPresentationSupportEXT                   = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceDirectFBPresentationSupportEXT                   , loader(instance, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT"                 )) ;
-    /* VK_EXT_acquire_xlib_display spec_version 1 */                                 
-    functions[0].AcquireXlibDisplayEXT                                             = REINTERPRET_CAST(PFN_vkAcquireXlibDisplayEXT                                             , loader(instance, "vkAcquireXlibDisplayEXT"                                           )) ;
-    functions[0].GetRandROutputDisplayEXT                                          = REINTERPRET_CAST(PFN_vkGetRandROutputDisplayEXT                                          , loader(instance, "vkGetRandROutputDisplayEXT"                                        )) ;
-    /* VK_GGP_stream_descriptor_surface spec_version 1 */                            
-    functions[0].CreateStreamDescriptorSurfaceGGP                                  = REINTERPRET_CAST(PFN_vkCreateStreamDescriptorSurfaceGGP                                  , loader(instance, "vkCreateStreamDescriptorSurfaceGGP"                                )) ;
-    /* VK_QNX_screen_surface spec_version 1 */                                       
-    functions[0].CreateScreenSurfaceQNX                                            = REINTERPRET_CAST(PFN_vkCreateScreenSurfaceQNX                                            , loader(instance, "vkCreateScreenSurfaceQNX"                                          )) ;
-    functions[0].GetPhysicalDeviceScreenPresentationSupportQNX                     = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceScreenPresentationSupportQNX                     , loader(instance, "vkGetPhysicalDeviceScreenPresentationSupportQNX"                   )) ;
-        /* Additions from 1.3.284 to 1.4.309: */
-    /* VK_NV_cooperative_vector spec_version 4 */
-    functions[0].GetPhysicalDeviceCooperativeVectorPropertiesNV                    = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceCooperativeVectorPropertiesNV                    , loader(instance, "vkGetPhysicalDeviceCooperativeVectorPropertiesNV"                  )) ;
-    /* VK_NV_cooperative_matrix2 spec_version 1 */
-    functions[0].GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV  = REINTERPRET_CAST(PFN_vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV  , loader(instance, "vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV")) ;
+#endif /* VKAD_HAS_THUNKS */
+#endif
+
+#ifdef VKAD_LAZY_LOADING
+/* lazy loading: every member of the table points to a thunk, which looks up the real function on its first call, writes it into the table and jumps to it.
+   Without thunks, vkadLoadDeviceFunctionsLazy loads the whole table immediately. */
+VKAD_API void vkadLoadDeviceFunctionsLazy     (PFN_vkGetDeviceProcAddr loader, VkDevice device, VkadDeviceFunctions* functions);
+VKAD_API void vkadReleaseDeviceFunctions      (VkadDeviceFunctions* functions);
+VKAD_API void vkadGetCalledDeviceFunctions    (const VkadDeviceFunctions* functions, VkadDeviceFunctionSet* called);
+VKAD_API void vkadLoadDeviceFunctionsPreloaded(PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkadDeviceFunctionSet* preload, VkadDeviceFunctions* functions);
+
+#if VKAD_HAS_DEFINITIONS
+#if VKAD_HAS_THUNKS
+/* maximum number of devices with a lazily loaded table at the same time; has to be the same in all translation units */
+#ifndef VKAD_MAX_LAZY_DEVICES
+#define VKAD_MAX_LAZY_DEVICES 64
+#endif
+/* number of thunks, has to be a literal for the assembler */
+#define VKAD_DEVICE_THUNK_COUNT 614
+typedef char VkadDeviceThunkCountCheck[(VKAD_DEVICE_THUNK_COUNT == VKAD_DEVICE_FUNCTION_COUNT) ? 1 : -1];
+
+/* the registration of a lazily loaded table: the thunks find it through the dispatch key of their first argument.
+   The registrations are a weak symbol, so all translation units share one list, and a table can be released in another file than the one it was loaded in. */
+typedef struct VkadLazyDeviceRegistration {
+    uint32_t                    state;      /* VKAD_REGISTRATION_FREE, _CLAIMED or _READY */
+    void*                       dispatchKey;
+    VkDevice                    device;
+    PFN_vkGetDeviceProcAddr     loader;
+    VkadDeviceFunctions*        functions;
+} VkadLazyDeviceRegistration;
+__attribute__((weak, visibility("hidden"))) VkadLazyDeviceRegistration vkadLazyDeviceRegistrations[VKAD_MAX_LAZY_DEVICES];
+
+/* every translation unit defines the thunks; the assembler conditional keeps a single copy when link time optimization merges them into one file */
+extern const unsigned char vkadDeviceThunks[] __asm__(VKAD_ASM_SYMBOL(vkadDeviceThunks)) __attribute__((visibility("hidden")));
+
+/* called by the thunk of the entry with the first argument of the call; returns the function to continue with */
+__attribute__((weak, visibility("hidden"), used)) PFN_vkVoidFunction vkadDeviceThunkResolve(const void* handle, uint32_t entry) {
+    const VkadLazyDeviceRegistration* registration = NULL;
+    void* dispatchKey = vkadDispatchKey(handle);
+    char name[VKAD_MAX_FUNCTION_NAME_SIZE];
+    PFN_vkVoidFunction function;
+    uint32_t i;
+    for (i = 0; i < VKAD_MAX_LAZY_DEVICES; ++i) {
+        const VkadLazyDeviceRegistration* candidate = &vkadLazyDeviceRegistrations[i];
+        if (__atomic_load_n(&candidate->state, __ATOMIC_ACQUIRE) != VKAD_REGISTRATION_READY) continue;
+        if (REINTERPRET_CAST(const void*, candidate->device) == handle) { registration = candidate; break; }
+        if (candidate->dispatchKey == dispatchKey && registration == NULL) registration = candidate;
+    }
+    /* calling a released table is invalid, this fails like a call of a NULL member */
+    if (registration == NULL) return NULL;
+    function = registration->loader(registration->device, vkadFunctionEntryName(&vkadDeviceFunctionEntries[entry], name));
+    /* a lazily loaded table never holds NULL, so an unsupported function gets its stub */
+    if (function == NULL) function = vkadUnsupportedStub(entry, vkadDeviceValueFunctions, sizeof(vkadDeviceValueFunctions) / sizeof(uint16_t));
+    /* several threads may get here for the same entry; they all store the same pointer */
+    __atomic_store_n(REINTERPRET_CAST(PFN_vkVoidFunction*, (REINTERPRET_CAST(char*, registration->functions) + vkadDeviceFunctionEntries[entry].memberOffset)), function, __ATOMIC_RELEASE);
+    return function;
 }
-static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice device, VkadDeviceFunctions* functions) {
-    /* VK_VERSION_1_0 */
-    functions[0].DestroyDevice                                                     = REINTERPRET_CAST(PFN_vkDestroyDevice                                                     , loader(device, "vkDestroyDevice"                                                 )) ;
-    functions[0].GetDeviceQueue                                                    = REINTERPRET_CAST(PFN_vkGetDeviceQueue                                                    , loader(device, "vkGetDeviceQueue"                                                )) ;
-    functions[0].QueueSubmit                                                       = REINTERPRET_CAST(PFN_vkQueueSubmit                                                       , loader(device, "vkQueueSubmit"                                                   )) ;
-    functions[0].QueueWaitIdle                                                     = REINTERPRET_CAST(PFN_vkQueueWaitIdle                                                     , loader(device, "vkQueueWaitIdle"                                                 )) ;
-    functions[0].DeviceWaitIdle                                                    = REINTERPRET_CAST(PFN_vkDeviceWaitIdle                                                    , loader(device, "vkDeviceWaitIdle"                                                )) ;
-    functions[0].AllocateMemory                                                    = REINTERPRET_CAST(PFN_vkAllocateMemory                                                    , loader(device, "vkAllocateMemory"                                                )) ;
-    functions[0].FreeMemory                                                        = REINTERPRET_CAST(PFN_vkFreeMemory                                                        , loader(device, "vkFreeMemory"                                                    )) ;
-    functions[0].MapMemory                                                         = REINTERPRET_CAST(PFN_vkMapMemory                                                         , loader(device, "vkMapMemory"                                                     )) ;
-    functions[0].UnmapMemory                                                       = REINTERPRET_CAST(PFN_vkUnmapMemory                                                       , loader(device, "vkUnmapMemory"                                                   )) ;
-    functions[0].FlushMappedMemoryRanges                                           = REINTERPRET_CAST(PFN_vkFlushMappedMemoryRanges                                           , loader(device, "vkFlushMappedMemoryRanges"                                       )) ;
-    functions[0].InvalidateMappedMemoryRanges                                      = REINTERPRET_CAST(PFN_vkInvalidateMappedMemoryRanges                                      , loader(device, "vkInvalidateMappedMemoryRanges"                                  )) ;
-    functions[0].GetDeviceMemoryCommitment                                         = REINTERPRET_CAST(PFN_vkGetDeviceMemoryCommitment                                         , loader(device, "vkGetDeviceMemoryCommitment"                                     )) ;
-    functions[0].BindBufferMemory                                                  = REINTERPRET_CAST(PFN_vkBindBufferMemory                                                  , loader(device, "vkBindBufferMemory"                                              )) ;
-    functions[0].BindImageMemory                                                   = REINTERPRET_CAST(PFN_vkBindImageMemory                                                   , loader(device, "vkBindImageMemory"                                               )) ;
-    functions[0].GetBufferMemoryRequirements                                       = REINTERPRET_CAST(PFN_vkGetBufferMemoryRequirements                                       , loader(device, "vkGetBufferMemoryRequirements"                                   )) ;
-    functions[0].GetImageMemoryRequirements                                        = REINTERPRET_CAST(PFN_vkGetImageMemoryRequirements                                        , loader(device, "vkGetImageMemoryRequirements"                                    )) ;
-    functions[0].GetImageSparseMemoryRequirements                                  = REINTERPRET_CAST(PFN_vkGetImageSparseMemoryRequirements                                  , loader(device, "vkGetImageSparseMemoryRequirements"                              )) ;
-    functions[0].QueueBindSparse                                                   = REINTERPRET_CAST(PFN_vkQueueBindSparse                                                   , loader(device, "vkQueueBindSparse"                                               )) ;
-    functions[0].CreateFence                                                       = REINTERPRET_CAST(PFN_vkCreateFence                                                       , loader(device, "vkCreateFence"                                                   )) ;
-    functions[0].DestroyFence                                                      = REINTERPRET_CAST(PFN_vkDestroyFence                                                      , loader(device, "vkDestroyFence"                                                  )) ;
-    functions[0].ResetFences                                                       = REINTERPRET_CAST(PFN_vkResetFences                                                       , loader(device, "vkResetFences"                                                   )) ;
-    functions[0].GetFenceStatus                                                    = REINTERPRET_CAST(PFN_vkGetFenceStatus                                                    , loader(device, "vkGetFenceStatus"                                                )) ;
-    functions[0].WaitForFences                                                     = REINTERPRET_CAST(PFN_vkWaitForFences                                                     , loader(device, "vkWaitForFences"                                                 )) ;
-    functions[0].CreateSemaphore                                                   = REINTERPRET_CAST(PFN_vkCreateSemaphore                                                   , loader(device, "vkCreateSemaphore"                                               )) ;
-    functions[0].DestroySemaphore                                                  = REINTERPRET_CAST(PFN_vkDestroySemaphore                                                  , loader(device, "vkDestroySemaphore"                                              )) ;
-    functions[0].CreateEvent                                                       = REINTERPRET_CAST(PFN_vkCreateEvent                                                       , loader(device, "vkCreateEvent"                                                   )) ;
-    functions[0].DestroyEvent                                                      = REINTERPRET_CAST(PFN_vkDestroyEvent                                                      , loader(device, "vkDestroyEvent"                                                  )) ;
-    functions[0].GetEventStatus                                                    = REINTERPRET_CAST(PFN_vkGetEventStatus                                                    , loader(device, "vkGetEventStatus"                                                )) ;
-    functions[0].SetEvent                                                          = REINTERPRET_CAST(PFN_vkSetEvent                                                          , loader(device, "vkSetEvent"                                                      )) ;
-    functions[0].ResetEvent                                                        = REINTERPRET_CAST(PFN_vkResetEvent                                                        , loader(device, "vkResetEvent"                                                    )) ;
-    functions[0].CreateQueryPool                                                   = REINTERPRET_CAST(PFN_vkCreateQueryPool                                                   , loader(device, "vkCreateQueryPool"                                               )) ;
-    functions[0].DestroyQueryPool                                                  = REINTERPRET_CAST(PFN_vkDestroyQueryPool                                                  , loader(device, "vkDestroyQueryPool"                                              )) ;
-    functions[0].GetQueryPoolResults                                               = REINTERPRET_CAST(PFN_vkGetQueryPoolResults                                               , loader(device, "vkGetQueryPoolResults"                                           )) ;
-    functions[0].CreateBuffer                                                      = REINTERPRET_CAST(PFN_vkCreateBuffer                                                      , loader(device, "vkCreateBuffer"                                                  )) ;
-    functions[0].DestroyBuffer                                                     = REINTERPRET_CAST(PFN_vkDestroyBuffer                                                     , loader(device, "vkDestroyBuffer"                                                 )) ;
-    functions[0].CreateBufferView                                                  = REINTERPRET_CAST(PFN_vkCreateBufferView                                                  , loader(device, "vkCreateBufferView"                                              )) ;
-    functions[0].DestroyBufferView                                                 = REINTERPRET_CAST(PFN_vkDestroyBufferView                                                 , loader(device, "vkDestroyBufferView"                                             )) ;
-    functions[0].CreateImage                                                       = REINTERPRET_CAST(PFN_vkCreateImage                                                       , loader(device, "vkCreateImage"                                                   )) ;
-    functions[0].DestroyImage                                                      = REINTERPRET_CAST(PFN_vkDestroyImage                                                      , loader(device, "vkDestroyImage"                                                  )) ;
-    functions[0].GetImageSubresourceLayout                                         = REINTERPRET_CAST(PFN_vkGetImageSubresourceLayout                                         , loader(device, "vkGetImageSubresourceLayout"                                     )) ;
-    functions[0].CreateImageView                                                   = REINTERPRET_CAST(PFN_vkCreateImageView                                                   , loader(device, "vkCreateImageView"                                               )) ;
-    functions[0].DestroyImageView                                                  = REINTERPRET_CAST(PFN_vkDestroyImageView                                                  , loader(device, "vkDestroyImageView"                                              )) ;
-    functions[0].CreateShaderModule                                                = REINTERPRET_CAST(PFN_vkCreateShaderModule                                                , loader(device, "vkCreateShaderModule"                                            )) ;
-    functions[0].DestroyShaderModule                                               = REINTERPRET_CAST(PFN_vkDestroyShaderModule                                               , loader(device, "vkDestroyShaderModule"                                           )) ;
-    functions[0].CreatePipelineCache                                               = REINTERPRET_CAST(PFN_vkCreatePipelineCache                                               , loader(device, "vkCreatePipelineCache"                                           )) ;
-    functions[0].DestroyPipelineCache                                              = REINTERPRET_CAST(PFN_vkDestroyPipelineCache                                              , loader(device, "vkDestroyPipelineCache"                                          )) ;
-    functions[0].GetPipelineCacheData                                              = REINTERPRET_CAST(PFN_vkGetPipelineCacheData                                              , loader(device, "vkGetPipelineCacheData"                                          )) ;
-    functions[0].MergePipelineCaches                                               = REINTERPRET_CAST(PFN_vkMergePipelineCaches                                               , loader(device, "vkMergePipelineCaches"                                           )) ;
-    functions[0].CreateGraphicsPipelines                                           = REINTERPRET_CAST(PFN_vkCreateGraphicsPipelines                                           , loader(device, "vkCreateGraphicsPipelines"                                       )) ;
-    functions[0].CreateComputePipelines                                            = REINTERPRET_CAST(PFN_vkCreateComputePipelines                                            , loader(device, "vkCreateComputePipelines"                                        )) ;
-    functions[0].DestroyPipeline                                                   = REINTERPRET_CAST(PFN_vkDestroyPipeline                                                   , loader(device, "vkDestroyPipeline"                                               )) ;
-    functions[0].CreatePipelineLayout                                              = REINTERPRET_CAST(PFN_vkCreatePipelineLayout                                              , loader(device, "vkCreatePipelineLayout"                                          )) ;
-    functions[0].DestroyPipelineLayout                                             = REINTERPRET_CAST(PFN_vkDestroyPipelineLayout                                             , loader(device, "vkDestroyPipelineLayout"                                         )) ;
-    functions[0].CreateSampler                                                     = REINTERPRET_CAST(PFN_vkCreateSampler                                                     , loader(device, "vkCreateSampler"                                                 )) ;
-    functions[0].DestroySampler                                                    = REINTERPRET_CAST(PFN_vkDestroySampler                                                    , loader(device, "vkDestroySampler"                                                )) ;
-    functions[0].CreateDescriptorSetLayout                                         = REINTERPRET_CAST(PFN_vkCreateDescriptorSetLayout                                         , loader(device, "vkCreateDescriptorSetLayout"                                     )) ;
-    functions[0].DestroyDescriptorSetLayout                                        = REINTERPRET_CAST(PFN_vkDestroyDescriptorSetLayout                                        , loader(device, "vkDestroyDescriptorSetLayout"                                    )) ;
-    functions[0].CreateDescriptorPool                                              = REINTERPRET_CAST(PFN_vkCreateDescriptorPool                                              , loader(device, "vkCreateDescriptorPool"                                          )) ;
-    functions[0].DestroyDescriptorPool                                             = REINTERPRET_CAST(PFN_vkDestroyDescriptorPool                                             , loader(device, "vkDestroyDescriptorPool"                                         )) ;
-    functions[0].ResetDescriptorPool                                               = REINTERPRET_CAST(PFN_vkResetDescriptorPool                                               , loader(device, "vkResetDescriptorPool"                                           )) ;
-    functions[0].AllocateDescriptorSets                                            = REINTERPRET_CAST(PFN_vkAllocateDescriptorSets                                            , loader(device, "vkAllocateDescriptorSets"                                        )) ;
-    functions[0].FreeDescriptorSets                                                = REINTERPRET_CAST(PFN_vkFreeDescriptorSets                                                , loader(device, "vkFreeDescriptorSets"                                            )) ;
-    functions[0].UpdateDescriptorSets                                              = REINTERPRET_CAST(PFN_vkUpdateDescriptorSets                                              , loader(device, "vkUpdateDescriptorSets"                                          )) ;
-    functions[0].CreateFramebuffer                                                 = REINTERPRET_CAST(PFN_vkCreateFramebuffer                                                 , loader(device, "vkCreateFramebuffer"                                             )) ;
-    functions[0].DestroyFramebuffer                                                = REINTERPRET_CAST(PFN_vkDestroyFramebuffer                                                , loader(device, "vkDestroyFramebuffer"                                            )) ;
-    functions[0].CreateRenderPass                                                  = REINTERPRET_CAST(PFN_vkCreateRenderPass                                                  , loader(device, "vkCreateRenderPass"                                              )) ;
-    functions[0].DestroyRenderPass                                                 = REINTERPRET_CAST(PFN_vkDestroyRenderPass                                                 , loader(device, "vkDestroyRenderPass"                                             )) ;
-    functions[0].GetRenderAreaGranularity                                          = REINTERPRET_CAST(PFN_vkGetRenderAreaGranularity                                          , loader(device, "vkGetRenderAreaGranularity"                                      )) ;
-    functions[0].CreateCommandPool                                                 = REINTERPRET_CAST(PFN_vkCreateCommandPool                                                 , loader(device, "vkCreateCommandPool"                                             )) ;
-    functions[0].DestroyCommandPool                                                = REINTERPRET_CAST(PFN_vkDestroyCommandPool                                                , loader(device, "vkDestroyCommandPool"                                            )) ;
-    functions[0].ResetCommandPool                                                  = REINTERPRET_CAST(PFN_vkResetCommandPool                                                  , loader(device, "vkResetCommandPool"                                              )) ;
-    functions[0].AllocateCommandBuffers                                            = REINTERPRET_CAST(PFN_vkAllocateCommandBuffers                                            , loader(device, "vkAllocateCommandBuffers"                                        )) ;
-    functions[0].FreeCommandBuffers                                                = REINTERPRET_CAST(PFN_vkFreeCommandBuffers                                                , loader(device, "vkFreeCommandBuffers"                                            )) ;
-    functions[0].BeginCommandBuffer                                                = REINTERPRET_CAST(PFN_vkBeginCommandBuffer                                                , loader(device, "vkBeginCommandBuffer"                                            )) ;
-    functions[0].EndCommandBuffer                                                  = REINTERPRET_CAST(PFN_vkEndCommandBuffer                                                  , loader(device, "vkEndCommandBuffer"                                              )) ;
-    functions[0].ResetCommandBuffer                                                = REINTERPRET_CAST(PFN_vkResetCommandBuffer                                                , loader(device, "vkResetCommandBuffer"                                            )) ;
-    functions[0].CmdBindPipeline                                                   = REINTERPRET_CAST(PFN_vkCmdBindPipeline                                                   , loader(device, "vkCmdBindPipeline"                                               )) ;
-    functions[0].CmdSetViewport                                                    = REINTERPRET_CAST(PFN_vkCmdSetViewport                                                    , loader(device, "vkCmdSetViewport"                                                )) ;
-    functions[0].CmdSetScissor                                                     = REINTERPRET_CAST(PFN_vkCmdSetScissor                                                     , loader(device, "vkCmdSetScissor"                                                 )) ;
-    functions[0].CmdSetLineWidth                                                   = REINTERPRET_CAST(PFN_vkCmdSetLineWidth                                                   , loader(device, "vkCmdSetLineWidth"                                               )) ;
-    functions[0].CmdSetDepthBias                                                   = REINTERPRET_CAST(PFN_vkCmdSetDepthBias                                                   , loader(device, "vkCmdSetDepthBias"                                               )) ;
-    functions[0].CmdSetBlendConstants                                              = REINTERPRET_CAST(PFN_vkCmdSetBlendConstants                                              , loader(device, "vkCmdSetBlendConstants"                                          )) ;
-    functions[0].CmdSetDepthBounds                                                 = REINTERPRET_CAST(PFN_vkCmdSetDepthBounds                                                 , loader(device, "vkCmdSetDepthBounds"                                             )) ;
-    functions[0].CmdSetStencilCompareMask                                          = REINTERPRET_CAST(PFN_vkCmdSetStencilCompareMask                                          , loader(device, "vkCmdSetStencilCompareMask"                                      )) ;
-    functions[0].CmdSetStencilWriteMask                                            = REINTERPRET_CAST(PFN_vkCmdSetStencilWriteMask                                            , loader(device, "vkCmdSetStencilWriteMask"                                        )) ;
-    functions[0].CmdSetStencilReference                                            = REINTERPRET_CAST(PFN_vkCmdSetStencilReference                                            , loader(device, "vkCmdSetStencilReference"                                        )) ;
-    functions[0].CmdBindDescriptorSets                                             = REINTERPRET_CAST(PFN_vkCmdBindDescriptorSets                                             , loader(device, "vkCmdBindDescriptorSets"                                         )) ;
-    functions[0].CmdBindIndexBuffer                                                = REINTERPRET_CAST(PFN_vkCmdBindIndexBuffer                                                , loader(device, "vkCmdBindIndexBuffer"                                            )) ;
-    functions[0].CmdBindVertexBuffers                                              = REINTERPRET_CAST(PFN_vkCmdBindVertexBuffers                                              , loader(device, "vkCmdBindVertexBuffers"                                          )) ;
-    functions[0].CmdDraw                                                           = REINTERPRET_CAST(PFN_vkCmdDraw                                                           , loader(device, "vkCmdDraw"                                                       )) ;
-    functions[0].CmdDrawIndexed                                                    = REINTERPRET_CAST(PFN_vkCmdDrawIndexed                                                    , loader(device, "vkCmdDrawIndexed"                                                )) ;
-    functions[0].CmdDrawIndirect                                                   = REINTERPRET_CAST(PFN_vkCmdDrawIndirect                                                   , loader(device, "vkCmdDrawIndirect"                                               )) ;
-    functions[0].CmdDrawIndexedIndirect                                            = REINTERPRET_CAST(PFN_vkCmdDrawIndexedIndirect                                            , loader(device, "vkCmdDrawIndexedIndirect"                                        )) ;
-    functions[0].CmdDispatch                                                       = REINTERPRET_CAST(PFN_vkCmdDispatch                                                       , loader(device, "vkCmdDispatch"                                                   )) ;
-    functions[0].CmdDispatchIndirect                                               = REINTERPRET_CAST(PFN_vkCmdDispatchIndirect                                               , loader(device, "vkCmdDispatchIndirect"                                           )) ;
-    functions[0].CmdCopyBuffer                                                     = REINTERPRET_CAST(PFN_vkCmdCopyBuffer                                                     , loader(device, "vkCmdCopyBuffer"                                                 )) ;
-    functions[0].CmdCopyImage                                                      = REINTERPRET_CAST(PFN_vkCmdCopyImage                                                      , loader(device, "vkCmdCopyImage"                                                  )) ;
-    functions[0].CmdBlitImage                                                      = REINTERPRET_CAST(PFN_vkCmdBlitImage                                                      , loader(device, "vkCmdBlitImage"                                                  )) ;
-    functions[0].CmdCopyBufferToImage                                              = REINTERPRET_CAST(PFN_vkCmdCopyBufferToImage                                              , loader(device, "vkCmdCopyBufferToImage"                                          )) ;
-    functions[0].CmdCopyImageToBuffer                                              = REINTERPRET_CAST(PFN_vkCmdCopyImageToBuffer                                              , loader(device, "vkCmdCopyImageToBuffer"                                          )) ;
-    functions[0].CmdUpdateBuffer                                                   = REINTERPRET_CAST(PFN_vkCmdUpdateBuffer                                                   , loader(device, "vkCmdUpdateBuffer"                                               )) ;
-    functions[0].CmdFillBuffer                                                     = REINTERPRET_CAST(PFN_vkCmdFillBuffer                                                     , loader(device, "vkCmdFillBuffer"                                                 )) ;
-    functions[0].CmdClearColorImage                                                = REINTERPRET_CAST(PFN_vkCmdClearColorImage                                                , loader(device, "vkCmdClearColorImage"                                            )) ;
-    functions[0].CmdClearDepthStencilImage                                         = REINTERPRET_CAST(PFN_vkCmdClearDepthStencilImage                                         , loader(device, "vkCmdClearDepthStencilImage"                                     )) ;
-    functions[0].CmdClearAttachments                                               = REINTERPRET_CAST(PFN_vkCmdClearAttachments                                               , loader(device, "vkCmdClearAttachments"                                           )) ;
-    functions[0].CmdResolveImage                                                   = REINTERPRET_CAST(PFN_vkCmdResolveImage                                                   , loader(device, "vkCmdResolveImage"                                               )) ;
-    functions[0].CmdSetEvent                                                       = REINTERPRET_CAST(PFN_vkCmdSetEvent                                                       , loader(device, "vkCmdSetEvent"                                                   )) ;
-    functions[0].CmdResetEvent                                                     = REINTERPRET_CAST(PFN_vkCmdResetEvent                                                     , loader(device, "vkCmdResetEvent"                                                 )) ;
-    functions[0].CmdWaitEvents                                                     = REINTERPRET_CAST(PFN_vkCmdWaitEvents                                                     , loader(device, "vkCmdWaitEvents"                                                 )) ;
-    functions[0].CmdPipelineBarrier                                                = REINTERPRET_CAST(PFN_vkCmdPipelineBarrier                                                , loader(device, "vkCmdPipelineBarrier"                                            )) ;
-    functions[0].CmdBeginQuery                                                     = REINTERPRET_CAST(PFN_vkCmdBeginQuery                                                     , loader(device, "vkCmdBeginQuery"                                                 )) ;
-    functions[0].CmdEndQuery                                                       = REINTERPRET_CAST(PFN_vkCmdEndQuery                                                       , loader(device, "vkCmdEndQuery"                                                   )) ;
-    functions[0].CmdResetQueryPool                                                 = REINTERPRET_CAST(PFN_vkCmdResetQueryPool                                                 , loader(device, "vkCmdResetQueryPool"                                             )) ;
-    functions[0].CmdWriteTimestamp                                                 = REINTERPRET_CAST(PFN_vkCmdWriteTimestamp                                                 , loader(device, "vkCmdWriteTimestamp"                                             )) ;
-    functions[0].CmdCopyQueryPoolResults                                           = REINTERPRET_CAST(PFN_vkCmdCopyQueryPoolResults                                           , loader(device, "vkCmdCopyQueryPoolResults"                                       )) ;
-    functions[0].CmdPushConstants                                                  = REINTERPRET_CAST(PFN_vkCmdPushConstants                                                  , loader(device, "vkCmdPushConstants"                                              )) ;
-    functions[0].CmdBeginRenderPass                                                = REINTERPRET_CAST(PFN_vkCmdBeginRenderPass                                                , loader(device, "vkCmdBeginRenderPass"                                            )) ;
-    functions[0].CmdNextSubpass                                                    = REINTERPRET_CAST(PFN_vkCmdNextSubpass                                                    , loader(device, "vkCmdNextSubpass"                                                )) ;
-    functions[0].CmdEndRenderPass                                                  = REINTERPRET_CAST(PFN_vkCmdEndRenderPass                                                  , loader(device, "vkCmdEndRenderPass"                                              )) ;
-    functions[0].CmdExecuteCommands                                                = REINTERPRET_CAST(PFN_vkCmdExecuteCommands                                                , loader(device, "vkCmdExecuteCommands"                                            )) ;
-    /* VK_VERSION_1_1 */                                                             
-    functions[0].BindBufferMemory2                                                 = REINTERPRET_CAST(PFN_vkBindBufferMemory2                                                 , loader(device, "vkBindBufferMemory2"                                             )) ;
-    functions[0].BindImageMemory2                                                  = REINTERPRET_CAST(PFN_vkBindImageMemory2                                                  , loader(device, "vkBindImageMemory2"                                              )) ;
-    functions[0].GetDeviceGroupPeerMemoryFeatures                                  = REINTERPRET_CAST(PFN_vkGetDeviceGroupPeerMemoryFeatures                                  , loader(device, "vkGetDeviceGroupPeerMemoryFeatures"                              )) ;
-    functions[0].CmdSetDeviceMask                                                  = REINTERPRET_CAST(PFN_vkCmdSetDeviceMask                                                  , loader(device, "vkCmdSetDeviceMask"                                              )) ;
-    functions[0].CmdDispatchBase                                                   = REINTERPRET_CAST(PFN_vkCmdDispatchBase                                                   , loader(device, "vkCmdDispatchBase"                                               )) ;
-    functions[0].GetImageMemoryRequirements2                                       = REINTERPRET_CAST(PFN_vkGetImageMemoryRequirements2                                       , loader(device, "vkGetImageMemoryRequirements2"                                   )) ;
-    functions[0].GetBufferMemoryRequirements2                                      = REINTERPRET_CAST(PFN_vkGetBufferMemoryRequirements2                                      , loader(device, "vkGetBufferMemoryRequirements2"                                  )) ;
-    functions[0].GetImageSparseMemoryRequirements2                                 = REINTERPRET_CAST(PFN_vkGetImageSparseMemoryRequirements2                                 , loader(device, "vkGetImageSparseMemoryRequirements2"                             )) ;
-    functions[0].TrimCommandPool                                                   = REINTERPRET_CAST(PFN_vkTrimCommandPool                                                   , loader(device, "vkTrimCommandPool"                                               )) ;
-    functions[0].GetDeviceQueue2                                                   = REINTERPRET_CAST(PFN_vkGetDeviceQueue2                                                   , loader(device, "vkGetDeviceQueue2"                                               )) ;
-    functions[0].CreateSamplerYcbcrConversion                                      = REINTERPRET_CAST(PFN_vkCreateSamplerYcbcrConversion                                      , loader(device, "vkCreateSamplerYcbcrConversion"                                  )) ;
-    functions[0].DestroySamplerYcbcrConversion                                     = REINTERPRET_CAST(PFN_vkDestroySamplerYcbcrConversion                                     , loader(device, "vkDestroySamplerYcbcrConversion"                                 )) ;
-    functions[0].CreateDescriptorUpdateTemplate                                    = REINTERPRET_CAST(PFN_vkCreateDescriptorUpdateTemplate                                    , loader(device, "vkCreateDescriptorUpdateTemplate"                                )) ;
-    functions[0].DestroyDescriptorUpdateTemplate                                   = REINTERPRET_CAST(PFN_vkDestroyDescriptorUpdateTemplate                                   , loader(device, "vkDestroyDescriptorUpdateTemplate"                               )) ;
-    functions[0].UpdateDescriptorSetWithTemplate                                   = REINTERPRET_CAST(PFN_vkUpdateDescriptorSetWithTemplate                                   , loader(device, "vkUpdateDescriptorSetWithTemplate"                               )) ;
-    functions[0].GetDescriptorSetLayoutSupport                                     = REINTERPRET_CAST(PFN_vkGetDescriptorSetLayoutSupport                                     , loader(device, "vkGetDescriptorSetLayoutSupport"                                 )) ;
-    /* VK_VERSION_1_2 */                                                             
-    functions[0].CmdDrawIndirectCount                                              = REINTERPRET_CAST(PFN_vkCmdDrawIndirectCount                                              , loader(device, "vkCmdDrawIndirectCount"                                          )) ;
-    functions[0].CmdDrawIndexedIndirectCount                                       = REINTERPRET_CAST(PFN_vkCmdDrawIndexedIndirectCount                                       , loader(device, "vkCmdDrawIndexedIndirectCount"                                   )) ;
-    functions[0].CreateRenderPass2                                                 = REINTERPRET_CAST(PFN_vkCreateRenderPass2                                                 , loader(device, "vkCreateRenderPass2"                                             )) ;
-    functions[0].CmdBeginRenderPass2                                               = REINTERPRET_CAST(PFN_vkCmdBeginRenderPass2                                               , loader(device, "vkCmdBeginRenderPass2"                                           )) ;
-    functions[0].CmdNextSubpass2                                                   = REINTERPRET_CAST(PFN_vkCmdNextSubpass2                                                   , loader(device, "vkCmdNextSubpass2"                                               )) ;
-    functions[0].CmdEndRenderPass2                                                 = REINTERPRET_CAST(PFN_vkCmdEndRenderPass2                                                 , loader(device, "vkCmdEndRenderPass2"                                             )) ;
-    functions[0].ResetQueryPool                                                    = REINTERPRET_CAST(PFN_vkResetQueryPool                                                    , loader(device, "vkResetQueryPool"                                                )) ;
-    functions[0].GetSemaphoreCounterValue                                          = REINTERPRET_CAST(PFN_vkGetSemaphoreCounterValue                                          , loader(device, "vkGetSemaphoreCounterValue"                                      )) ;
-    functions[0].WaitSemaphores                                                    = REINTERPRET_CAST(PFN_vkWaitSemaphores                                                    , loader(device, "vkWaitSemaphores"                                                )) ;
-    functions[0].SignalSemaphore                                                   = REINTERPRET_CAST(PFN_vkSignalSemaphore                                                   , loader(device, "vkSignalSemaphore"                                               )) ;
-    functions[0].GetBufferDeviceAddress                                            = REINTERPRET_CAST(PFN_vkGetBufferDeviceAddress                                            , loader(device, "vkGetBufferDeviceAddress"                                        )) ;
-    functions[0].GetBufferOpaqueCaptureAddress                                     = REINTERPRET_CAST(PFN_vkGetBufferOpaqueCaptureAddress                                     , loader(device, "vkGetBufferOpaqueCaptureAddress"                                 )) ;
-    functions[0].GetDeviceMemoryOpaqueCaptureAddress                               = REINTERPRET_CAST(PFN_vkGetDeviceMemoryOpaqueCaptureAddress                               , loader(device, "vkGetDeviceMemoryOpaqueCaptureAddress"                           )) ;
-    /* VK_VERSION_1_3 */                                                             
-    functions[0].CreatePrivateDataSlot                                             = REINTERPRET_CAST(PFN_vkCreatePrivateDataSlot                                             , loader(device, "vkCreatePrivateDataSlot"                                         )) ;
-    functions[0].DestroyPrivateDataSlot                                            = REINTERPRET_CAST(PFN_vkDestroyPrivateDataSlot                                            , loader(device, "vkDestroyPrivateDataSlot"                                        )) ;
-    functions[0].SetPrivateData                                                    = REINTERPRET_CAST(PFN_vkSetPrivateData                                                    , loader(device, "vkSetPrivateData"                                                )) ;
-    functions[0].GetPrivateData                                                    = REINTERPRET_CAST(PFN_vkGetPrivateData                                                    , loader(device, "vkGetPrivateData"                                                )) ;
-    functions[0].CmdSetEvent2                                                      = REINTERPRET_CAST(PFN_vkCmdSetEvent2                                                      , loader(device, "vkCmdSetEvent2"                                                  )) ;
-    functions[0].CmdResetEvent2                                                    = REINTERPRET_CAST(PFN_vkCmdResetEvent2                                                    , loader(device, "vkCmdResetEvent2"                                                )) ;
-    functions[0].CmdWaitEvents2                                                    = REINTERPRET_CAST(PFN_vkCmdWaitEvents2                                                    , loader(device, "vkCmdWaitEvents2"                                                )) ;
-    functions[0].CmdPipelineBarrier2                                               = REINTERPRET_CAST(PFN_vkCmdPipelineBarrier2                                               , loader(device, "vkCmdPipelineBarrier2"                                           )) ;
-    functions[0].CmdWriteTimestamp2                                                = REINTERPRET_CAST(PFN_vkCmdWriteTimestamp2                                                , loader(device, "vkCmdWriteTimestamp2"                                            )) ;
-    functions[0].QueueSubmit2                                                      = REINTERPRET_CAST(PFN_vkQueueSubmit2                                                      , loader(device, "vkQueueSubmit2"                                                  )) ;
-    functions[0].CmdCopyBuffer2                                                    = REINTERPRET_CAST(PFN_vkCmdCopyBuffer2                                                    , loader(device, "vkCmdCopyBuffer2"                                                )) ;
-    functions[0].CmdCopyImage2                                                     = REINTERPRET_CAST(PFN_vkCmdCopyImage2                                                     , loader(device, "vkCmdCopyImage2"                                                 )) ;
-    functions[0].CmdCopyBufferToImage2                                             = REINTERPRET_CAST(PFN_vkCmdCopyBufferToImage2                                             , loader(device, "vkCmdCopyBufferToImage2"                                         )) ;
-    functions[0].CmdCopyImageToBuffer2                                             = REINTERPRET_CAST(PFN_vkCmdCopyImageToBuffer2                                             , loader(device, "vkCmdCopyImageToBuffer2"                                         )) ;
-    functions[0].CmdBlitImage2                                                     = REINTERPRET_CAST(PFN_vkCmdBlitImage2                                                     , loader(device, "vkCmdBlitImage2"                                                 )) ;
-    functions[0].CmdResolveImage2                                                  = REINTERPRET_CAST(PFN_vkCmdResolveImage2                                                  , loader(device, "vkCmdResolveImage2"                                              )) ;
-    functions[0].CmdBeginRendering                                                 = REINTERPRET_CAST(PFN_vkCmdBeginRendering                                                 , loader(device, "vkCmdBeginRendering"                                             )) ;
-    functions[0].CmdEndRendering                                                   = REINTERPRET_CAST(PFN_vkCmdEndRendering                                                   , loader(device, "vkCmdEndRendering"                                               )) ;
-    functions[0].CmdSetCullMode                                                    = REINTERPRET_CAST(PFN_vkCmdSetCullMode                                                    , loader(device, "vkCmdSetCullMode"                                                )) ;
-    functions[0].CmdSetFrontFace                                                   = REINTERPRET_CAST(PFN_vkCmdSetFrontFace                                                   , loader(device, "vkCmdSetFrontFace"                                               )) ;
-    functions[0].CmdSetPrimitiveTopology                                           = REINTERPRET_CAST(PFN_vkCmdSetPrimitiveTopology                                           , loader(device, "vkCmdSetPrimitiveTopology"                                       )) ;
-    functions[0].CmdSetViewportWithCount                                           = REINTERPRET_CAST(PFN_vkCmdSetViewportWithCount                                           , loader(device, "vkCmdSetViewportWithCount"                                       )) ;
-    functions[0].CmdSetScissorWithCount                                            = REINTERPRET_CAST(PFN_vkCmdSetScissorWithCount                                            , loader(device, "vkCmdSetScissorWithCount"                                        )) ;
-    functions[0].CmdBindVertexBuffers2                                             = REINTERPRET_CAST(PFN_vkCmdBindVertexBuffers2                                             , loader(device, "vkCmdBindVertexBuffers2"                                         )) ;
-    functions[0].CmdSetDepthTestEnable                                             = REINTERPRET_CAST(PFN_vkCmdSetDepthTestEnable                                             , loader(device, "vkCmdSetDepthTestEnable"                                         )) ;
-    functions[0].CmdSetDepthWriteEnable                                            = REINTERPRET_CAST(PFN_vkCmdSetDepthWriteEnable                                            , loader(device, "vkCmdSetDepthWriteEnable"                                        )) ;
-    functions[0].CmdSetDepthCompareOp                                              = REINTERPRET_CAST(PFN_vkCmdSetDepthCompareOp                                              , loader(device, "vkCmdSetDepthCompareOp"                                          )) ;
-    functions[0].CmdSetDepthBoundsTestEnable                                       = REINTERPRET_CAST(PFN_vkCmdSetDepthBoundsTestEnable                                       , loader(device, "vkCmdSetDepthBoundsTestEnable"                                   )) ;
-    functions[0].CmdSetStencilTestEnable                                           = REINTERPRET_CAST(PFN_vkCmdSetStencilTestEnable                                           , loader(device, "vkCmdSetStencilTestEnable"                                       )) ;
-    functions[0].CmdSetStencilOp                                                   = REINTERPRET_CAST(PFN_vkCmdSetStencilOp                                                   , loader(device, "vkCmdSetStencilOp"                                               )) ;
-    functions[0].CmdSetRasterizerDiscardEnable                                     = REINTERPRET_CAST(PFN_vkCmdSetRasterizerDiscardEnable                                     , loader(device, "vkCmdSetRasterizerDiscardEnable"                                 )) ;
-    functions[0].CmdSetDepthBiasEnable                                             = REINTERPRET_CAST(PFN_vkCmdSetDepthBiasEnable                                             , loader(device, "vkCmdSetDepthBiasEnable"                                         )) ;
-    functions[0].CmdSetPrimitiveRestartEnable                                      = REINTERPRET_CAST(PFN_vkCmdSetPrimitiveRestartEnable                                      , loader(device, "vkCmdSetPrimitiveRestartEnable"                                  )) ;
-    functions[0].GetDeviceBufferMemoryRequirements                                 = REINTERPRET_CAST(PFN_vkGetDeviceBufferMemoryRequirements                                 , loader(device, "vkGetDeviceBufferMemoryRequirements"                             )) ;
-    functions[0].GetDeviceImageMemoryRequirements                                  = REINTERPRET_CAST(PFN_vkGetDeviceImageMemoryRequirements                                  , loader(device, "vkGetDeviceImageMemoryRequirements"                              )) ;
-    functions[0].GetDeviceImageSparseMemoryRequirements                            = REINTERPRET_CAST(PFN_vkGetDeviceImageSparseMemoryRequirements                            , loader(device, "vkGetDeviceImageSparseMemoryRequirements"                        )) ;
-    /* VK_KHR_swapchain spec_version 70  */                                          
-    functions[0].CreateSwapchainKHR                                                = REINTERPRET_CAST(PFN_vkCreateSwapchainKHR                                                , loader(device, "vkCreateSwapchainKHR"                                            )) ;
-    functions[0].DestroySwapchainKHR                                               = REINTERPRET_CAST(PFN_vkDestroySwapchainKHR                                               , loader(device, "vkDestroySwapchainKHR"                                           )) ;
-    functions[0].GetSwapchainImagesKHR                                             = REINTERPRET_CAST(PFN_vkGetSwapchainImagesKHR                                             , loader(device, "vkGetSwapchainImagesKHR"                                         )) ;
-    functions[0].AcquireNextImageKHR                                               = REINTERPRET_CAST(PFN_vkAcquireNextImageKHR                                               , loader(device, "vkAcquireNextImageKHR"                                           )) ;
-    functions[0].QueuePresentKHR                                                   = REINTERPRET_CAST(PFN_vkQueuePresentKHR                                                   , loader(device, "vkQueuePresentKHR"                                               )) ;
-    functions[0].GetDeviceGroupPresentCapabilitiesKHR                              = REINTERPRET_CAST(PFN_vkGetDeviceGroupPresentCapabilitiesKHR                              , loader(device, "vkGetDeviceGroupPresentCapabilitiesKHR"                          )) ;
-    functions[0].GetDeviceGroupSurfacePresentModesKHR                              = REINTERPRET_CAST(PFN_vkGetDeviceGroupSurfacePresentModesKHR                              , loader(device, "vkGetDeviceGroupSurfacePresentModesKHR"                          )) ;
-    functions[0].AcquireNextImage2KHR                                              = REINTERPRET_CAST(PFN_vkAcquireNextImage2KHR                                              , loader(device, "vkAcquireNextImage2KHR"                                          )) ;
-    /* VK_KHR_display_swapchain spec_version 10  */                                  
-    functions[0].CreateSharedSwapchainsKHR                                         = REINTERPRET_CAST(PFN_vkCreateSharedSwapchainsKHR                                         , loader(device, "vkCreateSharedSwapchainsKHR"                                     )) ;
-    /* VK_KHR_video_queue spec_version 8 */                                          
-    functions[0].CreateVideoSessionKHR                                             = REINTERPRET_CAST(PFN_vkCreateVideoSessionKHR                                             , loader(device, "vkCreateVideoSessionKHR"                                         )) ;
-    functions[0].DestroyVideoSessionKHR                                            = REINTERPRET_CAST(PFN_vkDestroyVideoSessionKHR                                            , loader(device, "vkDestroyVideoSessionKHR"                                        )) ;
-    functions[0].GetVideoSessionMemoryRequirementsKHR                              = REINTERPRET_CAST(PFN_vkGetVideoSessionMemoryRequirementsKHR                              , loader(device, "vkGetVideoSessionMemoryRequirementsKHR"                          )) ;
-    functions[0].BindVideoSessionMemoryKHR                                         = REINTERPRET_CAST(PFN_vkBindVideoSessionMemoryKHR                                         , loader(device, "vkBindVideoSessionMemoryKHR"                                     )) ;
-    functions[0].CreateVideoSessionParametersKHR                                   = REINTERPRET_CAST(PFN_vkCreateVideoSessionParametersKHR                                   , loader(device, "vkCreateVideoSessionParametersKHR"                               )) ;
-    functions[0].UpdateVideoSessionParametersKHR                                   = REINTERPRET_CAST(PFN_vkUpdateVideoSessionParametersKHR                                   , loader(device, "vkUpdateVideoSessionParametersKHR"                               )) ;
-    functions[0].DestroyVideoSessionParametersKHR                                  = REINTERPRET_CAST(PFN_vkDestroyVideoSessionParametersKHR                                  , loader(device, "vkDestroyVideoSessionParametersKHR"                              )) ;
-    functions[0].CmdBeginVideoCodingKHR                                            = REINTERPRET_CAST(PFN_vkCmdBeginVideoCodingKHR                                            , loader(device, "vkCmdBeginVideoCodingKHR"                                        )) ;
-    functions[0].CmdEndVideoCodingKHR                                              = REINTERPRET_CAST(PFN_vkCmdEndVideoCodingKHR                                              , loader(device, "vkCmdEndVideoCodingKHR"                                          )) ;
-    functions[0].CmdControlVideoCodingKHR                                          = REINTERPRET_CAST(PFN_vkCmdControlVideoCodingKHR                                          , loader(device, "vkCmdControlVideoCodingKHR"                                      )) ;
-    /* VK_KHR_video_decode_queue spec_version 8 */                                   
-    functions[0].CmdDecodeVideoKHR                                                 = REINTERPRET_CAST(PFN_vkCmdDecodeVideoKHR                                                 , loader(device, "vkCmdDecodeVideoKHR"                                             )) ;
-    /* VK_KHR_dynamic_rendering spec_version 1 */                                    
-    functions[0].CmdBeginRenderingKHR                                              = REINTERPRET_CAST(PFN_vkCmdBeginRenderingKHR                                              , loader(device, "vkCmdBeginRenderingKHR"                                          )) ;
-    functions[0].CmdEndRenderingKHR                                                = REINTERPRET_CAST(PFN_vkCmdEndRenderingKHR                                                , loader(device, "vkCmdEndRenderingKHR"                                            )) ;
-    /* VK_KHR_device_group spec_version 4 */                                         
-    functions[0].GetDeviceGroupPeerMemoryFeaturesKHR                               = REINTERPRET_CAST(PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR                               , loader(device, "vkGetDeviceGroupPeerMemoryFeaturesKHR"                           )) ;
-    functions[0].CmdSetDeviceMaskKHR                                               = REINTERPRET_CAST(PFN_vkCmdSetDeviceMaskKHR                                               , loader(device, "vkCmdSetDeviceMaskKHR"                                           )) ;
-    functions[0].CmdDispatchBaseKHR                                                = REINTERPRET_CAST(PFN_vkCmdDispatchBaseKHR                                                , loader(device, "vkCmdDispatchBaseKHR"                                            )) ;
-    /* VK_KHR_maintenance1 spec_version 2 */                                         
-    functions[0].TrimCommandPoolKHR                                                = REINTERPRET_CAST(PFN_vkTrimCommandPoolKHR                                                , loader(device, "vkTrimCommandPoolKHR"                                            )) ;
-    /* VK_KHR_external_memory_fd spec_version 1 */                                   
-    functions[0].GetMemoryFdKHR                                                    = REINTERPRET_CAST(PFN_vkGetMemoryFdKHR                                                    , loader(device, "vkGetMemoryFdKHR"                                                )) ;
-    functions[0].GetMemoryFdPropertiesKHR                                          = REINTERPRET_CAST(PFN_vkGetMemoryFdPropertiesKHR                                          , loader(device, "vkGetMemoryFdPropertiesKHR"                                      )) ;
-    /* VK_KHR_external_semaphore_fd spec_version 1 */                                
-    functions[0].ImportSemaphoreFdKHR                                              = REINTERPRET_CAST(PFN_vkImportSemaphoreFdKHR                                              , loader(device, "vkImportSemaphoreFdKHR"                                          )) ;
-    functions[0].GetSemaphoreFdKHR                                                 = REINTERPRET_CAST(PFN_vkGetSemaphoreFdKHR                                                 , loader(device, "vkGetSemaphoreFdKHR"                                             )) ;
-    /* VK_KHR_push_descriptor spec_version 2 */                                      
-    functions[0].CmdPushDescriptorSetKHR                                           = REINTERPRET_CAST(PFN_vkCmdPushDescriptorSetKHR                                           , loader(device, "vkCmdPushDescriptorSetKHR"                                       )) ;
-    functions[0].CmdPushDescriptorSetWithTemplateKHR                               = REINTERPRET_CAST(PFN_vkCmdPushDescriptorSetWithTemplateKHR                               , loader(device, "vkCmdPushDescriptorSetWithTemplateKHR"                           )) ;
-    /* VK_KHR_descriptor_update_template spec_version 1 */                           
-    functions[0].CreateDescriptorUpdateTemplateKHR                                 = REINTERPRET_CAST(PFN_vkCreateDescriptorUpdateTemplateKHR                                 , loader(device, "vkCreateDescriptorUpdateTemplateKHR"                             )) ;
-    functions[0].DestroyDescriptorUpdateTemplateKHR                                = REINTERPRET_CAST(PFN_vkDestroyDescriptorUpdateTemplateKHR                                , loader(device, "vkDestroyDescriptorUpdateTemplateKHR"                            )) ;
-    functions[0].UpdateDescriptorSetWithTemplateKHR                                = REINTERPRET_CAST(PFN_vkUpdateDescriptorSetWithTemplateKHR                                , loader(device, "vkUpdateDescriptorSetWithTemplateKHR"                            )) ;
-    /* VK_KHR_create_renderpass2 spec_version 1 */                                   
-    functions[0].CreateRenderPass2KHR                                              = REINTERPRET_CAST(PFN_vkCreateRenderPass2KHR                                              , loader(device, "vkCreateRenderPass2KHR"                                          )) ;
-    functions[0].CmdBeginRenderPass2KHR                                            = REINTERPRET_CAST(PFN_vkCmdBeginRenderPass2KHR                                            , loader(device, "vkCmdBeginRenderPass2KHR"                                        )) ;
-    functions[0].CmdNextSubpass2KHR                                                = REINTERPRET_CAST(PFN_vkCmdNextSubpass2KHR                                                , loader(device, "vkCmdNextSubpass2KHR"                                            )) ;
-    functions[0].CmdEndRenderPass2KHR                                              = REINTERPRET_CAST(PFN_vkCmdEndRenderPass2KHR                                              , loader(device, "vkCmdEndRenderPass2KHR"                                          )) ;
-    /* VK_KHR_shared_presentable_image spec_version 1 */                             
-    functions[0].GetSwapchainStatusKHR                                             = REINTERPRET_CAST(PFN_vkGetSwapchainStatusKHR                                             , loader(device, "vkGetSwapchainStatusKHR"                                         )) ;
-    /* VK_KHR_external_fence_fd spec_version 1 */                                    
-    functions[0].ImportFenceFdKHR                                                  = REINTERPRET_CAST(PFN_vkImportFenceFdKHR                                                  , loader(device, "vkImportFenceFdKHR"                                              )) ;
-    functions[0].GetFenceFdKHR                                                     = REINTERPRET_CAST(PFN_vkGetFenceFdKHR                                                     , loader(device, "vkGetFenceFdKHR"                                                 )) ;
-    /* VK_KHR_performance_query spec_version 1 */                                    
-    functions[0].AcquireProfilingLockKHR                                           = REINTERPRET_CAST(PFN_vkAcquireProfilingLockKHR                                           , loader(device, "vkAcquireProfilingLockKHR"                                       )) ;
-    functions[0].ReleaseProfilingLockKHR                                           = REINTERPRET_CAST(PFN_vkReleaseProfilingLockKHR                                           , loader(device, "vkReleaseProfilingLockKHR"                                       )) ;
-    /* VK_KHR_get_memory_requirements2 spec_version 1 */                             
-    functions[0].GetImageMemoryRequirements2KHR                                    = REINTERPRET_CAST(PFN_vkGetImageMemoryRequirements2KHR                                    , loader(device, "vkGetImageMemoryRequirements2KHR"                                )) ;
-    functions[0].GetBufferMemoryRequirements2KHR                                   = REINTERPRET_CAST(PFN_vkGetBufferMemoryRequirements2KHR                                   , loader(device, "vkGetBufferMemoryRequirements2KHR"                               )) ;
-    functions[0].GetImageSparseMemoryRequirements2KHR                              = REINTERPRET_CAST(PFN_vkGetImageSparseMemoryRequirements2KHR                              , loader(device, "vkGetImageSparseMemoryRequirements2KHR"                          )) ;
-    /* VK_KHR_sampler_ycbcr_conversion spec_version 14 */                            
-    functions[0].CreateSamplerYcbcrConversionKHR                                   = REINTERPRET_CAST(PFN_vkCreateSamplerYcbcrConversionKHR                                   , loader(device, "vkCreateSamplerYcbcrConversionKHR"                               )) ;
-    functions[0].DestroySamplerYcbcrConversionKHR                                  = REINTERPRET_CAST(PFN_vkDestroySamplerYcbcrConversionKHR                                  , loader(device, "vkDestroySamplerYcbcrConversionKHR"                              )) ;
-    /* VK_KHR_bind_memory2 spec_version 1 */                                         
-    functions[0].BindBufferMemory2KHR                                              = REINTERPRET_CAST(PFN_vkBindBufferMemory2KHR                                              , loader(device, "vkBindBufferMemory2KHR"                                          )) ;
-    functions[0].BindImageMemory2KHR                                               = REINTERPRET_CAST(PFN_vkBindImageMemory2KHR                                               , loader(device, "vkBindImageMemory2KHR"                                           )) ;
-    /* VK_KHR_maintenance3 spec_version 1 */                                         
-    functions[0].GetDescriptorSetLayoutSupportKHR                                  = REINTERPRET_CAST(PFN_vkGetDescriptorSetLayoutSupportKHR                                  , loader(device, "vkGetDescriptorSetLayoutSupportKHR"                              )) ;
-    /* VK_KHR_draw_indirect_count spec_version 1 */                                  
-    functions[0].CmdDrawIndirectCountKHR                                           = REINTERPRET_CAST(PFN_vkCmdDrawIndirectCountKHR                                           , loader(device, "vkCmdDrawIndirectCountKHR"                                       )) ;
-    functions[0].CmdDrawIndexedIndirectCountKHR                                    = REINTERPRET_CAST(PFN_vkCmdDrawIndexedIndirectCountKHR                                    , loader(device, "vkCmdDrawIndexedIndirectCountKHR"                                )) ;
-    /* VK_KHR_timeline_semaphore spec_version 2 */                                   
-    functions[0].GetSemaphoreCounterValueKHR                                       = REINTERPRET_CAST(PFN_vkGetSemaphoreCounterValueKHR                                       , loader(device, "vkGetSemaphoreCounterValueKHR"                                   )) ;
-    functions[0].WaitSemaphoresKHR                                                 = REINTERPRET_CAST(PFN_vkWaitSemaphoresKHR                                                 , loader(device, "vkWaitSemaphoresKHR"                                             )) ;
-    functions[0].SignalSemaphoreKHR                                                = REINTERPRET_CAST(PFN_vkSignalSemaphoreKHR                                                , loader(device, "vkSignalSemaphoreKHR"                                            )) ;
-    /* VK_KHR_fragment_shading_rate spec_version 2 */                                
-    functions[0].CmdSetFragmentShadingRateKHR                                      = REINTERPRET_CAST(PFN_vkCmdSetFragmentShadingRateKHR                                      , loader(device, "vkCmdSetFragmentShadingRateKHR"                                  )) ;
-    /* VK_KHR_dynamic_rendering_local_read spec_version 1 */                         
-    functions[0].CmdSetRenderingAttachmentLocationsKHR                             = REINTERPRET_CAST(PFN_vkCmdSetRenderingAttachmentLocationsKHR                             , loader(device, "vkCmdSetRenderingAttachmentLocationsKHR"                         )) ;
-    functions[0].CmdSetRenderingInputAttachmentIndicesKHR                          = REINTERPRET_CAST(PFN_vkCmdSetRenderingInputAttachmentIndicesKHR                          , loader(device, "vkCmdSetRenderingInputAttachmentIndicesKHR"                      )) ;
-    /* VK_KHR_present_wait spec_version 1 */                                         
-    functions[0].WaitForPresentKHR                                                 = REINTERPRET_CAST(PFN_vkWaitForPresentKHR                                                 , loader(device, "vkWaitForPresentKHR"                                             )) ;
-    /* VK_KHR_buffer_device_address spec_version 1 */                                
-    functions[0].GetBufferDeviceAddressKHR                                         = REINTERPRET_CAST(PFN_vkGetBufferDeviceAddressKHR                                         , loader(device, "vkGetBufferDeviceAddressKHR"                                     )) ;
-    functions[0].GetBufferOpaqueCaptureAddressKHR                                  = REINTERPRET_CAST(PFN_vkGetBufferOpaqueCaptureAddressKHR                                  , loader(device, "vkGetBufferOpaqueCaptureAddressKHR"                              )) ;
-    functions[0].GetDeviceMemoryOpaqueCaptureAddressKHR                            = REINTERPRET_CAST(PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR                            , loader(device, "vkGetDeviceMemoryOpaqueCaptureAddressKHR"                        )) ;
-    /* VK_KHR_deferred_host_operations spec_version 4 */                             
-    functions[0].CreateDeferredOperationKHR                                        = REINTERPRET_CAST(PFN_vkCreateDeferredOperationKHR                                        , loader(device, "vkCreateDeferredOperationKHR"                                    )) ;
-    functions[0].DestroyDeferredOperationKHR                                       = REINTERPRET_CAST(PFN_vkDestroyDeferredOperationKHR                                       , loader(device, "vkDestroyDeferredOperationKHR"                                   )) ;
-    functions[0].GetDeferredOperationMaxConcurrencyKHR                             = REINTERPRET_CAST(PFN_vkGetDeferredOperationMaxConcurrencyKHR                             , loader(device, "vkGetDeferredOperationMaxConcurrencyKHR"                         )) ;
-    functions[0].GetDeferredOperationResultKHR                                     = REINTERPRET_CAST(PFN_vkGetDeferredOperationResultKHR                                     , loader(device, "vkGetDeferredOperationResultKHR"                                 )) ;
-    functions[0].DeferredOperationJoinKHR                                          = REINTERPRET_CAST(PFN_vkDeferredOperationJoinKHR                                          , loader(device, "vkDeferredOperationJoinKHR"                                      )) ;
-    /* VK_KHR_pipeline_executable_properties spec_version 1 */                       
-    functions[0].GetPipelineExecutablePropertiesKHR                                = REINTERPRET_CAST(PFN_vkGetPipelineExecutablePropertiesKHR                                , loader(device, "vkGetPipelineExecutablePropertiesKHR"                            )) ;
-    functions[0].GetPipelineExecutableStatisticsKHR                                = REINTERPRET_CAST(PFN_vkGetPipelineExecutableStatisticsKHR                                , loader(device, "vkGetPipelineExecutableStatisticsKHR"                            )) ;
-    functions[0].GetPipelineExecutableInternalRepresentationsKHR                   = REINTERPRET_CAST(PFN_vkGetPipelineExecutableInternalRepresentationsKHR                   , loader(device, "vkGetPipelineExecutableInternalRepresentationsKHR"               )) ;
-    /* VK_KHR_map_memory2 spec_version 1 */                                          
-    functions[0].MapMemory2KHR                                                     = REINTERPRET_CAST(PFN_vkMapMemory2KHR                                                     , loader(device, "vkMapMemory2KHR"                                                 )) ;
-    functions[0].UnmapMemory2KHR                                                   = REINTERPRET_CAST(PFN_vkUnmapMemory2KHR                                                   , loader(device, "vkUnmapMemory2KHR"                                               )) ;
-    /* VK_KHR_video_encode_queue spec_version 12 */                                  
-    functions[0].GetEncodedVideoSessionParametersKHR                               = REINTERPRET_CAST(PFN_vkGetEncodedVideoSessionParametersKHR                               , loader(device, "vkGetEncodedVideoSessionParametersKHR"                           )) ;
-    functions[0].CmdEncodeVideoKHR                                                 = REINTERPRET_CAST(PFN_vkCmdEncodeVideoKHR                                                 , loader(device, "vkCmdEncodeVideoKHR"                                             )) ;
-    /* VK_KHR_synchronization2 spec_version 1 */
-    functions[0].CmdSetEvent2KHR                                                   = REINTERPRET_CAST(PFN_vkCmdSetEvent2KHR                                                   , loader(device, "vkCmdSetEvent2KHR"                                               )) ;
-    functions[0].CmdResetEvent2KHR                                                 = REINTERPRET_CAST(PFN_vkCmdResetEvent2KHR                                                 , loader(device, "vkCmdResetEvent2KHR"                                             )) ;
-    functions[0].CmdWaitEvents2KHR                                                 = REINTERPRET_CAST(PFN_vkCmdWaitEvents2KHR                                                 , loader(device, "vkCmdWaitEvents2KHR"                                             )) ;
-    functions[0].CmdPipelineBarrier2KHR                                            = REINTERPRET_CAST(PFN_vkCmdPipelineBarrier2KHR                                            , loader(device, "vkCmdPipelineBarrier2KHR"                                        )) ;
-    functions[0].CmdWriteTimestamp2KHR                                             = REINTERPRET_CAST(PFN_vkCmdWriteTimestamp2KHR                                             , loader(device, "vkCmdWriteTimestamp2KHR"                                         )) ;
-    functions[0].QueueSubmit2KHR                                                   = REINTERPRET_CAST(PFN_vkQueueSubmit2KHR                                                   , loader(device, "vkQueueSubmit2KHR"                                               )) ;
-    functions[0].CmdWriteBufferMarker2AMD                                          = REINTERPRET_CAST(PFN_vkCmdWriteBufferMarker2AMD                                          , loader(device, "vkCmdWriteBufferMarker2AMD"                                      )) ;
-    functions[0].GetQueueCheckpointData2NV                                         = REINTERPRET_CAST(PFN_vkGetQueueCheckpointData2NV                                         , loader(device, "vkGetQueueCheckpointData2NV"                                     )) ;
-                /* NOTE: The function vkCmdWriteBufferMarker2AMD was moved into VK_AMD_buffer_marker and vkGetQueueCheckpointData2NV into VK_NV_device_diagnostic_checkpoints from 1.3.284 to 1.4.309;
-                   they are kept here in their old position for the sake of preserving the memory layout of the old portion of the structs */
-    /* VK_KHR_copy_commands2 spec_version 1 */                                       
-    functions[0].CmdCopyBuffer2KHR                                                 = REINTERPRET_CAST(PFN_vkCmdCopyBuffer2KHR                                                 , loader(device, "vkCmdCopyBuffer2KHR"                                             )) ;
-    functions[0].CmdCopyImage2KHR                                                  = REINTERPRET_CAST(PFN_vkCmdCopyImage2KHR                                                  , loader(device, "vkCmdCopyImage2KHR"                                              )) ;
-    functions[0].CmdCopyBufferToImage2KHR                                          = REINTERPRET_CAST(PFN_vkCmdCopyBufferToImage2KHR                                          , loader(device, "vkCmdCopyBufferToImage2KHR"                                      )) ;
-    functions[0].CmdCopyImageToBuffer2KHR                                          = REINTERPRET_CAST(PFN_vkCmdCopyImageToBuffer2KHR                                          , loader(device, "vkCmdCopyImageToBuffer2KHR"                                      )) ;
-    functions[0].CmdBlitImage2KHR                                                  = REINTERPRET_CAST(PFN_vkCmdBlitImage2KHR                                                  , loader(device, "vkCmdBlitImage2KHR"                                              )) ;
-    functions[0].CmdResolveImage2KHR                                               = REINTERPRET_CAST(PFN_vkCmdResolveImage2KHR                                               , loader(device, "vkCmdResolveImage2KHR"                                           )) ;
-    /* VK_KHR_ray_tracing_maintenance1 spec_version 1 */                             
-    functions[0].CmdTraceRaysIndirect2KHR                                          = REINTERPRET_CAST(PFN_vkCmdTraceRaysIndirect2KHR                                          , loader(device, "vkCmdTraceRaysIndirect2KHR"                                      )) ;
-    /* VK_KHR_maintenance4 spec_version 2 */                                         
-    functions[0].GetDeviceBufferMemoryRequirementsKHR                              = REINTERPRET_CAST(PFN_vkGetDeviceBufferMemoryRequirementsKHR                              , loader(device, "vkGetDeviceBufferMemoryRequirementsKHR"                          )) ;
-    functions[0].GetDeviceImageMemoryRequirementsKHR                               = REINTERPRET_CAST(PFN_vkGetDeviceImageMemoryRequirementsKHR                               , loader(device, "vkGetDeviceImageMemoryRequirementsKHR"                           )) ;
-    functions[0].GetDeviceImageSparseMemoryRequirementsKHR                         = REINTERPRET_CAST(PFN_vkGetDeviceImageSparseMemoryRequirementsKHR                         , loader(device, "vkGetDeviceImageSparseMemoryRequirementsKHR"                     )) ;
-    /* VK_KHR_maintenance5 spec_version 1 */                                         
-    functions[0].CmdBindIndexBuffer2KHR                                            = REINTERPRET_CAST(PFN_vkCmdBindIndexBuffer2KHR                                            , loader(device, "vkCmdBindIndexBuffer2KHR"                                        )) ;
-    functions[0].GetRenderingAreaGranularityKHR                                    = REINTERPRET_CAST(PFN_vkGetRenderingAreaGranularityKHR                                    , loader(device, "vkGetRenderingAreaGranularityKHR"                                )) ;
-    functions[0].GetDeviceImageSubresourceLayoutKHR                                = REINTERPRET_CAST(PFN_vkGetDeviceImageSubresourceLayoutKHR                                , loader(device, "vkGetDeviceImageSubresourceLayoutKHR"                            )) ;
-    functions[0].GetImageSubresourceLayout2KHR                                     = REINTERPRET_CAST(PFN_vkGetImageSubresourceLayout2KHR                                     , loader(device, "vkGetImageSubresourceLayout2KHR"                                 )) ;
-    /* VK_KHR_line_rasterization spec_version 1 */                                   
-    functions[0].CmdSetLineStippleKHR                                              = REINTERPRET_CAST(PFN_vkCmdSetLineStippleKHR                                              , loader(device, "vkCmdSetLineStippleKHR"                                          )) ;
-    /* VK_KHR_calibrated_timestamps spec_version 1 */                                
-    functions[0].GetCalibratedTimestampsKHR                                        = REINTERPRET_CAST(PFN_vkGetCalibratedTimestampsKHR                                        , loader(device, "vkGetCalibratedTimestampsKHR"                                    )) ;
-    /* VK_KHR_maintenance6 spec_version 1 */                                         
-    functions[0].CmdBindDescriptorSets2KHR                                         = REINTERPRET_CAST(PFN_vkCmdBindDescriptorSets2KHR                                         , loader(device, "vkCmdBindDescriptorSets2KHR"                                     )) ;
-    functions[0].CmdPushConstants2KHR                                              = REINTERPRET_CAST(PFN_vkCmdPushConstants2KHR                                              , loader(device, "vkCmdPushConstants2KHR"                                          )) ;
-    functions[0].CmdPushDescriptorSet2KHR                                          = REINTERPRET_CAST(PFN_vkCmdPushDescriptorSet2KHR                                          , loader(device, "vkCmdPushDescriptorSet2KHR"                                      )) ;
-    functions[0].CmdPushDescriptorSetWithTemplate2KHR                              = REINTERPRET_CAST(PFN_vkCmdPushDescriptorSetWithTemplate2KHR                              , loader(device, "vkCmdPushDescriptorSetWithTemplate2KHR"                          )) ;
-    functions[0].CmdSetDescriptorBufferOffsets2EXT                                 = REINTERPRET_CAST(PFN_vkCmdSetDescriptorBufferOffsets2EXT                                 , loader(device, "vkCmdSetDescriptorBufferOffsets2EXT"                             )) ;
-    functions[0].CmdBindDescriptorBufferEmbeddedSamplers2EXT                       = REINTERPRET_CAST(PFN_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT                       , loader(device, "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT"                   )) ;
-    /* VK_EXT_debug_marker spec_version 4 */                                         
-    functions[0].DebugMarkerSetObjectTagEXT                                        = REINTERPRET_CAST(PFN_vkDebugMarkerSetObjectTagEXT                                        , loader(device, "vkDebugMarkerSetObjectTagEXT"                                    )) ;
-    functions[0].DebugMarkerSetObjectNameEXT                                       = REINTERPRET_CAST(PFN_vkDebugMarkerSetObjectNameEXT                                       , loader(device, "vkDebugMarkerSetObjectNameEXT"                                   )) ;
-    functions[0].CmdDebugMarkerBeginEXT                                            = REINTERPRET_CAST(PFN_vkCmdDebugMarkerBeginEXT                                            , loader(device, "vkCmdDebugMarkerBeginEXT"                                        )) ;
-    functions[0].CmdDebugMarkerEndEXT                                              = REINTERPRET_CAST(PFN_vkCmdDebugMarkerEndEXT                                              , loader(device, "vkCmdDebugMarkerEndEXT"                                          )) ;
-    functions[0].CmdDebugMarkerInsertEXT                                           = REINTERPRET_CAST(PFN_vkCmdDebugMarkerInsertEXT                                           , loader(device, "vkCmdDebugMarkerInsertEXT"                                       )) ;
-    /* VK_EXT_transform_feedback spec_version 1 */                                   
-    functions[0].CmdBindTransformFeedbackBuffersEXT                                = REINTERPRET_CAST(PFN_vkCmdBindTransformFeedbackBuffersEXT                                , loader(device, "vkCmdBindTransformFeedbackBuffersEXT"                            )) ;
-    functions[0].CmdBeginTransformFeedbackEXT                                      = REINTERPRET_CAST(PFN_vkCmdBeginTransformFeedbackEXT                                      , loader(device, "vkCmdBeginTransformFeedbackEXT"                                  )) ;
-    functions[0].CmdEndTransformFeedbackEXT                                        = REINTERPRET_CAST(PFN_vkCmdEndTransformFeedbackEXT                                        , loader(device, "vkCmdEndTransformFeedbackEXT"                                    )) ;
-    functions[0].CmdBeginQueryIndexedEXT                                           = REINTERPRET_CAST(PFN_vkCmdBeginQueryIndexedEXT                                           , loader(device, "vkCmdBeginQueryIndexedEXT"                                       )) ;
-    functions[0].CmdEndQueryIndexedEXT                                             = REINTERPRET_CAST(PFN_vkCmdEndQueryIndexedEXT                                             , loader(device, "vkCmdEndQueryIndexedEXT"                                         )) ;
-    functions[0].CmdDrawIndirectByteCountEXT                                       = REINTERPRET_CAST(PFN_vkCmdDrawIndirectByteCountEXT                                       , loader(device, "vkCmdDrawIndirectByteCountEXT"                                   )) ;
-    /* VK_NVX_binary_import spec_version 2 */
-    functions[0].CreateCuModuleNVX                                                 = REINTERPRET_CAST(PFN_vkCreateCuModuleNVX                                                 , loader(device, "vkCreateCuModuleNVX"                                             )) ;
-    functions[0].CreateCuFunctionNVX                                               = REINTERPRET_CAST(PFN_vkCreateCuFunctionNVX                                               , loader(device, "vkCreateCuFunctionNVX"                                           )) ;
-    functions[0].DestroyCuModuleNVX                                                = REINTERPRET_CAST(PFN_vkDestroyCuModuleNVX                                                , loader(device, "vkDestroyCuModuleNVX"                                            )) ;
-    functions[0].DestroyCuFunctionNVX                                              = REINTERPRET_CAST(PFN_vkDestroyCuFunctionNVX                                              , loader(device, "vkDestroyCuFunctionNVX"                                          )) ;
-    functions[0].CmdCuLaunchKernelNVX                                              = REINTERPRET_CAST(PFN_vkCmdCuLaunchKernelNVX                                              , loader(device, "vkCmdCuLaunchKernelNVX"                                          )) ;
-    /* VK_NVX_image_view_handle spec_version 3 */
-    functions[0].GetImageViewHandleNVX                                             = REINTERPRET_CAST(PFN_vkGetImageViewHandleNVX                                             , loader(device, "vkGetImageViewHandleNVX"                                         )) ;
-    functions[0].GetImageViewAddressNVX                                            = REINTERPRET_CAST(PFN_vkGetImageViewAddressNVX                                            , loader(device, "vkGetImageViewAddressNVX"                                        )) ;
-    /* VK_AMD_draw_indirect_count spec_version 2 */                                  
-    functions[0].CmdDrawIndirectCountAMD                                           = REINTERPRET_CAST(PFN_vkCmdDrawIndirectCountAMD                                           , loader(device, "vkCmdDrawIndirectCountAMD"                                       )) ;
-    functions[0].CmdDrawIndexedIndirectCountAMD                                    = REINTERPRET_CAST(PFN_vkCmdDrawIndexedIndirectCountAMD                                    , loader(device, "vkCmdDrawIndexedIndirectCountAMD"                                )) ;
-    /* VK_AMD_shader_info spec_version 1 */                                          
-    functions[0].GetShaderInfoAMD                                                  = REINTERPRET_CAST(PFN_vkGetShaderInfoAMD                                                  , loader(device, "vkGetShaderInfoAMD"                                              )) ;
-    /* VK_EXT_conditional_rendering spec_version 2 */                                
-    functions[0].CmdBeginConditionalRenderingEXT                                   = REINTERPRET_CAST(PFN_vkCmdBeginConditionalRenderingEXT                                   , loader(device, "vkCmdBeginConditionalRenderingEXT"                               )) ;
-    functions[0].CmdEndConditionalRenderingEXT                                     = REINTERPRET_CAST(PFN_vkCmdEndConditionalRenderingEXT                                     , loader(device, "vkCmdEndConditionalRenderingEXT"                                 )) ;
-    /* VK_NV_clip_space_w_scaling spec_version 1 */                                  
-    functions[0].CmdSetViewportWScalingNV                                          = REINTERPRET_CAST(PFN_vkCmdSetViewportWScalingNV                                          , loader(device, "vkCmdSetViewportWScalingNV"                                      )) ;
-    /* VK_EXT_display_control spec_version 1 */                                      
-    functions[0].DisplayPowerControlEXT                                            = REINTERPRET_CAST(PFN_vkDisplayPowerControlEXT                                            , loader(device, "vkDisplayPowerControlEXT"                                        )) ;
-    functions[0].RegisterDeviceEventEXT                                            = REINTERPRET_CAST(PFN_vkRegisterDeviceEventEXT                                            , loader(device, "vkRegisterDeviceEventEXT"                                        )) ;
-    functions[0].RegisterDisplayEventEXT                                           = REINTERPRET_CAST(PFN_vkRegisterDisplayEventEXT                                           , loader(device, "vkRegisterDisplayEventEXT"                                       )) ;
-    functions[0].GetSwapchainCounterEXT                                            = REINTERPRET_CAST(PFN_vkGetSwapchainCounterEXT                                            , loader(device, "vkGetSwapchainCounterEXT"                                        )) ;
-    /* VK_GOOGLE_display_timing spec_version 1 */                                    
-    functions[0].GetRefreshCycleDurationGOOGLE                                     = REINTERPRET_CAST(PFN_vkGetRefreshCycleDurationGOOGLE                                     , loader(device, "vkGetRefreshCycleDurationGOOGLE"                                 )) ;
-    functions[0].GetPastPresentationTimingGOOGLE                                   = REINTERPRET_CAST(PFN_vkGetPastPresentationTimingGOOGLE                                   , loader(device, "vkGetPastPresentationTimingGOOGLE"                               )) ;
-    /* VK_EXT_discard_rectangles spec_version 2 */                                   
-    functions[0].CmdSetDiscardRectangleEXT                                         = REINTERPRET_CAST(PFN_vkCmdSetDiscardRectangleEXT                                         , loader(device, "vkCmdSetDiscardRectangleEXT"                                     )) ;
-    functions[0].CmdSetDiscardRectangleEnableEXT                                   = REINTERPRET_CAST(PFN_vkCmdSetDiscardRectangleEnableEXT                                   , loader(device, "vkCmdSetDiscardRectangleEnableEXT"                               )) ;
-    functions[0].CmdSetDiscardRectangleModeEXT                                     = REINTERPRET_CAST(PFN_vkCmdSetDiscardRectangleModeEXT                                     , loader(device, "vkCmdSetDiscardRectangleModeEXT"                                 )) ;
-    /* VK_EXT_hdr_metadata spec_version 3 */
-    functions[0].SetHdrMetadataEXT                                                 = REINTERPRET_CAST(PFN_vkSetHdrMetadataEXT                                                 , loader(device, "vkSetHdrMetadataEXT"                                             )) ;
-    /* VK_EXT_debug_utils spec_version 2 */                                          
-    functions[0].SetDebugUtilsObjectNameEXT                                        = REINTERPRET_CAST(PFN_vkSetDebugUtilsObjectNameEXT                                        , loader(device, "vkSetDebugUtilsObjectNameEXT"                                    )) ;
-    functions[0].SetDebugUtilsObjectTagEXT                                         = REINTERPRET_CAST(PFN_vkSetDebugUtilsObjectTagEXT                                         , loader(device, "vkSetDebugUtilsObjectTagEXT"                                     )) ;
-    functions[0].QueueBeginDebugUtilsLabelEXT                                      = REINTERPRET_CAST(PFN_vkQueueBeginDebugUtilsLabelEXT                                      , loader(device, "vkQueueBeginDebugUtilsLabelEXT"                                  )) ;
-    functions[0].QueueEndDebugUtilsLabelEXT                                        = REINTERPRET_CAST(PFN_vkQueueEndDebugUtilsLabelEXT                                        , loader(device, "vkQueueEndDebugUtilsLabelEXT"                                    )) ;
-    functions[0].QueueInsertDebugUtilsLabelEXT                                     = REINTERPRET_CAST(PFN_vkQueueInsertDebugUtilsLabelEXT                                     , loader(device, "vkQueueInsertDebugUtilsLabelEXT"                                 )) ;
-    functions[0].CmdBeginDebugUtilsLabelEXT                                        = REINTERPRET_CAST(PFN_vkCmdBeginDebugUtilsLabelEXT                                        , loader(device, "vkCmdBeginDebugUtilsLabelEXT"                                    )) ;
-    functions[0].CmdEndDebugUtilsLabelEXT                                          = REINTERPRET_CAST(PFN_vkCmdEndDebugUtilsLabelEXT                                          , loader(device, "vkCmdEndDebugUtilsLabelEXT"                                      )) ;
-    functions[0].CmdInsertDebugUtilsLabelEXT                                       = REINTERPRET_CAST(PFN_vkCmdInsertDebugUtilsLabelEXT                                       , loader(device, "vkCmdInsertDebugUtilsLabelEXT"                                   )) ;
-    /* VK_EXT_sample_locations spec_version 1 */                                     
-    functions[0].CmdSetSampleLocationsEXT                                          = REINTERPRET_CAST(PFN_vkCmdSetSampleLocationsEXT                                          , loader(device, "vkCmdSetSampleLocationsEXT"                                      )) ;
-    /* VK_EXT_image_drm_format_modifier spec_version 2 */                            
-    functions[0].GetImageDrmFormatModifierPropertiesEXT                            = REINTERPRET_CAST(PFN_vkGetImageDrmFormatModifierPropertiesEXT                            , loader(device, "vkGetImageDrmFormatModifierPropertiesEXT"                        )) ;
-    /* VK_EXT_validation_cache spec_version 1 */                                     
-    functions[0].CreateValidationCacheEXT                                          = REINTERPRET_CAST(PFN_vkCreateValidationCacheEXT                                          , loader(device, "vkCreateValidationCacheEXT"                                      )) ;
-    functions[0].DestroyValidationCacheEXT                                         = REINTERPRET_CAST(PFN_vkDestroyValidationCacheEXT                                         , loader(device, "vkDestroyValidationCacheEXT"                                     )) ;
-    functions[0].MergeValidationCachesEXT                                          = REINTERPRET_CAST(PFN_vkMergeValidationCachesEXT                                          , loader(device, "vkMergeValidationCachesEXT"                                      )) ;
-    functions[0].GetValidationCacheDataEXT                                         = REINTERPRET_CAST(PFN_vkGetValidationCacheDataEXT                                         , loader(device, "vkGetValidationCacheDataEXT"                                     )) ;
-    /* VK_NV_shading_rate_image spec_version 3 */                                    
-    functions[0].CmdBindShadingRateImageNV                                         = REINTERPRET_CAST(PFN_vkCmdBindShadingRateImageNV                                         , loader(device, "vkCmdBindShadingRateImageNV"                                     )) ;
-    functions[0].CmdSetViewportShadingRatePaletteNV                                = REINTERPRET_CAST(PFN_vkCmdSetViewportShadingRatePaletteNV                                , loader(device, "vkCmdSetViewportShadingRatePaletteNV"                            )) ;
-    functions[0].CmdSetCoarseSampleOrderNV                                         = REINTERPRET_CAST(PFN_vkCmdSetCoarseSampleOrderNV                                         , loader(device, "vkCmdSetCoarseSampleOrderNV"                                     )) ;
-    /* VK_NV_ray_tracing spec_version 3 */                                           
-    functions[0].CreateAccelerationStructureNV                                     = REINTERPRET_CAST(PFN_vkCreateAccelerationStructureNV                                     , loader(device, "vkCreateAccelerationStructureNV"                                 )) ;
-    functions[0].DestroyAccelerationStructureNV                                    = REINTERPRET_CAST(PFN_vkDestroyAccelerationStructureNV                                    , loader(device, "vkDestroyAccelerationStructureNV"                                )) ;
-    functions[0].GetAccelerationStructureMemoryRequirementsNV                      = REINTERPRET_CAST(PFN_vkGetAccelerationStructureMemoryRequirementsNV                      , loader(device, "vkGetAccelerationStructureMemoryRequirementsNV"                  )) ;
-    functions[0].BindAccelerationStructureMemoryNV                                 = REINTERPRET_CAST(PFN_vkBindAccelerationStructureMemoryNV                                 , loader(device, "vkBindAccelerationStructureMemoryNV"                             )) ;
-    functions[0].CmdBuildAccelerationStructureNV                                   = REINTERPRET_CAST(PFN_vkCmdBuildAccelerationStructureNV                                   , loader(device, "vkCmdBuildAccelerationStructureNV"                               )) ;
-    functions[0].CmdCopyAccelerationStructureNV                                    = REINTERPRET_CAST(PFN_vkCmdCopyAccelerationStructureNV                                    , loader(device, "vkCmdCopyAccelerationStructureNV"                                )) ;
-    functions[0].CmdTraceRaysNV                                                    = REINTERPRET_CAST(PFN_vkCmdTraceRaysNV                                                    , loader(device, "vkCmdTraceRaysNV"                                                )) ;
-    functions[0].CreateRayTracingPipelinesNV                                       = REINTERPRET_CAST(PFN_vkCreateRayTracingPipelinesNV                                       , loader(device, "vkCreateRayTracingPipelinesNV"                                   )) ;
-    functions[0].GetRayTracingShaderGroupHandlesKHR                                = REINTERPRET_CAST(PFN_vkGetRayTracingShaderGroupHandlesKHR                                , loader(device, "vkGetRayTracingShaderGroupHandlesKHR"                            )) ;
-    functions[0].GetRayTracingShaderGroupHandlesNV                                 = REINTERPRET_CAST(PFN_vkGetRayTracingShaderGroupHandlesNV                                 , loader(device, "vkGetRayTracingShaderGroupHandlesNV"                             )) ;
-    functions[0].GetAccelerationStructureHandleNV                                  = REINTERPRET_CAST(PFN_vkGetAccelerationStructureHandleNV                                  , loader(device, "vkGetAccelerationStructureHandleNV"                              )) ;
-    functions[0].CmdWriteAccelerationStructuresPropertiesNV                        = REINTERPRET_CAST(PFN_vkCmdWriteAccelerationStructuresPropertiesNV                        , loader(device, "vkCmdWriteAccelerationStructuresPropertiesNV"                    )) ;
-    functions[0].CompileDeferredNV                                                 = REINTERPRET_CAST(PFN_vkCompileDeferredNV                                                 , loader(device, "vkCompileDeferredNV"                                             )) ;
-    /* VK_EXT_external_memory_host spec_version 1 */                                 
-    functions[0].GetMemoryHostPointerPropertiesEXT                                 = REINTERPRET_CAST(PFN_vkGetMemoryHostPointerPropertiesEXT                                 , loader(device, "vkGetMemoryHostPointerPropertiesEXT"                             )) ;  
-    /* VK_AMD_buffer_marker spec_version 1 */                                        
-    functions[0].CmdWriteBufferMarkerAMD                                           = REINTERPRET_CAST(PFN_vkCmdWriteBufferMarkerAMD                                           , loader(device, "vkCmdWriteBufferMarkerAMD"                                       )) ;
-    /* VK_EXT_calibrated_timestamps spec_version 2 */                                
-    functions[0].GetCalibratedTimestampsEXT                                        = REINTERPRET_CAST(PFN_vkGetCalibratedTimestampsEXT                                        , loader(device, "vkGetCalibratedTimestampsEXT"                                    )) ;
-    /* VK_NV_mesh_shader spec_version 1 */                                           
-    functions[0].CmdDrawMeshTasksNV                                                = REINTERPRET_CAST(PFN_vkCmdDrawMeshTasksNV                                                , loader(device, "vkCmdDrawMeshTasksNV"                                            )) ;
-    functions[0].CmdDrawMeshTasksIndirectNV                                        = REINTERPRET_CAST(PFN_vkCmdDrawMeshTasksIndirectNV                                        , loader(device, "vkCmdDrawMeshTasksIndirectNV"                                    )) ;
-    functions[0].CmdDrawMeshTasksIndirectCountNV                                   = REINTERPRET_CAST(PFN_vkCmdDrawMeshTasksIndirectCountNV                                   , loader(device, "vkCmdDrawMeshTasksIndirectCountNV"                               )) ;
-    /* VK_NV_scissor_exclusive spec_version 2 */                                     
-    functions[0].CmdSetExclusiveScissorEnableNV                                    = REINTERPRET_CAST(PFN_vkCmdSetExclusiveScissorEnableNV                                    , loader(device, "vkCmdSetExclusiveScissorEnableNV"                                )) ;
-    functions[0].CmdSetExclusiveScissorNV                                          = REINTERPRET_CAST(PFN_vkCmdSetExclusiveScissorNV                                          , loader(device, "vkCmdSetExclusiveScissorNV"                                      )) ;
-    /* VK_NV_device_diagnostic_checkpoints spec_version 2 */                         
-    functions[0].CmdSetCheckpointNV                                                = REINTERPRET_CAST(PFN_vkCmdSetCheckpointNV                                                , loader(device, "vkCmdSetCheckpointNV"                                            )) ;
-    functions[0].GetQueueCheckpointDataNV                                          = REINTERPRET_CAST(PFN_vkGetQueueCheckpointDataNV                                          , loader(device, "vkGetQueueCheckpointDataNV"                                      )) ;
-    /* VK_INTEL_performance_query spec_version 2 */                                  
-    functions[0].InitializePerformanceApiINTEL                                     = REINTERPRET_CAST(PFN_vkInitializePerformanceApiINTEL                                     , loader(device, "vkInitializePerformanceApiINTEL"                                 )) ;
-    functions[0].UninitializePerformanceApiINTEL                                   = REINTERPRET_CAST(PFN_vkUninitializePerformanceApiINTEL                                   , loader(device, "vkUninitializePerformanceApiINTEL"                               )) ;
-    functions[0].CmdSetPerformanceMarkerINTEL                                      = REINTERPRET_CAST(PFN_vkCmdSetPerformanceMarkerINTEL                                      , loader(device, "vkCmdSetPerformanceMarkerINTEL"                                  )) ;
-    functions[0].CmdSetPerformanceStreamMarkerINTEL                                = REINTERPRET_CAST(PFN_vkCmdSetPerformanceStreamMarkerINTEL                                , loader(device, "vkCmdSetPerformanceStreamMarkerINTEL"                            )) ;
-    functions[0].CmdSetPerformanceOverrideINTEL                                    = REINTERPRET_CAST(PFN_vkCmdSetPerformanceOverrideINTEL                                    , loader(device, "vkCmdSetPerformanceOverrideINTEL"                                )) ;
-    functions[0].AcquirePerformanceConfigurationINTEL                              = REINTERPRET_CAST(PFN_vkAcquirePerformanceConfigurationINTEL                              , loader(device, "vkAcquirePerformanceConfigurationINTEL"                          )) ;
-    functions[0].ReleasePerformanceConfigurationINTEL                              = REINTERPRET_CAST(PFN_vkReleasePerformanceConfigurationINTEL                              , loader(device, "vkReleasePerformanceConfigurationINTEL"                          )) ;
-    functions[0].QueueSetPerformanceConfigurationINTEL                             = REINTERPRET_CAST(PFN_vkQueueSetPerformanceConfigurationINTEL                             , loader(device, "vkQueueSetPerformanceConfigurationINTEL"                         )) ;
-    functions[0].GetPerformanceParameterINTEL                                      = REINTERPRET_CAST(PFN_vkGetPerformanceParameterINTEL                                      , loader(device, "vkGetPerformanceParameterINTEL"                                  )) ;
-    /* VK_AMD_display_native_hdr spec_version 1 */                                   
-    functions[0].SetLocalDimmingAMD                                                = REINTERPRET_CAST(PFN_vkSetLocalDimmingAMD                                                , loader(device, "vkSetLocalDimmingAMD"                                            )) ;
-    /* VK_EXT_buffer_device_address spec_version 2 */                                
-    functions[0].GetBufferDeviceAddressEXT                                         = REINTERPRET_CAST(PFN_vkGetBufferDeviceAddressEXT                                         , loader(device, "vkGetBufferDeviceAddressEXT"                                     )) ;
-    /* VK_EXT_line_rasterization spec_version 1 */                                   
-    functions[0].CmdSetLineStippleEXT                                              = REINTERPRET_CAST(PFN_vkCmdSetLineStippleEXT                                              , loader(device, "vkCmdSetLineStippleEXT"                                          )) ;
-    /* VK_EXT_host_query_reset spec_version 1 */                                     
-    functions[0].ResetQueryPoolEXT                                                 = REINTERPRET_CAST(PFN_vkResetQueryPoolEXT                                                 , loader(device, "vkResetQueryPoolEXT"                                             )) ;  
-    /* VK_EXT_extended_dynamic_state spec_version 1 */                               
-    functions[0].CmdSetCullModeEXT                                                 = REINTERPRET_CAST(PFN_vkCmdSetCullModeEXT                                                 , loader(device, "vkCmdSetCullModeEXT"                                             )) ;
-    functions[0].CmdSetFrontFaceEXT                                                = REINTERPRET_CAST(PFN_vkCmdSetFrontFaceEXT                                                , loader(device, "vkCmdSetFrontFaceEXT"                                            )) ;
-    functions[0].CmdSetPrimitiveTopologyEXT                                        = REINTERPRET_CAST(PFN_vkCmdSetPrimitiveTopologyEXT                                        , loader(device, "vkCmdSetPrimitiveTopologyEXT"                                    )) ;
-    functions[0].CmdSetViewportWithCountEXT                                        = REINTERPRET_CAST(PFN_vkCmdSetViewportWithCountEXT                                        , loader(device, "vkCmdSetViewportWithCountEXT"                                    )) ;
-    functions[0].CmdSetScissorWithCountEXT                                         = REINTERPRET_CAST(PFN_vkCmdSetScissorWithCountEXT                                         , loader(device, "vkCmdSetScissorWithCountEXT"                                     )) ;
-    functions[0].CmdBindVertexBuffers2EXT                                          = REINTERPRET_CAST(PFN_vkCmdBindVertexBuffers2EXT                                          , loader(device, "vkCmdBindVertexBuffers2EXT"                                      )) ;
-    functions[0].CmdSetDepthTestEnableEXT                                          = REINTERPRET_CAST(PFN_vkCmdSetDepthTestEnableEXT                                          , loader(device, "vkCmdSetDepthTestEnableEXT"                                      )) ;
-    functions[0].CmdSetDepthWriteEnableEXT                                         = REINTERPRET_CAST(PFN_vkCmdSetDepthWriteEnableEXT                                         , loader(device, "vkCmdSetDepthWriteEnableEXT"                                     )) ;
-    functions[0].CmdSetDepthCompareOpEXT                                           = REINTERPRET_CAST(PFN_vkCmdSetDepthCompareOpEXT                                           , loader(device, "vkCmdSetDepthCompareOpEXT"                                       )) ;
-    functions[0].CmdSetDepthBoundsTestEnableEXT                                    = REINTERPRET_CAST(PFN_vkCmdSetDepthBoundsTestEnableEXT                                    , loader(device, "vkCmdSetDepthBoundsTestEnableEXT"                                )) ;
-    functions[0].CmdSetStencilTestEnableEXT                                        = REINTERPRET_CAST(PFN_vkCmdSetStencilTestEnableEXT                                        , loader(device, "vkCmdSetStencilTestEnableEXT"                                    )) ;
-    functions[0].CmdSetStencilOpEXT                                                = REINTERPRET_CAST(PFN_vkCmdSetStencilOpEXT                                                , loader(device, "vkCmdSetStencilOpEXT"                                            )) ;
-    /* VK_EXT_host_image_copy spec_version 1 */                                      
-    functions[0].CopyMemoryToImageEXT                                              = REINTERPRET_CAST(PFN_vkCopyMemoryToImageEXT                                              , loader(device, "vkCopyMemoryToImageEXT"                                          )) ;
-    functions[0].CopyImageToMemoryEXT                                              = REINTERPRET_CAST(PFN_vkCopyImageToMemoryEXT                                              , loader(device, "vkCopyImageToMemoryEXT"                                          )) ;
-    functions[0].CopyImageToImageEXT                                               = REINTERPRET_CAST(PFN_vkCopyImageToImageEXT                                               , loader(device, "vkCopyImageToImageEXT"                                           )) ;
-    functions[0].TransitionImageLayoutEXT                                          = REINTERPRET_CAST(PFN_vkTransitionImageLayoutEXT                                          , loader(device, "vkTransitionImageLayoutEXT"                                      )) ;
-    functions[0].GetImageSubresourceLayout2EXT                                     = REINTERPRET_CAST(PFN_vkGetImageSubresourceLayout2EXT                                     , loader(device, "vkGetImageSubresourceLayout2EXT"                                 )) ;
-    /* VK_EXT_swapchain_maintenance1 spec_version 1 */                               
-    functions[0].ReleaseSwapchainImagesEXT                                         = REINTERPRET_CAST(PFN_vkReleaseSwapchainImagesEXT                                         , loader(device, "vkReleaseSwapchainImagesEXT"                                     )) ;
-    /* VK_NV_device_generated_commands spec_version 3 */                             
-    functions[0].GetGeneratedCommandsMemoryRequirementsNV                          = REINTERPRET_CAST(PFN_vkGetGeneratedCommandsMemoryRequirementsNV                          , loader(device, "vkGetGeneratedCommandsMemoryRequirementsNV"                      )) ;
-    functions[0].CmdPreprocessGeneratedCommandsNV                                  = REINTERPRET_CAST(PFN_vkCmdPreprocessGeneratedCommandsNV                                  , loader(device, "vkCmdPreprocessGeneratedCommandsNV"                              )) ;
-    functions[0].CmdExecuteGeneratedCommandsNV                                     = REINTERPRET_CAST(PFN_vkCmdExecuteGeneratedCommandsNV                                     , loader(device, "vkCmdExecuteGeneratedCommandsNV"                                 )) ;
-    functions[0].CmdBindPipelineShaderGroupNV                                      = REINTERPRET_CAST(PFN_vkCmdBindPipelineShaderGroupNV                                      , loader(device, "vkCmdBindPipelineShaderGroupNV"                                  )) ;
-    functions[0].CreateIndirectCommandsLayoutNV                                    = REINTERPRET_CAST(PFN_vkCreateIndirectCommandsLayoutNV                                    , loader(device, "vkCreateIndirectCommandsLayoutNV"                                )) ;
-    functions[0].DestroyIndirectCommandsLayoutNV                                   = REINTERPRET_CAST(PFN_vkDestroyIndirectCommandsLayoutNV                                   , loader(device, "vkDestroyIndirectCommandsLayoutNV"                               )) ;
-    /* VK_EXT_depth_bias_control spec_version 1 */                                   
-    functions[0].CmdSetDepthBias2EXT                                               = REINTERPRET_CAST(PFN_vkCmdSetDepthBias2EXT                                               , loader(device, "vkCmdSetDepthBias2EXT"                                           )) ;
-    /* VK_EXT_private_data spec_version 1 */                                         
-    functions[0].CreatePrivateDataSlotEXT                                          = REINTERPRET_CAST(PFN_vkCreatePrivateDataSlotEXT                                          , loader(device, "vkCreatePrivateDataSlotEXT"                                      )) ;
-    functions[0].DestroyPrivateDataSlotEXT                                         = REINTERPRET_CAST(PFN_vkDestroyPrivateDataSlotEXT                                         , loader(device, "vkDestroyPrivateDataSlotEXT"                                     )) ;
-    functions[0].SetPrivateDataEXT                                                 = REINTERPRET_CAST(PFN_vkSetPrivateDataEXT                                                 , loader(device, "vkSetPrivateDataEXT"                                             )) ;
-    functions[0].GetPrivateDataEXT                                                 = REINTERPRET_CAST(PFN_vkGetPrivateDataEXT                                                 , loader(device, "vkGetPrivateDataEXT"                                             )) ;
-    /* VK_NV_cuda_kernel_launch spec_version 2 */                                    
-    functions[0].CreateCudaModuleNV                                                = REINTERPRET_CAST(PFN_vkCreateCudaModuleNV                                                , loader(device, "vkCreateCudaModuleNV"                                            )) ;
-    functions[0].GetCudaModuleCacheNV                                              = REINTERPRET_CAST(PFN_vkGetCudaModuleCacheNV                                              , loader(device, "vkGetCudaModuleCacheNV"                                          )) ;
-    functions[0].CreateCudaFunctionNV                                              = REINTERPRET_CAST(PFN_vkCreateCudaFunctionNV                                              , loader(device, "vkCreateCudaFunctionNV"                                          )) ;
-    functions[0].DestroyCudaModuleNV                                               = REINTERPRET_CAST(PFN_vkDestroyCudaModuleNV                                               , loader(device, "vkDestroyCudaModuleNV"                                           )) ;
-    functions[0].DestroyCudaFunctionNV                                             = REINTERPRET_CAST(PFN_vkDestroyCudaFunctionNV                                             , loader(device, "vkDestroyCudaFunctionNV"                                         )) ;
-    functions[0].CmdCudaLaunchKernelNV                                             = REINTERPRET_CAST(PFN_vkCmdCudaLaunchKernelNV                                             , loader(device, "vkCmdCudaLaunchKernelNV"                                         )) ;
-    /* VK_EXT_descriptor_buffer spec_version 1 */                                    
-    functions[0].GetDescriptorSetLayoutSizeEXT                                     = REINTERPRET_CAST(PFN_vkGetDescriptorSetLayoutSizeEXT                                     , loader(device, "vkGetDescriptorSetLayoutSizeEXT"                                 )) ;
-    functions[0].GetDescriptorSetLayoutBindingOffsetEXT                            = REINTERPRET_CAST(PFN_vkGetDescriptorSetLayoutBindingOffsetEXT                            , loader(device, "vkGetDescriptorSetLayoutBindingOffsetEXT"                        )) ;
-    functions[0].GetDescriptorEXT                                                  = REINTERPRET_CAST(PFN_vkGetDescriptorEXT                                                  , loader(device, "vkGetDescriptorEXT"                                              )) ;
-    functions[0].CmdBindDescriptorBuffersEXT                                       = REINTERPRET_CAST(PFN_vkCmdBindDescriptorBuffersEXT                                       , loader(device, "vkCmdBindDescriptorBuffersEXT"                                   )) ;
-    functions[0].CmdSetDescriptorBufferOffsetsEXT                                  = REINTERPRET_CAST(PFN_vkCmdSetDescriptorBufferOffsetsEXT                                  , loader(device, "vkCmdSetDescriptorBufferOffsetsEXT"                              )) ;
-    functions[0].CmdBindDescriptorBufferEmbeddedSamplersEXT                        = REINTERPRET_CAST(PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT                        , loader(device, "vkCmdBindDescriptorBufferEmbeddedSamplersEXT"                    )) ;
-    functions[0].GetBufferOpaqueCaptureDescriptorDataEXT                           = REINTERPRET_CAST(PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT                           , loader(device, "vkGetBufferOpaqueCaptureDescriptorDataEXT"                       )) ;
-    functions[0].GetImageOpaqueCaptureDescriptorDataEXT                            = REINTERPRET_CAST(PFN_vkGetImageOpaqueCaptureDescriptorDataEXT                            , loader(device, "vkGetImageOpaqueCaptureDescriptorDataEXT"                        )) ;
-    functions[0].GetImageViewOpaqueCaptureDescriptorDataEXT                        = REINTERPRET_CAST(PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT                        , loader(device, "vkGetImageViewOpaqueCaptureDescriptorDataEXT"                    )) ;
-    functions[0].GetSamplerOpaqueCaptureDescriptorDataEXT                          = REINTERPRET_CAST(PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT                          , loader(device, "vkGetSamplerOpaqueCaptureDescriptorDataEXT"                      )) ;
-    functions[0].GetAccelerationStructureOpaqueCaptureDescriptorDataEXT            = REINTERPRET_CAST(PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT            , loader(device, "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT"        )) ;
-    /* VK_NV_fragment_shading_rate_enums spec_version 1 */                           
-    functions[0].CmdSetFragmentShadingRateEnumNV                                   = REINTERPRET_CAST(PFN_vkCmdSetFragmentShadingRateEnumNV                                   , loader(device, "vkCmdSetFragmentShadingRateEnumNV"                               )) ;
-    /* VK_EXT_device_fault spec_version 2 */                                         
-    functions[0].GetDeviceFaultInfoEXT                                             = REINTERPRET_CAST(PFN_vkGetDeviceFaultInfoEXT                                             , loader(device, "vkGetDeviceFaultInfoEXT"                                         )) ;
-    /* VK_EXT_vertex_input_dynamic_state spec_version 2 */                           
-    functions[0].CmdSetVertexInputEXT                                              = REINTERPRET_CAST(PFN_vkCmdSetVertexInputEXT                                              , loader(device, "vkCmdSetVertexInputEXT"                                          )) ;
-    /* VK_HUAWEI_subpass_shading spec_version 3 */                                   
-    functions[0].GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI                     = REINTERPRET_CAST(PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI                     , loader(device, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI"                 )) ;
-    functions[0].CmdSubpassShadingHUAWEI                                           = REINTERPRET_CAST(PFN_vkCmdSubpassShadingHUAWEI                                           , loader(device, "vkCmdSubpassShadingHUAWEI"                                       )) ;
-    /* VK_HUAWEI_invocation_mask spec_version 1 */                                   
-    functions[0].CmdBindInvocationMaskHUAWEI                                       = REINTERPRET_CAST(PFN_vkCmdBindInvocationMaskHUAWEI                                       , loader(device, "vkCmdBindInvocationMaskHUAWEI"                                   )) ;
-    /* VK_NV_external_memory_rdma spec_version 1 */                                  
-    functions[0].GetMemoryRemoteAddressNV                                          = REINTERPRET_CAST(PFN_vkGetMemoryRemoteAddressNV                                          , loader(device, "vkGetMemoryRemoteAddressNV"                                      )) ;
-    /* VK_EXT_pipeline_properties spec_version 1 */                                  
-    functions[0].GetPipelinePropertiesEXT                                          = REINTERPRET_CAST(PFN_vkGetPipelinePropertiesEXT                                          , loader(device, "vkGetPipelinePropertiesEXT"                                      )) ;
-    /* VK_EXT_extended_dynamic_state2 spec_version 1 */                              
-    functions[0].CmdSetPatchControlPointsEXT                                       = REINTERPRET_CAST(PFN_vkCmdSetPatchControlPointsEXT                                       , loader(device, "vkCmdSetPatchControlPointsEXT"                                   )) ;
-    functions[0].CmdSetRasterizerDiscardEnableEXT                                  = REINTERPRET_CAST(PFN_vkCmdSetRasterizerDiscardEnableEXT                                  , loader(device, "vkCmdSetRasterizerDiscardEnableEXT"                              )) ;
-    functions[0].CmdSetDepthBiasEnableEXT                                          = REINTERPRET_CAST(PFN_vkCmdSetDepthBiasEnableEXT                                          , loader(device, "vkCmdSetDepthBiasEnableEXT"                                      )) ;
-    functions[0].CmdSetLogicOpEXT                                                  = REINTERPRET_CAST(PFN_vkCmdSetLogicOpEXT                                                  , loader(device, "vkCmdSetLogicOpEXT"                                              )) ;
-    functions[0].CmdSetPrimitiveRestartEnableEXT                                   = REINTERPRET_CAST(PFN_vkCmdSetPrimitiveRestartEnableEXT                                   , loader(device, "vkCmdSetPrimitiveRestartEnableEXT"                               )) ;
-    /* VK_EXT_color_write_enable spec_version 1 */                                   
-    functions[0].CmdSetColorWriteEnableEXT                                         = REINTERPRET_CAST(PFN_vkCmdSetColorWriteEnableEXT                                         , loader(device, "vkCmdSetColorWriteEnableEXT"                                     )) ;
-    /* VK_EXT_multi_draw spec_version 1 */                                           
-    functions[0].CmdDrawMultiEXT                                                   = REINTERPRET_CAST(PFN_vkCmdDrawMultiEXT                                                   , loader(device, "vkCmdDrawMultiEXT"                                               )) ;
-    functions[0].CmdDrawMultiIndexedEXT                                            = REINTERPRET_CAST(PFN_vkCmdDrawMultiIndexedEXT                                            , loader(device, "vkCmdDrawMultiIndexedEXT"                                        )) ;
-    /* VK_EXT_opacity_micromap spec_version 2 */                                     
-    functions[0].CreateMicromapEXT                                                 = REINTERPRET_CAST(PFN_vkCreateMicromapEXT                                                 , loader(device, "vkCreateMicromapEXT"                                             )) ;
-    functions[0].DestroyMicromapEXT                                                = REINTERPRET_CAST(PFN_vkDestroyMicromapEXT                                                , loader(device, "vkDestroyMicromapEXT"                                            )) ;
-    functions[0].CmdBuildMicromapsEXT                                              = REINTERPRET_CAST(PFN_vkCmdBuildMicromapsEXT                                              , loader(device, "vkCmdBuildMicromapsEXT"                                          )) ;
-    functions[0].BuildMicromapsEXT                                                 = REINTERPRET_CAST(PFN_vkBuildMicromapsEXT                                                 , loader(device, "vkBuildMicromapsEXT"                                             )) ;
-    functions[0].CopyMicromapEXT                                                   = REINTERPRET_CAST(PFN_vkCopyMicromapEXT                                                   , loader(device, "vkCopyMicromapEXT"                                               )) ;
-    functions[0].CopyMicromapToMemoryEXT                                           = REINTERPRET_CAST(PFN_vkCopyMicromapToMemoryEXT                                           , loader(device, "vkCopyMicromapToMemoryEXT"                                       )) ;
-    functions[0].CopyMemoryToMicromapEXT                                           = REINTERPRET_CAST(PFN_vkCopyMemoryToMicromapEXT                                           , loader(device, "vkCopyMemoryToMicromapEXT"                                       )) ;
-    functions[0].WriteMicromapsPropertiesEXT                                       = REINTERPRET_CAST(PFN_vkWriteMicromapsPropertiesEXT                                       , loader(device, "vkWriteMicromapsPropertiesEXT"                                   )) ;
-    functions[0].CmdCopyMicromapEXT                                                = REINTERPRET_CAST(PFN_vkCmdCopyMicromapEXT                                                , loader(device, "vkCmdCopyMicromapEXT"                                            )) ;
-    functions[0].CmdCopyMicromapToMemoryEXT                                        = REINTERPRET_CAST(PFN_vkCmdCopyMicromapToMemoryEXT                                        , loader(device, "vkCmdCopyMicromapToMemoryEXT"                                    )) ;
-    functions[0].CmdCopyMemoryToMicromapEXT                                        = REINTERPRET_CAST(PFN_vkCmdCopyMemoryToMicromapEXT                                        , loader(device, "vkCmdCopyMemoryToMicromapEXT"                                    )) ;
-    functions[0].CmdWriteMicromapsPropertiesEXT                                    = REINTERPRET_CAST(PFN_vkCmdWriteMicromapsPropertiesEXT                                    , loader(device, "vkCmdWriteMicromapsPropertiesEXT"                                )) ;
-    functions[0].GetDeviceMicromapCompatibilityEXT                                 = REINTERPRET_CAST(PFN_vkGetDeviceMicromapCompatibilityEXT                                 , loader(device, "vkGetDeviceMicromapCompatibilityEXT"                             )) ;
-    functions[0].GetMicromapBuildSizesEXT                                          = REINTERPRET_CAST(PFN_vkGetMicromapBuildSizesEXT                                          , loader(device, "vkGetMicromapBuildSizesEXT"                                      )) ;
-    /* VK_HUAWEI_cluster_culling_shader spec_version 3 */                            
-    functions[0].CmdDrawClusterHUAWEI                                              = REINTERPRET_CAST(PFN_vkCmdDrawClusterHUAWEI                                              , loader(device, "vkCmdDrawClusterHUAWEI"                                          )) ;
-    functions[0].CmdDrawClusterIndirectHUAWEI                                      = REINTERPRET_CAST(PFN_vkCmdDrawClusterIndirectHUAWEI                                      , loader(device, "vkCmdDrawClusterIndirectHUAWEI"                                  )) ;
-    /* VK_EXT_pageable_device_local_memory spec_version 1 */                         
-    functions[0].SetDeviceMemoryPriorityEXT                                        = REINTERPRET_CAST(PFN_vkSetDeviceMemoryPriorityEXT                                        , loader(device, "vkSetDeviceMemoryPriorityEXT"                                    )) ;
-    /* VK_VALVE_descriptor_set_host_mapping spec_version 1 */                        
-    functions[0].GetDescriptorSetLayoutHostMappingInfoVALVE                        = REINTERPRET_CAST(PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE                        , loader(device, "vkGetDescriptorSetLayoutHostMappingInfoVALVE"                    )) ;
-    functions[0].GetDescriptorSetHostMappingVALVE                                  = REINTERPRET_CAST(PFN_vkGetDescriptorSetHostMappingVALVE                                  , loader(device, "vkGetDescriptorSetHostMappingVALVE"                              )) ;
-    /* VK_NV_copy_memory_indirect spec_version 1 */                                  
-    functions[0].CmdCopyMemoryIndirectNV                                           = REINTERPRET_CAST(PFN_vkCmdCopyMemoryIndirectNV                                           , loader(device, "vkCmdCopyMemoryIndirectNV"                                       )) ;
-    functions[0].CmdCopyMemoryToImageIndirectNV                                    = REINTERPRET_CAST(PFN_vkCmdCopyMemoryToImageIndirectNV                                    , loader(device, "vkCmdCopyMemoryToImageIndirectNV"                                )) ;
-    /* VK_NV_memory_decompression spec_version 1 */                                  
-    functions[0].CmdDecompressMemoryNV                                             = REINTERPRET_CAST(PFN_vkCmdDecompressMemoryNV                                             , loader(device, "vkCmdDecompressMemoryNV"                                         )) ;
-    functions[0].CmdDecompressMemoryIndirectCountNV                                = REINTERPRET_CAST(PFN_vkCmdDecompressMemoryIndirectCountNV                                , loader(device, "vkCmdDecompressMemoryIndirectCountNV"                            )) ;
-    /* VK_NV_device_generated_commands_compute spec_version 2 */                     
-    functions[0].GetPipelineIndirectMemoryRequirementsNV                           = REINTERPRET_CAST(PFN_vkGetPipelineIndirectMemoryRequirementsNV                           , loader(device, "vkGetPipelineIndirectMemoryRequirementsNV"                       )) ;
-    functions[0].CmdUpdatePipelineIndirectBufferNV                                 = REINTERPRET_CAST(PFN_vkCmdUpdatePipelineIndirectBufferNV                                 , loader(device, "vkCmdUpdatePipelineIndirectBufferNV"                             )) ;
-    functions[0].GetPipelineIndirectDeviceAddressNV                                = REINTERPRET_CAST(PFN_vkGetPipelineIndirectDeviceAddressNV                                , loader(device, "vkGetPipelineIndirectDeviceAddressNV"                            )) ;
-    /* VK_EXT_extended_dynamic_state3 spec_version 2 */                              
-    functions[0].CmdSetDepthClampEnableEXT                                         = REINTERPRET_CAST(PFN_vkCmdSetDepthClampEnableEXT                                         , loader(device, "vkCmdSetDepthClampEnableEXT"                                     )) ;
-    functions[0].CmdSetPolygonModeEXT                                              = REINTERPRET_CAST(PFN_vkCmdSetPolygonModeEXT                                              , loader(device, "vkCmdSetPolygonModeEXT"                                          )) ;
-    functions[0].CmdSetRasterizationSamplesEXT                                     = REINTERPRET_CAST(PFN_vkCmdSetRasterizationSamplesEXT                                     , loader(device, "vkCmdSetRasterizationSamplesEXT"                                 )) ;
-    functions[0].CmdSetSampleMaskEXT                                               = REINTERPRET_CAST(PFN_vkCmdSetSampleMaskEXT                                               , loader(device, "vkCmdSetSampleMaskEXT"                                           )) ;
-    functions[0].CmdSetAlphaToCoverageEnableEXT                                    = REINTERPRET_CAST(PFN_vkCmdSetAlphaToCoverageEnableEXT                                    , loader(device, "vkCmdSetAlphaToCoverageEnableEXT"                                )) ;
-    functions[0].CmdSetAlphaToOneEnableEXT                                         = REINTERPRET_CAST(PFN_vkCmdSetAlphaToOneEnableEXT                                         , loader(device, "vkCmdSetAlphaToOneEnableEXT"                                     )) ;
-    functions[0].CmdSetLogicOpEnableEXT                                            = REINTERPRET_CAST(PFN_vkCmdSetLogicOpEnableEXT                                            , loader(device, "vkCmdSetLogicOpEnableEXT"                                        )) ;
-    functions[0].CmdSetColorBlendEnableEXT                                         = REINTERPRET_CAST(PFN_vkCmdSetColorBlendEnableEXT                                         , loader(device, "vkCmdSetColorBlendEnableEXT"                                     )) ;
-    functions[0].CmdSetColorBlendEquationEXT                                       = REINTERPRET_CAST(PFN_vkCmdSetColorBlendEquationEXT                                       , loader(device, "vkCmdSetColorBlendEquationEXT"                                   )) ;
-    functions[0].CmdSetColorWriteMaskEXT                                           = REINTERPRET_CAST(PFN_vkCmdSetColorWriteMaskEXT                                           , loader(device, "vkCmdSetColorWriteMaskEXT"                                       )) ;
-    functions[0].CmdSetTessellationDomainOriginEXT                                 = REINTERPRET_CAST(PFN_vkCmdSetTessellationDomainOriginEXT                                 , loader(device, "vkCmdSetTessellationDomainOriginEXT"                             )) ;
-    functions[0].CmdSetRasterizationStreamEXT                                      = REINTERPRET_CAST(PFN_vkCmdSetRasterizationStreamEXT                                      , loader(device, "vkCmdSetRasterizationStreamEXT"                                  )) ;
-    functions[0].CmdSetConservativeRasterizationModeEXT                            = REINTERPRET_CAST(PFN_vkCmdSetConservativeRasterizationModeEXT                            , loader(device, "vkCmdSetConservativeRasterizationModeEXT"                        )) ;
-    functions[0].CmdSetExtraPrimitiveOverestimationSizeEXT                         = REINTERPRET_CAST(PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT                         , loader(device, "vkCmdSetExtraPrimitiveOverestimationSizeEXT"                     )) ;
-    functions[0].CmdSetDepthClipEnableEXT                                          = REINTERPRET_CAST(PFN_vkCmdSetDepthClipEnableEXT                                          , loader(device, "vkCmdSetDepthClipEnableEXT"                                      )) ;
-    functions[0].CmdSetSampleLocationsEnableEXT                                    = REINTERPRET_CAST(PFN_vkCmdSetSampleLocationsEnableEXT                                    , loader(device, "vkCmdSetSampleLocationsEnableEXT"                                )) ;
-    functions[0].CmdSetColorBlendAdvancedEXT                                       = REINTERPRET_CAST(PFN_vkCmdSetColorBlendAdvancedEXT                                       , loader(device, "vkCmdSetColorBlendAdvancedEXT"                                   )) ;
-    functions[0].CmdSetProvokingVertexModeEXT                                      = REINTERPRET_CAST(PFN_vkCmdSetProvokingVertexModeEXT                                      , loader(device, "vkCmdSetProvokingVertexModeEXT"                                  )) ;
-    functions[0].CmdSetLineRasterizationModeEXT                                    = REINTERPRET_CAST(PFN_vkCmdSetLineRasterizationModeEXT                                    , loader(device, "vkCmdSetLineRasterizationModeEXT"                                )) ;
-    functions[0].CmdSetLineStippleEnableEXT                                        = REINTERPRET_CAST(PFN_vkCmdSetLineStippleEnableEXT                                        , loader(device, "vkCmdSetLineStippleEnableEXT"                                    )) ;
-    functions[0].CmdSetDepthClipNegativeOneToOneEXT                                = REINTERPRET_CAST(PFN_vkCmdSetDepthClipNegativeOneToOneEXT                                , loader(device, "vkCmdSetDepthClipNegativeOneToOneEXT"                            )) ;
-    functions[0].CmdSetViewportWScalingEnableNV                                    = REINTERPRET_CAST(PFN_vkCmdSetViewportWScalingEnableNV                                    , loader(device, "vkCmdSetViewportWScalingEnableNV"                                )) ;
-    functions[0].CmdSetViewportSwizzleNV                                           = REINTERPRET_CAST(PFN_vkCmdSetViewportSwizzleNV                                           , loader(device, "vkCmdSetViewportSwizzleNV"                                       )) ;
-    functions[0].CmdSetCoverageToColorEnableNV                                     = REINTERPRET_CAST(PFN_vkCmdSetCoverageToColorEnableNV                                     , loader(device, "vkCmdSetCoverageToColorEnableNV"                                 )) ;
-    functions[0].CmdSetCoverageToColorLocationNV                                   = REINTERPRET_CAST(PFN_vkCmdSetCoverageToColorLocationNV                                   , loader(device, "vkCmdSetCoverageToColorLocationNV"                               )) ;
-    functions[0].CmdSetCoverageModulationModeNV                                    = REINTERPRET_CAST(PFN_vkCmdSetCoverageModulationModeNV                                    , loader(device, "vkCmdSetCoverageModulationModeNV"                                )) ;
-    functions[0].CmdSetCoverageModulationTableEnableNV                             = REINTERPRET_CAST(PFN_vkCmdSetCoverageModulationTableEnableNV                             , loader(device, "vkCmdSetCoverageModulationTableEnableNV"                         )) ;
-    functions[0].CmdSetCoverageModulationTableNV                                   = REINTERPRET_CAST(PFN_vkCmdSetCoverageModulationTableNV                                   , loader(device, "vkCmdSetCoverageModulationTableNV"                               )) ;
-    functions[0].CmdSetShadingRateImageEnableNV                                    = REINTERPRET_CAST(PFN_vkCmdSetShadingRateImageEnableNV                                    , loader(device, "vkCmdSetShadingRateImageEnableNV"                                )) ;
-    functions[0].CmdSetRepresentativeFragmentTestEnableNV                          = REINTERPRET_CAST(PFN_vkCmdSetRepresentativeFragmentTestEnableNV                          , loader(device, "vkCmdSetRepresentativeFragmentTestEnableNV"                      )) ;
-    functions[0].CmdSetCoverageReductionModeNV                                     = REINTERPRET_CAST(PFN_vkCmdSetCoverageReductionModeNV                                     , loader(device, "vkCmdSetCoverageReductionModeNV"                                 )) ;
-    /* VK_EXT_shader_module_identifier spec_version 1 */                             
-    functions[0].GetShaderModuleIdentifierEXT                                      = REINTERPRET_CAST(PFN_vkGetShaderModuleIdentifierEXT                                      , loader(device, "vkGetShaderModuleIdentifierEXT"                                  )) ;
-    functions[0].GetShaderModuleCreateInfoIdentifierEXT                            = REINTERPRET_CAST(PFN_vkGetShaderModuleCreateInfoIdentifierEXT                            , loader(device, "vkGetShaderModuleCreateInfoIdentifierEXT"                        )) ;
-    /* VK_NV_optical_flow spec_version 1 */                                          
-    functions[0].CreateOpticalFlowSessionNV                                        = REINTERPRET_CAST(PFN_vkCreateOpticalFlowSessionNV                                        , loader(device, "vkCreateOpticalFlowSessionNV"                                    )) ;
-    functions[0].DestroyOpticalFlowSessionNV                                       = REINTERPRET_CAST(PFN_vkDestroyOpticalFlowSessionNV                                       , loader(device, "vkDestroyOpticalFlowSessionNV"                                   )) ;
-    functions[0].BindOpticalFlowSessionImageNV                                     = REINTERPRET_CAST(PFN_vkBindOpticalFlowSessionImageNV                                     , loader(device, "vkBindOpticalFlowSessionImageNV"                                 )) ;
-    functions[0].CmdOpticalFlowExecuteNV                                           = REINTERPRET_CAST(PFN_vkCmdOpticalFlowExecuteNV                                           , loader(device, "vkCmdOpticalFlowExecuteNV"                                       )) ;
-    /* VK_EXT_shader_object spec_version 1 */                                        
-    functions[0].CreateShadersEXT                                                  = REINTERPRET_CAST(PFN_vkCreateShadersEXT                                                  , loader(device, "vkCreateShadersEXT"                                              )) ;
-    functions[0].DestroyShaderEXT                                                  = REINTERPRET_CAST(PFN_vkDestroyShaderEXT                                                  , loader(device, "vkDestroyShaderEXT"                                              )) ;
-    functions[0].GetShaderBinaryDataEXT                                            = REINTERPRET_CAST(PFN_vkGetShaderBinaryDataEXT                                            , loader(device, "vkGetShaderBinaryDataEXT"                                        )) ;
-    functions[0].CmdBindShadersEXT                                                 = REINTERPRET_CAST(PFN_vkCmdBindShadersEXT                                                 , loader(device, "vkCmdBindShadersEXT"                                             )) ;
-    /* VK_QCOM_tile_properties spec_version 1 */                                     
-    functions[0].GetFramebufferTilePropertiesQCOM                                  = REINTERPRET_CAST(PFN_vkGetFramebufferTilePropertiesQCOM                                  , loader(device, "vkGetFramebufferTilePropertiesQCOM"                              )) ;
-    functions[0].GetDynamicRenderingTilePropertiesQCOM                             = REINTERPRET_CAST(PFN_vkGetDynamicRenderingTilePropertiesQCOM                             , loader(device, "vkGetDynamicRenderingTilePropertiesQCOM"                         )) ;
-    /* VK_NV_low_latency2 spec_version 2 */                                          
-    functions[0].SetLatencySleepModeNV                                             = REINTERPRET_CAST(PFN_vkSetLatencySleepModeNV                                             , loader(device, "vkSetLatencySleepModeNV"                                         )) ;
-    functions[0].LatencySleepNV                                                    = REINTERPRET_CAST(PFN_vkLatencySleepNV                                                    , loader(device, "vkLatencySleepNV"                                                )) ;
-    functions[0].SetLatencyMarkerNV                                                = REINTERPRET_CAST(PFN_vkSetLatencyMarkerNV                                                , loader(device, "vkSetLatencyMarkerNV"                                            )) ;
-    functions[0].GetLatencyTimingsNV                                               = REINTERPRET_CAST(PFN_vkGetLatencyTimingsNV                                               , loader(device, "vkGetLatencyTimingsNV"                                           )) ;
-    functions[0].QueueNotifyOutOfBandNV                                            = REINTERPRET_CAST(PFN_vkQueueNotifyOutOfBandNV                                            , loader(device, "vkQueueNotifyOutOfBandNV"                                        )) ;
-    /* VK_EXT_attachment_feedback_loop_dynamic_state spec_version 1 */               
-    functions[0].CmdSetAttachmentFeedbackLoopEnableEXT                             = REINTERPRET_CAST(PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT                             , loader(device, "vkCmdSetAttachmentFeedbackLoopEnableEXT"                         )) ;
-    /* VK_KHR_acceleration_structure spec_version 13 */                              
-    functions[0].CreateAccelerationStructureKHR                                    = REINTERPRET_CAST(PFN_vkCreateAccelerationStructureKHR                                    , loader(device, "vkCreateAccelerationStructureKHR"                                )) ;
-    functions[0].DestroyAccelerationStructureKHR                                   = REINTERPRET_CAST(PFN_vkDestroyAccelerationStructureKHR                                   , loader(device, "vkDestroyAccelerationStructureKHR"                               )) ;
-    functions[0].CmdBuildAccelerationStructuresKHR                                 = REINTERPRET_CAST(PFN_vkCmdBuildAccelerationStructuresKHR                                 , loader(device, "vkCmdBuildAccelerationStructuresKHR"                             )) ;
-    functions[0].CmdBuildAccelerationStructuresIndirectKHR                         = REINTERPRET_CAST(PFN_vkCmdBuildAccelerationStructuresIndirectKHR                         , loader(device, "vkCmdBuildAccelerationStructuresIndirectKHR"                     )) ;
-    functions[0].BuildAccelerationStructuresKHR                                    = REINTERPRET_CAST(PFN_vkBuildAccelerationStructuresKHR                                    , loader(device, "vkBuildAccelerationStructuresKHR"                                )) ;
-    functions[0].CopyAccelerationStructureKHR                                      = REINTERPRET_CAST(PFN_vkCopyAccelerationStructureKHR                                      , loader(device, "vkCopyAccelerationStructureKHR"                                  )) ;
-    functions[0].CopyAccelerationStructureToMemoryKHR                              = REINTERPRET_CAST(PFN_vkCopyAccelerationStructureToMemoryKHR                              , loader(device, "vkCopyAccelerationStructureToMemoryKHR"                          )) ;
-    functions[0].CopyMemoryToAccelerationStructureKHR                              = REINTERPRET_CAST(PFN_vkCopyMemoryToAccelerationStructureKHR                              , loader(device, "vkCopyMemoryToAccelerationStructureKHR"                          )) ;
-    functions[0].WriteAccelerationStructuresPropertiesKHR                          = REINTERPRET_CAST(PFN_vkWriteAccelerationStructuresPropertiesKHR                          , loader(device, "vkWriteAccelerationStructuresPropertiesKHR"                      )) ;
-    functions[0].CmdCopyAccelerationStructureKHR                                   = REINTERPRET_CAST(PFN_vkCmdCopyAccelerationStructureKHR                                   , loader(device, "vkCmdCopyAccelerationStructureKHR"                               )) ;
-    functions[0].CmdCopyAccelerationStructureToMemoryKHR                           = REINTERPRET_CAST(PFN_vkCmdCopyAccelerationStructureToMemoryKHR                           , loader(device, "vkCmdCopyAccelerationStructureToMemoryKHR"                       )) ;
-    functions[0].CmdCopyMemoryToAccelerationStructureKHR                           = REINTERPRET_CAST(PFN_vkCmdCopyMemoryToAccelerationStructureKHR                           , loader(device, "vkCmdCopyMemoryToAccelerationStructureKHR"                       )) ;
-    functions[0].GetAccelerationStructureDeviceAddressKHR                          = REINTERPRET_CAST(PFN_vkGetAccelerationStructureDeviceAddressKHR                          , loader(device, "vkGetAccelerationStructureDeviceAddressKHR"                      )) ;
-    functions[0].CmdWriteAccelerationStructuresPropertiesKHR                       = REINTERPRET_CAST(PFN_vkCmdWriteAccelerationStructuresPropertiesKHR                       , loader(device, "vkCmdWriteAccelerationStructuresPropertiesKHR"                   )) ;
-    functions[0].GetDeviceAccelerationStructureCompatibilityKHR                    = REINTERPRET_CAST(PFN_vkGetDeviceAccelerationStructureCompatibilityKHR                    , loader(device, "vkGetDeviceAccelerationStructureCompatibilityKHR"                )) ;
-    functions[0].GetAccelerationStructureBuildSizesKHR                             = REINTERPRET_CAST(PFN_vkGetAccelerationStructureBuildSizesKHR                             , loader(device, "vkGetAccelerationStructureBuildSizesKHR"                         )) ;
-    /* VK_KHR_ray_tracing_pipeline spec_version 1 */                                 
-    functions[0].CmdTraceRaysKHR                                                   = REINTERPRET_CAST(PFN_vkCmdTraceRaysKHR                                                   , loader(device, "vkCmdTraceRaysKHR"                                               )) ;
-    functions[0].CreateRayTracingPipelinesKHR                                      = REINTERPRET_CAST(PFN_vkCreateRayTracingPipelinesKHR                                      , loader(device, "vkCreateRayTracingPipelinesKHR"                                  )) ;
-    functions[0].GetRayTracingCaptureReplayShaderGroupHandlesKHR                   = REINTERPRET_CAST(PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR                   , loader(device, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR"               )) ;
-    functions[0].CmdTraceRaysIndirectKHR                                           = REINTERPRET_CAST(PFN_vkCmdTraceRaysIndirectKHR                                           , loader(device, "vkCmdTraceRaysIndirectKHR"                                       )) ;
-    functions[0].GetRayTracingShaderGroupStackSizeKHR                              = REINTERPRET_CAST(PFN_vkGetRayTracingShaderGroupStackSizeKHR                              , loader(device, "vkGetRayTracingShaderGroupStackSizeKHR"                          )) ;
-    functions[0].CmdSetRayTracingPipelineStackSizeKHR                              = REINTERPRET_CAST(PFN_vkCmdSetRayTracingPipelineStackSizeKHR                              , loader(device, "vkCmdSetRayTracingPipelineStackSizeKHR"                          )) ;
-    /* VK_EXT_mesh_shader spec_version 1 */                                          
-    functions[0].CmdDrawMeshTasksEXT                                               = REINTERPRET_CAST(PFN_vkCmdDrawMeshTasksEXT                                               , loader(device, "vkCmdDrawMeshTasksEXT"                                           )) ;
-    functions[0].CmdDrawMeshTasksIndirectEXT                                       = REINTERPRET_CAST(PFN_vkCmdDrawMeshTasksIndirectEXT                                       , loader(device, "vkCmdDrawMeshTasksIndirectEXT"                                   )) ;
-    functions[0].CmdDrawMeshTasksIndirectCountEXT                                  = REINTERPRET_CAST(PFN_vkCmdDrawMeshTasksIndirectCountEXT                                  , loader(device, "vkCmdDrawMeshTasksIndirectCountEXT"                              )) ;
-    /* VK_ANDROID_external_memory_android_hardware_buffer spec_version 5 */          
-    functions[0].GetAndroidHardwareBufferPropertiesANDROID                         = REINTERPRET_CAST(PFN_vkGetAndroidHardwareBufferPropertiesANDROID                         , loader(device, "vkGetAndroidHardwareBufferPropertiesANDROID"                     )) ;
-    functions[0].GetMemoryAndroidHardwareBufferANDROID                             = REINTERPRET_CAST(PFN_vkGetMemoryAndroidHardwareBufferANDROID                             , loader(device, "vkGetMemoryAndroidHardwareBufferANDROID"                         )) ;
-    /* VK_FUCHSIA_external_memory spec_version 1 */                                  
-    functions[0].GetMemoryZirconHandleFUCHSIA                                      = REINTERPRET_CAST(PFN_vkGetMemoryZirconHandleFUCHSIA                                      , loader(device, "vkGetMemoryZirconHandleFUCHSIA"                                  )) ;
-    functions[0].GetMemoryZirconHandlePropertiesFUCHSIA                            = REINTERPRET_CAST(PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA                            , loader(device, "vkGetMemoryZirconHandlePropertiesFUCHSIA"                        )) ;
-    /* VK_FUCHSIA_external_semaphore spec_version 1 */                               
-    functions[0].ImportSemaphoreZirconHandleFUCHSIA                                = REINTERPRET_CAST(PFN_vkImportSemaphoreZirconHandleFUCHSIA                                , loader(device, "vkImportSemaphoreZirconHandleFUCHSIA"                            )) ;
-    functions[0].GetSemaphoreZirconHandleFUCHSIA                                   = REINTERPRET_CAST(PFN_vkGetSemaphoreZirconHandleFUCHSIA                                   , loader(device, "vkGetSemaphoreZirconHandleFUCHSIA"                               )) ;
-    /* VK_FUCHSIA_buffer_collection spec_version 2 */                                
-    functions[0].CreateBufferCollectionFUCHSIA                                     = REINTERPRET_CAST(PFN_vkCreateBufferCollectionFUCHSIA                                     , loader(device, "vkCreateBufferCollectionFUCHSIA"                                 )) ;
-    functions[0].SetBufferCollectionImageConstraintsFUCHSIA                        = REINTERPRET_CAST(PFN_vkSetBufferCollectionImageConstraintsFUCHSIA                        , loader(device, "vkSetBufferCollectionImageConstraintsFUCHSIA"                    )) ;
-    functions[0].SetBufferCollectionBufferConstraintsFUCHSIA                       = REINTERPRET_CAST(PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA                       , loader(device, "vkSetBufferCollectionBufferConstraintsFUCHSIA"                   )) ;
-    functions[0].DestroyBufferCollectionFUCHSIA                                    = REINTERPRET_CAST(PFN_vkDestroyBufferCollectionFUCHSIA                                    , loader(device, "vkDestroyBufferCollectionFUCHSIA"                                )) ;
-    functions[0].GetBufferCollectionPropertiesFUCHSIA                              = REINTERPRET_CAST(PFN_vkGetBufferCollectionPropertiesFUCHSIA                              , loader(device, "vkGetBufferCollectionPropertiesFUCHSIA"                          )) ;
-    /* VK_EXT_metal_objects spec_version 2 */                                        
-    functions[0].ExportMetalObjectsEXT                                             = REINTERPRET_CAST(PFN_vkExportMetalObjectsEXT                                             , loader(device, "vkExportMetalObjectsEXT"                                         )) ;
-    /* VK_KHR_external_memory_win32 spec_version 1 */                                
-    functions[0].GetMemoryWin32HandleKHR                                           = REINTERPRET_CAST(PFN_vkGetMemoryWin32HandleKHR                                           , loader(device, "vkGetMemoryWin32HandleKHR"                                       )) ;
-    functions[0].GetMemoryWin32HandlePropertiesKHR                                 = REINTERPRET_CAST(PFN_vkGetMemoryWin32HandlePropertiesKHR                                 , loader(device, "vkGetMemoryWin32HandlePropertiesKHR"                             )) ;
-    /* VK_KHR_external_semaphore_win32 spec_version 1 */                             
-    functions[0].ImportSemaphoreWin32HandleKHR                                     = REINTERPRET_CAST(PFN_vkImportSemaphoreWin32HandleKHR                                     , loader(device, "vkImportSemaphoreWin32HandleKHR"                                 )) ;
-    functions[0].GetSemaphoreWin32HandleKHR                                        = REINTERPRET_CAST(PFN_vkGetSemaphoreWin32HandleKHR                                        , loader(device, "vkGetSemaphoreWin32HandleKHR"                                    )) ;
-    /* VK_KHR_external_fence_win32 spec_version 1 */                                 
-    functions[0].ImportFenceWin32HandleKHR                                         = REINTERPRET_CAST(PFN_vkImportFenceWin32HandleKHR                                         , loader(device, "vkImportFenceWin32HandleKHR"                                     )) ;
-    functions[0].GetFenceWin32HandleKHR                                            = REINTERPRET_CAST(PFN_vkGetFenceWin32HandleKHR                                            , loader(device, "vkGetFenceWin32HandleKHR"                                        )) ;
-    /* VK_NV_external_memory_win32 spec_version 1 */                                 
-    functions[0].GetMemoryWin32HandleNV                                            = REINTERPRET_CAST(PFN_vkGetMemoryWin32HandleNV                                            , loader(device, "vkGetMemoryWin32HandleNV"                                        )) ;
-    /* VK_EXT_full_screen_exclusive spec_version 4 */                                
-    functions[0].AcquireFullScreenExclusiveModeEXT                                 = REINTERPRET_CAST(PFN_vkAcquireFullScreenExclusiveModeEXT                                 , loader(device, "vkAcquireFullScreenExclusiveModeEXT"                             )) ;
-    functions[0].ReleaseFullScreenExclusiveModeEXT                                 = REINTERPRET_CAST(PFN_vkReleaseFullScreenExclusiveModeEXT                                 , loader(device, "vkReleaseFullScreenExclusiveModeEXT"                             )) ;
-    functions[0].GetDeviceGroupSurfacePresentModes2EXT                             = REINTERPRET_CAST(PFN_vkGetDeviceGroupSurfacePresentModes2EXT                             , loader(device, "vkGetDeviceGroupSurfacePresentModes2EXT"                         )) ;
-    /* VK_QNX_external_memory_screen_buffer spec_version 1 */                        
-    functions[0].GetScreenBufferPropertiesQNX                                      = REINTERPRET_CAST(PFN_vkGetScreenBufferPropertiesQNX                                      , loader(device, "vkGetScreenBufferPropertiesQNX"                                  )) ;
-    /* VK_AMDX_shader_enqueue spec_version 2 */
-    functions[0].CreateExecutionGraphPipelinesAMDX                                 = REINTERPRET_CAST(PFN_vkCreateExecutionGraphPipelinesAMDX                                 , loader(device, "vkCreateExecutionGraphPipelinesAMDX"                             )) ;
-    functions[0].GetExecutionGraphPipelineScratchSizeAMDX                          = REINTERPRET_CAST(PFN_vkGetExecutionGraphPipelineScratchSizeAMDX                          , loader(device, "vkGetExecutionGraphPipelineScratchSizeAMDX"                      )) ;
-    functions[0].GetExecutionGraphPipelineNodeIndexAMDX                            = REINTERPRET_CAST(PFN_vkGetExecutionGraphPipelineNodeIndexAMDX                            , loader(device, "vkGetExecutionGraphPipelineNodeIndexAMDX"                        )) ;
-    functions[0].CmdInitializeGraphScratchMemoryAMDX                               = REINTERPRET_CAST(PFN_vkCmdInitializeGraphScratchMemoryAMDX                               , loader(device, "vkCmdInitializeGraphScratchMemoryAMDX"                           )) ;
-    functions[0].CmdDispatchGraphAMDX                                              = REINTERPRET_CAST(PFN_vkCmdDispatchGraphAMDX                                              , loader(device, "vkCmdDispatchGraphAMDX"                                          )) ;
-    functions[0].CmdDispatchGraphIndirectAMDX                                      = REINTERPRET_CAST(PFN_vkCmdDispatchGraphIndirectAMDX                                      , loader(device, "vkCmdDispatchGraphIndirectAMDX"                                  )) ;
-    functions[0].CmdDispatchGraphIndirectCountAMDX                                 = REINTERPRET_CAST(PFN_vkCmdDispatchGraphIndirectCountAMDX                                 , loader(device, "vkCmdDispatchGraphIndirectCountAMDX"                             )) ;
-        /* Additions from 1.3.284 to 1.4.309: */
-    /* to VK_NVX_image_view_handle spec_version 3 */
-    functions[0].GetImageViewHandle64NVX                                           = REINTERPRET_CAST(PFN_vkGetImageViewHandle64NVX                                           , loader(device, "vkGetImageViewHandle64NVX"                                       )) ;
-    /* to VK_EXT_shader_object spec_version 1 */
-    functions[0].CmdSetDepthClampRangeEXT                                          = REINTERPRET_CAST(PFN_vkCmdSetDepthClampRangeEXT                                          , loader(device, "vkCmdSetDepthClampRangeEXT"                                      )) ;
-    /* VK_VERSION_1_4 */
-    functions[0].CmdSetLineStipple                                                 = REINTERPRET_CAST(PFN_vkCmdSetLineStipple                                                 , loader(device, "vkCmdSetLineStipple"                                             )) ;
-    functions[0].MapMemory2                                                        = REINTERPRET_CAST(PFN_vkMapMemory2                                                        , loader(device, "vkMapMemory2"                                                    )) ;
-    functions[0].UnmapMemory2                                                      = REINTERPRET_CAST(PFN_vkUnmapMemory2                                                      , loader(device, "vkUnmapMemory2"                                                  )) ;
-    functions[0].CmdBindIndexBuffer2                                               = REINTERPRET_CAST(PFN_vkCmdBindIndexBuffer2                                               , loader(device, "vkCmdBindIndexBuffer2"                                           )) ;
-    functions[0].GetRenderingAreaGranularity                                       = REINTERPRET_CAST(PFN_vkGetRenderingAreaGranularity                                       , loader(device, "vkGetRenderingAreaGranularity"                                   )) ;
-    functions[0].GetDeviceImageSubresourceLayout                                   = REINTERPRET_CAST(PFN_vkGetDeviceImageSubresourceLayout                                   , loader(device, "vkGetDeviceImageSubresourceLayout"                               )) ;
-    functions[0].GetImageSubresourceLayout2                                        = REINTERPRET_CAST(PFN_vkGetImageSubresourceLayout2                                        , loader(device, "vkGetImageSubresourceLayout2"                                    )) ;
-    functions[0].CmdPushDescriptorSet                                              = REINTERPRET_CAST(PFN_vkCmdPushDescriptorSet                                              , loader(device, "vkCmdPushDescriptorSet"                                          )) ;
-    functions[0].CmdPushDescriptorSetWithTemplate                                  = REINTERPRET_CAST(PFN_vkCmdPushDescriptorSetWithTemplate                                  , loader(device, "vkCmdPushDescriptorSetWithTemplate"                              )) ;
-    functions[0].CmdSetRenderingAttachmentLocations                                = REINTERPRET_CAST(PFN_vkCmdSetRenderingAttachmentLocations                                , loader(device, "vkCmdSetRenderingAttachmentLocations"                            )) ;
-    functions[0].CmdSetRenderingInputAttachmentIndices                             = REINTERPRET_CAST(PFN_vkCmdSetRenderingInputAttachmentIndices                             , loader(device, "vkCmdSetRenderingInputAttachmentIndices"                         )) ;
-    functions[0].CmdBindDescriptorSets2                                            = REINTERPRET_CAST(PFN_vkCmdBindDescriptorSets2                                            , loader(device, "vkCmdBindDescriptorSets2"                                        )) ;
-    functions[0].CmdPushConstants2                                                 = REINTERPRET_CAST(PFN_vkCmdPushConstants2                                                 , loader(device, "vkCmdPushConstants2"                                             )) ;
-    functions[0].CmdPushDescriptorSet2                                             = REINTERPRET_CAST(PFN_vkCmdPushDescriptorSet2                                             , loader(device, "vkCmdPushDescriptorSet2"                                         )) ;
-    functions[0].CmdPushDescriptorSetWithTemplate2                                 = REINTERPRET_CAST(PFN_vkCmdPushDescriptorSetWithTemplate2                                 , loader(device, "vkCmdPushDescriptorSetWithTemplate2"                             )) ;
-    functions[0].CopyMemoryToImage                                                 = REINTERPRET_CAST(PFN_vkCopyMemoryToImage                                                 , loader(device, "vkCopyMemoryToImage"                                             )) ;
-    functions[0].CopyImageToMemory                                                 = REINTERPRET_CAST(PFN_vkCopyImageToMemory                                                 , loader(device, "vkCopyImageToMemory"                                             )) ;
-    functions[0].CopyImageToImage                                                  = REINTERPRET_CAST(PFN_vkCopyImageToImage                                                  , loader(device, "vkCopyImageToImage"                                              )) ;
-    functions[0].TransitionImageLayout                                             = REINTERPRET_CAST(PFN_vkTransitionImageLayout                                             , loader(device, "vkTransitionImageLayout"                                         )) ;
-    /* VK_KHR_pipeline_binary spec_version 1 */
-    functions[0].CreatePipelineBinariesKHR                                         = REINTERPRET_CAST(PFN_vkCreatePipelineBinariesKHR                                         , loader(device, "vkCreatePipelineBinariesKHR"                                     )) ;
-    functions[0].DestroyPipelineBinaryKHR                                          = REINTERPRET_CAST(PFN_vkDestroyPipelineBinaryKHR                                          , loader(device, "vkDestroyPipelineBinaryKHR"                                      )) ;
-    functions[0].GetPipelineKeyKHR                                                 = REINTERPRET_CAST(PFN_vkGetPipelineKeyKHR                                                 , loader(device, "vkGetPipelineKeyKHR"                                             )) ;
-    functions[0].GetPipelineBinaryDataKHR                                          = REINTERPRET_CAST(PFN_vkGetPipelineBinaryDataKHR                                          , loader(device, "vkGetPipelineBinaryDataKHR"                                      )) ;
-    functions[0].ReleaseCapturedPipelineDataKHR                                    = REINTERPRET_CAST(PFN_vkReleaseCapturedPipelineDataKHR                                    , loader(device, "vkReleaseCapturedPipelineDataKHR"                                )) ;
-    /* VK_AMD_anti_lag spec_version 1 */
-    functions[0].AntiLagUpdateAMD                                                  = REINTERPRET_CAST(PFN_vkAntiLagUpdateAMD                                                  , loader(device, "vkAntiLagUpdateAMD"                                              )) ;
-    /* VK_NV_cooperative_vector spec_version 4 */
-    functions[0].ConvertCooperativeVectorMatrixNV                                  = REINTERPRET_CAST(PFN_vkConvertCooperativeVectorMatrixNV                                  , loader(device, "vkConvertCooperativeVectorMatrixNV"                              )) ;
-    functions[0].CmdConvertCooperativeVectorMatrixNV                               = REINTERPRET_CAST(PFN_vkCmdConvertCooperativeVectorMatrixNV                               , loader(device, "vkCmdConvertCooperativeVectorMatrixNV"                           )) ;
-    /* VK_NV_cluster_acceleration_structure spec_version 2 */
-    functions[0].GetClusterAccelerationStructureBuildSizesNV                       = REINTERPRET_CAST(PFN_vkGetClusterAccelerationStructureBuildSizesNV                       , loader(device, "vkGetClusterAccelerationStructureBuildSizesNV"                   )) ;
-    functions[0].CmdBuildClusterAccelerationStructureIndirectNV                    = REINTERPRET_CAST(PFN_vkCmdBuildClusterAccelerationStructureIndirectNV                    , loader(device, "vkCmdBuildClusterAccelerationStructureIndirectNV"                )) ;
-    /* VK_NV_partitioned_acceleration_structure spec_version 1 */
-    functions[0].GetPartitionedAccelerationStructuresBuildSizesNV                  = REINTERPRET_CAST(PFN_vkGetPartitionedAccelerationStructuresBuildSizesNV                  , loader(device, "vkGetPartitionedAccelerationStructuresBuildSizesNV"              )) ;
-    functions[0].CmdBuildPartitionedAccelerationStructuresNV                       = REINTERPRET_CAST(PFN_vkCmdBuildPartitionedAccelerationStructuresNV                       , loader(device, "vkCmdBuildPartitionedAccelerationStructuresNV"                   )) ;
-    /* VK_EXT_device_generated_commands spec_version 1 */
-    functions[0].GetGeneratedCommandsMemoryRequirementsEXT                         = REINTERPRET_CAST(PFN_vkGetGeneratedCommandsMemoryRequirementsEXT                         , loader(device, "vkGetGeneratedCommandsMemoryRequirementsEXT"                     )) ;
-    functions[0].CmdPreprocessGeneratedCommandsEXT                                 = REINTERPRET_CAST(PFN_vkCmdPreprocessGeneratedCommandsEXT                                 , loader(device, "vkCmdPreprocessGeneratedCommandsEXT"                             )) ;
-    functions[0].CmdExecuteGeneratedCommandsEXT                                    = REINTERPRET_CAST(PFN_vkCmdExecuteGeneratedCommandsEXT                                    , loader(device, "vkCmdExecuteGeneratedCommandsEXT"                                )) ;
-    functions[0].CreateIndirectCommandsLayoutEXT                                   = REINTERPRET_CAST(PFN_vkCreateIndirectCommandsLayoutEXT                                   , loader(device, "vkCreateIndirectCommandsLayoutEXT"                               )) ;
-    functions[0].DestroyIndirectCommandsLayoutEXT                                  = REINTERPRET_CAST(PFN_vkDestroyIndirectCommandsLayoutEXT                                  , loader(device, "vkDestroyIndirectCommandsLayoutEXT"                              )) ;
-    functions[0].CreateIndirectExecutionSetEXT                                     = REINTERPRET_CAST(PFN_vkCreateIndirectExecutionSetEXT                                     , loader(device, "vkCreateIndirectExecutionSetEXT"                                 )) ;
-    functions[0].DestroyIndirectExecutionSetEXT                                    = REINTERPRET_CAST(PFN_vkDestroyIndirectExecutionSetEXT                                    , loader(device, "vkDestroyIndirectExecutionSetEXT"                                )) ;
-    functions[0].UpdateIndirectExecutionSetPipelineEXT                             = REINTERPRET_CAST(PFN_vkUpdateIndirectExecutionSetPipelineEXT                             , loader(device, "vkUpdateIndirectExecutionSetPipelineEXT"                         )) ;
-    functions[0].UpdateIndirectExecutionSetShaderEXT                               = REINTERPRET_CAST(PFN_vkUpdateIndirectExecutionSetShaderEXT                               , loader(device, "vkUpdateIndirectExecutionSetShaderEXT"                           )) ;
-    /* VK_EXT_external_memory_metal spec_version 1 */
-    functions[0].GetMemoryMetalHandleEXT                                           = REINTERPRET_CAST(PFN_vkGetMemoryMetalHandleEXT                                           , loader(device, "vkGetMemoryMetalHandleEXT"                                       )) ;
-    functions[0].GetMemoryMetalHandlePropertiesEXT                                 = REINTERPRET_CAST(PFN_vkGetMemoryMetalHandlePropertiesEXT                                 , loader(device, "vkGetMemoryMetalHandlePropertiesEXT"                             )) ;
+
+#if defined(__x86_64__)
+/* the common part saves the argument registers, calls vkadDeviceThunkResolve with the first argument and the entry index from r11, and jumps to the result.
+   Every thunk starts with endbr64, so it is a valid target of indirect calls with CET. */
+__asm__(
+    ".ifndef " VKAD_ASM_SYMBOL(vkadDeviceThunks) "\n"
+    VKAD_ASM_SECTION_BEGIN(vkadDeviceThunks)
+    "    .p2align 4\n"
+    VKAD_ASM_SYMBOL(vkadDeviceThunkCommon) ":\n"
+    "    pushq   %rbp\n"
+    "    movq    %rsp, %rbp\n"
+    "    subq    $176, %rsp\n"
+    "    movq    %rdi, 0(%rsp)\n"
+    "    movq    %rsi, 8(%rsp)\n"
+    "    movq    %rdx, 16(%rsp)\n"
+    "    movq    %rcx, 24(%rsp)\n"
+    "    movq    %r8, 32(%rsp)\n"
+    "    movq    %r9, 40(%rsp)\n"
+    "    movaps  %xmm0, 48(%rsp)\n"
+    "    movaps  %xmm1, 64(%rsp)\n"
+    "    movaps  %xmm2, 80(%rsp)\n"
+    "    movaps  %xmm3, 96(%rsp)\n"
+    "    movaps  %xmm4, 112(%rsp)\n"
+    "    movaps  %xmm5, 128(%rsp)\n"
+    "    movaps  %xmm6, 144(%rsp)\n"
+    "    movaps  %xmm7, 160(%rsp)\n"
+    "    movl    %r11d, %esi\n"
+    "    call    " VKAD_ASM_SYMBOL(vkadDeviceThunkResolve) "\n"
+    "    movq    %rax, %r11\n"
+    "    movq    0(%rsp), %rdi\n"
+    "    movq    8(%rsp), %rsi\n"
+    "    movq    16(%rsp), %rdx\n"
+    "    movq    24(%rsp), %rcx\n"
+    "    movq    32(%rsp), %r8\n"
+    "    movq    40(%rsp), %r9\n"
+    "    movaps  48(%rsp), %xmm0\n"
+    "    movaps  64(%rsp), %xmm1\n"
+    "    movaps  80(%rsp), %xmm2\n"
+    "    movaps  96(%rsp), %xmm3\n"
+    "    movaps  112(%rsp), %xmm4\n"
+    "    movaps  128(%rsp), %xmm5\n"
+    "    movaps  144(%rsp), %xmm6\n"
+    "    movaps  160(%rsp), %xmm7\n"
+    "    leave\n"
+    "    jmpq    *%r11\n"
+    "    .p2align 4\n"
+    VKAD_ASM_WEAK(vkadDeviceThunks)
+    VKAD_ASM_SYMBOL(vkadDeviceThunks) ":\n"
+    "    .set    vkad_entry, 0\n"
+    "    .rept   " VKAD_EXPAND_STRINGIFY(VKAD_DEVICE_THUNK_COUNT) "\n"
+    "    endbr64\n"
+    "    movl    $vkad_entry, %r11d\n"
+    "    jmp     " VKAD_ASM_SYMBOL(vkadDeviceThunkCommon) "\n"
+    "    .p2align 4\n"
+    "    .set    vkad_entry, vkad_entry + 1\n"
+    "    .endr\n"
+    VKAD_ASM_SECTION_END
+    ".endif\n"
+);
+#elif defined(__aarch64__)
+/* the same for AArch64, with the entry index in w17; x16 is used for the final branch, which BTI allows to land on "bti c" */
+__asm__(
+    ".ifndef " VKAD_ASM_SYMBOL(vkadDeviceThunks) "\n"
+    VKAD_ASM_SECTION_BEGIN(vkadDeviceThunks)
+    "    .p2align 4\n"
+    VKAD_ASM_SYMBOL(vkadDeviceThunkCommon) ":\n"
+    "    stp     x29, x30, [sp, #-224]!\n"
+    "    mov     x29, sp\n"
+    "    stp     x0, x1, [sp, #16]\n"
+    "    stp     x2, x3, [sp, #32]\n"
+    "    stp     x4, x5, [sp, #48]\n"
+    "    stp     x6, x7, [sp, #64]\n"
+    "    str     x8, [sp, #80]\n"
+    "    stp     q0, q1, [sp, #96]\n"
+    "    stp     q2, q3, [sp, #128]\n"
+    "    stp     q4, q5, [sp, #160]\n"
+    "    stp     q6, q7, [sp, #192]\n"
+    "    mov     w1, w17\n"
+    "    bl      " VKAD_ASM_SYMBOL(vkadDeviceThunkResolve) "\n"
+    "    mov     x16, x0\n"
+    "    ldp     x0, x1, [sp, #16]\n"
+    "    ldp     x2, x3, [sp, #32]\n"
+    "    ldp     x4, x5, [sp, #48]\n"
+    "    ldp     x6, x7, [sp, #64]\n"
+    "    ldr     x8, [sp, #80]\n"
+    "    ldp     q0, q1, [sp, #96]\n"
+    "    ldp     q2, q3, [sp, #128]\n"
+    "    ldp     q4, q5, [sp, #160]\n"
+    "    ldp     q6, q7, [sp, #192]\n"
+    "    ldp     x29, x30, [sp], #224\n"
+    "    br      x16\n"
+    "    .p2align 4\n"
+    VKAD_ASM_WEAK(vkadDeviceThunks)
+    VKAD_ASM_SYMBOL(vkadDeviceThunks) ":\n"
+    "    .set    vkad_entry, 0\n"
+    "    .rept   " VKAD_EXPAND_STRINGIFY(VKAD_DEVICE_THUNK_COUNT) "\n"
+    "    hint    #34\n"
+    "    mov     w17, #vkad_entry\n"
+    "    b       " VKAD_ASM_SYMBOL(vkadDeviceThunkCommon) "\n"
+    "    .p2align 4\n"
+    "    .set    vkad_entry, vkad_entry + 1\n"
+    "    .endr\n"
+    VKAD_ASM_SECTION_END
+    ".endif\n"
+);
+#endif
+#endif /* VKAD_HAS_THUNKS */
+
+/* whether another registration than the given one has or is about to get the dispatch key */
+static int vkadLazyDispatchKeyTaken(const VkadLazyDeviceRegistration* registration, void* dispatchKey) {
+    uint32_t i;
+    for (i = 0; i < VKAD_MAX_LAZY_DEVICES; ++i) {
+        const VkadLazyDeviceRegistration* other = &vkadLazyDeviceRegistrations[i];
+        if (other == registration || __atomic_load_n(&other->state, __ATOMIC_SEQ_CST) == VKAD_REGISTRATION_FREE) continue;
+        if (__atomic_load_n(&other->dispatchKey, __ATOMIC_SEQ_CST) == dispatchKey) return 1;
+    }
+    return 0;
+}
+/* points every member of the table to its thunk and registers the table for the device; the table must not be copied, since the thunks only update the registered one.
+   Without thunk support, when all registrations are in use, or when another lazily loaded device has the same dispatch key, this loads the whole table like
+   vkadLoadDeviceFunctions. Drivers opened directly often store the same loader magic in all their objects instead of a dispatch table, and then the thunks
+   could not tell the devices apart. */
+VKAD_API void vkadLoadDeviceFunctionsLazy(PFN_vkGetDeviceProcAddr loader, VkDevice device, VkadDeviceFunctions* functions) {
+#if VKAD_HAS_THUNKS
+    void* dispatchKey = vkadDispatchKey(device);
+    uint32_t i, j;
+    for (i = 0; i < VKAD_MAX_LAZY_DEVICES; ++i) {
+        VkadLazyDeviceRegistration* registration = &vkadLazyDeviceRegistrations[i];
+        uint32_t expected = VKAD_REGISTRATION_FREE;
+        if (!__atomic_compare_exchange_n(&registration->state, &expected, VKAD_REGISTRATION_CLAIMED, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) continue;
+        /* the key is published before the others are checked, so of two devices with the same key registered at the same time, at least one sees the other */
+        __atomic_store_n(&registration->dispatchKey, dispatchKey, __ATOMIC_SEQ_CST);
+        if (vkadLazyDispatchKeyTaken(registration, dispatchKey)) {
+            __atomic_store_n(&registration->state, VKAD_REGISTRATION_FREE, __ATOMIC_RELEASE);
+            break;
+        }
+        registration->device      = device;
+        registration->loader      = loader;
+        registration->functions   = functions;
+        for (j = 0; j < VKAD_DEVICE_FUNCTION_COUNT; ++j) {
+            vkadStoreFunction(functions, &vkadDeviceFunctionEntries[j], REINTERPRET_CAST(PFN_vkVoidFunction, (REINTERPRET_CAST(uintptr_t, vkadDeviceThunks) + j * VKAD_THUNK_SIZE)));
+        }
+        __atomic_store_n(&registration->state, VKAD_REGISTRATION_READY, __ATOMIC_RELEASE);
+        return;
+    }
+#endif
+    vkadLoadDeviceFunctions(loader, device, functions);
+}
+/* ends the registration of a lazily loaded table, has to be called before the device is destroyed; members that were not called until then stay unusable */
+VKAD_API void vkadReleaseDeviceFunctions(VkadDeviceFunctions* functions) {
+#if VKAD_HAS_THUNKS
+    uint32_t i;
+    for (i = 0; i < VKAD_MAX_LAZY_DEVICES; ++i) {
+        VkadLazyDeviceRegistration* registration = &vkadLazyDeviceRegistrations[i];
+        if (__atomic_load_n(&registration->state, __ATOMIC_ACQUIRE) == VKAD_REGISTRATION_READY && registration->functions == functions) {
+            __atomic_store_n(&registration->state, VKAD_REGISTRATION_FREE, __ATOMIC_RELEASE);
+        }
+    }
+#else
+    (void) functions;
+#endif
+}
+#if VKAD_HAS_THUNKS
+static int vkadIsDeviceThunk(PFN_vkVoidFunction function) {
+    uintptr_t address = REINTERPRET_CAST(uintptr_t, function), thunks = REINTERPRET_CAST(uintptr_t, vkadDeviceThunks);
+    return address >= thunks && address < thunks + VKAD_DEVICE_THUNK_COUNT * VKAD_THUNK_SIZE;
+}
+#endif
+/* the members of a lazily loaded table that were called (or preloaded) so far, which is what a load manifest records; for other tables, all members that are not NULL */
+VKAD_API void vkadGetCalledDeviceFunctions(const VkadDeviceFunctions* functions, VkadDeviceFunctionSet* called) {
+    uint32_t i;
+    memset(called, 0, sizeof(VkadDeviceFunctionSet));
+    for (i = 0; i < VKAD_DEVICE_FUNCTION_COUNT; ++i) {
+        PFN_vkVoidFunction function = vkadGetDeviceFunction(functions, (VkadDeviceFunctionId) i);
+        if (function == NULL) continue;
+#if VKAD_HAS_THUNKS
+        if (vkadIsDeviceThunk(function)) continue;
+#endif
+        vkadAddToFunctionSet(called->bits, i);
+    }
+}
+/* loads the table lazily, but looks up the functions in preload right away, so the usual ones do not go through the thunks on their first call */
+VKAD_API void vkadLoadDeviceFunctionsPreloaded(PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkadDeviceFunctionSet* preload, VkadDeviceFunctions* functions) {
+#if VKAD_HAS_THUNKS
+    char name[VKAD_MAX_FUNCTION_NAME_SIZE];
+    uint32_t i;
+#endif
+    vkadLoadDeviceFunctionsLazy(loader, device, functions);
+#if VKAD_HAS_THUNKS
+    for (i = 0; i < VKAD_DEVICE_FUNCTION_COUNT; ++i) {
+        const VkadFunctionEntry* entry = &vkadDeviceFunctionEntries[i];
+        PFN_vkVoidFunction function = vkadGetDeviceFunction(functions, (VkadDeviceFunctionId) i);
+        /* a table that could not be registered was loaded completely */
+        if (!vkadDeviceFunctionAvailable(preload, (VkadDeviceFunctionId) i) || function == NULL || !vkadIsDeviceThunk(function)) continue;
+        function = loader(device, vkadFunctionEntryName(entry, name));
+        if (function == NULL) function = vkadUnsupportedStub(i, vkadDeviceValueFunctions, sizeof(vkadDeviceValueFunctions) / sizeof(uint16_t));
+        vkadStoreFunction(functions, entry, function);
+    }
+#else
+    (void) preload;
+#endif
+}
+#endif /* VKAD_HAS_DEFINITIONS */
+#endif /* VKAD_LAZY_LOADING */
+
+#ifdef VKAD_LOAD_MANIFESTS
+/* load manifests: the functions used in a recorded run, as a text file with a header line and one function name per line,
+   so a manifest stays usable with other versions of vkad; unknown names are skipped */
+#define VKAD_LOAD_MANIFEST_HEADER "vkad load manifest 1"
+VKAD_API int vkadWriteLoadManifest(const char* path, const VkadInstanceFunctionSet* instanceFunctions, const VkadDeviceFunctionSet* deviceFunctions);
+VKAD_API int vkadReadLoadManifest (const char* path, VkadInstanceFunctionSet* instanceFunctions, VkadDeviceFunctionSet* deviceFunctions);
+
+#if VKAD_HAS_DEFINITIONS
+VKAD_API int vkadWriteLoadManifest(const char* path, const VkadInstanceFunctionSet* instanceFunctions, const VkadDeviceFunctionSet* deviceFunctions) {
+    FILE* file = fopen(path, "w");
+    uint32_t i;
+    int success;
+    if (file == NULL) return 0;
+    fputs(VKAD_LOAD_MANIFEST_HEADER "\n", file);
+    for (i = 0; instanceFunctions != NULL && i < VKAD_INSTANCE_FUNCTION_ID_COUNT; ++i) {
+        if (vkadInstanceFunctionAvailable(instanceFunctions, (VkadInstanceFunctionId) i)) fprintf(file, "vk%s\n", vkadInstanceFunctionName((VkadInstanceFunctionId) i));
+    }
+    for (i = 0; deviceFunctions != NULL && i < VKAD_DEVICE_FUNCTION_ID_COUNT; ++i) {
+        if (vkadDeviceFunctionAvailable(deviceFunctions, (VkadDeviceFunctionId) i)) fprintf(file, "vk%s\n", vkadDeviceFunctionName((VkadDeviceFunctionId) i));
+    }
+    success = !ferror(file);
+    return fclose(file) == 0 && success;
+}
+/* reads a line without its line break (\n or \r\n, or none at the end of the file) into line; a line that does not fit is skipped and read as empty.
+   Returns 0 at the end of the file. */
+static int vkadReadManifestLine(char* line, int size, FILE* file) {
+    size_t length;
+    if (fgets(line, size, file) == NULL) return 0;
+    length = strlen(line);
+    if (length > 0 && line[length - 1] == '\n') {
+        line[--length] = '\0';
+    } else if (!feof(file)) {
+        /* too long for a function name, skip the rest of the line */
+        int c;
+        do c = fgetc(file); while (c != '\n' && c != EOF);
+        line[0] = '\0';
+        return 1;
+    }
+    if (length > 0 && line[length - 1] == '\r') line[--length] = '\0';
+    return 1;
+}
+/* reads a manifest into the sets (either may be NULL), returns 0 if the file can not be read or is no manifest */
+VKAD_API int vkadReadLoadManifest(const char* path, VkadInstanceFunctionSet* instanceFunctions, VkadDeviceFunctionSet* deviceFunctions) {
+    char line[VKAD_MAX_FUNCTION_NAME_SIZE + 2];
+    FILE* file = fopen(path, "r");
+    int success = 0;
+    if (instanceFunctions != NULL) memset(instanceFunctions, 0, sizeof(VkadInstanceFunctionSet));
+    if (deviceFunctions != NULL) memset(deviceFunctions, 0, sizeof(VkadDeviceFunctionSet));
+    if (file == NULL) return 0;
+    if (vkadReadManifestLine(line, (int) sizeof(line), file) && strcmp(line, VKAD_LOAD_MANIFEST_HEADER) == 0) {
+        while (vkadReadManifestLine(line, (int) sizeof(line), file)) {
+            VkadInstanceFunctionId instanceId;
+            VkadDeviceFunctionId deviceId;
+            if (instanceFunctions != NULL && vkadFindInstanceFunctionId(line, &instanceId)) vkadAddToFunctionSet(instanceFunctions->bits, instanceId);
+            if (deviceFunctions != NULL && vkadFindDeviceFunctionId(line, &deviceId)) vkadAddToFunctionSet(deviceFunctions->bits, deviceId);
+        }
+        success = !ferror(file);
+    }
+    fclose(file);
+    return success;
+}
+#endif /* VKAD_HAS_DEFINITIONS */
+#endif /* VKAD_LOAD_MANIFESTS */
+
+#ifdef VKAD_INSTRUMENTATION
+/* instrumentation: an instrumented table points every member to a thunk, which counts the call and measures its wall time before it jumps to the member of the real table.
+   The thunk replaces the return address of the call with a second piece of assembly, which takes the time when the function returns; the original return addresses are kept
+   on a stack per thread. That is not compatible with hardware shadow stacks (CET on x86-64), which have to be disabled for the instrumented binary. */
+/* calls and time of one function */
+typedef struct VkadCallCounter {
+    uint64_t                    callCount;
+    uint64_t                    timedCount;         /* the calls that were timed, fewer than callCount with sampling */
+    uint64_t                    nanoseconds;        /* wall time spent in the function, including nested calls; estimated for all calls from the timed ones */
+} VkadCallCounter;
+typedef struct VkadCallStatistics {
+    VkadCallCounter             instance[VKAD_INSTANCE_FUNCTION_ID_COUNT];
+    VkadCallCounter             device[VKAD_DEVICE_FUNCTION_ID_COUNT];
+} VkadCallStatistics;
+VKAD_API int  vkadInstrumentInstanceFunctions (VkInstance instance, const VkadInstanceFunctions* functions, VkadInstanceFunctions* instrumented);
+VKAD_API int  vkadInstrumentDeviceFunctions   (VkDevice device, const VkadDeviceFunctions* functions, VkadDeviceFunctions* instrumented);
+VKAD_API void vkadReleaseInstrumentedFunctions(const void* functions);
+VKAD_API void vkadGetCallStatistics           (VkadCallStatistics* statistics);
+VKAD_API void vkadSetCallSampling             (uint32_t interval);
+VKAD_API void vkadSetTracing                  (int enabled);
+VKAD_API int  vkadWriteTrace                  (const char* path);
+
+#if VKAD_HAS_DEFINITIONS
+
+#if VKAD_HAS_THUNKS
+/* maximum number of instrumented tables at the same time and of nested instrumented calls (from callbacks) per thread; have to be the same in all translation units */
+#ifndef VKAD_MAX_INSTRUMENTED_TABLES
+#define VKAD_MAX_INSTRUMENTED_TABLES 16
+#endif
+#ifndef VKAD_MAX_INSTRUMENTED_CALL_DEPTH
+#define VKAD_MAX_INSTRUMENTED_CALL_DEPTH 32
+#endif
+/* number of trace records kept per thread until they are written, a power of two */
+#ifndef VKAD_TRACE_BUFFER_SIZE
+#define VKAD_TRACE_BUFFER_SIZE 4096
+#endif
+typedef char VkadTraceBufferSizeCheck[(VKAD_TRACE_BUFFER_SIZE & (VKAD_TRACE_BUFFER_SIZE - 1)) == 0 ? 1 : -1];
+/* number of thunks, the instance entries and then the device entries; has to be a literal for the assembler */
+#define VKAD_INSTRUMENTATION_THUNK_COUNT 721
+typedef char VkadInstrumentationThunkCountCheck[(VKAD_INSTRUMENTATION_THUNK_COUNT == VKAD_INSTANCE_FUNCTION_COUNT + VKAD_DEVICE_FUNCTION_COUNT) ? 1 : -1];
+
+/* the registration of an instrumented table, which the thunks find through the dispatch key of their first argument; instance and device tables are kept apart,
+   since a driver without the loader may use the same key for all handles */
+typedef struct VkadInstrumentedRegistration {
+    uint32_t                    state;              /* VKAD_REGISTRATION_FREE, _CLAIMED or _READY */
+    uint32_t                    device;             /* 1 for a device table */
+    void*                       dispatchKey;
+    const void*                 handle;
+    const void*                 functions;          /* the real table */
+} VkadInstrumentedRegistration;
+__attribute__((weak, visibility("hidden"))) VkadInstrumentedRegistration vkadInstrumentedRegistrations[VKAD_MAX_INSTRUMENTED_TABLES];
+
+/* the counters of one thread, and the calls it is in; a block is only written by its thread, and reused by a later thread after its thread ended */
+typedef struct VkadInstrumentedCall {
+    uintptr_t                   returnAddress;
+    uint64_t                    start;
+    const void*                 handle;
+    uint32_t                    entry;
+} VkadInstrumentedCall;
+/* a finished call in the trace buffer of a thread; the fields are written with relaxed atomics, since the buffer is read by the thread writing the trace */
+typedef struct VkadTraceRecord {
+    uint64_t                    start;
+    uint64_t                    end;
+    const void*                 handle;
+    uint64_t                    entry;
+} VkadTraceRecord;
+typedef struct VkadThreadStatistics {
+    struct VkadThreadStatistics* next;
+    uint32_t                    inUse;
+    uint32_t                    depth;
+    uint32_t                    index;              /* the thread ID in the trace */
+    VkadInstrumentedCall        calls[VKAD_MAX_INSTRUMENTED_CALL_DEPTH];
+    VkadCallStatistics          statistics;
+    /* the calls of every entry until the next one is timed with sampling */
+    uint32_t                    sampleCountdowns[VKAD_INSTRUMENTATION_THUNK_COUNT];
+    /* a ring buffer only written by its thread: traceHead counts all records ever written, traceTail the ones already written to a trace file */
+    VkadTraceRecord*            traceRecords;
+    uint64_t                    traceHead;
+    uint64_t                    traceTail;
+} VkadThreadStatistics;
+__attribute__((weak, visibility("hidden"))) VkadThreadStatistics* vkadThreadStatisticsList;
+__attribute__((weak, visibility("hidden"))) uint32_t vkadThreadStatisticsCount;
+__attribute__((weak, visibility("hidden"))) uint32_t vkadTracingEnabled;
+__attribute__((weak, visibility("hidden"))) uint32_t vkadCallSamplingInterval;
+__attribute__((weak, visibility("hidden"))) pthread_key_t vkadThreadStatisticsKey;
+__attribute__((weak, visibility("hidden"))) pthread_once_t vkadThreadStatisticsOnce = PTHREAD_ONCE_INIT;
+
+static void vkadEndThreadStatistics(void* statistics) {
+    __atomic_store_n(&REINTERPRET_CAST(VkadThreadStatistics*, statistics)->inUse, 0, __ATOMIC_RELEASE);
+}
+__attribute__((weak, visibility("hidden"))) void vkadCreateThreadStatisticsKey(void) {
+    pthread_key_create(&vkadThreadStatisticsKey, vkadEndThreadStatistics);
+}
+/* the block of the calling thread: a free one from the list, or a new one */
+static VkadThreadStatistics* vkadGetThreadStatistics(void) {
+    VkadThreadStatistics* statistics;
+    pthread_once(&vkadThreadStatisticsOnce, vkadCreateThreadStatisticsKey);
+    statistics = REINTERPRET_CAST(VkadThreadStatistics*, pthread_getspecific(vkadThreadStatisticsKey));
+    if (statistics != NULL) return statistics;
+    for (statistics = __atomic_load_n(&vkadThreadStatisticsList, __ATOMIC_ACQUIRE); statistics != NULL; statistics = statistics->next) {
+        uint32_t expected = 0;
+        if (__atomic_compare_exchange_n(&statistics->inUse, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) break;
+    }
+    if (statistics == NULL) {
+        statistics = REINTERPRET_CAST(VkadThreadStatistics*, calloc(1, sizeof(VkadThreadStatistics)));
+        if (statistics == NULL) return NULL;
+        statistics->inUse = 1;
+        statistics->index = __atomic_add_fetch(&vkadThreadStatisticsCount, 1, __ATOMIC_RELAXED);
+        statistics->next  = __atomic_load_n(&vkadThreadStatisticsList, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&vkadThreadStatisticsList, &statistics->next, statistics, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {}
+    }
+    statistics->depth = 0;
+    pthread_setspecific(vkadThreadStatisticsKey, statistics);
+    return statistics;
+}
+static VkadCallCounter* vkadInstrumentedCounter(VkadThreadStatistics* statistics, uint32_t entry) {
+    if (entry < VKAD_INSTANCE_FUNCTION_COUNT) return &statistics->statistics.instance[entry];
+    return &statistics->statistics.device[entry - VKAD_INSTANCE_FUNCTION_COUNT];
+}
+
+extern const unsigned char vkadInstrumentationThunks[] __asm__(VKAD_ASM_SYMBOL(vkadInstrumentationThunks)) __attribute__((visibility("hidden")));
+extern const unsigned char vkadInstrumentationReturn[] __asm__(VKAD_ASM_SYMBOL(vkadInstrumentationReturn)) __attribute__((visibility("hidden")));
+
+/* the function to jump to, and the return address it gets: the return thunk, or the caller's own if the call can not be timed */
+typedef struct VkadInstrumentedTarget {
+    PFN_vkVoidFunction          function;
+    uintptr_t                   returnAddress;
+} VkadInstrumentedTarget;
+/* called by the thunk of the entry with the first argument and the return address of the call */
+__attribute__((weak, visibility("hidden"), used)) VkadInstrumentedTarget vkadInstrumentationEnter(const void* handle, uintptr_t returnAddress, uint32_t entry) {
+    const VkadInstrumentedRegistration* registration = NULL;
+    uint32_t device = entry >= VKAD_INSTANCE_FUNCTION_COUNT;
+    const VkadFunctionEntry* functionEntry = device ? &vkadDeviceFunctionEntries[entry - VKAD_INSTANCE_FUNCTION_COUNT] : &vkadInstanceFunctionEntries[entry];
+    void* dispatchKey = vkadDispatchKey(handle);
+    VkadThreadStatistics* statistics;
+    VkadInstrumentedTarget target;
+    uint32_t i, interval, timed = 1;
+    for (i = 0; i < VKAD_MAX_INSTRUMENTED_TABLES; ++i) {
+        const VkadInstrumentedRegistration* candidate = &vkadInstrumentedRegistrations[i];
+        if (__atomic_load_n(&candidate->state, __ATOMIC_ACQUIRE) != VKAD_REGISTRATION_READY || candidate->device != device) continue;
+        if (candidate->handle == handle) { registration = candidate; break; }
+        if (candidate->dispatchKey == dispatchKey && registration == NULL) registration = candidate;
+    }
+    target.returnAddress = returnAddress;
+    /* calling a released table is invalid, this fails like a call of a NULL member */
+    if (registration == NULL) {
+        target.function = NULL;
+        return target;
+    }
+    memcpy(&target.function, REINTERPRET_CAST(const char*, registration->functions) + functionEntry->memberOffset, sizeof(PFN_vkVoidFunction));
+    statistics = vkadGetThreadStatistics();
+    if (statistics == NULL) return target;
+    interval = __atomic_load_n(&vkadCallSamplingInterval, __ATOMIC_RELAXED);
+    if (interval > 1) {
+        uint32_t* countdown = &statistics->sampleCountdowns[entry];
+        /* the countdown may be left from a larger interval */
+        if (*countdown != 0 && *countdown < interval) { --*countdown; timed = 0; }
+        else *countdown = interval - 1;
+    }
+    if (!timed || statistics->depth == VKAD_MAX_INSTRUMENTED_CALL_DEPTH) {
+        /* not sampled, or too deeply nested to be timed: only counted */
+        VkadCallCounter* counter = vkadInstrumentedCounter(statistics, entry);
+        __atomic_store_n(&counter->callCount, counter->callCount + 1, __ATOMIC_RELAXED);
+        return target;
+    }
+    statistics->calls[statistics->depth].returnAddress = returnAddress;
+    statistics->calls[statistics->depth].handle        = handle;
+    statistics->calls[statistics->depth].entry         = entry;
+    statistics->calls[statistics->depth].start         = vkadNanoseconds();
+    ++statistics->depth;
+    target.returnAddress = REINTERPRET_CAST(uintptr_t, vkadInstrumentationReturn);
+    return target;
+}
+/* called by the return thunk when the function returned; returns the caller's return address */
+__attribute__((weak, visibility("hidden"), used)) uintptr_t vkadInstrumentationLeave(void) {
+    VkadThreadStatistics* statistics = REINTERPRET_CAST(VkadThreadStatistics*, pthread_getspecific(vkadThreadStatisticsKey));
+    const VkadInstrumentedCall* call = &statistics->calls[--statistics->depth];
+    VkadCallCounter* counter = vkadInstrumentedCounter(statistics, call->entry);
+    uint64_t end = vkadNanoseconds();
+    __atomic_store_n(&counter->callCount, counter->callCount + 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&counter->timedCount, counter->timedCount + 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&counter->nanoseconds, counter->nanoseconds + (end - call->start), __ATOMIC_RELAXED);
+    if (__atomic_load_n(&vkadTracingEnabled, __ATOMIC_RELAXED)) {
+        VkadTraceRecord* records = statistics->traceRecords;
+        if (records == NULL) {
+            records = REINTERPRET_CAST(VkadTraceRecord*, calloc(VKAD_TRACE_BUFFER_SIZE, sizeof(VkadTraceRecord)));
+            __atomic_store_n(&statistics->traceRecords, records, __ATOMIC_RELEASE);
+        }
+        if (records != NULL) {
+            /* the oldest record is overwritten when the buffer is full; the new head is published after the record, so the reader can tell which records it got complete */
+            VkadTraceRecord* record = &records[statistics->traceHead & (VKAD_TRACE_BUFFER_SIZE - 1)];
+            __atomic_store_n(&record->start,  call->start,           __ATOMIC_RELAXED);
+            __atomic_store_n(&record->end,    end,                   __ATOMIC_RELAXED);
+            __atomic_store_n(&record->handle, call->handle,          __ATOMIC_RELAXED);
+            __atomic_store_n(&record->entry,  (uint64_t) call->entry, __ATOMIC_RELAXED);
+            __atomic_store_n(&statistics->traceHead, statistics->traceHead + 1, __ATOMIC_RELEASE);
+        }
+    }
+    return call->returnAddress;
+}
+
+#if defined(__x86_64__)
+/* the common part saves the argument registers, calls vkadInstrumentationEnter with the first argument, the return address and the entry index from r11,
+   replaces the return address and jumps to the function. The return thunk saves the return registers, calls vkadInstrumentationLeave and returns to the caller. */
+__asm__(
+    ".ifndef " VKAD_ASM_SYMBOL(vkadInstrumentationThunks) "\n"
+    VKAD_ASM_SECTION_BEGIN(vkadInstrumentationThunks)
+    "    .p2align 4\n"
+    VKAD_ASM_SYMBOL(vkadInstrumentationThunkCommon) ":\n"
+    "    pushq   %rbp\n"
+    "    movq    %rsp, %rbp\n"
+    "    subq    $176, %rsp\n"
+    "    movq    %rdi, 0(%rsp)\n"
+    "    movq    %rsi, 8(%rsp)\n"
+    "    movq    %rdx, 16(%rsp)\n"
+    "    movq    %rcx, 24(%rsp)\n"
+    "    movq    %r8, 32(%rsp)\n"
+    "    movq    %r9, 40(%rsp)\n"
+    "    movaps  %xmm0, 48(%rsp)\n"
+    "    movaps  %xmm1, 64(%rsp)\n"
+    "    movaps  %xmm2, 80(%rsp)\n"
+    "    movaps  %xmm3, 96(%rsp)\n"
+    "    movaps  %xmm4, 112(%rsp)\n"
+    "    movaps  %xmm5, 128(%rsp)\n"
+    "    movaps  %xmm6, 144(%rsp)\n"
+    "    movaps  %xmm7, 160(%rsp)\n"
+    "    movq    8(%rbp), %rsi\n"
+    "    movl    %r11d, %edx\n"
+    "    call    " VKAD_ASM_SYMBOL(vkadInstrumentationEnter) "\n"
+    "    movq    %rax, %r11\n"
+    "    movq    %rdx, 8(%rbp)\n"
+    "    movq    0(%rsp), %rdi\n"
+    "    movq    8(%rsp), %rsi\n"
+    "    movq    16(%rsp), %rdx\n"
+    "    movq    24(%rsp), %rcx\n"
+    "    movq    32(%rsp), %r8\n"
+    "    movq    40(%rsp), %r9\n"
+    "    movaps  48(%rsp), %xmm0\n"
+    "    movaps  64(%rsp), %xmm1\n"
+    "    movaps  80(%rsp), %xmm2\n"
+    "    movaps  96(%rsp), %xmm3\n"
+    "    movaps  112(%rsp), %xmm4\n"
+    "    movaps  128(%rsp), %xmm5\n"
+    "    movaps  144(%rsp), %xmm6\n"
+    "    movaps  160(%rsp), %xmm7\n"
+    "    leave\n"
+    "    jmpq    *%r11\n"
+    "    .p2align 4\n"
+    VKAD_ASM_WEAK(vkadInstrumentationReturn)
+    VKAD_ASM_SYMBOL(vkadInstrumentationReturn) ":\n"
+    "    subq    $48, %rsp\n"
+    "    movq    %rax, 0(%rsp)\n"
+    "    movq    %rdx, 8(%rsp)\n"
+    "    movaps  %xmm0, 16(%rsp)\n"
+    "    movaps  %xmm1, 32(%rsp)\n"
+    "    call    " VKAD_ASM_SYMBOL(vkadInstrumentationLeave) "\n"
+    "    movq    %rax, %r11\n"
+    "    movq    0(%rsp), %rax\n"
+    "    movq    8(%rsp), %rdx\n"
+    "    movaps  16(%rsp), %xmm0\n"
+    "    movaps  32(%rsp), %xmm1\n"
+    "    addq    $48, %rsp\n"
+    "    pushq   %r11\n"
+    "    ret\n"
+    "    .p2align 4\n"
+    VKAD_ASM_WEAK(vkadInstrumentationThunks)
+    VKAD_ASM_SYMBOL(vkadInstrumentationThunks) ":\n"
+    "    .set    vkad_instrumentation_entry, 0\n"
+    "    .rept   " VKAD_EXPAND_STRINGIFY(VKAD_INSTRUMENTATION_THUNK_COUNT) "\n"
+    "    endbr64\n"
+    "    movl    $vkad_instrumentation_entry, %r11d\n"
+    "    jmp     " VKAD_ASM_SYMBOL(vkadInstrumentationThunkCommon) "\n"
+    "    .p2align 4\n"
+    "    .set    vkad_instrumentation_entry, vkad_instrumentation_entry + 1\n"
+    "    .endr\n"
+    VKAD_ASM_SECTION_END
+    ".endif\n"
+);
+#elif defined(__aarch64__)
+/* the same for AArch64, with the entry index in w17 and the return address in x30 */
+__asm__(
+    ".ifndef " VKAD_ASM_SYMBOL(vkadInstrumentationThunks) "\n"
+    VKAD_ASM_SECTION_BEGIN(vkadInstrumentationThunks)
+    "    .p2align 4\n"
+    VKAD_ASM_SYMBOL(vkadInstrumentationThunkCommon) ":\n"
+    "    stp     x29, x30, [sp, #-224]!\n"
+    "    mov     x29, sp\n"
+    "    stp     x0, x1, [sp, #16]\n"
+    "    stp     x2, x3, [sp, #32]\n"
+    "    stp     x4, x5, [sp, #48]\n"
+    "    stp     x6, x7, [sp, #64]\n"
+    "    str     x8, [sp, #80]\n"
+    "    stp     q0, q1, [sp, #96]\n"
+    "    stp     q2, q3, [sp, #128]\n"
+    "    stp     q4, q5, [sp, #160]\n"
+    "    stp     q6, q7, [sp, #192]\n"
+    "    mov     x1, x30\n"
+    "    mov     w2, w17\n"
+    "    bl      " VKAD_ASM_SYMBOL(vkadInstrumentationEnter) "\n"
+    "    mov     x16, x0\n"
+    "    str     x1, [sp, #8]\n"
+    "    ldp     x0, x1, [sp, #16]\n"
+    "    ldp     x2, x3, [sp, #32]\n"
+    "    ldp     x4, x5, [sp, #48]\n"
+    "    ldp     x6, x7, [sp, #64]\n"
+    "    ldr     x8, [sp, #80]\n"
+    "    ldp     q0, q1, [sp, #96]\n"
+    "    ldp     q2, q3, [sp, #128]\n"
+    "    ldp     q4, q5, [sp, #160]\n"
+    "    ldp     q6, q7, [sp, #192]\n"
+    "    ldp     x29, x30, [sp], #224\n"
+    "    br      x16\n"
+    "    .p2align 4\n"
+    VKAD_ASM_WEAK(vkadInstrumentationReturn)
+    VKAD_ASM_SYMBOL(vkadInstrumentationReturn) ":\n"
+    "    stp     x29, x30, [sp, #-96]!\n"
+    "    mov     x29, sp\n"
+    "    stp     x0, x1, [sp, #16]\n"
+    "    stp     q0, q1, [sp, #32]\n"
+    "    stp     q2, q3, [sp, #64]\n"
+    "    bl      " VKAD_ASM_SYMBOL(vkadInstrumentationLeave) "\n"
+    "    mov     x30, x0\n"
+    "    ldp     x0, x1, [sp, #16]\n"
+    "    ldp     q0, q1, [sp, #32]\n"
+    "    ldp     q2, q3, [sp, #64]\n"
+    "    ldr     x29, [sp], #96\n"
+    "    ret\n"
+    "    .p2align 4\n"
+    VKAD_ASM_WEAK(vkadInstrumentationThunks)
+    VKAD_ASM_SYMBOL(vkadInstrumentationThunks) ":\n"
+    "    .set    vkad_instrumentation_entry, 0\n"
+    "    .rept   " VKAD_EXPAND_STRINGIFY(VKAD_INSTRUMENTATION_THUNK_COUNT) "\n"
+    "    hint    #34\n"
+    "    mov     w17, #vkad_instrumentation_entry\n"
+    "    b       " VKAD_ASM_SYMBOL(vkadInstrumentationThunkCommon) "\n"
+    "    .p2align 4\n"
+    "    .set    vkad_instrumentation_entry, vkad_instrumentation_entry + 1\n"
+    "    .endr\n"
+    VKAD_ASM_SECTION_END
+    ".endif\n"
+);
+#endif
+
+/* whether another registration of the same kind than the given one has or is about to get the dispatch key */
+static int vkadInstrumentedDispatchKeyTaken(const VkadInstrumentedRegistration* registration, uint32_t device, void* dispatchKey) {
+    uint32_t i;
+    for (i = 0; i < VKAD_MAX_INSTRUMENTED_TABLES; ++i) {
+        const VkadInstrumentedRegistration* other = &vkadInstrumentedRegistrations[i];
+        if (other == registration || __atomic_load_n(&other->state, __ATOMIC_SEQ_CST) == VKAD_REGISTRATION_FREE) continue;
+        if (__atomic_load_n(&other->device, __ATOMIC_SEQ_CST) == device && __atomic_load_n(&other->dispatchKey, __ATOMIC_SEQ_CST) == dispatchKey) return 1;
+    }
+    return 0;
+}
+/* registers the real table and points the members of the instrumented one to the thunks, starting with the thunk of the first entry.
+   A second table with the dispatch key of a registered one is refused, since the thunks could not tell them apart, like the lazily loaded tables. */
+static int vkadInstrument(const void* handle, const void* functions, void* instrumented, uint32_t device, const VkadFunctionEntry* entries, uint32_t entryCount, uint32_t firstThunk) {
+    void* dispatchKey = vkadDispatchKey(handle);
+    uint32_t i, j;
+    for (i = 0; i < VKAD_MAX_INSTRUMENTED_TABLES; ++i) {
+        VkadInstrumentedRegistration* registration = &vkadInstrumentedRegistrations[i];
+        uint32_t expected = VKAD_REGISTRATION_FREE;
+        if (!__atomic_compare_exchange_n(&registration->state, &expected, VKAD_REGISTRATION_CLAIMED, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) continue;
+        __atomic_store_n(&registration->device, device, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&registration->dispatchKey, dispatchKey, __ATOMIC_SEQ_CST);
+        if (vkadInstrumentedDispatchKeyTaken(registration, device, dispatchKey)) {
+            __atomic_store_n(&registration->state, VKAD_REGISTRATION_FREE, __ATOMIC_RELEASE);
+            return 0;
+        }
+        registration->handle      = handle;
+        registration->functions   = functions;
+        for (j = 0; j < entryCount; ++j) {
+            PFN_vkVoidFunction function;
+            if (entries[j].memberOffset == VKAD_NO_MEMBER) continue;
+            memcpy(&function, REINTERPRET_CAST(const char*, functions) + entries[j].memberOffset, sizeof(PFN_vkVoidFunction));
+            /* members that are NULL stay NULL, so they can still be checked */
+            if (function != NULL) function = REINTERPRET_CAST(PFN_vkVoidFunction, (REINTERPRET_CAST(uintptr_t, vkadInstrumentationThunks) + (firstThunk + j) * VKAD_THUNK_SIZE));
+            vkadStoreFunction(instrumented, &entries[j], function);
+        }
+        __atomic_store_n(&registration->state, VKAD_REGISTRATION_READY, __ATOMIC_RELEASE);
+        return 1;
+    }
+    return 0;
+}
+#endif /* VKAD_HAS_THUNKS */
+
+/* fills instrumented with thunks that count and time the calls of the members of functions, the loaded table of the instance or device. functions must stay unchanged
+   and at the same address while instrumented is in use, instrumented can be copied. Returns 0 if there are no thunks, all registrations are in use or another instrumented table of the same kind has the same dispatch key (see
+   vkadLoadDeviceFunctionsLazy); instrumented is then a plain copy. */
+VKAD_API int vkadInstrumentInstanceFunctions(VkInstance instance, const VkadInstanceFunctions* functions, VkadInstanceFunctions* instrumented) {
+#if VKAD_HAS_THUNKS
+    if (vkadInstrument(instance, functions, instrumented, 0, vkadInstanceFunctionEntries, VKAD_INSTANCE_FUNCTION_COUNT, 0)) {
+        /* the only instance level function called with a device, which the thunks could not find the table for */
+        instrumented->GetDeviceProcAddr = functions->GetDeviceProcAddr;
+        return 1;
+    }
+#else
+    (void) instance;
+#endif
+    *instrumented = *functions;
+    return 0;
+}
+VKAD_API int vkadInstrumentDeviceFunctions(VkDevice device, const VkadDeviceFunctions* functions, VkadDeviceFunctions* instrumented) {
+#if VKAD_HAS_THUNKS
+    if (vkadInstrument(device, functions, instrumented, 1, vkadDeviceFunctionEntries, VKAD_DEVICE_FUNCTION_COUNT, VKAD_INSTANCE_FUNCTION_COUNT)) return 1;
+#else
+    (void) device;
+#endif
+    *instrumented = *functions;
+    return 0;
+}
+/* ends the instrumentation of the real table functions, has to be called before its instance or device is destroyed */
+VKAD_API void vkadReleaseInstrumentedFunctions(const void* functions) {
+#if VKAD_HAS_THUNKS
+    uint32_t i;
+    for (i = 0; i < VKAD_MAX_INSTRUMENTED_TABLES; ++i) {
+        VkadInstrumentedRegistration* registration = &vkadInstrumentedRegistrations[i];
+        if (__atomic_load_n(&registration->state, __ATOMIC_ACQUIRE) == VKAD_REGISTRATION_READY && registration->functions == functions) {
+            __atomic_store_n(&registration->state, VKAD_REGISTRATION_FREE, __ATOMIC_RELEASE);
+        }
+    }
+#else
+    (void) functions;
+#endif
+}
+/* the sums of the counters of all threads, by function ID; calls that are still running are not included */
+#if VKAD_HAS_THUNKS
+static void vkadAddCallCounter(VkadCallCounter* sum, const VkadCallCounter* counter) {
+    uint64_t callCount   = __atomic_load_n(&counter->callCount, __ATOMIC_RELAXED);
+    uint64_t timedCount  = __atomic_load_n(&counter->timedCount, __ATOMIC_RELAXED);
+    uint64_t nanoseconds = __atomic_load_n(&counter->nanoseconds, __ATOMIC_RELAXED);
+    sum->callCount  += callCount;
+    sum->timedCount += timedCount;
+    /* scaled per thread, since the threads may call a function with different costs */
+    if (timedCount != 0) sum->nanoseconds += timedCount == callCount ? nanoseconds : (uint64_t) ((double) nanoseconds * (double) callCount / (double) timedCount);
+}
+#endif
+VKAD_API void vkadGetCallStatistics(VkadCallStatistics* statistics) {
+#if VKAD_HAS_THUNKS
+    const VkadThreadStatistics* thread;
+    uint32_t i;
+    memset(statistics, 0, sizeof(VkadCallStatistics));
+    for (thread = __atomic_load_n(&vkadThreadStatisticsList, __ATOMIC_ACQUIRE); thread != NULL; thread = thread->next) {
+        for (i = 0; i < VKAD_INSTANCE_FUNCTION_ID_COUNT; ++i) vkadAddCallCounter(&statistics->instance[i], &thread->statistics.instance[i]);
+        for (i = 0; i < VKAD_DEVICE_FUNCTION_ID_COUNT; ++i)   vkadAddCallCounter(&statistics->device[i],   &thread->statistics.device[i]);
+    }
+#else
+    memset(statistics, 0, sizeof(VkadCallStatistics));
+#endif
+}
+/* times only every interval-th call of every function in every thread, the others are only counted; 0 and 1 time every call. Takes effect immediately for all instrumented tables. */
+VKAD_API void vkadSetCallSampling(uint32_t interval) {
+#if VKAD_HAS_THUNKS
+    __atomic_store_n(&vkadCallSamplingInterval, interval, __ATOMIC_RELAXED);
+#else
+    (void) interval;
+#endif
+}
+/* starts or stops recording every timed call of an instrumented table into the trace buffer of its thread */
+VKAD_API void vkadSetTracing(int enabled) {
+#if VKAD_HAS_THUNKS
+    __atomic_store_n(&vkadTracingEnabled, enabled ? 1 : 0, __ATOMIC_RELAXED);
+#else
+    (void) enabled;
+#endif
+}
+/* writes the records in the trace buffers that were not written yet into a new file in the JSON format of the Chrome trace viewer, which Perfetto can also open;
+   records overwritten before are lost. Must not be called from several threads at once. Returns 0 on failure. */
+VKAD_API int vkadWriteTrace(const char* path) {
+    FILE* file = fopen(path, "w");
+    int first = 1;
+#if VKAD_HAS_THUNKS
+    VkadThreadStatistics* thread;
+#endif
+    if (file == NULL) return 0;
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+#if VKAD_HAS_THUNKS
+    for (thread = __atomic_load_n(&vkadThreadStatisticsList, __ATOMIC_ACQUIRE); thread != NULL; thread = thread->next) {
+        const VkadTraceRecord* records = __atomic_load_n(&thread->traceRecords, __ATOMIC_ACQUIRE);
+        uint64_t head, i;
+        if (records == NULL) continue;
+        head = __atomic_load_n(&thread->traceHead, __ATOMIC_ACQUIRE);
+        /* the writer fills the slot of record head before it publishes head + 1, so the record head - VKAD_TRACE_BUFFER_SIZE may already be half overwritten */
+        i = head - thread->traceTail >= VKAD_TRACE_BUFFER_SIZE ? head - VKAD_TRACE_BUFFER_SIZE + 1 : thread->traceTail;
+        for (; i < head; ++i) {
+            const VkadTraceRecord* record = &records[i & (VKAD_TRACE_BUFFER_SIZE - 1)];
+            uint64_t start  = __atomic_load_n(&record->start, __ATOMIC_RELAXED);
+            uint64_t end    = __atomic_load_n(&record->end, __ATOMIC_RELAXED);
+            const void* handle = __atomic_load_n(&record->handle, __ATOMIC_RELAXED);
+            uint64_t entry  = __atomic_load_n(&record->entry, __ATOMIC_RELAXED);
+            /* the record may have been overwritten while it was read */
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (__atomic_load_n(&thread->traceHead, __ATOMIC_RELAXED) - i >= VKAD_TRACE_BUFFER_SIZE) continue;
+            fprintf(file, "%s\n{\"name\":\"vk%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%llu.%03u,\"dur\":%llu.%03u,\"args\":{\"handle\":\"%p\"}}",
+                first ? "" : ",",
+                entry < VKAD_INSTANCE_FUNCTION_COUNT ? vkadInstanceFunctionName((VkadInstanceFunctionId) entry) : vkadDeviceFunctionName((VkadDeviceFunctionId) (entry - VKAD_INSTANCE_FUNCTION_COUNT)),
+                thread->index, (unsigned long long) (start / 1000), (unsigned) (start % 1000), (unsigned long long) ((end - start) / 1000), (unsigned) ((end - start) % 1000), handle);
+            first = 0;
+        }
+        thread->traceTail = head;
+    }
+#endif
+    fputs("\n]}\n", file);
+    return fclose(file) == 0;
+}
+#endif /* VKAD_HAS_DEFINITIONS */
+#endif /* VKAD_INSTRUMENTATION */
+
+#ifdef VKAD_LIBRARY_LOADING
+/* opening the Vulkan library at runtime, so the application needs no link time dependency on it */
+typedef struct VkadLibrary {
+    void*                       handle;
+} VkadLibrary;
+VKAD_API PFN_vkGetInstanceProcAddr vkadOpenLibrary (const char* path, VkadLibrary* library);
+VKAD_API void                      vkadCloseLibrary(VkadLibrary* library);
+VKAD_API PFN_vkGetInstanceProcAddr vkadOpenDriver  (const char* path, VkadLibrary* library);
+
+#if VKAD_HAS_DEFINITIONS
+/* the library names tried in order, when neither a path nor the VKAD_VULKAN_LIBRARY environment variable is given */
+#if defined(_WIN32)
+static const char* const vkadDefaultLibraryNames[] = { "vulkan-1.dll" };
+#elif defined(__APPLE__)
+static const char* const vkadDefaultLibraryNames[] = { "libvulkan.dylib", "libvulkan.1.dylib", "libMoltenVK.dylib" };
+#elif defined(__ANDROID__)
+static const char* const vkadDefaultLibraryNames[] = { "libvulkan.so" };
+#else
+static const char* const vkadDefaultLibraryNames[] = { "libvulkan.so.1", "libvulkan.so" };
+#endif
+static void* vkadOpenLibraryFile(const char* path) {
+#ifdef _WIN32
+    return REINTERPRET_CAST(void*, LoadLibraryA(path));
+#else
+    /* binding on first call keeps the start quick, and local binding keeps the symbols of the library from clashing with the application's */
+    return dlopen(path, RTLD_LAZY | RTLD_LOCAL);
+#endif
+}
+static PFN_vkVoidFunction vkadLibrarySymbol(void* handle, const char* name) {
+    PFN_vkVoidFunction function;
+#ifdef _WIN32
+    FARPROC symbol = GetProcAddress(REINTERPRET_CAST(HMODULE, handle), name);
+#else
+    void* symbol = dlsym(handle, name);
+#endif
+    /* object to function pointer conversions are not allowed in ISO C, so the bits are copied */
+    memcpy(&function, &symbol, sizeof(PFN_vkVoidFunction));
+    return function;
+}
+/* closes a library opened by vkadOpenLibrary; all functions loaded from it become invalid */
+VKAD_API void vkadCloseLibrary(VkadLibrary* library) {
+    if (library->handle == NULL) return;
+#ifdef _WIN32
+    FreeLibrary(REINTERPRET_CAST(HMODULE, library->handle));
+#else
+    dlclose(library->handle);
+#endif
+    library->handle = NULL;
+}
+/* opens the library at path, or at the path in the environment variable VKAD_VULKAN_LIBRARY if path is NULL, or the system's Vulkan loader otherwise,
+   and returns its vkGetInstanceProcAddr, or NULL if no library could be opened or it has no such function */
+VKAD_API PFN_vkGetInstanceProcAddr vkadOpenLibrary(const char* path, VkadLibrary* library) {
+    PFN_vkGetInstanceProcAddr loader;
+    size_t i;
+    library->handle = NULL;
+    if (path == NULL) path = getenv("VKAD_VULKAN_LIBRARY");
+    if (path != NULL && path[0] != '\0') {
+        library->handle = vkadOpenLibraryFile(path);
+    } else {
+        for (i = 0; i < sizeof(vkadDefaultLibraryNames) / sizeof(vkadDefaultLibraryNames[0]) && library->handle == NULL; ++i) {
+            library->handle = vkadOpenLibraryFile(vkadDefaultLibraryNames[i]);
+        }
+    }
+    if (library->handle == NULL) return NULL;
+    loader = REINTERPRET_CAST(PFN_vkGetInstanceProcAddr, vkadLibrarySymbol(library->handle, "vkGetInstanceProcAddr"));
+    if (loader == NULL) vkadCloseLibrary(library);
+    return loader;
+}
+
+/* direct driver loading: instead of the Vulkan loader, the driver (ICD) library is opened and its functions are used directly.
+   This skips the search for manifests and layers and the loader's trampolines, but also everything the loader adds, like layers, several drivers and the loader's own surface handling. */
+#ifndef VKAD_MAX_PATH_SIZE
+#define VKAD_MAX_PATH_SIZE 4096
+#endif
+/* the loader-driver interface version offered to the driver, 5 is the first that allows instances for any API version without the loader's checks */
+#define VKAD_ICD_INTERFACE_VERSION 5
+typedef VkResult (VKAPI_PTR *PFN_vkadNegotiateLoaderICDInterfaceVersion)(uint32_t* pSupportedVersion);
+#ifdef _WIN32
+#define VKAD_PATH_LIST_SEPARATOR ';'
+#else
+#define VKAD_PATH_LIST_SEPARATOR ':'
+#endif
+static int vkadIsPathSeparator(char c) {
+#ifdef _WIN32
+    return c == '/' || c == '\\';
+#else
+    return c == '/';
+#endif
+}
+static int vkadIsAbsolutePath(const char* path) {
+#ifdef _WIN32
+    return vkadIsPathSeparator(path[0]) || (path[0] != '\0' && path[1] == ':');
+#else
+    return path[0] == '/';
+#endif
+}
+/* reads the library_path of the driver manifest (a small JSON file) into path, relative to the directory of the manifest if it is a relative path, and returns 0 on failure */
+static int vkadReadDriverManifest(const char* manifest, char* path, size_t pathSize) {
+    char text[VKAD_MAX_PATH_SIZE];
+    const char* c;
+    size_t length, directoryLength = 0, i = 0, j;
+    FILE* file = fopen(manifest, "rb");
+    if (file == NULL) return 0;
+    length = fread(text, 1, sizeof(text) - 1, file);
+    fclose(file);
+    text[length] = '\0';
+    c = strstr(text, "\"library_path\"");
+    if (c == NULL) return 0;
+    c += sizeof("\"library_path\"") - 1;
+    while (*c == ' ' || *c == '\t' || *c == '\r' || *c == '\n') ++c;
+    if (*c++ != ':') return 0;
+    while (*c == ' ' || *c == '\t' || *c == '\r' || *c == '\n') ++c;
+    if (*c++ != '"') return 0;
+    /* a relative path with a directory is relative to the manifest, a plain file name is searched by the system */
+    for (length = 0; c[length] != '"' && c[length] != '\0'; ++length) {
+        if (c[length] == '\\') {
+            if (c[length + 1] == '\0') return 0;
+            ++length;
+        }
+    }
+    /* a value without its closing quote is cut off, and would give a wrong path */
+    if (c[length] != '"') return 0;
+    for (i = 0; i < length; ++i) {
+        if (vkadIsPathSeparator(c[i])) break;
+    }
+    if (i < length && !vkadIsAbsolutePath(c)) {
+        for (i = 0; manifest[i] != '\0'; ++i) {
+            if (vkadIsPathSeparator(manifest[i])) directoryLength = i + 1;
+        }
+    }
+    if (directoryLength + length >= pathSize) return 0;
+    memcpy(path, manifest, directoryLength);
+    for (i = directoryLength, j = 0; j < length; ++i, ++j) {
+        /* JSON escapes of paths are only backslashes, quotes and slashes; the scan above made sure that every backslash has a character after it */
+        if (c[j] == '\\') ++j;
+        path[i] = c[j];
+    }
+    path[i] = '\0';
+    return 1;
+}
+/* opens the driver library at path, which can be a driver manifest (.json) or the library itself, or if path is NULL the first entry of the VK_DRIVER_FILES or VK_ICD_FILENAMES environment variables,
+   negotiates the interface version and returns the driver's vk_icdGetInstanceProcAddr, or NULL on failure */
+VKAD_API PFN_vkGetInstanceProcAddr vkadOpenDriver(const char* path, VkadLibrary* library) {
+    char file[VKAD_MAX_PATH_SIZE];
+    char libraryPath[VKAD_MAX_PATH_SIZE];
+    PFN_vkadNegotiateLoaderICDInterfaceVersion negotiate;
+    PFN_vkGetInstanceProcAddr loader;
+    uint32_t version = VKAD_ICD_INTERFACE_VERSION;
+    size_t length;
+    library->handle = NULL;
+    if (path == NULL) path = getenv("VK_DRIVER_FILES");
+    if (path == NULL) path = getenv("VK_ICD_FILENAMES");
+    if (path == NULL) return NULL;
+    for (length = 0; path[length] != '\0' && path[length] != VKAD_PATH_LIST_SEPARATOR; ++length);
+    if (length == 0 || length >= sizeof(file)) return NULL;
+    memcpy(file, path, length);
+    file[length] = '\0';
+    if (length > 5 && strcmp(file + length - 5, ".json") == 0) {
+        if (!vkadReadDriverManifest(file, libraryPath, sizeof(libraryPath))) return NULL;
+        library->handle = vkadOpenLibraryFile(libraryPath);
+    } else {
+        library->handle = vkadOpenLibraryFile(file);
+    }
+    if (library->handle == NULL) return NULL;
+    /* drivers without the negotiation are from before interface version 2, and only export vkGetInstanceProcAddr */
+    negotiate = REINTERPRET_CAST(PFN_vkadNegotiateLoaderICDInterfaceVersion, vkadLibrarySymbol(library->handle, "vk_icdNegotiateLoaderICDInterfaceVersion"));
+    if (negotiate != NULL && negotiate(&version) != VK_SUCCESS) {
+        vkadCloseLibrary(library);
+        return NULL;
+    }
+    loader = REINTERPRET_CAST(PFN_vkGetInstanceProcAddr, vkadLibrarySymbol(library->handle, "vk_icdGetInstanceProcAddr"));
+    if (loader == NULL) loader = REINTERPRET_CAST(PFN_vkGetInstanceProcAddr, vkadLibrarySymbol(library->handle, "vkGetInstanceProcAddr"));
+    if (loader == NULL) vkadCloseLibrary(library);
+    return loader;
+}
+#endif /* VKAD_HAS_DEFINITIONS */
+#endif /* VKAD_LIBRARY_LOADING */
+
+/* batch loading: the tables of several devices are independent, so they can be loaded at the same time.
+   The work is split into one task per device; a task only writes the table of its device, so the result does not depend on the order the tasks run in. */
+typedef void (*PFN_vkadTask)(void* pTaskData, uint32_t index);
+/* an executor supplied by the application, pfnParallelFor has to call pfnTask(pTaskData, i) once for every i < taskCount and return after all calls have finished */
+typedef struct VkadExecutor {
+    void*                       pUserData;
+    void                        (*pfnParallelFor)(void* pUserData, uint32_t taskCount, PFN_vkadTask pfnTask, void* pTaskData);
+} VkadExecutor;
+VKAD_API void vkadLoadDeviceFunctionsBatch(PFN_vkGetDeviceProcAddr loader, uint32_t deviceCount, const VkDevice* pDevices, const VkadDeviceLoadInfo* pLoadInfos, VkadDeviceFunctions* pFunctions, const VkadExecutor* pExecutor);
+
+#if VKAD_HAS_DEFINITIONS
+
+typedef struct VkadDeviceBatch {
+    PFN_vkGetDeviceProcAddr     loader;
+    const VkDevice*             pDevices;
+    const VkadDeviceLoadInfo*   pLoadInfos;
+    VkadDeviceFunctions*        pFunctions;
+} VkadDeviceBatch;
+static void vkadLoadDeviceBatchTask(void* pTaskData, uint32_t index) {
+    const VkadDeviceBatch* batch = REINTERPRET_CAST(const VkadDeviceBatch*, pTaskData);
+    VkadDeviceLoadInfo loadInfo = { NULL, 0, 0, NULL, NULL, NULL };
+    vkadLoadDeviceFunctionsEx(batch->loader, batch->pDevices[index], batch->pLoadInfos != NULL ? &batch->pLoadInfos[index] : &loadInfo, &batch->pFunctions[index]);
 }
 
-#ifndef VKAD_NO_GLOBAL_SYMBOLS
+#ifdef VKAD_THREAD_POOL
+/* maximum number of threads started for one batch, the calling thread works on the batch as well */
+#ifndef VKAD_MAX_LOAD_THREADS
+#define VKAD_MAX_LOAD_THREADS 8
+#endif
+typedef struct VkadThread {
+#ifdef _WIN32
+    HANDLE                      handle;
+#else
+    pthread_t                   handle;
+#endif
+    void                        (*function)(void* argument);
+    void*                       argument;
+} VkadThread;
+#ifdef _WIN32
+static DWORD WINAPI vkadThreadEntry(LPVOID thread) {
+    REINTERPRET_CAST(VkadThread*, thread)->function(REINTERPRET_CAST(VkadThread*, thread)->argument);
+    return 0;
+}
+#else
+static void* vkadThreadEntry(void* thread) {
+    REINTERPRET_CAST(VkadThread*, thread)->function(REINTERPRET_CAST(VkadThread*, thread)->argument);
+    return NULL;
+}
+#endif
+/* the thread struct has to stay valid until vkadJoinThread; returns 0 if no thread could be started */
+static int vkadStartThread(VkadThread* thread, void (*function)(void* argument), void* argument) {
+    thread->function = function;
+    thread->argument = argument;
+#ifdef _WIN32
+    thread->handle = CreateThread(NULL, 0, vkadThreadEntry, thread, 0, NULL);
+    return thread->handle != NULL;
+#else
+    return pthread_create(&thread->handle, NULL, vkadThreadEntry, thread) == 0;
+#endif
+}
+static void vkadJoinThread(VkadThread* thread) {
+#ifdef _WIN32
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+}
+
+/* every worker runs the tasks first, first + stride, first + 2 * stride, ... */
+typedef struct VkadWorker {
+    PFN_vkadTask                pfnTask;
+    void*                       pTaskData;
+    uint32_t                    taskCount;
+    uint32_t                    first;
+    uint32_t                    stride;
+} VkadWorker;
+static void vkadRunWorker(void* argument) {
+    const VkadWorker* worker = REINTERPRET_CAST(const VkadWorker*, argument);
+    uint32_t i;
+    for (i = worker->first; i < worker->taskCount; i += worker->stride) worker->pfnTask(worker->pTaskData, i);
+}
+static void vkadThreadPoolParallelFor(void* pUserData, uint32_t taskCount, PFN_vkadTask pfnTask, void* pTaskData) {
+    VkadThread threads[VKAD_MAX_LOAD_THREADS];
+    VkadWorker workers[VKAD_MAX_LOAD_THREADS + 1];
+    int started[VKAD_MAX_LOAD_THREADS];
+    uint32_t threadCount, i;
+    (void) pUserData;
+    if (taskCount == 0) return;
+    threadCount = taskCount - 1 < VKAD_MAX_LOAD_THREADS ? taskCount - 1 : VKAD_MAX_LOAD_THREADS;
+    for (i = 0; i <= threadCount; ++i) {
+        workers[i].pfnTask   = pfnTask;
+        workers[i].pTaskData = pTaskData;
+        workers[i].taskCount = taskCount;
+        workers[i].first     = i;
+        workers[i].stride    = threadCount + 1;
+    }
+    for (i = 0; i < threadCount; ++i) started[i] = vkadStartThread(&threads[i], vkadRunWorker, &workers[i + 1]);
+    vkadRunWorker(&workers[0]);
+    /* the share of a thread that could not be started is done here */
+    for (i = 0; i < threadCount; ++i) {
+        if (started[i]) vkadJoinThread(&threads[i]);
+        else vkadRunWorker(&workers[i + 1]);
+    }
+}
+#else
+static void vkadSerialParallelFor(void* pUserData, uint32_t taskCount, PFN_vkadTask pfnTask, void* pTaskData) {
+    uint32_t i;
+    (void) pUserData;
+    for (i = 0; i < taskCount; ++i) pfnTask(pTaskData, i);
+}
+#endif /* VKAD_THREAD_POOL */
+
+/* loads the tables of deviceCount devices with the load info of the same index (all functions if pLoadInfos is NULL).
+   The tasks run on pExecutor if it is not NULL, else on the internal threads with VKAD_THREAD_POOL, else one after another on the calling thread. */
+VKAD_API void vkadLoadDeviceFunctionsBatch(PFN_vkGetDeviceProcAddr loader, uint32_t deviceCount, const VkDevice* pDevices, const VkadDeviceLoadInfo* pLoadInfos, VkadDeviceFunctions* pFunctions, const VkadExecutor* pExecutor) {
+    VkadDeviceBatch batch;
+    batch.loader     = loader;
+    batch.pDevices   = pDevices;
+    batch.pLoadInfos = pLoadInfos;
+    batch.pFunctions = pFunctions;
+    if (pExecutor != NULL) {
+        pExecutor->pfnParallelFor(pExecutor->pUserData, deviceCount, vkadLoadDeviceBatchTask, &batch);
+        return;
+    }
+#ifdef VKAD_THREAD_POOL
+    vkadThreadPoolParallelFor(NULL, deviceCount, vkadLoadDeviceBatchTask, &batch);
+#else
+    vkadSerialParallelFor(NULL, deviceCount, vkadLoadDeviceBatchTask, &batch);
+#endif
+}
+#endif /* VKAD_HAS_DEFINITIONS */
+
+/* asynchronous loading: the device table is loaded on a thread of its own while the application goes on with its initialization; a hot set of functions
+   is loaded before vkadLoadDeviceFunctionsAsync returns, so these members can be called right away, and the others after vkadWaitDeviceFunctions */
+typedef struct VkadAsyncLoad VkadAsyncLoad;
+VKAD_API VkadAsyncLoad* vkadLoadDeviceFunctionsAsync(PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkadDeviceLoadInfo* loadInfo, const VkadDeviceFunctionSet* hot, VkadDeviceFunctions* functions);
+VKAD_API void           vkadWaitDeviceFunctions     (VkadAsyncLoad* load);
+
+#if VKAD_HAS_DEFINITIONS
+#ifdef VKAD_THREAD_POOL
+struct VkadAsyncLoad {
+    VkadThread                  thread;
+    PFN_vkGetDeviceProcAddr     loader;
+    VkDevice                    device;
+    VkadDeviceLoadInfo          loadInfo;           /* with copies of the sets; the create info is only needed for the groups, so it is not kept */
+    uint32_t                    groups[(VKAD_DEVICE_FUNCTION_GROUP_COUNT + 31) / 32];
+    VkadDeviceFunctionSet       selection;
+    VkadDeviceFunctionSet       hot;
+    VkadDeviceFunctions*        functions;
+    uint64_t                    start;
+};
+static void vkadRunAsyncLoad(void* argument) {
+    VkadAsyncLoad* load = REINTERPRET_CAST(VkadAsyncLoad*, argument);
+    vkadLoadDeviceFunctionsPart(load->loader, load->device, load->groups, &load->loadInfo, &load->hot, 0, load->functions);
+    if (load->loadInfo.pStats != NULL) load->loadInfo.pStats->nanoseconds = vkadNanoseconds() - load->start;
+}
+#endif /* VKAD_THREAD_POOL */
+
+/* loads the members in hot (none if it is NULL) and starts a thread for the others, with the load info (everything if it is NULL); pAvailable and pStats
+   are written until vkadWaitDeviceFunctions returns. Returns NULL if the whole table is loaded already, which is always the case without VKAD_THREAD_POOL,
+   or if no thread could be started. */
+VKAD_API VkadAsyncLoad* vkadLoadDeviceFunctionsAsync(PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkadDeviceLoadInfo* loadInfo, const VkadDeviceFunctionSet* hot, VkadDeviceFunctions* functions) {
+    VkadDeviceLoadInfo defaultLoadInfo = { NULL, 0, 0, NULL, NULL, NULL };
+#ifdef VKAD_THREAD_POOL
+    VkadAsyncLoad* load = REINTERPRET_CAST(VkadAsyncLoad*, calloc(1, sizeof(VkadAsyncLoad)));
+    if (load != NULL) {
+        load->loader    = loader;
+        load->device    = device;
+        load->loadInfo  = loadInfo != NULL ? *loadInfo : defaultLoadInfo;
+        load->functions = functions;
+        vkadGetEnabledDeviceFunctionGroups(&load->loadInfo, load->groups);
+        load->loadInfo.pCreateInfo = NULL;
+        if (load->loadInfo.pSelection != NULL) {
+            load->selection = *load->loadInfo.pSelection;
+            load->loadInfo.pSelection = &load->selection;
+        }
+        if (hot != NULL) load->hot = *hot;
+        if (load->loadInfo.pAvailable != NULL) memset(load->loadInfo.pAvailable, 0, sizeof(VkadDeviceFunctionSet));
+        if (load->loadInfo.pStats != NULL) {
+            memset(load->loadInfo.pStats, 0, sizeof(VkadLoadStats));
+            load->start = vkadNanoseconds();
+        }
+        vkadLoadDeviceFunctionsPart(loader, device, load->groups, &load->loadInfo, &load->hot, 1, functions);
+        if (vkadStartThread(&load->thread, vkadRunAsyncLoad, load)) return load;
+        /* without a thread, the rest is loaded here */
+        vkadRunAsyncLoad(load);
+        free(load);
+        return NULL;
+    }
+#else
+    (void) hot;
+#endif
+    vkadLoadDeviceFunctionsEx(loader, device, loadInfo != NULL ? loadInfo : &defaultLoadInfo, functions);
+    return NULL;
+}
+/* waits until the table is complete and frees the handle; does nothing for NULL */
+VKAD_API void vkadWaitDeviceFunctions(VkadAsyncLoad* load) {
+#ifdef VKAD_THREAD_POOL
+    if (load == NULL) return;
+    vkadJoinThread(&load->thread);
+    free(load);
+#else
+    (void) load;
+#endif
+}
+#endif /* VKAD_HAS_DEFINITIONS */
+
+/* shared tables: devices on the same driver, with the same extensions and options, usually get the same pointers, so they can use one table.
+   The tables live in a cache owned by the application, which has to synchronize the calls with the same cache, like an externally synchronized Vulkan object. */
+#ifndef VKAD_MAX_SHARED_TABLES
+#define VKAD_MAX_SHARED_TABLES 4
+#endif
+typedef struct VkadSharedDeviceFunctions {
+    VkadDeviceFunctions         functions;          /* first member, so the table handed out points to the whole entry */
+    VkadDeviceFunctionSet       available;
+    uint8_t                     driverUUID[VK_UUID_SIZE];
+    uint32_t                    driverID;
+    uint32_t                    groups[(VKAD_DEVICE_FUNCTION_GROUP_COUNT + 31) / 32];
+    VkadDeviceFunctionSet       selection;
+    uint32_t                    flags;
+    uint32_t                    referenceCount;     /* 0 for a free entry */
+} VkadSharedDeviceFunctions;
+typedef struct VkadDeviceFunctionCache {
+    VkadSharedDeviceFunctions   tables[VKAD_MAX_SHARED_TABLES];
+} VkadDeviceFunctionCache;
+VKAD_API const VkadDeviceFunctions* vkadAcquireSharedDeviceFunctions(VkadDeviceFunctionCache* cache, PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkPhysicalDeviceIDProperties* idProperties, const VkPhysicalDeviceDriverProperties* driverProperties, const VkadDeviceLoadInfo* loadInfo, uint32_t verifyCount);
+VKAD_API void                       vkadReleaseSharedDeviceFunctions(VkadDeviceFunctionCache* cache, const VkadDeviceFunctions* functions);
+
+#if VKAD_HAS_DEFINITIONS
+
+/* looks up verifyCount of the loaded functions, spread over the table, again for the device, and returns 0 if any of them differs */
+static int vkadVerifySharedDeviceFunctions(PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkadSharedDeviceFunctions* shared, uint32_t verifyCount) {
+    char name[VKAD_MAX_FUNCTION_NAME_SIZE];
+    uint32_t availableCount = 0, wanted, step, index = 0, i, checked = 0;
+    /* the samples are spread over the loaded members, since most IDs of a filtered table are not loaded */
+    for (i = 0; i < VKAD_DEVICE_FUNCTION_ID_COUNT; ++i) availableCount += (uint32_t) vkadDeviceFunctionAvailable(&shared->available, (VkadDeviceFunctionId) i);
+    wanted = verifyCount < availableCount ? verifyCount : availableCount;
+    if (wanted == 0) return 1;
+    step = availableCount / wanted;
+    for (i = 0; i < VKAD_DEVICE_FUNCTION_ID_COUNT && checked < wanted; ++i) {
+        VkadDeviceFunctionId id = (VkadDeviceFunctionId) i;
+        if (!vkadDeviceFunctionAvailable(&shared->available, id)) continue;
+        if (index++ % step != 0) continue;
+        if (loader(device, vkadFunctionEntryName(&vkadDeviceFunctionEntries[i], name)) != vkadGetDeviceFunction(&shared->functions, id)) return 0;
+        ++checked;
+    }
+    return checked >= wanted;
+}
+/* returns the shared table for the device, loading it if no device with the same driver and load info has one, and counts a reference to it.
+   idProperties and driverProperties (optional) are the properties of the physical device; pAvailable of the load info receives the set of the shared table.
+   With verifyCount > 0, an existing table is only shared after that many of its functions were looked up again for the device and found identical.
+   Returns NULL if the verification fails or the cache is full; the device then needs a table of its own. */
+VKAD_API const VkadDeviceFunctions* vkadAcquireSharedDeviceFunctions(VkadDeviceFunctionCache* cache, PFN_vkGetDeviceProcAddr loader, VkDevice device, const VkPhysicalDeviceIDProperties* idProperties, const VkPhysicalDeviceDriverProperties* driverProperties, const VkadDeviceLoadInfo* loadInfo, uint32_t verifyCount) {
+    uint32_t groups[(VKAD_DEVICE_FUNCTION_GROUP_COUNT + 31) / 32];
+    uint32_t driverID = driverProperties != NULL ? (uint32_t) driverProperties->driverID : 0;
+    VkadSharedDeviceFunctions* shared = NULL;
+    VkadDeviceLoadInfo sharedLoadInfo = *loadInfo;
+    VkadDeviceFunctionSet selection;
+    uint32_t i;
+    vkadGetEnabledDeviceFunctionGroups(loadInfo, groups);
+    if (loadInfo->pSelection != NULL) selection = *loadInfo->pSelection;
+    else memset(&selection, 0xFF, sizeof(selection));
+    for (i = 0; i < VKAD_MAX_SHARED_TABLES; ++i) {
+        VkadSharedDeviceFunctions* candidate = &cache->tables[i];
+        if (candidate->referenceCount == 0) {
+            if (shared == NULL) shared = candidate;
+            continue;
+        }
+        if (memcmp(candidate->driverUUID, idProperties->driverUUID, VK_UUID_SIZE) != 0 || candidate->driverID != driverID || candidate->flags != loadInfo->flags) continue;
+        if (memcmp(candidate->groups, groups, sizeof(groups)) != 0 || memcmp(&candidate->selection, &selection, sizeof(selection)) != 0) continue;
+        if (verifyCount > 0 && !vkadVerifySharedDeviceFunctions(loader, device, candidate, verifyCount)) return NULL;
+        ++candidate->referenceCount;
+        if (loadInfo->pAvailable != NULL) *loadInfo->pAvailable = candidate->available;
+        /* nothing was looked up */
+        if (loadInfo->pStats != NULL) memset(loadInfo->pStats, 0, sizeof(VkadLoadStats));
+        return &candidate->functions;
+    }
+    if (shared == NULL) return NULL;
+    sharedLoadInfo.pAvailable = &shared->available;
+    vkadLoadDeviceFunctionsEx(loader, device, &sharedLoadInfo, &shared->functions);
+    memcpy(shared->driverUUID, idProperties->driverUUID, VK_UUID_SIZE);
+    memcpy(shared->groups, groups, sizeof(groups));
+    shared->selection      = selection;
+    shared->driverID       = driverID;
+    shared->flags          = loadInfo->flags;
+    shared->referenceCount = 1;
+    if (loadInfo->pAvailable != NULL) *loadInfo->pAvailable = shared->available;
+    return &shared->functions;
+}
+/* drops a reference to a table returned by vkadAcquireSharedDeviceFunctions, the entry is reused after the last one */
+VKAD_API void vkadReleaseSharedDeviceFunctions(VkadDeviceFunctionCache* cache, const VkadDeviceFunctions* functions) {
+    uint32_t i;
+    for (i = 0; i < VKAD_MAX_SHARED_TABLES; ++i) {
+        if (&cache->tables[i].functions == functions && cache->tables[i].referenceCount > 0) --cache->tables[i].referenceCount;
+    }
+}
+#endif /* VKAD_HAS_DEFINITIONS */
+
+/* thread-local dispatch: the vk* device macros go through a pointer to the current table of the calling thread, so threads can drive different devices with the same macros.
+   __thread and __declspec(thread) come first, since C++ calls a wrapper function for every access of an extern thread_local variable. */
+#ifdef VKAD_THREAD_LOCAL_DISPATCH
+#ifdef VKAD_USER_DEVICE
+#error "VKAD_THREAD_LOCAL_DISPATCH defines VKAD_USER_DEVICE itself"
+#endif
+#if defined(__GNUC__) || defined(__clang__)
+#define VKAD_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define VKAD_THREAD_LOCAL __declspec(thread)
+#elif defined(__cplusplus) && __cplusplus >= 201103L
+#define VKAD_THREAD_LOCAL thread_local
+#else
+#define VKAD_THREAD_LOCAL _Thread_local
+#endif
+/* the initial-exec model reads the pointer at a fixed offset from the thread pointer, without a call of __tls_get_addr; a library that is opened with dlopen may have to define this empty */
+#ifndef VKAD_TLS_MODEL
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32)
+#define VKAD_TLS_MODEL __attribute__((tls_model("initial-exec")))
+#else
+#define VKAD_TLS_MODEL
+#endif
+#endif
+#define VKAD_USER_DEVICE (*vkadCurrentDeviceFunctions)
+#ifdef VKAD_SPLIT_IMPLEMENTATION
+extern VKAD_THREAD_LOCAL const VkadDeviceFunctions* vkadCurrentDeviceFunctions VKAD_TLS_MODEL;
+#endif
+VKAD_API const VkadDeviceFunctions* vkadMakeCurrent(const VkadDeviceFunctions* functions);
+
+#if VKAD_HAS_DEFINITIONS
+#ifdef VKAD_SPLIT_IMPLEMENTATION
+VKAD_THREAD_LOCAL const VkadDeviceFunctions* vkadCurrentDeviceFunctions VKAD_TLS_MODEL = NULL;
+#else
+static VKAD_THREAD_LOCAL const VkadDeviceFunctions* vkadCurrentDeviceFunctions VKAD_TLS_MODEL = NULL;
+#endif
+/* sets the table of the calling thread and returns the previous one, which allows to switch back */
+VKAD_API const VkadDeviceFunctions* vkadMakeCurrent(const VkadDeviceFunctions* functions) {
+    const VkadDeviceFunctions* previous = vkadCurrentDeviceFunctions;
+    vkadCurrentDeviceFunctions = functions;
+    return previous;
+}
+#endif /* VKAD_HAS_DEFINITIONS */
+#endif /* VKAD_THREAD_LOCAL_DISPATCH */
+
+/* with static dispatch, the vk* names are not redirected to the tables, so they are direct calls of the linked functions */
+#if !defined(VKAD_NO_GLOBAL_SYMBOLS) && !defined(VKAD_STATIC_DISPATCH)
 /* global functions */
         /* VK_VERSION_1_0 */
 #define vkEnumerateInstanceExtensionProperties                              VKAD_USER_GLOBAL.EnumerateInstanceExtensionProperties                           
@@ -2265,6 +8617,7 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkGetPhysicalDeviceExternalSemaphoreProperties                      VKAD_USER_INSTANCE.GetPhysicalDeviceExternalSemaphoreProperties            
         /* VK_VERSION_1_3 */                                                
 #define vkGetPhysicalDeviceToolProperties                                   VKAD_USER_INSTANCE.GetPhysicalDeviceToolProperties                         
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_KHR_surface spec_version 25  */                               
 #define vkDestroySurfaceKHR                                                 VKAD_USER_INSTANCE.DestroySurfaceKHR                                       
 #define vkGetPhysicalDeviceSurfaceSupportKHR                                VKAD_USER_INSTANCE.GetPhysicalDeviceSurfaceSupportKHR                      
@@ -2281,9 +8634,12 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCreateDisplayModeKHR                                              VKAD_USER_INSTANCE.CreateDisplayModeKHR                                         
 #define vkGetDisplayPlaneCapabilitiesKHR                                    VKAD_USER_INSTANCE.GetDisplayPlaneCapabilitiesKHR                               
 #define vkCreateDisplayPlaneSurfaceKHR                                      VKAD_USER_INSTANCE.CreateDisplayPlaneSurfaceKHR                                 
+#endif
+#ifndef VKAD_NO_VIDEO_EXTENSIONS
         /* VK_KHR_video_queue spec_version 8 */                             
 #define vkGetPhysicalDeviceVideoCapabilitiesKHR                             VKAD_USER_INSTANCE.GetPhysicalDeviceVideoCapabilitiesKHR                        
 #define vkGetPhysicalDeviceVideoFormatPropertiesKHR                         VKAD_USER_INSTANCE.GetPhysicalDeviceVideoFormatPropertiesKHR                    
+#endif
         /* VK_KHR_get_physical_device_properties2 spec_version 2 */         
 #define vkGetPhysicalDeviceFeatures2KHR                                     VKAD_USER_INSTANCE.GetPhysicalDeviceFeatures2KHR                                
 #define vkGetPhysicalDeviceProperties2KHR                                   VKAD_USER_INSTANCE.GetPhysicalDeviceProperties2KHR                              
@@ -2303,6 +8659,7 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
         /* VK_KHR_performance_query spec_version 1 */                       
 #define vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR     VKAD_USER_INSTANCE.EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR
 #define vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR             VKAD_USER_INSTANCE.GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR        
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_KHR_get_surface_capabilities2 spec_version 1 */               
 #define vkGetPhysicalDeviceSurfaceCapabilities2KHR                          VKAD_USER_INSTANCE.GetPhysicalDeviceSurfaceCapabilities2KHR                
 #define vkGetPhysicalDeviceSurfaceFormats2KHR                               VKAD_USER_INSTANCE.GetPhysicalDeviceSurfaceFormats2KHR                     
@@ -2311,10 +8668,15 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkGetPhysicalDeviceDisplayPlaneProperties2KHR                       VKAD_USER_INSTANCE.GetPhysicalDeviceDisplayPlaneProperties2KHR               
 #define vkGetDisplayModeProperties2KHR                                      VKAD_USER_INSTANCE.GetDisplayModeProperties2KHR                            
 #define vkGetDisplayPlaneCapabilities2KHR                                   VKAD_USER_INSTANCE.GetDisplayPlaneCapabilities2KHR                         
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_KHR_fragment_shading_rate spec_version 2 */                   
 #define vkGetPhysicalDeviceFragmentShadingRatesKHR                          VKAD_USER_INSTANCE.GetPhysicalDeviceFragmentShadingRatesKHR                
+#endif
+#ifndef VKAD_NO_VIDEO_EXTENSIONS
         /* VK_KHR_video_encode_queue spec_version 12 */                     
 #define vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR             VKAD_USER_INSTANCE.GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR   
+#endif
         /* VK_KHR_cooperative_matrix spec_version 2 */                      
 #define vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR                   VKAD_USER_INSTANCE.GetPhysicalDeviceCooperativeMatrixPropertiesKHR         
         /* VK_KHR_calibrated_timestamps spec_version 1 */                   
@@ -2323,33 +8685,46 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCreateDebugReportCallbackEXT                                      VKAD_USER_INSTANCE.CreateDebugReportCallbackEXT                            
 #define vkDestroyDebugReportCallbackEXT                                     VKAD_USER_INSTANCE.DestroyDebugReportCallbackEXT                           
 #define vkDebugReportMessageEXT                                             VKAD_USER_INSTANCE.DebugReportMessageEXT                                   
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_external_memory_capabilities spec_version 1 */             
 #define vkGetPhysicalDeviceExternalImageFormatPropertiesNV                  VKAD_USER_INSTANCE.GetPhysicalDeviceExternalImageFormatPropertiesNV        
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_EXT_direct_mode_display spec_version 1 */                     
 #define vkReleaseDisplayEXT                                                 VKAD_USER_INSTANCE.ReleaseDisplayEXT                                       
         /* VK_EXT_display_surface_counter spec_version 1 */                 
 #define vkGetPhysicalDeviceSurfaceCapabilities2EXT                          VKAD_USER_INSTANCE.GetPhysicalDeviceSurfaceCapabilities2EXT                
+#endif
         /* VK_EXT_debug_utils spec_version 2 */                             
 #define vkCreateDebugUtilsMessengerEXT                                      VKAD_USER_INSTANCE.CreateDebugUtilsMessengerEXT                            
 #define vkDestroyDebugUtilsMessengerEXT                                     VKAD_USER_INSTANCE.DestroyDebugUtilsMessengerEXT                           
 #define vkSubmitDebugUtilsMessageEXT                                        VKAD_USER_INSTANCE.SubmitDebugUtilsMessageEXT                              
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_sample_locations spec_version 1 */                        
 #define vkGetPhysicalDeviceMultisamplePropertiesEXT                         VKAD_USER_INSTANCE.GetPhysicalDeviceMultisamplePropertiesEXT               
+#endif
         /* VK_EXT_calibrated_timestamps spec_version 2 */                   
 #define vkGetPhysicalDeviceCalibrateableTimeDomainsEXT                      VKAD_USER_INSTANCE.GetPhysicalDeviceCalibrateableTimeDomainsEXT            
         /* VK_EXT_tooling_info spec_version 1 */                            
 #define vkGetPhysicalDeviceToolPropertiesEXT                                VKAD_USER_INSTANCE.GetPhysicalDeviceToolPropertiesEXT                      
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_cooperative_matrix spec_version 1 */                       
 #define vkGetPhysicalDeviceCooperativeMatrixPropertiesNV                    VKAD_USER_INSTANCE.GetPhysicalDeviceCooperativeMatrixPropertiesNV          
         /* VK_NV_coverage_reduction_mode spec_version 1 */                  
 #define vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV   VKAD_USER_INSTANCE.GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_EXT_headless_surface spec_version 1 */                        
 #define vkCreateHeadlessSurfaceEXT                                          VKAD_USER_INSTANCE.CreateHeadlessSurfaceEXT                                       
         /* VK_EXT_acquire_drm_display spec_version 1 */                     
 #define vkAcquireDrmDisplayEXT                                              VKAD_USER_INSTANCE.AcquireDrmDisplayEXT                                  
 #define vkGetDrmDisplayEXT                                                  VKAD_USER_INSTANCE.GetDrmDisplayEXT                                      
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_optical_flow spec_version 1 */                             
 #define vkGetPhysicalDeviceOpticalFlowImageFormatsNV                        VKAD_USER_INSTANCE.GetPhysicalDeviceOpticalFlowImageFormatsNV            
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_KHR_android_surface spec_version 6 */                         
 #define vkCreateAndroidSurfaceKHR                                           VKAD_USER_INSTANCE.CreateAndroidSurfaceKHR                               
         /* VK_FUCHSIA_imagepipe_surface spec_version 1 */                   
@@ -2390,11 +8765,14 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
         /* VK_QNX_screen_surface spec_version 1 */                          
 #define vkCreateScreenSurfaceQNX                                            VKAD_USER_INSTANCE.CreateScreenSurfaceQNX                                
 #define vkGetPhysicalDeviceScreenPresentationSupportQNX                     VKAD_USER_INSTANCE.GetPhysicalDeviceScreenPresentationSupportQNX         
+#endif
         /* Additions from 1.3.284 to 1.4.309: */
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_cooperative_vector spec_version 4 */
 #define vkGetPhysicalDeviceCooperativeVectorPropertiesNV                    VKAD_USER_INSTANCE.GetPhysicalDeviceCooperativeVectorPropertiesNV
         /* VK_NV_cooperative_matrix2 spec_version 1 */
 #define vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV  VKAD_USER_INSTANCE.GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV
+#endif
 
 
 /* device functions */    
@@ -2587,6 +8965,7 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkGetDeviceBufferMemoryRequirements                                 VKAD_USER_DEVICE.GetDeviceBufferMemoryRequirements                          
 #define vkGetDeviceImageMemoryRequirements                                  VKAD_USER_DEVICE.GetDeviceImageMemoryRequirements                           
 #define vkGetDeviceImageSparseMemoryRequirements                            VKAD_USER_DEVICE.GetDeviceImageSparseMemoryRequirements                     
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_KHR_swapchain spec_version 70  */                             
 #define vkCreateSwapchainKHR                                                VKAD_USER_DEVICE.CreateSwapchainKHR                                         
 #define vkDestroySwapchainKHR                                               VKAD_USER_DEVICE.DestroySwapchainKHR                                        
@@ -2598,6 +8977,8 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkAcquireNextImage2KHR                                              VKAD_USER_DEVICE.AcquireNextImage2KHR                                       
         /* VK_KHR_display_swapchain spec_version 10  */                     
 #define vkCreateSharedSwapchainsKHR                                         VKAD_USER_DEVICE.CreateSharedSwapchainsKHR                                  
+#endif
+#ifndef VKAD_NO_VIDEO_EXTENSIONS
         /* VK_KHR_video_queue spec_version 8 */                             
 #define vkCreateVideoSessionKHR                                             VKAD_USER_DEVICE.CreateVideoSessionKHR                                      
 #define vkDestroyVideoSessionKHR                                            VKAD_USER_DEVICE.DestroyVideoSessionKHR                                     
@@ -2611,9 +8992,12 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdControlVideoCodingKHR                                          VKAD_USER_DEVICE.CmdControlVideoCodingKHR                                   
         /* VK_KHR_video_decode_queue spec_version 8 */                      
 #define vkCmdDecodeVideoKHR                                                 VKAD_USER_DEVICE.CmdDecodeVideoKHR                                          
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_KHR_dynamic_rendering spec_version 1 */                       
 #define vkCmdBeginRenderingKHR                                              VKAD_USER_DEVICE.CmdBeginRenderingKHR                                       
 #define vkCmdEndRenderingKHR                                                VKAD_USER_DEVICE.CmdEndRenderingKHR                                         
+#endif
         /* VK_KHR_device_group spec_version 4 */                            
 #define vkGetDeviceGroupPeerMemoryFeaturesKHR                               VKAD_USER_DEVICE.GetDeviceGroupPeerMemoryFeaturesKHR                        
 #define vkCmdSetDeviceMaskKHR                                               VKAD_USER_DEVICE.CmdSetDeviceMaskKHR                                        
@@ -2633,13 +9017,17 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCreateDescriptorUpdateTemplateKHR                                 VKAD_USER_DEVICE.CreateDescriptorUpdateTemplateKHR                          
 #define vkDestroyDescriptorUpdateTemplateKHR                                VKAD_USER_DEVICE.DestroyDescriptorUpdateTemplateKHR                         
 #define vkUpdateDescriptorSetWithTemplateKHR                                VKAD_USER_DEVICE.UpdateDescriptorSetWithTemplateKHR                         
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_KHR_create_renderpass2 spec_version 1 */                      
 #define vkCreateRenderPass2KHR                                              VKAD_USER_DEVICE.CreateRenderPass2KHR                                       
 #define vkCmdBeginRenderPass2KHR                                            VKAD_USER_DEVICE.CmdBeginRenderPass2KHR                                     
 #define vkCmdNextSubpass2KHR                                                VKAD_USER_DEVICE.CmdNextSubpass2KHR                                         
 #define vkCmdEndRenderPass2KHR                                              VKAD_USER_DEVICE.CmdEndRenderPass2KHR                                       
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_KHR_shared_presentable_image spec_version 1 */                
 #define vkGetSwapchainStatusKHR                                             VKAD_USER_DEVICE.GetSwapchainStatusKHR                                      
+#endif
         /* VK_KHR_external_fence_fd spec_version 1 */                       
 #define vkImportFenceFdKHR                                                  VKAD_USER_DEVICE.ImportFenceFdKHR                                           
 #define vkGetFenceFdKHR                                                     VKAD_USER_DEVICE.GetFenceFdKHR                                              
@@ -2658,20 +9046,26 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkBindImageMemory2KHR                                               VKAD_USER_DEVICE.BindImageMemory2KHR                                        
         /* VK_KHR_maintenance3 spec_version 1 */                            
 #define vkGetDescriptorSetLayoutSupportKHR                                  VKAD_USER_DEVICE.GetDescriptorSetLayoutSupportKHR                           
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_KHR_draw_indirect_count spec_version 1 */                     
 #define vkCmdDrawIndirectCountKHR                                           VKAD_USER_DEVICE.CmdDrawIndirectCountKHR                                    
 #define vkCmdDrawIndexedIndirectCountKHR                                    VKAD_USER_DEVICE.CmdDrawIndexedIndirectCountKHR                             
+#endif
         /* VK_KHR_timeline_semaphore spec_version 2 */                      
 #define vkGetSemaphoreCounterValueKHR                                       VKAD_USER_DEVICE.GetSemaphoreCounterValueKHR                                
 #define vkWaitSemaphoresKHR                                                 VKAD_USER_DEVICE.WaitSemaphoresKHR                                          
 #define vkSignalSemaphoreKHR                                                VKAD_USER_DEVICE.SignalSemaphoreKHR                                         
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_KHR_fragment_shading_rate spec_version 2 */                   
 #define vkCmdSetFragmentShadingRateKHR                                      VKAD_USER_DEVICE.CmdSetFragmentShadingRateKHR                               
         /* VK_KHR_dynamic_rendering_local_read spec_version 1 */            
 #define vkCmdSetRenderingAttachmentLocationsKHR                             VKAD_USER_DEVICE.CmdSetRenderingAttachmentLocationsKHR                      
 #define vkCmdSetRenderingInputAttachmentIndicesKHR                          VKAD_USER_DEVICE.CmdSetRenderingInputAttachmentIndicesKHR                   
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_KHR_present_wait spec_version 1 */                            
 #define vkWaitForPresentKHR                                                 VKAD_USER_DEVICE.WaitForPresentKHR                                          
+#endif
         /* VK_KHR_buffer_device_address spec_version 1 */                   
 #define vkGetBufferDeviceAddressKHR                                         VKAD_USER_DEVICE.GetBufferDeviceAddressKHR                                  
 #define vkGetBufferOpaqueCaptureAddressKHR                                  VKAD_USER_DEVICE.GetBufferOpaqueCaptureAddressKHR                          
@@ -2689,9 +9083,11 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
         /* VK_KHR_map_memory2 spec_version 1 */                             
 #define vkMapMemory2KHR                                                     VKAD_USER_DEVICE.MapMemory2KHR                                             
 #define vkUnmapMemory2KHR                                                   VKAD_USER_DEVICE.UnmapMemory2KHR                                           
+#ifndef VKAD_NO_VIDEO_EXTENSIONS
         /* VK_KHR_video_encode_queue spec_version 12 */                     
 #define vkGetEncodedVideoSessionParametersKHR                               VKAD_USER_DEVICE.GetEncodedVideoSessionParametersKHR                       
 #define vkCmdEncodeVideoKHR                                                 VKAD_USER_DEVICE.CmdEncodeVideoKHR                                         
+#endif
         /* VK_KHR_synchronization2 spec_version 1 */                        
 #define vkCmdSetEvent2KHR                                                   VKAD_USER_DEVICE.CmdSetEvent2KHR                                           
 #define vkCmdResetEvent2KHR                                                 VKAD_USER_DEVICE.CmdResetEvent2KHR                                         
@@ -2699,8 +9095,10 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdPipelineBarrier2KHR                                            VKAD_USER_DEVICE.CmdPipelineBarrier2KHR                                    
 #define vkCmdWriteTimestamp2KHR                                             VKAD_USER_DEVICE.CmdWriteTimestamp2KHR                                     
 #define vkQueueSubmit2KHR                                                   VKAD_USER_DEVICE.QueueSubmit2KHR                                           
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
 #define vkCmdWriteBufferMarker2AMD                                          VKAD_USER_DEVICE.CmdWriteBufferMarker2AMD                                  
 #define vkGetQueueCheckpointData2NV                                         VKAD_USER_DEVICE.GetQueueCheckpointData2NV                                 
+#endif
                 /* NOTE: The function vkCmdWriteBufferMarker2AMD was moved into VK_AMD_buffer_marker and vkGetQueueCheckpointData2NV into VK_NV_device_diagnostic_checkpoints from 1.3.284 to 1.4.309;
                    they are kept here in their old position for the sake of preserving the memory layout of the old portion of the structs */
         /* VK_KHR_copy_commands2 spec_version 1 */                          
@@ -2710,8 +9108,10 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdCopyImageToBuffer2KHR                                          VKAD_USER_DEVICE.CmdCopyImageToBuffer2KHR                                  
 #define vkCmdBlitImage2KHR                                                  VKAD_USER_DEVICE.CmdBlitImage2KHR                                          
 #define vkCmdResolveImage2KHR                                               VKAD_USER_DEVICE.CmdResolveImage2KHR                                       
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
         /* VK_KHR_ray_tracing_maintenance1 spec_version 1 */                
 #define vkCmdTraceRaysIndirect2KHR                                          VKAD_USER_DEVICE.CmdTraceRaysIndirect2KHR                                  
+#endif
         /* VK_KHR_maintenance4 spec_version 2 */                            
 #define vkGetDeviceBufferMemoryRequirementsKHR                              VKAD_USER_DEVICE.GetDeviceBufferMemoryRequirementsKHR                      
 #define vkGetDeviceImageMemoryRequirementsKHR                               VKAD_USER_DEVICE.GetDeviceImageMemoryRequirementsKHR                       
@@ -2721,8 +9121,10 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkGetRenderingAreaGranularityKHR                                    VKAD_USER_DEVICE.GetRenderingAreaGranularityKHR                            
 #define vkGetDeviceImageSubresourceLayoutKHR                                VKAD_USER_DEVICE.GetDeviceImageSubresourceLayoutKHR                        
 #define vkGetImageSubresourceLayout2KHR                                     VKAD_USER_DEVICE.GetImageSubresourceLayout2KHR                             
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_KHR_line_rasterization spec_version 1 */                      
 #define vkCmdSetLineStippleKHR                                              VKAD_USER_DEVICE.CmdSetLineStippleKHR                                      
+#endif
         /* VK_KHR_calibrated_timestamps spec_version 1 */                   
 #define vkGetCalibratedTimestampsKHR                                        VKAD_USER_DEVICE.GetCalibratedTimestampsKHR                                
         /* VK_KHR_maintenance6 spec_version 1 */                            
@@ -2738,6 +9140,7 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdDebugMarkerBeginEXT                                            VKAD_USER_DEVICE.CmdDebugMarkerBeginEXT                                    
 #define vkCmdDebugMarkerEndEXT                                              VKAD_USER_DEVICE.CmdDebugMarkerEndEXT                                      
 #define vkCmdDebugMarkerInsertEXT                                           VKAD_USER_DEVICE.CmdDebugMarkerInsertEXT                                   
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_transform_feedback spec_version 1 */                      
 #define vkCmdBindTransformFeedbackBuffersEXT                                VKAD_USER_DEVICE.CmdBindTransformFeedbackBuffersEXT                        
 #define vkCmdBeginTransformFeedbackEXT                                      VKAD_USER_DEVICE.CmdBeginTransformFeedbackEXT                              
@@ -2745,6 +9148,8 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdBeginQueryIndexedEXT                                           VKAD_USER_DEVICE.CmdBeginQueryIndexedEXT                                   
 #define vkCmdEndQueryIndexedEXT                                             VKAD_USER_DEVICE.CmdEndQueryIndexedEXT                                     
 #define vkCmdDrawIndirectByteCountEXT                                       VKAD_USER_DEVICE.CmdDrawIndirectByteCountEXT                               
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NVX_binary_import spec_version 2 */
 #define vkCreateCuModuleNVX                                                 VKAD_USER_DEVICE.CreateCuModuleNVX                                         
 #define vkCreateCuFunctionNVX                                               VKAD_USER_DEVICE.CreateCuFunctionNVX                                       
@@ -2759,11 +9164,15 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdDrawIndexedIndirectCountAMD                                    VKAD_USER_DEVICE.CmdDrawIndexedIndirectCountAMD                            
         /* VK_AMD_shader_info spec_version 1 */                             
 #define vkGetShaderInfoAMD                                                  VKAD_USER_DEVICE.GetShaderInfoAMD                                          
+#endif
         /* VK_EXT_conditional_rendering spec_version 2 */                   
 #define vkCmdBeginConditionalRenderingEXT                                   VKAD_USER_DEVICE.CmdBeginConditionalRenderingEXT                           
 #define vkCmdEndConditionalRenderingEXT                                     VKAD_USER_DEVICE.CmdEndConditionalRenderingEXT                             
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_clip_space_w_scaling spec_version 1 */                     
 #define vkCmdSetViewportWScalingNV                                          VKAD_USER_DEVICE.CmdSetViewportWScalingNV                                  
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_EXT_display_control spec_version 1 */                         
 #define vkDisplayPowerControlEXT                                            VKAD_USER_DEVICE.DisplayPowerControlEXT                                    
 #define vkRegisterDeviceEventEXT                                            VKAD_USER_DEVICE.RegisterDeviceEventEXT                                    
@@ -2772,12 +9181,17 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
         /* VK_GOOGLE_display_timing spec_version 1 */                       
 #define vkGetRefreshCycleDurationGOOGLE                                     VKAD_USER_DEVICE.GetRefreshCycleDurationGOOGLE                             
 #define vkGetPastPresentationTimingGOOGLE                                   VKAD_USER_DEVICE.GetPastPresentationTimingGOOGLE                           
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_discard_rectangles spec_version 2 */                      
 #define vkCmdSetDiscardRectangleEXT                                         VKAD_USER_DEVICE.CmdSetDiscardRectangleEXT                                 
 #define vkCmdSetDiscardRectangleEnableEXT                                   VKAD_USER_DEVICE.CmdSetDiscardRectangleEnableEXT                           
 #define vkCmdSetDiscardRectangleModeEXT                                     VKAD_USER_DEVICE.CmdSetDiscardRectangleModeEXT                             
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_EXT_hdr_metadata spec_version 3 */
 #define vkSetHdrMetadataEXT                                                 VKAD_USER_DEVICE.SetHdrMetadataEXT                                         
+#endif
         /* VK_EXT_debug_utils spec_version 2 */                             
 #define vkSetDebugUtilsObjectNameEXT                                        VKAD_USER_DEVICE.SetDebugUtilsObjectNameEXT                                
 #define vkSetDebugUtilsObjectTagEXT                                         VKAD_USER_DEVICE.SetDebugUtilsObjectTagEXT                                 
@@ -2787,8 +9201,10 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdBeginDebugUtilsLabelEXT                                        VKAD_USER_DEVICE.CmdBeginDebugUtilsLabelEXT                                
 #define vkCmdEndDebugUtilsLabelEXT                                          VKAD_USER_DEVICE.CmdEndDebugUtilsLabelEXT                                  
 #define vkCmdInsertDebugUtilsLabelEXT                                       VKAD_USER_DEVICE.CmdInsertDebugUtilsLabelEXT                               
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_sample_locations spec_version 1 */                        
 #define vkCmdSetSampleLocationsEXT                                          VKAD_USER_DEVICE.CmdSetSampleLocationsEXT                                  
+#endif
         /* VK_EXT_image_drm_format_modifier spec_version 2 */               
 #define vkGetImageDrmFormatModifierPropertiesEXT                            VKAD_USER_DEVICE.GetImageDrmFormatModifierPropertiesEXT                    
         /* VK_EXT_validation_cache spec_version 1 */                        
@@ -2796,10 +9212,13 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkDestroyValidationCacheEXT                                         VKAD_USER_DEVICE.DestroyValidationCacheEXT                                 
 #define vkMergeValidationCachesEXT                                          VKAD_USER_DEVICE.MergeValidationCachesEXT                                  
 #define vkGetValidationCacheDataEXT                                         VKAD_USER_DEVICE.GetValidationCacheDataEXT                                 
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_shading_rate_image spec_version 3 */                       
 #define vkCmdBindShadingRateImageNV                                         VKAD_USER_DEVICE.CmdBindShadingRateImageNV                                 
 #define vkCmdSetViewportShadingRatePaletteNV                                VKAD_USER_DEVICE.CmdSetViewportShadingRatePaletteNV                        
 #define vkCmdSetCoarseSampleOrderNV                                         VKAD_USER_DEVICE.CmdSetCoarseSampleOrderNV                                 
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
         /* VK_NV_ray_tracing spec_version 3 */                              
 #define vkCreateAccelerationStructureNV                                     VKAD_USER_DEVICE.CreateAccelerationStructureNV                             
 #define vkDestroyAccelerationStructureNV                                    VKAD_USER_DEVICE.DestroyAccelerationStructureNV                            
@@ -2814,12 +9233,16 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkGetAccelerationStructureHandleNV                                  VKAD_USER_DEVICE.GetAccelerationStructureHandleNV                        
 #define vkCmdWriteAccelerationStructuresPropertiesNV                        VKAD_USER_DEVICE.CmdWriteAccelerationStructuresPropertiesNV              
 #define vkCompileDeferredNV                                                 VKAD_USER_DEVICE.CompileDeferredNV                                       
+#endif
         /* VK_EXT_external_memory_host spec_version 1 */                    
 #define vkGetMemoryHostPointerPropertiesEXT                                 VKAD_USER_DEVICE.GetMemoryHostPointerPropertiesEXT                                             
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_AMD_buffer_marker spec_version 1 */                           
 #define vkCmdWriteBufferMarkerAMD                                           VKAD_USER_DEVICE.CmdWriteBufferMarkerAMD                                 
+#endif
         /* VK_EXT_calibrated_timestamps spec_version 2 */                   
 #define vkGetCalibratedTimestampsEXT                                        VKAD_USER_DEVICE.GetCalibratedTimestampsEXT                              
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_mesh_shader spec_version 1 */                              
 #define vkCmdDrawMeshTasksNV                                                VKAD_USER_DEVICE.CmdDrawMeshTasksNV                                      
 #define vkCmdDrawMeshTasksIndirectNV                                        VKAD_USER_DEVICE.CmdDrawMeshTasksIndirectNV                              
@@ -2840,14 +9263,20 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkReleasePerformanceConfigurationINTEL                              VKAD_USER_DEVICE.ReleasePerformanceConfigurationINTEL                    
 #define vkQueueSetPerformanceConfigurationINTEL                             VKAD_USER_DEVICE.QueueSetPerformanceConfigurationINTEL                   
 #define vkGetPerformanceParameterINTEL                                      VKAD_USER_DEVICE.GetPerformanceParameterINTEL                            
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_AMD_display_native_hdr spec_version 1 */                      
 #define vkSetLocalDimmingAMD                                                VKAD_USER_DEVICE.SetLocalDimmingAMD                                      
+#endif
         /* VK_EXT_buffer_device_address spec_version 2 */                   
 #define vkGetBufferDeviceAddressEXT                                         VKAD_USER_DEVICE.GetBufferDeviceAddressEXT                               
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_line_rasterization spec_version 1 */                      
 #define vkCmdSetLineStippleEXT                                              VKAD_USER_DEVICE.CmdSetLineStippleEXT                                    
+#endif
         /* VK_EXT_host_query_reset spec_version 1 */                        
 #define vkResetQueryPoolEXT                                                 VKAD_USER_DEVICE.ResetQueryPoolEXT                                                                             
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_extended_dynamic_state spec_version 1 */                  
 #define vkCmdSetCullModeEXT                                                 VKAD_USER_DEVICE.CmdSetCullModeEXT                                       
 #define vkCmdSetFrontFaceEXT                                                VKAD_USER_DEVICE.CmdSetFrontFaceEXT                                        
@@ -2861,14 +9290,18 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdSetDepthBoundsTestEnableEXT                                    VKAD_USER_DEVICE.CmdSetDepthBoundsTestEnableEXT                            
 #define vkCmdSetStencilTestEnableEXT                                        VKAD_USER_DEVICE.CmdSetStencilTestEnableEXT                                
 #define vkCmdSetStencilOpEXT                                                VKAD_USER_DEVICE.CmdSetStencilOpEXT                                        
+#endif
         /* VK_EXT_host_image_copy spec_version 1 */                         
 #define vkCopyMemoryToImageEXT                                              VKAD_USER_DEVICE.CopyMemoryToImageEXT                                      
 #define vkCopyImageToMemoryEXT                                              VKAD_USER_DEVICE.CopyImageToMemoryEXT                                      
 #define vkCopyImageToImageEXT                                               VKAD_USER_DEVICE.CopyImageToImageEXT                                       
 #define vkTransitionImageLayoutEXT                                          VKAD_USER_DEVICE.TransitionImageLayoutEXT                                  
 #define vkGetImageSubresourceLayout2EXT                                     VKAD_USER_DEVICE.GetImageSubresourceLayout2EXT                             
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_EXT_swapchain_maintenance1 spec_version 1 */                  
 #define vkReleaseSwapchainImagesEXT                                         VKAD_USER_DEVICE.ReleaseSwapchainImagesEXT                                 
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_device_generated_commands spec_version 3 */                
 #define vkGetGeneratedCommandsMemoryRequirementsNV                          VKAD_USER_DEVICE.GetGeneratedCommandsMemoryRequirementsNV                  
 #define vkCmdPreprocessGeneratedCommandsNV                                  VKAD_USER_DEVICE.CmdPreprocessGeneratedCommandsNV                          
@@ -2876,13 +9309,17 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdBindPipelineShaderGroupNV                                      VKAD_USER_DEVICE.CmdBindPipelineShaderGroupNV                              
 #define vkCreateIndirectCommandsLayoutNV                                    VKAD_USER_DEVICE.CreateIndirectCommandsLayoutNV                            
 #define vkDestroyIndirectCommandsLayoutNV                                   VKAD_USER_DEVICE.DestroyIndirectCommandsLayoutNV                           
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_depth_bias_control spec_version 1 */                      
 #define vkCmdSetDepthBias2EXT                                               VKAD_USER_DEVICE.CmdSetDepthBias2EXT                                       
+#endif
         /* VK_EXT_private_data spec_version 1 */                            
 #define vkCreatePrivateDataSlotEXT                                          VKAD_USER_DEVICE.CreatePrivateDataSlotEXT                                  
 #define vkDestroyPrivateDataSlotEXT                                         VKAD_USER_DEVICE.DestroyPrivateDataSlotEXT                                 
 #define vkSetPrivateDataEXT                                                 VKAD_USER_DEVICE.SetPrivateDataEXT                                         
 #define vkGetPrivateDataEXT                                                 VKAD_USER_DEVICE.GetPrivateDataEXT                                         
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_cuda_kernel_launch spec_version 2 */                       
 #define vkCreateCudaModuleNV                                                VKAD_USER_DEVICE.CreateCudaModuleNV                                        
 #define vkGetCudaModuleCacheNV                                              VKAD_USER_DEVICE.GetCudaModuleCacheNV                                      
@@ -2890,6 +9327,7 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkDestroyCudaModuleNV                                               VKAD_USER_DEVICE.DestroyCudaModuleNV                                       
 #define vkDestroyCudaFunctionNV                                             VKAD_USER_DEVICE.DestroyCudaFunctionNV                                     
 #define vkCmdCudaLaunchKernelNV                                             VKAD_USER_DEVICE.CmdCudaLaunchKernelNV                                     
+#endif
         /* VK_EXT_descriptor_buffer spec_version 1 */                       
 #define vkGetDescriptorSetLayoutSizeEXT                                     VKAD_USER_DEVICE.GetDescriptorSetLayoutSizeEXT                             
 #define vkGetDescriptorSetLayoutBindingOffsetEXT                            VKAD_USER_DEVICE.GetDescriptorSetLayoutBindingOffsetEXT                      
@@ -2902,12 +9340,17 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkGetImageViewOpaqueCaptureDescriptorDataEXT                        VKAD_USER_DEVICE.GetImageViewOpaqueCaptureDescriptorDataEXT                  
 #define vkGetSamplerOpaqueCaptureDescriptorDataEXT                          VKAD_USER_DEVICE.GetSamplerOpaqueCaptureDescriptorDataEXT                    
 #define vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT            VKAD_USER_DEVICE.GetAccelerationStructureOpaqueCaptureDescriptorDataEXT      
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_fragment_shading_rate_enums spec_version 1 */              
 #define vkCmdSetFragmentShadingRateEnumNV                                   VKAD_USER_DEVICE.CmdSetFragmentShadingRateEnumNV                             
+#endif
         /* VK_EXT_device_fault spec_version 2 */                            
 #define vkGetDeviceFaultInfoEXT                                             VKAD_USER_DEVICE.GetDeviceFaultInfoEXT                                       
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_vertex_input_dynamic_state spec_version 2 */              
 #define vkCmdSetVertexInputEXT                                              VKAD_USER_DEVICE.CmdSetVertexInputEXT                                        
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_HUAWEI_subpass_shading spec_version 3 */                      
 #define vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI                     VKAD_USER_DEVICE.GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI               
 #define vkCmdSubpassShadingHUAWEI                                           VKAD_USER_DEVICE.CmdSubpassShadingHUAWEI                                     
@@ -2915,8 +9358,10 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdBindInvocationMaskHUAWEI                                       VKAD_USER_DEVICE.CmdBindInvocationMaskHUAWEI                                 
         /* VK_NV_external_memory_rdma spec_version 1 */                     
 #define vkGetMemoryRemoteAddressNV                                          VKAD_USER_DEVICE.GetMemoryRemoteAddressNV                                    
+#endif
         /* VK_EXT_pipeline_properties spec_version 1 */                     
 #define vkGetPipelinePropertiesEXT                                          VKAD_USER_DEVICE.GetPipelinePropertiesEXT                                    
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_extended_dynamic_state2 spec_version 1 */                 
 #define vkCmdSetPatchControlPointsEXT                                       VKAD_USER_DEVICE.CmdSetPatchControlPointsEXT                                 
 #define vkCmdSetRasterizerDiscardEnableEXT                                  VKAD_USER_DEVICE.CmdSetRasterizerDiscardEnableEXT                            
@@ -2928,6 +9373,8 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
         /* VK_EXT_multi_draw spec_version 1 */                              
 #define vkCmdDrawMultiEXT                                                   VKAD_USER_DEVICE.CmdDrawMultiEXT                                             
 #define vkCmdDrawMultiIndexedEXT                                            VKAD_USER_DEVICE.CmdDrawMultiIndexedEXT                                      
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
         /* VK_EXT_opacity_micromap spec_version 2 */                        
 #define vkCreateMicromapEXT                                                 VKAD_USER_DEVICE.CreateMicromapEXT                                           
 #define vkDestroyMicromapEXT                                                VKAD_USER_DEVICE.DestroyMicromapEXT                                          
@@ -2943,11 +9390,15 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdWriteMicromapsPropertiesEXT                                    VKAD_USER_DEVICE.CmdWriteMicromapsPropertiesEXT                            
 #define vkGetDeviceMicromapCompatibilityEXT                                 VKAD_USER_DEVICE.GetDeviceMicromapCompatibilityEXT                         
 #define vkGetMicromapBuildSizesEXT                                          VKAD_USER_DEVICE.GetMicromapBuildSizesEXT                                  
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_HUAWEI_cluster_culling_shader spec_version 3 */               
 #define vkCmdDrawClusterHUAWEI                                              VKAD_USER_DEVICE.CmdDrawClusterHUAWEI                                      
 #define vkCmdDrawClusterIndirectHUAWEI                                      VKAD_USER_DEVICE.CmdDrawClusterIndirectHUAWEI                              
+#endif
         /* VK_EXT_pageable_device_local_memory spec_version 1 */            
 #define vkSetDeviceMemoryPriorityEXT                                        VKAD_USER_DEVICE.SetDeviceMemoryPriorityEXT                                
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_VALVE_descriptor_set_host_mapping spec_version 1 */           
 #define vkGetDescriptorSetLayoutHostMappingInfoVALVE                        VKAD_USER_DEVICE.GetDescriptorSetLayoutHostMappingInfoVALVE                
 #define vkGetDescriptorSetHostMappingVALVE                                  VKAD_USER_DEVICE.GetDescriptorSetHostMappingVALVE                          
@@ -2961,6 +9412,8 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkGetPipelineIndirectMemoryRequirementsNV                           VKAD_USER_DEVICE.GetPipelineIndirectMemoryRequirementsNV                   
 #define vkCmdUpdatePipelineIndirectBufferNV                                 VKAD_USER_DEVICE.CmdUpdatePipelineIndirectBufferNV                         
 #define vkGetPipelineIndirectDeviceAddressNV                                VKAD_USER_DEVICE.GetPipelineIndirectDeviceAddressNV                        
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_extended_dynamic_state3 spec_version 2 */                 
 #define vkCmdSetDepthClampEnableEXT                                         VKAD_USER_DEVICE.CmdSetDepthClampEnableEXT                                 
 #define vkCmdSetPolygonModeEXT                                              VKAD_USER_DEVICE.CmdSetPolygonModeEXT                                      
@@ -2993,19 +9446,23 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdSetShadingRateImageEnableNV                                    VKAD_USER_DEVICE.CmdSetShadingRateImageEnableNV                            
 #define vkCmdSetRepresentativeFragmentTestEnableNV                          VKAD_USER_DEVICE.CmdSetRepresentativeFragmentTestEnableNV                  
 #define vkCmdSetCoverageReductionModeNV                                     VKAD_USER_DEVICE.CmdSetCoverageReductionModeNV                             
+#endif
         /* VK_EXT_shader_module_identifier spec_version 1 */                
 #define vkGetShaderModuleIdentifierEXT                                      VKAD_USER_DEVICE.GetShaderModuleIdentifierEXT                              
 #define vkGetShaderModuleCreateInfoIdentifierEXT                            VKAD_USER_DEVICE.GetShaderModuleCreateInfoIdentifierEXT                    
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_optical_flow spec_version 1 */                             
 #define vkCreateOpticalFlowSessionNV                                        VKAD_USER_DEVICE.CreateOpticalFlowSessionNV                                
 #define vkDestroyOpticalFlowSessionNV                                       VKAD_USER_DEVICE.DestroyOpticalFlowSessionNV                               
 #define vkBindOpticalFlowSessionImageNV                                     VKAD_USER_DEVICE.BindOpticalFlowSessionImageNV                             
 #define vkCmdOpticalFlowExecuteNV                                           VKAD_USER_DEVICE.CmdOpticalFlowExecuteNV                                   
+#endif
         /* VK_EXT_shader_object spec_version 1 */                           
 #define vkCreateShadersEXT                                                  VKAD_USER_DEVICE.CreateShadersEXT                                          
 #define vkDestroyShaderEXT                                                  VKAD_USER_DEVICE.DestroyShaderEXT                                          
 #define vkGetShaderBinaryDataEXT                                            VKAD_USER_DEVICE.GetShaderBinaryDataEXT                                    
 #define vkCmdBindShadersEXT                                                 VKAD_USER_DEVICE.CmdBindShadersEXT                                         
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_QCOM_tile_properties spec_version 1 */                        
 #define vkGetFramebufferTilePropertiesQCOM                                  VKAD_USER_DEVICE.GetFramebufferTilePropertiesQCOM                          
 #define vkGetDynamicRenderingTilePropertiesQCOM                             VKAD_USER_DEVICE.GetDynamicRenderingTilePropertiesQCOM                     
@@ -3015,8 +9472,12 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkSetLatencyMarkerNV                                                VKAD_USER_DEVICE.SetLatencyMarkerNV                                        
 #define vkGetLatencyTimingsNV                                               VKAD_USER_DEVICE.GetLatencyTimingsNV                                       
 #define vkQueueNotifyOutOfBandNV                                            VKAD_USER_DEVICE.QueueNotifyOutOfBandNV                                    
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_attachment_feedback_loop_dynamic_state spec_version 1 */  
 #define vkCmdSetAttachmentFeedbackLoopEnableEXT                             VKAD_USER_DEVICE.CmdSetAttachmentFeedbackLoopEnableEXT                     
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
         /* VK_KHR_acceleration_structure spec_version 13 */                 
 #define vkCreateAccelerationStructureKHR                                    VKAD_USER_DEVICE.CreateAccelerationStructureKHR                            
 #define vkDestroyAccelerationStructureKHR                                   VKAD_USER_DEVICE.DestroyAccelerationStructureKHR                           
@@ -3041,10 +9502,14 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdTraceRaysIndirectKHR                                           VKAD_USER_DEVICE.CmdTraceRaysIndirectKHR                                   
 #define vkGetRayTracingShaderGroupStackSizeKHR                              VKAD_USER_DEVICE.GetRayTracingShaderGroupStackSizeKHR                      
 #define vkCmdSetRayTracingPipelineStackSizeKHR                              VKAD_USER_DEVICE.CmdSetRayTracingPipelineStackSizeKHR                      
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* VK_EXT_mesh_shader spec_version 1 */                             
 #define vkCmdDrawMeshTasksEXT                                               VKAD_USER_DEVICE.CmdDrawMeshTasksEXT                                       
 #define vkCmdDrawMeshTasksIndirectEXT                                       VKAD_USER_DEVICE.CmdDrawMeshTasksIndirectEXT                               
 #define vkCmdDrawMeshTasksIndirectCountEXT                                  VKAD_USER_DEVICE.CmdDrawMeshTasksIndirectCountEXT                          
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_ANDROID_external_memory_android_hardware_buffer spec_version 5VKAD_USER_DEVICE. */ 
 #define vkGetAndroidHardwareBufferPropertiesANDROID                         VKAD_USER_DEVICE.GetAndroidHardwareBufferPropertiesANDROID                 
 #define vkGetMemoryAndroidHardwareBufferANDROID                             VKAD_USER_DEVICE.GetMemoryAndroidHardwareBufferANDROID                     
@@ -3060,6 +9525,7 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkSetBufferCollectionBufferConstraintsFUCHSIA                       VKAD_USER_DEVICE.SetBufferCollectionBufferConstraintsFUCHSIA               
 #define vkDestroyBufferCollectionFUCHSIA                                    VKAD_USER_DEVICE.DestroyBufferCollectionFUCHSIA                            
 #define vkGetBufferCollectionPropertiesFUCHSIA                              VKAD_USER_DEVICE.GetBufferCollectionPropertiesFUCHSIA                      
+#endif
         /* VK_EXT_metal_objects spec_version 2 */                           
 #define vkExportMetalObjectsEXT                                             VKAD_USER_DEVICE.ExportMetalObjectsEXT                                     
         /* VK_KHR_external_memory_win32 spec_version 1 */                   
@@ -3071,12 +9537,17 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
         /* VK_KHR_external_fence_win32 spec_version 1 */                    
 #define vkImportFenceWin32HandleKHR                                         VKAD_USER_DEVICE.ImportFenceWin32HandleKHR                                 
 #define vkGetFenceWin32HandleKHR                                            VKAD_USER_DEVICE.GetFenceWin32HandleKHR                                    
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_NV_external_memory_win32 spec_version 1 */                    
 #define vkGetMemoryWin32HandleNV                                            VKAD_USER_DEVICE.GetMemoryWin32HandleNV                                    
+#endif
+#ifndef VKAD_NO_WSI_EXTENSIONS
         /* VK_EXT_full_screen_exclusive spec_version 4 */                   
 #define vkAcquireFullScreenExclusiveModeEXT                                 VKAD_USER_DEVICE.AcquireFullScreenExclusiveModeEXT                         
 #define vkReleaseFullScreenExclusiveModeEXT                                 VKAD_USER_DEVICE.ReleaseFullScreenExclusiveModeEXT                         
 #define vkGetDeviceGroupSurfacePresentModes2EXT                             VKAD_USER_DEVICE.GetDeviceGroupSurfacePresentModes2EXT                     
+#endif
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_QNX_external_memory_screen_buffer spec_version 1 */           
 #define vkGetScreenBufferPropertiesQNX                                      VKAD_USER_DEVICE.GetScreenBufferPropertiesQNX                              
         /* VK_AMDX_shader_enqueue spec_version 2 */
@@ -3087,11 +9558,16 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkCmdDispatchGraphAMDX                                              VKAD_USER_DEVICE.CmdDispatchGraphAMDX                                      
 #define vkCmdDispatchGraphIndirectAMDX                                      VKAD_USER_DEVICE.CmdDispatchGraphIndirectAMDX                               
 #define vkCmdDispatchGraphIndirectCountAMDX                                 VKAD_USER_DEVICE.CmdDispatchGraphIndirectCountAMDX
+#endif
                 /* Additions from 1.3.284 to 1.4.309: */
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* to VK_NVX_image_view_handle spec_version 3 */
 #define vkGetImageViewHandle64NVX                                           VKAD_USER_DEVICE.GetImageViewHandle64NVX
+#endif
+#ifndef VKAD_NO_GRAPHICS_EXTENSIONS
         /* to VK_EXT_shader_object spec_version 1 */
 #define vkCmdSetDepthClampRangeEXT                                          VKAD_USER_DEVICE.CmdSetDepthClampRangeEXT
+#endif
         /* VK_VERSION_1_4 */
 #define vkCmdSetLineStipple                                                 VKAD_USER_DEVICE.CmdSetLineStipple
 #define vkMapMemory2                                                        VKAD_USER_DEVICE.MapMemory2
@@ -3118,17 +9594,21 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 #define vkGetPipelineKeyKHR                                                 VKAD_USER_DEVICE.GetPipelineKeyKHR
 #define vkGetPipelineBinaryDataKHR                                          VKAD_USER_DEVICE.GetPipelineBinaryDataKHR
 #define vkReleaseCapturedPipelineDataKHR                                    VKAD_USER_DEVICE.ReleaseCapturedPipelineDataKHR
+#ifndef VKAD_NO_VENDOR_EXTENSIONS
         /* VK_AMD_anti_lag spec_version 1 */
 #define vkAntiLagUpdateAMD                                                  VKAD_USER_DEVICE.AntiLagUpdateAMD
         /* VK_NV_cooperative_vector spec_version 4 */
 #define vkConvertCooperativeVectorMatrixNV                                  VKAD_USER_DEVICE.ConvertCooperativeVectorMatrixNV
 #define vkCmdConvertCooperativeVectorMatrixNV                               VKAD_USER_DEVICE.CmdConvertCooperativeVectorMatrixNV
+#endif
+#ifndef VKAD_NO_RAY_TRACING_EXTENSIONS
         /* VK_NV_cluster_acceleration_structure spec_version 2 */
 #define vkGetClusterAccelerationStructureBuildSizesNV                       VKAD_USER_DEVICE.GetClusterAccelerationStructureBuildSizesNV
 #define vkCmdBuildClusterAccelerationStructureIndirectNV                    VKAD_USER_DEVICE.CmdBuildClusterAccelerationStructureIndirectNV
         /* VK_NV_partitioned_acceleration_structure spec_version 1 */
 #define vkGetPartitionedAccelerationStructuresBuildSizesNV                  VKAD_USER_DEVICE.GetPartitionedAccelerationStructuresBuildSizesNV
 #define vkCmdBuildPartitionedAccelerationStructuresNV                       VKAD_USER_DEVICE.CmdBuildPartitionedAccelerationStructuresNV
+#endif
         /* VK_EXT_device_generated_commands spec_version 1 */
 #define vkGetGeneratedCommandsMemoryRequirementsEXT                         VKAD_USER_DEVICE.GetGeneratedCommandsMemoryRequirementsEXT
 #define vkCmdPreprocessGeneratedCommandsEXT                                 VKAD_USER_DEVICE.CmdPreprocessGeneratedCommandsEXT
@@ -3151,4 +9631,78 @@ static void vkadLoadDeviceFunctions  (PFN_vkGetDeviceProcAddr loader, VkDevice d
 } /* extern "C" */
 #endif
 
+#if defined(__cplusplus) && (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+/* C++ front end: every member called through vkad::call or read through vkad::get adds itself to the used set of its struct during static initialization,
+   so the tables can be loaded with the functions the program uses and nothing else */
+namespace vkad {
+/* the used sets of the whole program; inline functions, so all translation units share the same sets */
+inline VkadInstanceFunctionSet& usedInstanceFunctions() {
+    static VkadInstanceFunctionSet used;
+    return used;
+}
+inline VkadDeviceFunctionSet& usedDeviceFunctions() {
+    static VkadDeviceFunctionSet used;
+    return used;
+}
+/* internal linkage like the rest of vkad, since the templates call its functions, which are static unless VKAD_SPLIT_IMPLEMENTATION is defined.
+   The ID of a member is found by its offset, so only the declarations are needed. */
+namespace {
+template <typename Member> struct FunctionTable;
+template <typename Function> struct FunctionTable<Function VkadInstanceFunctions::*> {
+    typedef VkadInstanceFunctions Functions;
+    static void addUse(Function VkadInstanceFunctions::* member) {
+        VkadInstanceFunctions probe;
+        VkadInstanceFunctionId id;
+        size_t offset = static_cast<size_t>(reinterpret_cast<const char*>(&(probe.*member)) - reinterpret_cast<const char*>(&probe));
+        if (vkadFindInstanceFunctionIdByOffset(offset, &id)) usedInstanceFunctions().bits[id / 32] |= UINT32_C(1) << (id % 32);
+    }
+};
+template <typename Function> struct FunctionTable<Function VkadDeviceFunctions::*> {
+    typedef VkadDeviceFunctions Functions;
+    static void addUse(Function VkadDeviceFunctions::* member) {
+        VkadDeviceFunctions probe;
+        VkadDeviceFunctionId id;
+        size_t offset = static_cast<size_t>(reinterpret_cast<const char*>(&(probe.*member)) - reinterpret_cast<const char*>(&probe));
+        if (vkadFindDeviceFunctionIdByOffset(offset, &id)) usedDeviceFunctions().bits[id / 32] |= UINT32_C(1) << (id % 32);
+    }
+};
+/* instantiated once per used member; the dynamic initializer of registered does the registration */
+template <auto Member> struct FunctionUse {
+    typedef FunctionTable<decltype(Member)> Table;
+    static bool add() {
+        Table::addUse(Member);
+        return true;
+    }
+    static const bool registered;
+};
+template <auto Member> const bool FunctionUse<Member>::registered = FunctionUse<Member>::add();
+
+/* calls the member, for example vkad::call<&VkadDeviceFunctions::CmdDispatch>(functions, commandBuffer, x, y, z) */
+template <auto Member, typename... Arguments>
+inline decltype(auto) call(const typename FunctionTable<decltype(Member)>::Functions& functions, Arguments... arguments) {
+    (void) FunctionUse<Member>::registered;
+    return (functions.*Member)(arguments...);
+}
+/* returns the member, for code that keeps the pointer */
+template <auto Member>
+inline auto get(const typename FunctionTable<decltype(Member)>::Functions& functions) {
+    (void) FunctionUse<Member>::registered;
+    return functions.*Member;
+}
+
+/* load only the used functions, all other members are NULL; the sets are only complete after static initialization, so these should not be called before main */
+inline void loadUsedInstanceFunctions(PFN_vkGetInstanceProcAddr loader, VkInstance instance, VkadInstanceFunctions* functions) {
+    VkadInstanceLoadInfo loadInfo = { 0, NULL, NULL, NULL, NULL };
+    loadInfo.pSelection = &usedInstanceFunctions();
+    vkadLoadInstanceFunctionsEx(loader, instance, &loadInfo, functions);
+}
+inline void loadUsedDeviceFunctions(PFN_vkGetDeviceProcAddr loader, VkDevice device, VkadDeviceFunctions* functions) {
+    VkadDeviceLoadInfo loadInfo = { NULL, 0, 0, NULL, NULL, NULL };
+    loadInfo.pSelection = &usedDeviceFunctions();
+    vkadLoadDeviceFunctionsEx(loader, device, &loadInfo, functions);
+}
+}
+}
+#endif
+
 #endif        /* VKAD_H */